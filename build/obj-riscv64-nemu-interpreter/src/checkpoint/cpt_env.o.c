@@ -0,0 +1,57 @@
+# 0 "src/checkpoint/cpt_env.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "src/checkpoint/cpt_env.c"
+# 16 "src/checkpoint/cpt_env.c"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 145 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+
+# 145 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long int ptrdiff_t;
+# 214 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long unsigned int size_t;
+# 329 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef int wchar_t;
+# 424 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef struct {
+  long long __max_align_ll __attribute__((__aligned__(__alignof__(long long))));
+  long double __max_align_ld __attribute__((__aligned__(__alignof__(long double))));
+# 435 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+} max_align_t;
+# 17 "src/checkpoint/cpt_env.c" 2
+
+
+# 18 "src/checkpoint/cpt_env.c"
+char *output_base_dir = 
+# 18 "src/checkpoint/cpt_env.c" 3 4
+                       ((void *)0)
+# 18 "src/checkpoint/cpt_env.c"
+                           ;
+char *config_name = 
+# 19 "src/checkpoint/cpt_env.c" 3 4
+                   ((void *)0)
+# 19 "src/checkpoint/cpt_env.c"
+                       ;
+char *workload_name = 
+# 20 "src/checkpoint/cpt_env.c" 3 4
+                     ((void *)0)
+# 20 "src/checkpoint/cpt_env.c"
+                         ;
+char *simpoints_dir = 
+# 21 "src/checkpoint/cpt_env.c" 3 4
+                     ((void *)0)
+# 21 "src/checkpoint/cpt_env.c"
+                         ;
+int cpt_id = -1;
+char *cpt_file = 
+# 23 "src/checkpoint/cpt_env.c" 3 4
+                ((void *)0)
+# 23 "src/checkpoint/cpt_env.c"
+                    ;
+char *restorer = 
+# 24 "src/checkpoint/cpt_env.c" 3 4
+                ((void *)0)
+# 24 "src/checkpoint/cpt_env.c"
+                    ;
@@ -0,0 +1,7487 @@
+# 0 "src/cpu/tcache.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "src/cpu/tcache.c"
+# 16 "src/cpu/tcache.c"
+# 1 "/root/repo/include/cpu/decode.h" 1
+# 20 "/root/repo/include/cpu/decode.h"
+# 1 "/root/repo/include/isa.h" 1
+# 21 "/root/repo/include/isa.h"
+# 1 "/root/repo/src/isa/riscv64/include/isa-def.h" 1
+# 20 "/root/repo/src/isa/riscv64/include/isa-def.h"
+# 1 "/root/repo/include/common.h" 1
+# 20 "/root/repo/include/common.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 1 3 4
+# 9 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 3 4
+# 1 "/usr/include/stdint.h" 1 3 4
+# 26 "/usr/include/stdint.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 33 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+# 1 "/usr/include/features.h" 1 3 4
+# 392 "/usr/include/features.h" 3 4
+# 1 "/usr/include/features-time64.h" 1 3 4
+# 20 "/usr/include/features-time64.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 21 "/usr/include/features-time64.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 22 "/usr/include/features-time64.h" 2 3 4
+# 393 "/usr/include/features.h" 2 3 4
+# 489 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 1 3 4
+# 561 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 562 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 563 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 490 "/usr/include/features.h" 2 3 4
+# 513 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h" 1 3 4
+# 11 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 2 3 4
+# 514 "/usr/include/features.h" 2 3 4
+# 34 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 2 3 4
+# 27 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 28 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 29 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+
+# 31 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+typedef unsigned char __u_char;
+typedef unsigned short int __u_short;
+typedef unsigned int __u_int;
+typedef unsigned long int __u_long;
+
+
+typedef signed char __int8_t;
+typedef unsigned char __uint8_t;
+typedef signed short int __int16_t;
+typedef unsigned short int __uint16_t;
+typedef signed int __int32_t;
+typedef unsigned int __uint32_t;
+
+typedef signed long int __int64_t;
+typedef unsigned long int __uint64_t;
+
+
+
+
+
+
+typedef __int8_t __int_least8_t;
+typedef __uint8_t __uint_least8_t;
+typedef __int16_t __int_least16_t;
+typedef __uint16_t __uint_least16_t;
+typedef __int32_t __int_least32_t;
+typedef __uint32_t __uint_least32_t;
+typedef __int64_t __int_least64_t;
+typedef __uint64_t __uint_least64_t;
+
+
+
+typedef long int __quad_t;
+typedef unsigned long int __u_quad_t;
+
+
+
+
+
+
+
+typedef long int __intmax_t;
+typedef unsigned long int __uintmax_t;
+# 141 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 1 3 4
+# 142 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/time64.h" 1 3 4
+# 143 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+typedef unsigned long int __dev_t;
+typedef unsigned int __uid_t;
+typedef unsigned int __gid_t;
+typedef unsigned long int __ino_t;
+typedef unsigned long int __ino64_t;
+typedef unsigned int __mode_t;
+typedef unsigned long int __nlink_t;
+typedef long int __off_t;
+typedef long int __off64_t;
+typedef int __pid_t;
+typedef struct { int __val[2]; } __fsid_t;
+typedef long int __clock_t;
+typedef unsigned long int __rlim_t;
+typedef unsigned long int __rlim64_t;
+typedef unsigned int __id_t;
+typedef long int __time_t;
+typedef unsigned int __useconds_t;
+typedef long int __suseconds_t;
+typedef long int __suseconds64_t;
+
+typedef int __daddr_t;
+typedef int __key_t;
+
+
+typedef int __clockid_t;
+
+
+typedef void * __timer_t;
+
+
+typedef long int __blksize_t;
+
+
+
+
+typedef long int __blkcnt_t;
+typedef long int __blkcnt64_t;
+
+
+typedef unsigned long int __fsblkcnt_t;
+typedef unsigned long int __fsblkcnt64_t;
+
+
+typedef unsigned long int __fsfilcnt_t;
+typedef unsigned long int __fsfilcnt64_t;
+
+
+typedef long int __fsword_t;
+
+typedef long int __ssize_t;
+
+
+typedef long int __syscall_slong_t;
+
+typedef unsigned long int __syscall_ulong_t;
+
+
+
+typedef __off64_t __loff_t;
+typedef char *__caddr_t;
+
+
+typedef long int __intptr_t;
+
+
+typedef unsigned int __socklen_t;
+
+
+
+
+typedef int __sig_atomic_t;
+# 28 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wchar.h" 1 3 4
+# 29 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 30 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 3 4
+typedef __int8_t int8_t;
+typedef __int16_t int16_t;
+typedef __int32_t int32_t;
+typedef __int64_t int64_t;
+# 35 "/usr/include/stdint.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 3 4
+typedef __uint8_t uint8_t;
+typedef __uint16_t uint16_t;
+typedef __uint32_t uint32_t;
+typedef __uint64_t uint64_t;
+# 38 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+
+typedef __int_least8_t int_least8_t;
+typedef __int_least16_t int_least16_t;
+typedef __int_least32_t int_least32_t;
+typedef __int_least64_t int_least64_t;
+
+
+typedef __uint_least8_t uint_least8_t;
+typedef __uint_least16_t uint_least16_t;
+typedef __uint_least32_t uint_least32_t;
+typedef __uint_least64_t uint_least64_t;
+
+
+
+
+
+typedef signed char int_fast8_t;
+
+typedef long int int_fast16_t;
+typedef long int int_fast32_t;
+typedef long int int_fast64_t;
+# 71 "/usr/include/stdint.h" 3 4
+typedef unsigned char uint_fast8_t;
+
+typedef unsigned long int uint_fast16_t;
+typedef unsigned long int uint_fast32_t;
+typedef unsigned long int uint_fast64_t;
+# 87 "/usr/include/stdint.h" 3 4
+typedef long int intptr_t;
+
+
+typedef unsigned long int uintptr_t;
+# 101 "/usr/include/stdint.h" 3 4
+typedef __intmax_t intmax_t;
+typedef __uintmax_t uintmax_t;
+# 10 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 2 3 4
+# 21 "/root/repo/include/common.h" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h" 1 3 4
+# 22 "/root/repo/include/common.h" 2
+# 1 "/usr/include/assert.h" 1 3 4
+# 66 "/usr/include/assert.h" 3 4
+
+
+
+extern void __assert_fail (const char *__assertion, const char *__file,
+      unsigned int __line, const char *__function)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+extern void __assert_perror_fail (int __errnum, const char *__file,
+      unsigned int __line, const char *__function)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+
+extern void __assert (const char *__assertion, const char *__file, int __line)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+# 23 "/root/repo/include/common.h" 2
+# 1 "/usr/include/string.h" 1 3 4
+# 26 "/usr/include/string.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 27 "/usr/include/string.h" 2 3 4
+
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 214 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long unsigned int size_t;
+# 34 "/usr/include/string.h" 2 3 4
+# 43 "/usr/include/string.h" 3 4
+extern void *memcpy (void *__restrict __dest, const void *__restrict __src,
+       size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void *memmove (void *__dest, const void *__src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+extern void *memccpy (void *__restrict __dest, const void *__restrict __src,
+        int __c, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2))) __attribute__ ((__access__ (__write_only__, 1, 4)));
+
+
+
+
+extern void *memset (void *__s, int __c, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int memcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 80 "/usr/include/string.h" 3 4
+extern int __memcmpeq (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 107 "/usr/include/string.h" 3 4
+extern void *memchr (const void *__s, int __c, size_t __n)
+      __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 141 "/usr/include/string.h" 3 4
+extern char *strcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern char *strcat (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncat (char *__restrict __dest, const char *__restrict __src,
+        size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int strncmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcoll (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern size_t strxfrm (char *__restrict __dest,
+         const char *__restrict __src, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 3 4
+struct __locale_struct
+{
+
+  struct __locale_data *__locales[13];
+
+
+  const unsigned short int *__ctype_b;
+  const int *__ctype_tolower;
+  const int *__ctype_toupper;
+
+
+  const char *__names[13];
+};
+
+typedef struct __locale_struct *__locale_t;
+# 23 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 2 3 4
+
+typedef __locale_t locale_t;
+# 173 "/usr/include/string.h" 2 3 4
+
+
+extern int strcoll_l (const char *__s1, const char *__s2, locale_t __l)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+extern size_t strxfrm_l (char *__dest, const char *__src, size_t __n,
+    locale_t __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4)))
+     __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+
+
+extern char *strdup (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern char *strndup (const char *__string, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+# 246 "/usr/include/string.h" 3 4
+extern char *strchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 273 "/usr/include/string.h" 3 4
+extern char *strrchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 293 "/usr/include/string.h" 3 4
+extern size_t strcspn (const char *__s, const char *__reject)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern size_t strspn (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 323 "/usr/include/string.h" 3 4
+extern char *strpbrk (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 350 "/usr/include/string.h" 3 4
+extern char *strstr (const char *__haystack, const char *__needle)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strtok (char *__restrict __s, const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern char *__strtok_r (char *__restrict __s,
+    const char *__restrict __delim,
+    char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+
+extern char *strtok_r (char *__restrict __s, const char *__restrict __delim,
+         char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+# 407 "/usr/include/string.h" 3 4
+extern size_t strlen (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern size_t strnlen (const char *__string, size_t __maxlen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern char *strerror (int __errnum) __attribute__ ((__nothrow__ , __leaf__));
+# 432 "/usr/include/string.h" 3 4
+extern int strerror_r (int __errnum, char *__buf, size_t __buflen) __asm__ ("" "__xpg_strerror_r") __attribute__ ((__nothrow__ , __leaf__))
+
+                        __attribute__ ((__nonnull__ (2)))
+    __attribute__ ((__access__ (__write_only__, 2, 3)));
+# 458 "/usr/include/string.h" 3 4
+extern char *strerror_l (int __errnum, locale_t __l) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+# 1 "/usr/include/strings.h" 1 3 4
+# 23 "/usr/include/strings.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 24 "/usr/include/strings.h" 2 3 4
+
+
+
+
+
+
+
+
+
+
+extern int bcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bcopy (const void *__src, void *__dest, size_t __n)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 68 "/usr/include/strings.h" 3 4
+extern char *index (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 96 "/usr/include/strings.h" 3 4
+extern char *rindex (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int ffs (int __i) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+
+extern int ffsl (long int __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+__extension__ extern int ffsll (long long int __ll)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern int strcasecmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strncasecmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+
+extern int strcasecmp_l (const char *__s1, const char *__s2, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+
+extern int strncasecmp_l (const char *__s1, const char *__s2,
+     size_t __n, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 4)));
+
+
+
+# 463 "/usr/include/string.h" 2 3 4
+
+
+
+extern void explicit_bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)))
+    __attribute__ ((__access__ (__write_only__, 1, 2)));
+
+
+
+extern char *strsep (char **__restrict __stringp,
+       const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strsignal (int __sig) __attribute__ ((__nothrow__ , __leaf__));
+# 489 "/usr/include/string.h" 3 4
+extern char *__stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern char *__stpncpy (char *__restrict __dest,
+   const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+# 539 "/usr/include/string.h" 3 4
+
+# 24 "/root/repo/include/common.h" 2
+
+# 1 "/root/repo/include/generated/autoconf.h" 1
+# 26 "/root/repo/include/common.h" 2
+# 1 "/root/repo/include/macro.h" 1
+# 27 "/root/repo/include/common.h" 2
+
+
+
+
+
+
+# 32 "/root/repo/include/common.h"
+typedef uint64_t word_t;
+typedef int64_t sword_t;
+
+
+typedef word_t rtlreg_t;
+typedef word_t vaddr_t;
+typedef uint64_t paddr_t;
+
+typedef uint16_t ioaddr_t;
+
+
+
+
+
+
+
+struct DynamicConfig {
+  
+# 49 "/root/repo/include/common.h" 3 4
+ _Bool 
+# 49 "/root/repo/include/common.h"
+      ignore_illegal_mem_access;
+  
+# 50 "/root/repo/include/common.h" 3 4
+ _Bool 
+# 50 "/root/repo/include/common.h"
+      debug_difftest;
+};
+extern struct DynamicConfig dynamic_config;
+void update_dynamic_config(void* config);
+
+# 1 "/root/repo/include/debug.h" 1
+# 20 "/root/repo/include/debug.h"
+# 1 "/usr/include/stdio.h" 1 3 4
+# 27 "/usr/include/stdio.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 28 "/usr/include/stdio.h" 2 3 4
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 34 "/usr/include/stdio.h" 2 3 4
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 1 3 4
+# 40 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+
+# 40 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+typedef __builtin_va_list __gnuc_va_list;
+# 37 "/usr/include/stdio.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h" 1 3 4
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h" 1 3 4
+# 13 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h" 3 4
+typedef struct
+{
+  int __count;
+  union
+  {
+    unsigned int __wch;
+    char __wchb[4];
+  } __value;
+} __mbstate_t;
+# 6 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h" 2 3 4
+
+
+
+
+typedef struct _G_fpos_t
+{
+  __off_t __pos;
+  __mbstate_t __state;
+} __fpos_t;
+# 40 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__fpos64_t.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/bits/types/__fpos64_t.h" 3 4
+typedef struct _G_fpos64_t
+{
+  __off64_t __pos;
+  __mbstate_t __state;
+} __fpos64_t;
+# 41 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__FILE.h" 1 3 4
+
+
+
+struct _IO_FILE;
+typedef struct _IO_FILE __FILE;
+# 42 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h" 1 3 4
+
+
+
+struct _IO_FILE;
+
+
+typedef struct _IO_FILE FILE;
+# 43 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h" 1 3 4
+# 35 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h" 3 4
+struct _IO_FILE;
+struct _IO_marker;
+struct _IO_codecvt;
+struct _IO_wide_data;
+
+
+
+
+typedef void _IO_lock_t;
+
+
+
+
+
+struct _IO_FILE
+{
+  int _flags;
+
+
+  char *_IO_read_ptr;
+  char *_IO_read_end;
+  char *_IO_read_base;
+  char *_IO_write_base;
+  char *_IO_write_ptr;
+  char *_IO_write_end;
+  char *_IO_buf_base;
+  char *_IO_buf_end;
+
+
+  char *_IO_save_base;
+  char *_IO_backup_base;
+  char *_IO_save_end;
+
+  struct _IO_marker *_markers;
+
+  struct _IO_FILE *_chain;
+
+  int _fileno;
+  int _flags2;
+  __off_t _old_offset;
+
+
+  unsigned short _cur_column;
+  signed char _vtable_offset;
+  char _shortbuf[1];
+
+  _IO_lock_t *_lock;
+
+
+
+
+
+
+
+  __off64_t _offset;
+
+  struct _IO_codecvt *_codecvt;
+  struct _IO_wide_data *_wide_data;
+  struct _IO_FILE *_freeres_list;
+  void *_freeres_buf;
+  size_t __pad5;
+  int _mode;
+
+  char _unused2[15 * sizeof (int) - 4 * sizeof (void *) - sizeof (size_t)];
+};
+# 44 "/usr/include/stdio.h" 2 3 4
+# 52 "/usr/include/stdio.h" 3 4
+typedef __gnuc_va_list va_list;
+# 63 "/usr/include/stdio.h" 3 4
+typedef __off_t off_t;
+# 77 "/usr/include/stdio.h" 3 4
+typedef __ssize_t ssize_t;
+
+
+
+
+
+
+typedef __fpos_t fpos_t;
+# 133 "/usr/include/stdio.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdio_lim.h" 1 3 4
+# 134 "/usr/include/stdio.h" 2 3 4
+# 143 "/usr/include/stdio.h" 3 4
+extern FILE *stdin;
+extern FILE *stdout;
+extern FILE *stderr;
+
+
+
+
+
+
+extern int remove (const char *__filename) __attribute__ ((__nothrow__ , __leaf__));
+
+extern int rename (const char *__old, const char *__new) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int renameat (int __oldfd, const char *__old, int __newfd,
+       const char *__new) __attribute__ ((__nothrow__ , __leaf__));
+# 178 "/usr/include/stdio.h" 3 4
+extern int fclose (FILE *__stream);
+# 188 "/usr/include/stdio.h" 3 4
+extern FILE *tmpfile (void)
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+# 205 "/usr/include/stdio.h" 3 4
+extern char *tmpnam (char[20]) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern char *tmpnam_r (char __s[20]) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 222 "/usr/include/stdio.h" 3 4
+extern char *tempnam (const char *__dir, const char *__pfx)
+   __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (__builtin_free, 1)));
+
+
+
+
+
+
+extern int fflush (FILE *__stream);
+# 239 "/usr/include/stdio.h" 3 4
+extern int fflush_unlocked (FILE *__stream);
+# 258 "/usr/include/stdio.h" 3 4
+extern FILE *fopen (const char *__restrict __filename,
+      const char *__restrict __modes)
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+
+
+
+
+extern FILE *freopen (const char *__restrict __filename,
+        const char *__restrict __modes,
+        FILE *__restrict __stream) ;
+# 293 "/usr/include/stdio.h" 3 4
+extern FILE *fdopen (int __fd, const char *__modes) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+# 308 "/usr/include/stdio.h" 3 4
+extern FILE *fmemopen (void *__s, size_t __len, const char *__modes)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+
+
+
+
+extern FILE *open_memstream (char **__bufloc, size_t *__sizeloc) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+# 328 "/usr/include/stdio.h" 3 4
+extern void setbuf (FILE *__restrict __stream, char *__restrict __buf) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int setvbuf (FILE *__restrict __stream, char *__restrict __buf,
+      int __modes, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern void setbuffer (FILE *__restrict __stream, char *__restrict __buf,
+         size_t __size) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern void setlinebuf (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern int fprintf (FILE *__restrict __stream,
+      const char *__restrict __format, ...);
+
+
+
+
+extern int printf (const char *__restrict __format, ...);
+
+extern int sprintf (char *__restrict __s,
+      const char *__restrict __format, ...) __attribute__ ((__nothrow__));
+
+
+
+
+
+extern int vfprintf (FILE *__restrict __s, const char *__restrict __format,
+       __gnuc_va_list __arg);
+
+
+
+
+extern int vprintf (const char *__restrict __format, __gnuc_va_list __arg);
+
+extern int vsprintf (char *__restrict __s, const char *__restrict __format,
+       __gnuc_va_list __arg) __attribute__ ((__nothrow__));
+
+
+
+extern int snprintf (char *__restrict __s, size_t __maxlen,
+       const char *__restrict __format, ...)
+     __attribute__ ((__nothrow__)) __attribute__ ((__format__ (__printf__, 3, 4)));
+
+extern int vsnprintf (char *__restrict __s, size_t __maxlen,
+        const char *__restrict __format, __gnuc_va_list __arg)
+     __attribute__ ((__nothrow__)) __attribute__ ((__format__ (__printf__, 3, 0)));
+# 403 "/usr/include/stdio.h" 3 4
+extern int vdprintf (int __fd, const char *__restrict __fmt,
+       __gnuc_va_list __arg)
+     __attribute__ ((__format__ (__printf__, 2, 0)));
+extern int dprintf (int __fd, const char *__restrict __fmt, ...)
+     __attribute__ ((__format__ (__printf__, 2, 3)));
+
+
+
+
+
+
+
+extern int fscanf (FILE *__restrict __stream,
+     const char *__restrict __format, ...) ;
+
+
+
+
+extern int scanf (const char *__restrict __format, ...) ;
+
+extern int sscanf (const char *__restrict __s,
+     const char *__restrict __format, ...) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 1 3 4
+# 120 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 2 3 4
+# 121 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 2 3 4
+# 431 "/usr/include/stdio.h" 2 3 4
+
+
+
+extern int fscanf (FILE *__restrict __stream, const char *__restrict __format, ...) __asm__ ("" "__isoc99_fscanf")
+
+                               ;
+extern int scanf (const char *__restrict __format, ...) __asm__ ("" "__isoc99_scanf")
+                              ;
+extern int sscanf (const char *__restrict __s, const char *__restrict __format, ...) __asm__ ("" "__isoc99_sscanf") __attribute__ ((__nothrow__ , __leaf__))
+
+                      ;
+# 459 "/usr/include/stdio.h" 3 4
+extern int vfscanf (FILE *__restrict __s, const char *__restrict __format,
+      __gnuc_va_list __arg)
+     __attribute__ ((__format__ (__scanf__, 2, 0))) ;
+
+
+
+
+
+extern int vscanf (const char *__restrict __format, __gnuc_va_list __arg)
+     __attribute__ ((__format__ (__scanf__, 1, 0))) ;
+
+
+extern int vsscanf (const char *__restrict __s,
+      const char *__restrict __format, __gnuc_va_list __arg)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__format__ (__scanf__, 2, 0)));
+
+
+
+
+
+extern int vfscanf (FILE *__restrict __s, const char *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vfscanf")
+
+
+
+     __attribute__ ((__format__ (__scanf__, 2, 0))) ;
+extern int vscanf (const char *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vscanf")
+
+     __attribute__ ((__format__ (__scanf__, 1, 0))) ;
+extern int vsscanf (const char *__restrict __s, const char *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vsscanf") __attribute__ ((__nothrow__ , __leaf__))
+
+
+
+     __attribute__ ((__format__ (__scanf__, 2, 0)));
+# 513 "/usr/include/stdio.h" 3 4
+extern int fgetc (FILE *__stream);
+extern int getc (FILE *__stream);
+
+
+
+
+
+extern int getchar (void);
+
+
+
+
+
+
+extern int getc_unlocked (FILE *__stream);
+extern int getchar_unlocked (void);
+# 538 "/usr/include/stdio.h" 3 4
+extern int fgetc_unlocked (FILE *__stream);
+# 549 "/usr/include/stdio.h" 3 4
+extern int fputc (int __c, FILE *__stream);
+extern int putc (int __c, FILE *__stream);
+
+
+
+
+
+extern int putchar (int __c);
+# 565 "/usr/include/stdio.h" 3 4
+extern int fputc_unlocked (int __c, FILE *__stream);
+
+
+
+
+
+
+
+extern int putc_unlocked (int __c, FILE *__stream);
+extern int putchar_unlocked (int __c);
+
+
+
+
+
+
+extern int getw (FILE *__stream);
+
+
+extern int putw (int __w, FILE *__stream);
+
+
+
+
+
+
+
+extern char *fgets (char *__restrict __s, int __n, FILE *__restrict __stream)
+     __attribute__ ((__access__ (__write_only__, 1, 2)));
+# 632 "/usr/include/stdio.h" 3 4
+extern __ssize_t __getdelim (char **__restrict __lineptr,
+                             size_t *__restrict __n, int __delimiter,
+                             FILE *__restrict __stream) ;
+extern __ssize_t getdelim (char **__restrict __lineptr,
+                           size_t *__restrict __n, int __delimiter,
+                           FILE *__restrict __stream) ;
+
+
+
+
+
+
+
+extern __ssize_t getline (char **__restrict __lineptr,
+                          size_t *__restrict __n,
+                          FILE *__restrict __stream) ;
+
+
+
+
+
+
+
+extern int fputs (const char *__restrict __s, FILE *__restrict __stream);
+
+
+
+
+
+extern int puts (const char *__s);
+
+
+
+
+
+
+extern int ungetc (int __c, FILE *__stream);
+
+
+
+
+
+
+extern size_t fread (void *__restrict __ptr, size_t __size,
+       size_t __n, FILE *__restrict __stream) ;
+
+
+
+
+extern size_t fwrite (const void *__restrict __ptr, size_t __size,
+        size_t __n, FILE *__restrict __s);
+# 702 "/usr/include/stdio.h" 3 4
+extern size_t fread_unlocked (void *__restrict __ptr, size_t __size,
+         size_t __n, FILE *__restrict __stream) ;
+extern size_t fwrite_unlocked (const void *__restrict __ptr, size_t __size,
+          size_t __n, FILE *__restrict __stream);
+
+
+
+
+
+
+
+extern int fseek (FILE *__stream, long int __off, int __whence);
+
+
+
+
+extern long int ftell (FILE *__stream) ;
+
+
+
+
+extern void rewind (FILE *__stream);
+# 736 "/usr/include/stdio.h" 3 4
+extern int fseeko (FILE *__stream, __off_t __off, int __whence);
+
+
+
+
+extern __off_t ftello (FILE *__stream) ;
+# 760 "/usr/include/stdio.h" 3 4
+extern int fgetpos (FILE *__restrict __stream, fpos_t *__restrict __pos);
+
+
+
+
+extern int fsetpos (FILE *__stream, const fpos_t *__pos);
+# 786 "/usr/include/stdio.h" 3 4
+extern void clearerr (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+
+extern int feof (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+extern int ferror (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+extern void clearerr_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+extern int feof_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+extern int ferror_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+
+
+extern void perror (const char *__s);
+
+
+
+
+extern int fileno (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern int fileno_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 823 "/usr/include/stdio.h" 3 4
+extern int pclose (FILE *__stream);
+
+
+
+
+
+extern FILE *popen (const char *__command, const char *__modes)
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (pclose, 1))) ;
+
+
+
+
+
+
+extern char *ctermid (char *__s) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__access__ (__write_only__, 1)));
+# 867 "/usr/include/stdio.h" 3 4
+extern void flockfile (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int ftrylockfile (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern void funlockfile (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+# 885 "/usr/include/stdio.h" 3 4
+extern int __uflow (FILE *);
+extern int __overflow (FILE *, int);
+# 902 "/usr/include/stdio.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdio.h" 1 3 4
+# 38 "/usr/include/x86_64-linux-gnu/bits/stdio.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) int
+vprintf (const char *__restrict __fmt, __gnuc_va_list __arg)
+{
+  return vfprintf (stdout, __fmt, __arg);
+}
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+getchar (void)
+{
+  return getc (stdin);
+}
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+fgetc_unlocked (FILE *__fp)
+{
+  return (__builtin_expect (((__fp)->_IO_read_ptr >= (__fp)->_IO_read_end), 0) ? __uflow (__fp) : *(unsigned char *) (__fp)->_IO_read_ptr++);
+}
+
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+getc_unlocked (FILE *__fp)
+{
+  return (__builtin_expect (((__fp)->_IO_read_ptr >= (__fp)->_IO_read_end), 0) ? __uflow (__fp) : *(unsigned char *) (__fp)->_IO_read_ptr++);
+}
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+getchar_unlocked (void)
+{
+  return (__builtin_expect (((stdin)->_IO_read_ptr >= (stdin)->_IO_read_end), 0) ? __uflow (stdin) : *(unsigned char *) (stdin)->_IO_read_ptr++);
+}
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+putchar (int __c)
+{
+  return putc (__c, stdout);
+}
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+fputc_unlocked (int __c, FILE *__stream)
+{
+  return (__builtin_expect (((__stream)->_IO_write_ptr >= (__stream)->_IO_write_end), 0) ? __overflow (__stream, (unsigned char) (__c)) : (unsigned char) (*(__stream)->_IO_write_ptr++ = (__c)));
+}
+
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+putc_unlocked (int __c, FILE *__stream)
+{
+  return (__builtin_expect (((__stream)->_IO_write_ptr >= (__stream)->_IO_write_end), 0) ? __overflow (__stream, (unsigned char) (__c)) : (unsigned char) (*(__stream)->_IO_write_ptr++ = (__c)));
+}
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+putchar_unlocked (int __c)
+{
+  return (__builtin_expect (((stdout)->_IO_write_ptr >= (stdout)->_IO_write_end), 0) ? __overflow (stdout, (unsigned char) (__c)) : (unsigned char) (*(stdout)->_IO_write_ptr++ = (__c)));
+}
+# 127 "/usr/include/x86_64-linux-gnu/bits/stdio.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) int
+__attribute__ ((__nothrow__ , __leaf__)) feof_unlocked (FILE *__stream)
+{
+  return (((__stream)->_flags & 0x0010) != 0);
+}
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+__attribute__ ((__nothrow__ , __leaf__)) ferror_unlocked (FILE *__stream)
+{
+  return (((__stream)->_flags & 0x0020) != 0);
+}
+# 903 "/usr/include/stdio.h" 2 3 4
+
+
+
+
+
+
+
+# 21 "/root/repo/include/debug.h" 2
+# 1 "/usr/include/assert.h" 1 3 4
+# 22 "/root/repo/include/debug.h" 2
+# 1 "/root/repo/include/utils.h" 1
+# 20 "/root/repo/include/utils.h"
+# 1 "/root/repo/include/common.h" 1
+# 21 "/root/repo/include/utils.h" 2
+
+
+
+
+# 24 "/root/repo/include/utils.h"
+enum { NEMU_RUNNING, NEMU_STOP, NEMU_END, NEMU_ABORT, NEMU_QUIT };
+
+typedef struct {
+  int state;
+  vaddr_t halt_pc;
+  uint32_t halt_ret;
+} NEMUState;
+
+extern NEMUState nemu_state;
+
+enum {
+  dflag_none = 0,
+  dflag_mem,
+  dflag_translate,
+  dflag_trace_bb,
+  dflag_trace_inst,
+  dflag_trace_inst_dasm,
+  dflag_exit,
+};
+
+
+
+
+uint64_t get_time();
+# 68 "/root/repo/include/utils.h"
+extern char log_bytebuf[80];
+extern char log_asmbuf[80];
+
+
+
+word_t expr(char *e, 
+# 73 "/root/repo/include/utils.h" 3 4
+                    _Bool 
+# 73 "/root/repo/include/utils.h"
+                         *success);
+
+
+void iqueue_commit(vaddr_t pc, uint8_t *instr_buf, uint8_t ilen);
+void iqueue_dump();
+
+
+
+
+
+# 82 "/root/repo/include/utils.h" 3 4
+_Bool 
+# 82 "/root/repo/include/utils.h"
+    is_gz_file(const char *filename);
+# 23 "/root/repo/include/debug.h" 2
+# 1 "/usr/include/unistd.h" 1 3 4
+# 27 "/usr/include/unistd.h" 3 4
+
+# 202 "/usr/include/unistd.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/posix_opt.h" 1 3 4
+# 203 "/usr/include/unistd.h" 2 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/environments.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/environments.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/environments.h" 2 3 4
+# 207 "/usr/include/unistd.h" 2 3 4
+# 226 "/usr/include/unistd.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 227 "/usr/include/unistd.h" 2 3 4
+
+
+
+
+
+
+# 232 "/usr/include/unistd.h" 3 4
+typedef __gid_t gid_t;
+
+
+
+
+typedef __uid_t uid_t;
+# 255 "/usr/include/unistd.h" 3 4
+typedef __useconds_t useconds_t;
+
+
+
+
+typedef __pid_t pid_t;
+# 274 "/usr/include/unistd.h" 3 4
+typedef __socklen_t socklen_t;
+# 287 "/usr/include/unistd.h" 3 4
+extern int access (const char *__name, int __type) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 309 "/usr/include/unistd.h" 3 4
+extern int faccessat (int __fd, const char *__file, int __type, int __flag)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) ;
+# 339 "/usr/include/unistd.h" 3 4
+extern __off_t lseek (int __fd, __off_t __offset, int __whence) __attribute__ ((__nothrow__ , __leaf__));
+# 358 "/usr/include/unistd.h" 3 4
+extern int close (int __fd);
+
+
+
+
+extern void closefrom (int __lowfd) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern ssize_t read (int __fd, void *__buf, size_t __nbytes)
+    __attribute__ ((__access__ (__write_only__, 2, 3)));
+
+
+
+
+
+extern ssize_t write (int __fd, const void *__buf, size_t __n)
+    __attribute__ ((__access__ (__read_only__, 2, 3)));
+# 389 "/usr/include/unistd.h" 3 4
+extern ssize_t pread (int __fd, void *__buf, size_t __nbytes,
+        __off_t __offset)
+    __attribute__ ((__access__ (__write_only__, 2, 3)));
+
+
+
+
+
+
+extern ssize_t pwrite (int __fd, const void *__buf, size_t __n,
+         __off_t __offset)
+    __attribute__ ((__access__ (__read_only__, 2, 3)));
+# 437 "/usr/include/unistd.h" 3 4
+extern int pipe (int __pipedes[2]) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 452 "/usr/include/unistd.h" 3 4
+extern unsigned int alarm (unsigned int __seconds) __attribute__ ((__nothrow__ , __leaf__));
+# 464 "/usr/include/unistd.h" 3 4
+extern unsigned int sleep (unsigned int __seconds);
+
+
+
+
+
+
+
+extern __useconds_t ualarm (__useconds_t __value, __useconds_t __interval)
+     __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern int usleep (__useconds_t __useconds);
+# 489 "/usr/include/unistd.h" 3 4
+extern int pause (void);
+
+
+
+extern int chown (const char *__file, __uid_t __owner, __gid_t __group)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+extern int fchown (int __fd, __uid_t __owner, __gid_t __group) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern int lchown (const char *__file, __uid_t __owner, __gid_t __group)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+
+
+extern int fchownat (int __fd, const char *__file, __uid_t __owner,
+       __gid_t __group, int __flag)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) ;
+
+
+
+extern int chdir (const char *__path) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+extern int fchdir (int __fd) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 531 "/usr/include/unistd.h" 3 4
+extern char *getcwd (char *__buf, size_t __size) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 545 "/usr/include/unistd.h" 3 4
+extern char *getwd (char *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) __attribute__ ((__deprecated__))
+    __attribute__ ((__access__ (__write_only__, 1)));
+
+
+
+
+extern int dup (int __fd) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern int dup2 (int __fd, int __fd2) __attribute__ ((__nothrow__ , __leaf__));
+# 564 "/usr/include/unistd.h" 3 4
+extern char **__environ;
+
+
+
+
+
+
+
+extern int execve (const char *__path, char *const __argv[],
+     char *const __envp[]) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern int fexecve (int __fd, char *const __argv[], char *const __envp[])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+
+extern int execv (const char *__path, char *const __argv[])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern int execle (const char *__path, const char *__arg, ...)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern int execl (const char *__path, const char *__arg, ...)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern int execvp (const char *__file, char *const __argv[])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern int execlp (const char *__file, const char *__arg, ...)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+# 619 "/usr/include/unistd.h" 3 4
+extern int nice (int __inc) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern void _exit (int __status) __attribute__ ((__noreturn__));
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/confname.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/confname.h" 3 4
+enum
+  {
+    _PC_LINK_MAX,
+
+    _PC_MAX_CANON,
+
+    _PC_MAX_INPUT,
+
+    _PC_NAME_MAX,
+
+    _PC_PATH_MAX,
+
+    _PC_PIPE_BUF,
+
+    _PC_CHOWN_RESTRICTED,
+
+    _PC_NO_TRUNC,
+
+    _PC_VDISABLE,
+
+    _PC_SYNC_IO,
+
+    _PC_ASYNC_IO,
+
+    _PC_PRIO_IO,
+
+    _PC_SOCK_MAXBUF,
+
+    _PC_FILESIZEBITS,
+
+    _PC_REC_INCR_XFER_SIZE,
+
+    _PC_REC_MAX_XFER_SIZE,
+
+    _PC_REC_MIN_XFER_SIZE,
+
+    _PC_REC_XFER_ALIGN,
+
+    _PC_ALLOC_SIZE_MIN,
+
+    _PC_SYMLINK_MAX,
+
+    _PC_2_SYMLINKS
+
+  };
+
+
+enum
+  {
+    _SC_ARG_MAX,
+
+    _SC_CHILD_MAX,
+
+    _SC_CLK_TCK,
+
+    _SC_NGROUPS_MAX,
+
+    _SC_OPEN_MAX,
+
+    _SC_STREAM_MAX,
+
+    _SC_TZNAME_MAX,
+
+    _SC_JOB_CONTROL,
+
+    _SC_SAVED_IDS,
+
+    _SC_REALTIME_SIGNALS,
+
+    _SC_PRIORITY_SCHEDULING,
+
+    _SC_TIMERS,
+
+    _SC_ASYNCHRONOUS_IO,
+
+    _SC_PRIORITIZED_IO,
+
+    _SC_SYNCHRONIZED_IO,
+
+    _SC_FSYNC,
+
+    _SC_MAPPED_FILES,
+
+    _SC_MEMLOCK,
+
+    _SC_MEMLOCK_RANGE,
+
+    _SC_MEMORY_PROTECTION,
+
+    _SC_MESSAGE_PASSING,
+
+    _SC_SEMAPHORES,
+
+    _SC_SHARED_MEMORY_OBJECTS,
+
+    _SC_AIO_LISTIO_MAX,
+
+    _SC_AIO_MAX,
+
+    _SC_AIO_PRIO_DELTA_MAX,
+
+    _SC_DELAYTIMER_MAX,
+
+    _SC_MQ_OPEN_MAX,
+
+    _SC_MQ_PRIO_MAX,
+
+    _SC_VERSION,
+
+    _SC_PAGESIZE,
+
+
+    _SC_RTSIG_MAX,
+
+    _SC_SEM_NSEMS_MAX,
+
+    _SC_SEM_VALUE_MAX,
+
+    _SC_SIGQUEUE_MAX,
+
+    _SC_TIMER_MAX,
+
+
+
+
+    _SC_BC_BASE_MAX,
+
+    _SC_BC_DIM_MAX,
+
+    _SC_BC_SCALE_MAX,
+
+    _SC_BC_STRING_MAX,
+
+    _SC_COLL_WEIGHTS_MAX,
+
+    _SC_EQUIV_CLASS_MAX,
+
+    _SC_EXPR_NEST_MAX,
+
+    _SC_LINE_MAX,
+
+    _SC_RE_DUP_MAX,
+
+    _SC_CHARCLASS_NAME_MAX,
+
+
+    _SC_2_VERSION,
+
+    _SC_2_C_BIND,
+
+    _SC_2_C_DEV,
+
+    _SC_2_FORT_DEV,
+
+    _SC_2_FORT_RUN,
+
+    _SC_2_SW_DEV,
+
+    _SC_2_LOCALEDEF,
+
+
+    _SC_PII,
+
+    _SC_PII_XTI,
+
+    _SC_PII_SOCKET,
+
+    _SC_PII_INTERNET,
+
+    _SC_PII_OSI,
+
+    _SC_POLL,
+
+    _SC_SELECT,
+
+    _SC_UIO_MAXIOV,
+
+    _SC_IOV_MAX = _SC_UIO_MAXIOV,
+
+    _SC_PII_INTERNET_STREAM,
+
+    _SC_PII_INTERNET_DGRAM,
+
+    _SC_PII_OSI_COTS,
+
+    _SC_PII_OSI_CLTS,
+
+    _SC_PII_OSI_M,
+
+    _SC_T_IOV_MAX,
+
+
+
+    _SC_THREADS,
+
+    _SC_THREAD_SAFE_FUNCTIONS,
+
+    _SC_GETGR_R_SIZE_MAX,
+
+    _SC_GETPW_R_SIZE_MAX,
+
+    _SC_LOGIN_NAME_MAX,
+
+    _SC_TTY_NAME_MAX,
+
+    _SC_THREAD_DESTRUCTOR_ITERATIONS,
+
+    _SC_THREAD_KEYS_MAX,
+
+    _SC_THREAD_STACK_MIN,
+
+    _SC_THREAD_THREADS_MAX,
+
+    _SC_THREAD_ATTR_STACKADDR,
+
+    _SC_THREAD_ATTR_STACKSIZE,
+
+    _SC_THREAD_PRIORITY_SCHEDULING,
+
+    _SC_THREAD_PRIO_INHERIT,
+
+    _SC_THREAD_PRIO_PROTECT,
+
+    _SC_THREAD_PROCESS_SHARED,
+
+
+    _SC_NPROCESSORS_CONF,
+
+    _SC_NPROCESSORS_ONLN,
+
+    _SC_PHYS_PAGES,
+
+    _SC_AVPHYS_PAGES,
+
+    _SC_ATEXIT_MAX,
+
+    _SC_PASS_MAX,
+
+
+    _SC_XOPEN_VERSION,
+
+    _SC_XOPEN_XCU_VERSION,
+
+    _SC_XOPEN_UNIX,
+
+    _SC_XOPEN_CRYPT,
+
+    _SC_XOPEN_ENH_I18N,
+
+    _SC_XOPEN_SHM,
+
+
+    _SC_2_CHAR_TERM,
+
+    _SC_2_C_VERSION,
+
+    _SC_2_UPE,
+
+
+    _SC_XOPEN_XPG2,
+
+    _SC_XOPEN_XPG3,
+
+    _SC_XOPEN_XPG4,
+
+
+    _SC_CHAR_BIT,
+
+    _SC_CHAR_MAX,
+
+    _SC_CHAR_MIN,
+
+    _SC_INT_MAX,
+
+    _SC_INT_MIN,
+
+    _SC_LONG_BIT,
+
+    _SC_WORD_BIT,
+
+    _SC_MB_LEN_MAX,
+
+    _SC_NZERO,
+
+    _SC_SSIZE_MAX,
+
+    _SC_SCHAR_MAX,
+
+    _SC_SCHAR_MIN,
+
+    _SC_SHRT_MAX,
+
+    _SC_SHRT_MIN,
+
+    _SC_UCHAR_MAX,
+
+    _SC_UINT_MAX,
+
+    _SC_ULONG_MAX,
+
+    _SC_USHRT_MAX,
+
+
+    _SC_NL_ARGMAX,
+
+    _SC_NL_LANGMAX,
+
+    _SC_NL_MSGMAX,
+
+    _SC_NL_NMAX,
+
+    _SC_NL_SETMAX,
+
+    _SC_NL_TEXTMAX,
+
+
+    _SC_XBS5_ILP32_OFF32,
+
+    _SC_XBS5_ILP32_OFFBIG,
+
+    _SC_XBS5_LP64_OFF64,
+
+    _SC_XBS5_LPBIG_OFFBIG,
+
+
+    _SC_XOPEN_LEGACY,
+
+    _SC_XOPEN_REALTIME,
+
+    _SC_XOPEN_REALTIME_THREADS,
+
+
+    _SC_ADVISORY_INFO,
+
+    _SC_BARRIERS,
+
+    _SC_BASE,
+
+    _SC_C_LANG_SUPPORT,
+
+    _SC_C_LANG_SUPPORT_R,
+
+    _SC_CLOCK_SELECTION,
+
+    _SC_CPUTIME,
+
+    _SC_THREAD_CPUTIME,
+
+    _SC_DEVICE_IO,
+
+    _SC_DEVICE_SPECIFIC,
+
+    _SC_DEVICE_SPECIFIC_R,
+
+    _SC_FD_MGMT,
+
+    _SC_FIFO,
+
+    _SC_PIPE,
+
+    _SC_FILE_ATTRIBUTES,
+
+    _SC_FILE_LOCKING,
+
+    _SC_FILE_SYSTEM,
+
+    _SC_MONOTONIC_CLOCK,
+
+    _SC_MULTI_PROCESS,
+
+    _SC_SINGLE_PROCESS,
+
+    _SC_NETWORKING,
+
+    _SC_READER_WRITER_LOCKS,
+
+    _SC_SPIN_LOCKS,
+
+    _SC_REGEXP,
+
+    _SC_REGEX_VERSION,
+
+    _SC_SHELL,
+
+    _SC_SIGNALS,
+
+    _SC_SPAWN,
+
+    _SC_SPORADIC_SERVER,
+
+    _SC_THREAD_SPORADIC_SERVER,
+
+    _SC_SYSTEM_DATABASE,
+
+    _SC_SYSTEM_DATABASE_R,
+
+    _SC_TIMEOUTS,
+
+    _SC_TYPED_MEMORY_OBJECTS,
+
+    _SC_USER_GROUPS,
+
+    _SC_USER_GROUPS_R,
+
+    _SC_2_PBS,
+
+    _SC_2_PBS_ACCOUNTING,
+
+    _SC_2_PBS_LOCATE,
+
+    _SC_2_PBS_MESSAGE,
+
+    _SC_2_PBS_TRACK,
+
+    _SC_SYMLOOP_MAX,
+
+    _SC_STREAMS,
+
+    _SC_2_PBS_CHECKPOINT,
+
+
+    _SC_V6_ILP32_OFF32,
+
+    _SC_V6_ILP32_OFFBIG,
+
+    _SC_V6_LP64_OFF64,
+
+    _SC_V6_LPBIG_OFFBIG,
+
+
+    _SC_HOST_NAME_MAX,
+
+    _SC_TRACE,
+
+    _SC_TRACE_EVENT_FILTER,
+
+    _SC_TRACE_INHERIT,
+
+    _SC_TRACE_LOG,
+
+
+    _SC_LEVEL1_ICACHE_SIZE,
+
+    _SC_LEVEL1_ICACHE_ASSOC,
+
+    _SC_LEVEL1_ICACHE_LINESIZE,
+
+    _SC_LEVEL1_DCACHE_SIZE,
+
+    _SC_LEVEL1_DCACHE_ASSOC,
+
+    _SC_LEVEL1_DCACHE_LINESIZE,
+
+    _SC_LEVEL2_CACHE_SIZE,
+
+    _SC_LEVEL2_CACHE_ASSOC,
+
+    _SC_LEVEL2_CACHE_LINESIZE,
+
+    _SC_LEVEL3_CACHE_SIZE,
+
+    _SC_LEVEL3_CACHE_ASSOC,
+
+    _SC_LEVEL3_CACHE_LINESIZE,
+
+    _SC_LEVEL4_CACHE_SIZE,
+
+    _SC_LEVEL4_CACHE_ASSOC,
+
+    _SC_LEVEL4_CACHE_LINESIZE,
+
+
+
+    _SC_IPV6 = _SC_LEVEL1_ICACHE_SIZE + 50,
+
+    _SC_RAW_SOCKETS,
+
+
+    _SC_V7_ILP32_OFF32,
+
+    _SC_V7_ILP32_OFFBIG,
+
+    _SC_V7_LP64_OFF64,
+
+    _SC_V7_LPBIG_OFFBIG,
+
+
+    _SC_SS_REPL_MAX,
+
+
+    _SC_TRACE_EVENT_NAME_MAX,
+
+    _SC_TRACE_NAME_MAX,
+
+    _SC_TRACE_SYS_MAX,
+
+    _SC_TRACE_USER_EVENT_MAX,
+
+
+    _SC_XOPEN_STREAMS,
+
+
+    _SC_THREAD_ROBUST_PRIO_INHERIT,
+
+    _SC_THREAD_ROBUST_PRIO_PROTECT,
+
+
+    _SC_MINSIGSTKSZ,
+
+
+    _SC_SIGSTKSZ
+
+  };
+
+
+enum
+  {
+    _CS_PATH,
+
+
+    _CS_V6_WIDTH_RESTRICTED_ENVS,
+
+
+
+    _CS_GNU_LIBC_VERSION,
+
+    _CS_GNU_LIBPTHREAD_VERSION,
+
+
+    _CS_V5_WIDTH_RESTRICTED_ENVS,
+
+
+
+    _CS_V7_WIDTH_RESTRICTED_ENVS,
+
+
+
+    _CS_LFS_CFLAGS = 1000,
+
+    _CS_LFS_LDFLAGS,
+
+    _CS_LFS_LIBS,
+
+    _CS_LFS_LINTFLAGS,
+
+    _CS_LFS64_CFLAGS,
+
+    _CS_LFS64_LDFLAGS,
+
+    _CS_LFS64_LIBS,
+
+    _CS_LFS64_LINTFLAGS,
+
+
+    _CS_XBS5_ILP32_OFF32_CFLAGS = 1100,
+
+    _CS_XBS5_ILP32_OFF32_LDFLAGS,
+
+    _CS_XBS5_ILP32_OFF32_LIBS,
+
+    _CS_XBS5_ILP32_OFF32_LINTFLAGS,
+
+    _CS_XBS5_ILP32_OFFBIG_CFLAGS,
+
+    _CS_XBS5_ILP32_OFFBIG_LDFLAGS,
+
+    _CS_XBS5_ILP32_OFFBIG_LIBS,
+
+    _CS_XBS5_ILP32_OFFBIG_LINTFLAGS,
+
+    _CS_XBS5_LP64_OFF64_CFLAGS,
+
+    _CS_XBS5_LP64_OFF64_LDFLAGS,
+
+    _CS_XBS5_LP64_OFF64_LIBS,
+
+    _CS_XBS5_LP64_OFF64_LINTFLAGS,
+
+    _CS_XBS5_LPBIG_OFFBIG_CFLAGS,
+
+    _CS_XBS5_LPBIG_OFFBIG_LDFLAGS,
+
+    _CS_XBS5_LPBIG_OFFBIG_LIBS,
+
+    _CS_XBS5_LPBIG_OFFBIG_LINTFLAGS,
+
+
+    _CS_POSIX_V6_ILP32_OFF32_CFLAGS,
+
+    _CS_POSIX_V6_ILP32_OFF32_LDFLAGS,
+
+    _CS_POSIX_V6_ILP32_OFF32_LIBS,
+
+    _CS_POSIX_V6_ILP32_OFF32_LINTFLAGS,
+
+    _CS_POSIX_V6_ILP32_OFFBIG_CFLAGS,
+
+    _CS_POSIX_V6_ILP32_OFFBIG_LDFLAGS,
+
+    _CS_POSIX_V6_ILP32_OFFBIG_LIBS,
+
+    _CS_POSIX_V6_ILP32_OFFBIG_LINTFLAGS,
+
+    _CS_POSIX_V6_LP64_OFF64_CFLAGS,
+
+    _CS_POSIX_V6_LP64_OFF64_LDFLAGS,
+
+    _CS_POSIX_V6_LP64_OFF64_LIBS,
+
+    _CS_POSIX_V6_LP64_OFF64_LINTFLAGS,
+
+    _CS_POSIX_V6_LPBIG_OFFBIG_CFLAGS,
+
+    _CS_POSIX_V6_LPBIG_OFFBIG_LDFLAGS,
+
+    _CS_POSIX_V6_LPBIG_OFFBIG_LIBS,
+
+    _CS_POSIX_V6_LPBIG_OFFBIG_LINTFLAGS,
+
+
+    _CS_POSIX_V7_ILP32_OFF32_CFLAGS,
+
+    _CS_POSIX_V7_ILP32_OFF32_LDFLAGS,
+
+    _CS_POSIX_V7_ILP32_OFF32_LIBS,
+
+    _CS_POSIX_V7_ILP32_OFF32_LINTFLAGS,
+
+    _CS_POSIX_V7_ILP32_OFFBIG_CFLAGS,
+
+    _CS_POSIX_V7_ILP32_OFFBIG_LDFLAGS,
+
+    _CS_POSIX_V7_ILP32_OFFBIG_LIBS,
+
+    _CS_POSIX_V7_ILP32_OFFBIG_LINTFLAGS,
+
+    _CS_POSIX_V7_LP64_OFF64_CFLAGS,
+
+    _CS_POSIX_V7_LP64_OFF64_LDFLAGS,
+
+    _CS_POSIX_V7_LP64_OFF64_LIBS,
+
+    _CS_POSIX_V7_LP64_OFF64_LINTFLAGS,
+
+    _CS_POSIX_V7_LPBIG_OFFBIG_CFLAGS,
+
+    _CS_POSIX_V7_LPBIG_OFFBIG_LDFLAGS,
+
+    _CS_POSIX_V7_LPBIG_OFFBIG_LIBS,
+
+    _CS_POSIX_V7_LPBIG_OFFBIG_LINTFLAGS,
+
+
+    _CS_V6_ENV,
+
+    _CS_V7_ENV
+
+  };
+# 631 "/usr/include/unistd.h" 2 3 4
+
+
+extern long int pathconf (const char *__path, int __name)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern long int fpathconf (int __fd, int __name) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern long int sysconf (int __name) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern size_t confstr (int __name, char *__buf, size_t __len) __attribute__ ((__nothrow__ , __leaf__))
+    __attribute__ ((__access__ (__write_only__, 2, 3)));
+
+
+
+
+extern __pid_t getpid (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern __pid_t getppid (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern __pid_t getpgrp (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern __pid_t __getpgid (__pid_t __pid) __attribute__ ((__nothrow__ , __leaf__));
+
+extern __pid_t getpgid (__pid_t __pid) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern int setpgid (__pid_t __pid, __pid_t __pgid) __attribute__ ((__nothrow__ , __leaf__));
+# 682 "/usr/include/unistd.h" 3 4
+extern int setpgrp (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern __pid_t setsid (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern __pid_t getsid (__pid_t __pid) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern __uid_t getuid (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern __uid_t geteuid (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern __gid_t getgid (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern __gid_t getegid (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern int getgroups (int __size, __gid_t __list[]) __attribute__ ((__nothrow__ , __leaf__))
+    __attribute__ ((__access__ (__write_only__, 2, 1)));
+# 722 "/usr/include/unistd.h" 3 4
+extern int setuid (__uid_t __uid) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern int setreuid (__uid_t __ruid, __uid_t __euid) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern int seteuid (__uid_t __uid) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+
+extern int setgid (__gid_t __gid) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern int setregid (__gid_t __rgid, __gid_t __egid) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern int setegid (__gid_t __gid) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 778 "/usr/include/unistd.h" 3 4
+extern __pid_t fork (void) __attribute__ ((__nothrow__));
+
+
+
+
+
+
+
+extern __pid_t vfork (void) __attribute__ ((__nothrow__ , __leaf__));
+# 799 "/usr/include/unistd.h" 3 4
+extern char *ttyname (int __fd) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int ttyname_r (int __fd, char *__buf, size_t __buflen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)))
+     __attribute__ ((__access__ (__write_only__, 2, 3)));
+
+
+
+extern int isatty (int __fd) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern int ttyslot (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern int link (const char *__from, const char *__to)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2))) ;
+
+
+
+
+extern int linkat (int __fromfd, const char *__from, int __tofd,
+     const char *__to, int __flags)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4))) ;
+
+
+
+
+extern int symlink (const char *__from, const char *__to)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2))) ;
+
+
+
+
+extern ssize_t readlink (const char *__restrict __path,
+    char *__restrict __buf, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)))
+     __attribute__ ((__access__ (__write_only__, 2, 3)));
+
+
+
+
+
+extern int symlinkat (const char *__from, int __tofd,
+        const char *__to) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 3))) ;
+
+
+extern ssize_t readlinkat (int __fd, const char *__restrict __path,
+      char *__restrict __buf, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)))
+     __attribute__ ((__access__ (__write_only__, 3, 4)));
+
+
+
+extern int unlink (const char *__name) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int unlinkat (int __fd, const char *__name, int __flag)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern int rmdir (const char *__path) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern __pid_t tcgetpgrp (int __fd) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int tcsetpgrp (int __fd, __pid_t __pgrp_id) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern char *getlogin (void);
+
+
+
+
+
+
+
+extern int getlogin_r (char *__name, size_t __name_len) __attribute__ ((__nonnull__ (1)))
+    __attribute__ ((__access__ (__write_only__, 1, 2)));
+
+
+
+
+extern int setlogin (const char *__name) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/getopt_posix.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/getopt_posix.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/getopt_core.h" 1 3 4
+# 28 "/usr/include/x86_64-linux-gnu/bits/getopt_core.h" 3 4
+
+
+
+
+
+
+
+
+extern char *optarg;
+# 50 "/usr/include/x86_64-linux-gnu/bits/getopt_core.h" 3 4
+extern int optind;
+
+
+
+
+extern int opterr;
+
+
+
+extern int optopt;
+# 91 "/usr/include/x86_64-linux-gnu/bits/getopt_core.h" 3 4
+extern int getopt (int ___argc, char *const *___argv, const char *__shortopts)
+       __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+
+
+# 28 "/usr/include/x86_64-linux-gnu/bits/getopt_posix.h" 2 3 4
+
+
+# 49 "/usr/include/x86_64-linux-gnu/bits/getopt_posix.h" 3 4
+
+# 904 "/usr/include/unistd.h" 2 3 4
+
+
+
+
+
+
+
+extern int gethostname (char *__name, size_t __len) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)))
+    __attribute__ ((__access__ (__write_only__, 1, 2)));
+
+
+
+
+
+
+extern int sethostname (const char *__name, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) __attribute__ ((__access__ (__read_only__, 1, 2)));
+
+
+
+extern int sethostid (long int __id) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+extern int getdomainname (char *__name, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)))
+     __attribute__ ((__access__ (__write_only__, 1, 2)));
+extern int setdomainname (const char *__name, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) __attribute__ ((__access__ (__read_only__, 1, 2)));
+
+
+
+
+extern int vhangup (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int revoke (const char *__file) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+
+
+
+extern int profil (unsigned short int *__sample_buffer, size_t __size,
+     size_t __offset, unsigned int __scale)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern int acct (const char *__name) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern char *getusershell (void) __attribute__ ((__nothrow__ , __leaf__));
+extern void endusershell (void) __attribute__ ((__nothrow__ , __leaf__));
+extern void setusershell (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern int daemon (int __nochdir, int __noclose) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+
+extern int chroot (const char *__path) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+extern char *getpass (const char *__prompt) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+extern int fsync (int __fd);
+# 1002 "/usr/include/unistd.h" 3 4
+extern long int gethostid (void);
+
+
+extern void sync (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern int getpagesize (void) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern int getdtablesize (void) __attribute__ ((__nothrow__ , __leaf__));
+# 1026 "/usr/include/unistd.h" 3 4
+extern int truncate (const char *__file, __off_t __length)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 1049 "/usr/include/unistd.h" 3 4
+extern int ftruncate (int __fd, __off_t __length) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 1070 "/usr/include/unistd.h" 3 4
+extern int brk (void *__addr) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+extern void *sbrk (intptr_t __delta) __attribute__ ((__nothrow__ , __leaf__));
+# 1091 "/usr/include/unistd.h" 3 4
+extern long int syscall (long int __sysno, ...) __attribute__ ((__nothrow__ , __leaf__));
+# 1114 "/usr/include/unistd.h" 3 4
+extern int lockf (int __fd, int __cmd, __off_t __len) ;
+# 1150 "/usr/include/unistd.h" 3 4
+extern int fdatasync (int __fildes);
+# 1159 "/usr/include/unistd.h" 3 4
+extern char *crypt (const char *__key, const char *__salt)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+# 1198 "/usr/include/unistd.h" 3 4
+int getentropy (void *__buffer, size_t __length)
+    __attribute__ ((__access__ (__write_only__, 1, 2)));
+# 1218 "/usr/include/unistd.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/unistd_ext.h" 1 3 4
+# 1219 "/usr/include/unistd.h" 2 3 4
+
+
+# 24 "/root/repo/include/debug.h" 2
+# 56 "/root/repo/include/common.h" 2
+# 21 "/root/repo/src/isa/riscv64/include/isa-def.h" 2
+
+
+
+
+
+
+
+
+# 28 "/root/repo/src/isa/riscv64/include/isa-def.h"
+struct ExecutionGuide {
+
+  
+# 30 "/root/repo/src/isa/riscv64/include/isa-def.h" 3 4
+ _Bool 
+# 30 "/root/repo/src/isa/riscv64/include/isa-def.h"
+      force_raise_exception;
+  uint64_t exception_num;
+  uint64_t mtval;
+  uint64_t stval;
+
+  
+# 35 "/root/repo/src/isa/riscv64/include/isa-def.h" 3 4
+ _Bool 
+# 35 "/root/repo/src/isa/riscv64/include/isa-def.h"
+      force_set_jump_target;
+  uint64_t jump_target;
+};
+
+struct DebugInfo {
+  uint64_t current_pc;
+};
+# 58 "/root/repo/src/isa/riscv64/include/isa-def.h"
+typedef struct {
+
+  union {
+    uint64_t _64;
+  } gpr[32];
+
+  union {
+    uint64_t _64;
+  } fpr[32];
+
+
+  uint64_t pc;
+  uint64_t mstatus, mcause, mepc;
+  uint64_t sstatus, scause, sepc;
+
+  uint64_t satp, mip, mie, mscratch, sscratch, mideleg, medeleg;
+  uint64_t mtval, stval, mtvec, stvec;
+  uint64_t mode;
+# 93 "/root/repo/src/isa/riscv64/include/isa-def.h"
+  
+# 93 "/root/repo/src/isa/riscv64/include/isa-def.h" 3 4
+ _Bool 
+# 93 "/root/repo/src/isa/riscv64/include/isa-def.h"
+      amo;
+  int mem_exception;
+
+
+  uint64_t lr_addr;
+  uint64_t lr_valid;
+
+
+
+
+
+  
+# 104 "/root/repo/src/isa/riscv64/include/isa-def.h" 3 4
+ _Bool 
+# 104 "/root/repo/src/isa/riscv64/include/isa-def.h"
+      INTR;
+
+
+  
+# 107 "/root/repo/src/isa/riscv64/include/isa-def.h" 3 4
+ _Bool 
+# 107 "/root/repo/src/isa/riscv64/include/isa-def.h"
+      guided_exec;
+  struct ExecutionGuide execution_guide;
+
+
+  struct DebugInfo debug;
+
+
+
+} riscv64_CPU_state;
+
+
+typedef struct {
+  union {
+    struct {
+      uint32_t opcode1_0 : 2;
+      uint32_t opcode6_2 : 5;
+      uint32_t rd : 5;
+      uint32_t funct3 : 3;
+      uint32_t rs1 : 5;
+      uint32_t rs2 : 5;
+      uint32_t funct7 : 7;
+    } r;
+    struct {
+      uint32_t opcode1_0 : 2;
+      uint32_t opcode6_2 : 5;
+      uint32_t rd : 5;
+      uint32_t funct3 : 3;
+      uint32_t rs1 : 5;
+      int32_t simm11_0 :12;
+    } i;
+    struct {
+      uint32_t opcode1_0 : 2;
+      uint32_t opcode6_2 : 5;
+      uint32_t imm4_0 : 5;
+      uint32_t funct3 : 3;
+      uint32_t rs1 : 5;
+      uint32_t rs2 : 5;
+      int32_t simm11_5 : 7;
+    } s;
+    struct {
+      uint32_t opcode1_0 : 2;
+      uint32_t opcode6_2 : 5;
+      uint32_t imm11 : 1;
+      uint32_t imm4_1 : 4;
+      uint32_t funct3 : 3;
+      uint32_t rs1 : 5;
+      uint32_t rs2 : 5;
+      uint32_t imm10_5 : 6;
+      int32_t simm12 : 1;
+    } b;
+    struct {
+      uint32_t opcode1_0 : 2;
+      uint32_t opcode6_2 : 5;
+      uint32_t rd : 5;
+      int32_t simm31_12 :20;
+    } u;
+    struct {
+      uint32_t opcode1_0 : 2;
+      uint32_t opcode6_2 : 5;
+      uint32_t rd : 5;
+      uint32_t imm19_12 : 8;
+      uint32_t imm11 : 1;
+      uint32_t imm10_1 :10;
+      int32_t simm20 : 1;
+    } j;
+    struct {
+      uint32_t pad7 :20;
+      uint32_t csr :12;
+    } csr;
+    struct {
+      uint32_t opcode1_0 : 2;
+      uint32_t opcode6_2 : 5;
+      uint32_t rd : 5;
+      uint32_t rm : 3;
+      uint32_t rs1 : 5;
+      uint32_t rs2 : 5;
+      uint32_t fmt : 2;
+      uint32_t funct5 : 5;
+    } fp;
+# 238 "/root/repo/src/isa/riscv64/include/isa-def.h"
+    uint32_t val;
+  } instr;
+} riscv64_ISADecodeInfo;
+
+enum { MODE_U = 0, MODE_S, MODE_H, MODE_M };
+
+int get_data_mmu_state();
+# 22 "/root/repo/include/isa.h" 2
+
+
+
+typedef riscv64_CPU_state CPU_state;
+typedef riscv64_ISADecodeInfo ISADecodeInfo;
+
+
+extern char isa_logo[];
+void init_isa();
+
+
+
+
+
+extern CPU_state cpu;
+extern rtlreg_t csr_array[4096];
+void isa_reg_display();
+word_t isa_reg_str2val(const char *name, 
+# 39 "/root/repo/include/isa.h" 3 4
+                                        _Bool 
+# 39 "/root/repo/include/isa.h"
+                                             *success);
+
+
+struct Decode;
+int isa_fetch_decode(struct Decode *s);
+void isa_hostcall(uint32_t id, rtlreg_t *dest, const rtlreg_t *src1,
+    const rtlreg_t *src2, word_t imm);
+
+
+enum { MMU_DIRECT, MMU_TRANSLATE, MMU_DYNAMIC };
+enum { MEM_TYPE_IFETCH, MEM_TYPE_READ, MEM_TYPE_WRITE, MEM_TYPE_IFETCH_READ, MEM_TYPE_WRITE_READ };
+enum { MEM_RET_OK, MEM_RET_FAIL, MEM_RET_CROSS_PAGE };
+
+
+
+
+int isa_mmu_check(vaddr_t vaddr, int len, int type);
+
+paddr_t isa_mmu_translate(vaddr_t vaddr, int len, int type);
+
+# 58 "/root/repo/include/isa.h" 3 4
+_Bool 
+# 58 "/root/repo/include/isa.h"
+    isa_pmp_check_permission(paddr_t addr, int len, int type, int mode);
+
+# 59 "/root/repo/include/isa.h" 3 4
+_Bool 
+# 59 "/root/repo/include/isa.h"
+    isa_spmp_check_permission(paddr_t addr, int len, int type, int mode);
+
+
+vaddr_t raise_intr(word_t NO, vaddr_t epc);
+
+word_t isa_query_intr();
+
+# 65 "/root/repo/include/isa.h" 3 4
+_Bool 
+# 65 "/root/repo/include/isa.h"
+    isa_has_pending_intr();
+
+
+struct CptRegs;
+void isa_restore_cpt_regs(const struct CptRegs *regs);
+
+
+
+
+# 73 "/root/repo/include/isa.h" 3 4
+_Bool 
+# 73 "/root/repo/include/isa.h"
+    isa_difftest_checkregs(CPU_state *ref_r, vaddr_t pc);
+void isa_difftest_attach();
+
+
+void isa_difftest_regcpy(void *dut, 
+# 77 "/root/repo/include/isa.h" 3 4
+                                   _Bool 
+# 77 "/root/repo/include/isa.h"
+                                        direction);
+void isa_difftest_csrcpy(void *dut, 
+# 78 "/root/repo/include/isa.h" 3 4
+                                   _Bool 
+# 78 "/root/repo/include/isa.h"
+                                        direction);
+void isa_difftest_raise_intr(word_t NO);
+void isa_difftest_uarchstatus_cpy(void *dut, 
+# 80 "/root/repo/include/isa.h" 3 4
+                                            _Bool 
+# 80 "/root/repo/include/isa.h"
+                                                 direction);
+void isa_difftest_guided_exec(void *guide);
+void isa_difftest_query_ref(void *result_buffer, uint64_t type);
+# 21 "/root/repo/include/cpu/decode.h" 2
+
+
+
+typedef struct {
+  union {
+    ;
+    ;
+    rtlreg_t *preg;
+    word_t imm;
+    sword_t simm;
+  };
+  ;
+  ;
+  ;
+  ;
+  ;
+  ;
+} Operand;
+
+enum {
+  INSTR_TYPE_N,
+  INSTR_TYPE_J,
+  INSTR_TYPE_B,
+  INSTR_TYPE_I,
+};
+
+
+
+
+
+typedef struct Decode {
+  union {
+    struct {
+      struct Decode *tnext;
+      struct Decode *ntnext;
+    };
+    struct {
+      struct Decode *list_next;
+      struct Decode *bb_src;
+    };
+  };
+  const void *EHelper;
+  ;
+  Operand dest, src1, src2;
+  vaddr_t pc;
+  uint16_t idx_in_bb;
+  uint8_t type;
+  uint32_t epoch;
+
+  vaddr_t snpc;
+  vaddr_t jnpc;
+  uint32_t exec_cnt;
+  uint32_t bbv_id;
+  struct Decode *rnext;
+  ;
+  ISADecodeInfo isa;
+  ;
+# 86 "/root/repo/include/cpu/decode.h"
+} Decode;
+# 122 "/root/repo/include/cpu/decode.h"
+static inline void decode_empty (Decode *s, int width) {}
+
+
+
+
+
+
+__attribute__((always_inline))
+static inline void pattern_decode(const char *str, int len,
+    uint32_t *key, uint32_t *mask, uint32_t *shift) {
+  uint32_t __key = 0, __mask = 0, __shift = 0;
+# 152 "/root/repo/include/cpu/decode.h"
+  if ((0) >= len) goto finish; else { char c = str[0]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail (
+# 152 "/root/repo/include/cpu/decode.h"
+ "c == '0' || c == '1' || c == '?'"
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ , "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((0) + 1) >= len) goto finish; else { char c = str[(0) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((0) + 2) >= len) goto finish; else { char c = str[(0) + 2]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((0) + 2) + 1) >= len) goto finish; else { char c = str[((0) + 2) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((0) + 4) >= len) goto finish; else { char c = str[(0) + 4]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((0) + 4) + 1) >= len) goto finish; else { char c = str[((0) + 4) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((0) + 4) + 2) >= len) goto finish; else { char c = str[((0) + 4) + 2]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((0) + 4) + 2) + 1) >= len) goto finish; else { char c = str[(((0) + 4) + 2) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((0) + 8) >= len) goto finish; else { char c = str[(0) + 8]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((0) + 8) + 1) >= len) goto finish; else { char c = str[((0) + 8) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((0) + 8) + 2) >= len) goto finish; else { char c = str[((0) + 8) + 2]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((0) + 8) + 2) + 1) >= len) goto finish; else { char c = str[(((0) + 8) + 2) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((0) + 8) + 4) >= len) goto finish; else { char c = str[((0) + 8) + 4]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((0) + 8) + 4) + 1) >= len) goto finish; else { char c = str[(((0) + 8) + 4) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((0) + 8) + 4) + 2) >= len) goto finish; else { char c = str[(((0) + 8) + 4) + 2]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((((0) + 8) + 4) + 2) + 1) >= len) goto finish; else { char c = str[((((0) + 8) + 4) + 2) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((0) + 16) >= len) goto finish; else { char c = str[(0) + 16]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((0) + 16) + 1) >= len) goto finish; else { char c = str[((0) + 16) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((0) + 16) + 2) >= len) goto finish; else { char c = str[((0) + 16) + 2]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((0) + 16) + 2) + 1) >= len) goto finish; else { char c = str[(((0) + 16) + 2) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((0) + 16) + 4) >= len) goto finish; else { char c = str[((0) + 16) + 4]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((0) + 16) + 4) + 1) >= len) goto finish; else { char c = str[(((0) + 16) + 4) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((0) + 16) + 4) + 2) >= len) goto finish; else { char c = str[(((0) + 16) + 4) + 2]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((((0) + 16) + 4) + 2) + 1) >= len) goto finish; else { char c = str[((((0) + 16) + 4) + 2) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((0) + 16) + 8) >= len) goto finish; else { char c = str[((0) + 16) + 8]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((0) + 16) + 8) + 1) >= len) goto finish; else { char c = str[(((0) + 16) + 8) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((0) + 16) + 8) + 2) >= len) goto finish; else { char c = str[(((0) + 16) + 8) + 2]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((((0) + 16) + 8) + 2) + 1) >= len) goto finish; else { char c = str[((((0) + 16) + 8) + 2) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((0) + 16) + 8) + 4) >= len) goto finish; else { char c = str[(((0) + 16) + 8) + 4]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((((0) + 16) + 8) + 4) + 1) >= len) goto finish; else { char c = str[((((0) + 16) + 8) + 4) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((((0) + 16) + 8) + 4) + 2) >= len) goto finish; else { char c = str[((((0) + 16) + 8) + 4) + 2]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((((0) + 16) + 8) + 4) + 2) + 1) >= len) goto finish; else { char c = str[(((((0) + 16) + 8) + 4) + 2) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((0) + 32) >= len) goto finish; else { char c = str[(0) + 32]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((0) + 32) + 1) >= len) goto finish; else { char c = str[((0) + 32) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((0) + 32) + 2) >= len) goto finish; else { char c = str[((0) + 32) + 2]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((0) + 32) + 2) + 1) >= len) goto finish; else { char c = str[(((0) + 32) + 2) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((0) + 32) + 4) >= len) goto finish; else { char c = str[((0) + 32) + 4]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((0) + 32) + 4) + 1) >= len) goto finish; else { char c = str[(((0) + 32) + 4) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((0) + 32) + 4) + 2) >= len) goto finish; else { char c = str[(((0) + 32) + 4) + 2]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((((0) + 32) + 4) + 2) + 1) >= len) goto finish; else { char c = str[((((0) + 32) + 4) + 2) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((0) + 32) + 8) >= len) goto finish; else { char c = str[((0) + 32) + 8]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((0) + 32) + 8) + 1) >= len) goto finish; else { char c = str[(((0) + 32) + 8) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((0) + 32) + 8) + 2) >= len) goto finish; else { char c = str[(((0) + 32) + 8) + 2]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((((0) + 32) + 8) + 2) + 1) >= len) goto finish; else { char c = str[((((0) + 32) + 8) + 2) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((0) + 32) + 8) + 4) >= len) goto finish; else { char c = str[(((0) + 32) + 8) + 4]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((((0) + 32) + 8) + 4) + 1) >= len) goto finish; else { char c = str[((((0) + 32) + 8) + 4) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((((0) + 32) + 8) + 4) + 2) >= len) goto finish; else { char c = str[((((0) + 32) + 8) + 4) + 2]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((((0) + 32) + 8) + 4) + 2) + 1) >= len) goto finish; else { char c = str[(((((0) + 32) + 8) + 4) + 2) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((0) + 32) + 16) >= len) goto finish; else { char c = str[((0) + 32) + 16]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((0) + 32) + 16) + 1) >= len) goto finish; else { char c = str[(((0) + 32) + 16) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((0) + 32) + 16) + 2) >= len) goto finish; else { char c = str[(((0) + 32) + 16) + 2]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((((0) + 32) + 16) + 2) + 1) >= len) goto finish; else { char c = str[((((0) + 32) + 16) + 2) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((0) + 32) + 16) + 4) >= len) goto finish; else { char c = str[(((0) + 32) + 16) + 4]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((((0) + 32) + 16) + 4) + 1) >= len) goto finish; else { char c = str[((((0) + 32) + 16) + 4) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((((0) + 32) + 16) + 4) + 2) >= len) goto finish; else { char c = str[((((0) + 32) + 16) + 4) + 2]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((((0) + 32) + 16) + 4) + 2) + 1) >= len) goto finish; else { char c = str[(((((0) + 32) + 16) + 4) + 2) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((0) + 32) + 16) + 8) >= len) goto finish; else { char c = str[(((0) + 32) + 16) + 8]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((((0) + 32) + 16) + 8) + 1) >= len) goto finish; else { char c = str[((((0) + 32) + 16) + 8) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((((0) + 32) + 16) + 8) + 2) >= len) goto finish; else { char c = str[((((0) + 32) + 16) + 8) + 2]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((((0) + 32) + 16) + 8) + 2) + 1) >= len) goto finish; else { char c = str[(((((0) + 32) + 16) + 8) + 2) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((((0) + 32) + 16) + 8) + 4) >= len) goto finish; else { char c = str[((((0) + 32) + 16) + 8) + 4]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((((0) + 32) + 16) + 8) + 4) + 1) >= len) goto finish; else { char c = str[(((((0) + 32) + 16) + 8) + 4) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((((0) + 32) + 16) + 8) + 4) + 2) >= len) goto finish; else { char c = str[(((((0) + 32) + 16) + 8) + 4) + 2]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((((((0) + 32) + 16) + 8) + 4) + 2) + 1) >= len) goto finish; else { char c = str[((((((0) + 32) + 16) + 8) + 4) + 2) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } };
+
+finish:
+  *key = __key >> __shift;
+  *mask = __mask >> __shift;
+  *shift = __shift;
+}
+# 17 "src/cpu/tcache.c" 2
+# 1 "/root/repo/include/cpu/cpu.h" 1
+# 21 "/root/repo/include/cpu/cpu.h"
+enum {
+  NEMU_EXEC_RUNNING = 0,
+  NEMU_EXEC_END,
+  NEMU_EXEC_AGAIN,
+  NEMU_EXEC_EXCEPTION,
+  NEMU_EXEC_SERIAL
+};
+
+void cpu_exec(uint64_t n);
+# 41 "/root/repo/include/cpu/cpu.h"
+__attribute__((noreturn)) void longjmp_exec(int cause);
+__attribute__((noreturn)) void longjmp_exception(int ex_cause);
+
+enum {
+  SYS_STATE_UPDATE = 1,
+  SYS_STATE_FLUSH_TCACHE = 2,
+  SYS_STATE_REMAP = 4,
+  SYS_STATE_FENCE_I = 8,
+};
+void set_sys_state_flag(int flag);
+void cpu_wait_for_intr();
+void mmu_tlb_flush(vaddr_t vaddr);
+void mmu_ifetch_remap();
+
+struct Decode;
+void save_globals(struct Decode *s);
+void fetch_decode(struct Decode *s, vaddr_t pc);
+# 18 "src/cpu/tcache.c" 2
+# 1 "/root/repo/include/memory/paddr.h" 1
+# 21 "/root/repo/include/memory/paddr.h"
+# 1 "/root/repo/include/memory/host.h" 1
+# 21 "/root/repo/include/memory/host.h"
+static inline word_t host_read(void *addr, int len) {
+  switch (len) {
+    case 1: return *(uint8_t *)addr;
+    case 2: return *(uint16_t *)addr;
+    case 4: return *(uint32_t *)addr;
+    case 8: return *(uint64_t *)addr;
+    default: 
+# 27 "/root/repo/include/memory/host.h" 3 4
+            ((void) sizeof ((
+# 27 "/root/repo/include/memory/host.h"
+            0
+# 27 "/root/repo/include/memory/host.h" 3 4
+            ) ? 1 : 0), __extension__ ({ if (
+# 27 "/root/repo/include/memory/host.h"
+            0
+# 27 "/root/repo/include/memory/host.h" 3 4
+            ) ; else __assert_fail (
+# 27 "/root/repo/include/memory/host.h"
+            "0"
+# 27 "/root/repo/include/memory/host.h" 3 4
+            , "/root/repo/include/memory/host.h", 27, __extension__ __PRETTY_FUNCTION__); }))
+# 27 "/root/repo/include/memory/host.h"
+                                                        ;
+  }
+}
+
+static inline void host_write(void *addr, int len, word_t data) {
+  switch (len) {
+    case 1: *(uint8_t *)addr = data; return;
+    case 2: *(uint16_t *)addr = data; return;
+    case 4: *(uint32_t *)addr = data; return;
+    case 8: *(uint64_t *)addr = data; return;
+    default: 
+# 37 "/root/repo/include/memory/host.h" 3 4
+   ((void) sizeof ((
+# 37 "/root/repo/include/memory/host.h"
+   0
+# 37 "/root/repo/include/memory/host.h" 3 4
+   ) ? 1 : 0), __extension__ ({ if (
+# 37 "/root/repo/include/memory/host.h"
+   0
+# 37 "/root/repo/include/memory/host.h" 3 4
+   ) ; else __assert_fail (
+# 37 "/root/repo/include/memory/host.h"
+   "0"
+# 37 "/root/repo/include/memory/host.h" 3 4
+   , "/root/repo/include/memory/host.h", 37, __extension__ __PRETTY_FUNCTION__); }))
+# 37 "/root/repo/include/memory/host.h"
+                                             ;
+  }
+}
+# 22 "/root/repo/include/memory/paddr.h" 2
+# 1 "/root/repo/include/memory/vaddr.h" 1
+# 21 "/root/repo/include/memory/vaddr.h"
+struct Decode;
+word_t vaddr_ifetch(vaddr_t addr, int len);
+paddr_t vaddr_ifetch_paddr(vaddr_t addr);
+word_t vaddr_read(struct Decode *s, vaddr_t addr, int len, int mmu_mode);
+void vaddr_write(struct Decode *s, vaddr_t addr, int len, word_t data, int mmu_mode);
+
+word_t vaddr_read_safe(vaddr_t addr, int len);
+
+
+
+
+
+int force_raise_pf(vaddr_t vaddr, int type);
+# 23 "/root/repo/include/memory/paddr.h" 2
+
+extern unsigned long MEMORY_SIZE;
+# 34 "/root/repo/include/memory/paddr.h"
+void init_mem();
+
+
+uint8_t* guest_to_host(paddr_t paddr);
+
+paddr_t host_to_guest(uint8_t *haddr);
+
+static inline 
+# 41 "/root/repo/include/memory/paddr.h" 3 4
+             _Bool 
+# 41 "/root/repo/include/memory/paddr.h"
+                  in_pmem(paddr_t addr) {
+  paddr_t mbase_mask = 0x80000000 - 1;
+  paddr_t msize_mask = MEMORY_SIZE - 1;
+  
+# 44 "/root/repo/include/memory/paddr.h" 3 4
+ _Bool 
+# 44 "/root/repo/include/memory/paddr.h"
+      mbase_align = (0x80000000 & mbase_mask) == 0;
+  
+# 45 "/root/repo/include/memory/paddr.h" 3 4
+ _Bool 
+# 45 "/root/repo/include/memory/paddr.h"
+      msize_align = (MEMORY_SIZE & msize_mask) == 0;
+  
+# 46 "/root/repo/include/memory/paddr.h" 3 4
+ _Bool 
+# 46 "/root/repo/include/memory/paddr.h"
+      msize_inside_mbase = msize_mask <= mbase_mask;
+  if (mbase_align && msize_align && msize_inside_mbase) {
+    return (addr & ~msize_mask) == 0x80000000;
+  } else {
+    return (addr >= 0x80000000) && (addr < (paddr_t)0x80000000 + MEMORY_SIZE);
+  }
+}
+
+word_t paddr_read(paddr_t addr, int len, int type, int mode, vaddr_t vaddr);
+void paddr_write(paddr_t addr, int len, word_t data, int mode, vaddr_t vaddr);
+uint8_t *get_pmem();
+
+void pmem_set_code_page(paddr_t addr);
+# 99 "/root/repo/include/memory/paddr.h"
+void pmem_mark_dirty(paddr_t addr, size_t len);
+const uint64_t *pmem_dirty_bitmap();
+void pmem_clear_dirty();
+# 19 "src/cpu/tcache.c" 2
+
+# 1 "/root/repo/include/checkpoint/profiling.h" 1
+# 21 "/root/repo/include/checkpoint/profiling.h"
+enum ProfilingState {
+    NoProfiling = 0,
+    SimpointProfiling,
+    SimpointCheckpointing,
+    UniformCheckpointing
+};
+
+enum CheckpointFormat {
+    GzCheckpoint = 0,
+    ChunkedCheckpoint,
+};
+
+enum BbvFormat {
+    TextBbv = 0,
+    BinaryBbv,
+};
+
+extern int profiling_state;
+extern 
+# 39 "/root/repo/include/checkpoint/profiling.h" 3 4
+      _Bool 
+# 39 "/root/repo/include/checkpoint/profiling.h"
+           checkpoint_taking;
+extern 
+# 40 "/root/repo/include/checkpoint/profiling.h" 3 4
+      _Bool 
+# 40 "/root/repo/include/checkpoint/profiling.h"
+           checkpoint_restoring;
+extern 
+# 41 "/root/repo/include/checkpoint/profiling.h" 3 4
+      _Bool 
+# 41 "/root/repo/include/checkpoint/profiling.h"
+           checkpoint_native_restore;
+extern 
+# 42 "/root/repo/include/checkpoint/profiling.h" 3 4
+      _Bool 
+# 42 "/root/repo/include/checkpoint/profiling.h"
+           checkpoint_lazy_restore;
+extern char *checkpoint_cache_dir;
+extern uint64_t checkpoint_interval;
+extern int checkpoint_jobs;
+extern int checkpoint_format;
+extern int checkpoint_delta;
+extern int simpoint_cluster_maxk;
+extern int simpoint_bbv_format;
+extern uint64_t simpoint_shard_intervals;
+extern int simpoint_shard_jobs;
+
+extern 
+# 53 "/root/repo/include/checkpoint/profiling.h" 3 4
+      _Bool 
+# 53 "/root/repo/include/checkpoint/profiling.h"
+           profiling_started;
+extern 
+# 54 "/root/repo/include/checkpoint/profiling.h" 3 4
+      _Bool 
+# 54 "/root/repo/include/checkpoint/profiling.h"
+           force_cpt_mmode;
+# 21 "src/cpu/tcache.c" 2
+# 1 "/usr/include/stdlib.h" 1 3 4
+# 26 "/usr/include/stdlib.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 27 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 329 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+
+# 329 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef int wchar_t;
+# 33 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/waitflags.h" 1 3 4
+# 41 "/usr/include/stdlib.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h" 1 3 4
+# 42 "/usr/include/stdlib.h" 2 3 4
+# 59 "/usr/include/stdlib.h" 3 4
+typedef struct
+  {
+    int quot;
+    int rem;
+  } div_t;
+
+
+
+typedef struct
+  {
+    long int quot;
+    long int rem;
+  } ldiv_t;
+
+
+
+
+
+__extension__ typedef struct
+  {
+    long long int quot;
+    long long int rem;
+  } lldiv_t;
+# 98 "/usr/include/stdlib.h" 3 4
+extern size_t __ctype_get_mb_cur_max (void) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+extern double atof (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+extern int atoi (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+extern long int atol (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+__extension__ extern long long int atoll (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+extern double strtod (const char *__restrict __nptr,
+        char **__restrict __endptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern float strtof (const char *__restrict __nptr,
+       char **__restrict __endptr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+extern long double strtold (const char *__restrict __nptr,
+       char **__restrict __endptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 177 "/usr/include/stdlib.h" 3 4
+extern long int strtol (const char *__restrict __nptr,
+   char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+extern unsigned long int strtoul (const char *__restrict __nptr,
+      char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+__extension__
+extern long long int strtoq (const char *__restrict __nptr,
+        char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+__extension__
+extern unsigned long long int strtouq (const char *__restrict __nptr,
+           char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+__extension__
+extern long long int strtoll (const char *__restrict __nptr,
+         char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+__extension__
+extern unsigned long long int strtoull (const char *__restrict __nptr,
+     char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 361 "/usr/include/stdlib.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) int
+__attribute__ ((__nothrow__ , __leaf__)) atoi (const char *__nptr)
+{
+  return (int) strtol (__nptr, (char **) ((void *)0), 10);
+}
+extern __inline __attribute__ ((__gnu_inline__)) long int
+__attribute__ ((__nothrow__ , __leaf__)) atol (const char *__nptr)
+{
+  return strtol (__nptr, (char **) ((void *)0), 10);
+}
+
+
+__extension__ extern __inline __attribute__ ((__gnu_inline__)) long long int
+__attribute__ ((__nothrow__ , __leaf__)) atoll (const char *__nptr)
+{
+  return strtoll (__nptr, (char **) ((void *)0), 10);
+}
+# 386 "/usr/include/stdlib.h" 3 4
+extern char *l64a (long int __n) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern long int a64l (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/sys/types.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+
+
+
+
+
+
+typedef __u_char u_char;
+typedef __u_short u_short;
+typedef __u_int u_int;
+typedef __u_long u_long;
+typedef __quad_t quad_t;
+typedef __u_quad_t u_quad_t;
+typedef __fsid_t fsid_t;
+
+
+typedef __loff_t loff_t;
+
+
+
+
+typedef __ino_t ino_t;
+# 59 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+typedef __dev_t dev_t;
+# 69 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+typedef __mode_t mode_t;
+
+
+
+
+typedef __nlink_t nlink_t;
+# 103 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+typedef __id_t id_t;
+# 114 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+typedef __daddr_t daddr_t;
+typedef __caddr_t caddr_t;
+
+
+
+
+
+typedef __key_t key_t;
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h" 1 3 4
+
+
+
+
+
+
+typedef __clock_t clock_t;
+# 127 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h" 1 3 4
+
+
+
+
+
+
+typedef __clockid_t clockid_t;
+# 129 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h" 3 4
+typedef __time_t time_t;
+# 130 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h" 1 3 4
+
+
+
+
+
+
+typedef __timer_t timer_t;
+# 131 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+# 144 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 145 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+typedef unsigned long int ulong;
+typedef unsigned short int ushort;
+typedef unsigned int uint;
+
+
+
+
+
+
+
+typedef __uint8_t u_int8_t;
+typedef __uint16_t u_int16_t;
+typedef __uint32_t u_int32_t;
+typedef __uint64_t u_int64_t;
+
+
+typedef int register_t __attribute__ ((__mode__ (__word__)));
+# 176 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+# 1 "/usr/include/endian.h" 1 3 4
+# 24 "/usr/include/endian.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/endian.h" 1 3 4
+# 35 "/usr/include/x86_64-linux-gnu/bits/endian.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/endianness.h" 1 3 4
+# 36 "/usr/include/x86_64-linux-gnu/bits/endian.h" 2 3 4
+# 25 "/usr/include/endian.h" 2 3 4
+# 35 "/usr/include/endian.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 1 3 4
+# 33 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 3 4
+static __inline __uint16_t
+__bswap_16 (__uint16_t __bsx)
+{
+
+  return __builtin_bswap16 (__bsx);
+
+
+
+}
+
+
+
+
+
+
+static __inline __uint32_t
+__bswap_32 (__uint32_t __bsx)
+{
+
+  return __builtin_bswap32 (__bsx);
+
+
+
+}
+# 69 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 3 4
+__extension__ static __inline __uint64_t
+__bswap_64 (__uint64_t __bsx)
+{
+
+  return __builtin_bswap64 (__bsx);
+
+
+
+}
+# 36 "/usr/include/endian.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h" 1 3 4
+# 32 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h" 3 4
+static __inline __uint16_t
+__uint16_identity (__uint16_t __x)
+{
+  return __x;
+}
+
+static __inline __uint32_t
+__uint32_identity (__uint32_t __x)
+{
+  return __x;
+}
+
+static __inline __uint64_t
+__uint64_identity (__uint64_t __x)
+{
+  return __x;
+}
+# 37 "/usr/include/endian.h" 2 3 4
+# 177 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/sys/select.h" 1 3 4
+# 30 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/select.h" 1 3 4
+# 31 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h" 1 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h" 1 3 4
+
+
+
+
+typedef struct
+{
+  unsigned long int __val[(1024 / (8 * sizeof (unsigned long int)))];
+} __sigset_t;
+# 5 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h" 2 3 4
+
+
+typedef __sigset_t sigset_t;
+# 34 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h" 1 3 4
+
+
+
+
+
+
+
+struct timeval
+{
+
+
+
+
+  __time_t tv_sec;
+  __suseconds_t tv_usec;
+
+};
+# 38 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 1 3 4
+# 11 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 3 4
+struct timespec
+{
+
+
+
+  __time_t tv_sec;
+
+
+
+
+  __syscall_slong_t tv_nsec;
+# 31 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 3 4
+};
+# 40 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+
+
+typedef __suseconds_t suseconds_t;
+
+
+
+
+
+typedef long int __fd_mask;
+# 59 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+typedef struct
+  {
+
+
+
+
+
+
+    __fd_mask __fds_bits[1024 / (8 * (int) sizeof (__fd_mask))];
+
+
+  } fd_set;
+
+
+
+
+
+
+typedef __fd_mask fd_mask;
+# 91 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+
+# 102 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+extern int select (int __nfds, fd_set *__restrict __readfds,
+     fd_set *__restrict __writefds,
+     fd_set *__restrict __exceptfds,
+     struct timeval *__restrict __timeout);
+# 127 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+extern int pselect (int __nfds, fd_set *__restrict __readfds,
+      fd_set *__restrict __writefds,
+      fd_set *__restrict __exceptfds,
+      const struct timespec *__restrict __timeout,
+      const __sigset_t *__restrict __sigmask);
+# 153 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+
+# 180 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+
+
+typedef __blksize_t blksize_t;
+
+
+
+
+
+
+typedef __blkcnt_t blkcnt_t;
+
+
+
+typedef __fsblkcnt_t fsblkcnt_t;
+
+
+
+typedef __fsfilcnt_t fsfilcnt_t;
+# 227 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 1 3 4
+# 44 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 1 3 4
+# 21 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 2 3 4
+# 45 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h" 3 4
+typedef union
+{
+  __extension__ unsigned long long int __value64;
+  struct
+  {
+    unsigned int __low;
+    unsigned int __high;
+  } __value32;
+} __atomic_wide_counter;
+# 47 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+
+
+
+typedef struct __pthread_internal_list
+{
+  struct __pthread_internal_list *__prev;
+  struct __pthread_internal_list *__next;
+} __pthread_list_t;
+
+typedef struct __pthread_internal_slist
+{
+  struct __pthread_internal_slist *__next;
+} __pthread_slist_t;
+# 76 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 3 4
+struct __pthread_mutex_s
+{
+  int __lock;
+  unsigned int __count;
+  int __owner;
+
+  unsigned int __nusers;
+
+
+
+  int __kind;
+
+  short __spins;
+  short __elision;
+  __pthread_list_t __list;
+# 53 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 3 4
+};
+# 77 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+# 89 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 3 4
+struct __pthread_rwlock_arch_t
+{
+  unsigned int __readers;
+  unsigned int __writers;
+  unsigned int __wrphase_futex;
+  unsigned int __writers_futex;
+  unsigned int __pad3;
+  unsigned int __pad4;
+
+  int __cur_writer;
+  int __shared;
+  signed char __rwelision;
+
+
+
+
+  unsigned char __pad1[7];
+
+
+  unsigned long int __pad2;
+
+
+  unsigned int __flags;
+# 55 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 3 4
+};
+# 90 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+
+
+
+struct __pthread_cond_s
+{
+  __atomic_wide_counter __wseq;
+  __atomic_wide_counter __g1_start;
+  unsigned int __g_refs[2] ;
+  unsigned int __g_size[2];
+  unsigned int __g1_orig_size;
+  unsigned int __wrefs;
+  unsigned int __g_signals[2];
+};
+
+typedef unsigned int __tss_t;
+typedef unsigned long int __thrd_t;
+
+typedef struct
+{
+  int __data ;
+} __once_flag;
+# 24 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 2 3 4
+
+
+
+typedef unsigned long int pthread_t;
+
+
+
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_mutexattr_t;
+
+
+
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_condattr_t;
+
+
+
+typedef unsigned int pthread_key_t;
+
+
+
+typedef int pthread_once_t;
+
+
+union pthread_attr_t
+{
+  char __size[56];
+  long int __align;
+};
+
+typedef union pthread_attr_t pthread_attr_t;
+
+
+
+
+typedef union
+{
+  struct __pthread_mutex_s __data;
+  char __size[40];
+  long int __align;
+} pthread_mutex_t;
+
+
+typedef union
+{
+  struct __pthread_cond_s __data;
+  char __size[48];
+  __extension__ long long int __align;
+} pthread_cond_t;
+
+
+
+
+
+typedef union
+{
+  struct __pthread_rwlock_arch_t __data;
+  char __size[56];
+  long int __align;
+} pthread_rwlock_t;
+
+typedef union
+{
+  char __size[8];
+  long int __align;
+} pthread_rwlockattr_t;
+
+
+
+
+
+typedef volatile int pthread_spinlock_t;
+
+
+
+
+typedef union
+{
+  char __size[32];
+  long int __align;
+} pthread_barrier_t;
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_barrierattr_t;
+# 228 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+# 396 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+
+extern long int random (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern void srandom (unsigned int __seed) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern char *initstate (unsigned int __seed, char *__statebuf,
+   size_t __statelen) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern char *setstate (char *__statebuf) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+struct random_data
+  {
+    int32_t *fptr;
+    int32_t *rptr;
+    int32_t *state;
+    int rand_type;
+    int rand_deg;
+    int rand_sep;
+    int32_t *end_ptr;
+  };
+
+extern int random_r (struct random_data *__restrict __buf,
+       int32_t *__restrict __result) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int srandom_r (unsigned int __seed, struct random_data *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+extern int initstate_r (unsigned int __seed, char *__restrict __statebuf,
+   size_t __statelen,
+   struct random_data *__restrict __buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4)));
+
+extern int setstate_r (char *__restrict __statebuf,
+         struct random_data *__restrict __buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+extern int rand (void) __attribute__ ((__nothrow__ , __leaf__));
+
+extern void srand (unsigned int __seed) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int rand_r (unsigned int *__seed) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern double drand48 (void) __attribute__ ((__nothrow__ , __leaf__));
+extern double erand48 (unsigned short int __xsubi[3]) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern long int lrand48 (void) __attribute__ ((__nothrow__ , __leaf__));
+extern long int nrand48 (unsigned short int __xsubi[3])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern long int mrand48 (void) __attribute__ ((__nothrow__ , __leaf__));
+extern long int jrand48 (unsigned short int __xsubi[3])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern void srand48 (long int __seedval) __attribute__ ((__nothrow__ , __leaf__));
+extern unsigned short int *seed48 (unsigned short int __seed16v[3])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+extern void lcong48 (unsigned short int __param[7]) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+struct drand48_data
+  {
+    unsigned short int __x[3];
+    unsigned short int __old_x[3];
+    unsigned short int __c;
+    unsigned short int __init;
+    __extension__ unsigned long long int __a;
+
+  };
+
+
+extern int drand48_r (struct drand48_data *__restrict __buffer,
+        double *__restrict __result) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern int erand48_r (unsigned short int __xsubi[3],
+        struct drand48_data *__restrict __buffer,
+        double *__restrict __result) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int lrand48_r (struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern int nrand48_r (unsigned short int __xsubi[3],
+        struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int mrand48_r (struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern int jrand48_r (unsigned short int __xsubi[3],
+        struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int srand48_r (long int __seedval, struct drand48_data *__buffer)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+extern int seed48_r (unsigned short int __seed16v[3],
+       struct drand48_data *__buffer) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int lcong48_r (unsigned short int __param[7],
+        struct drand48_data *__buffer)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern __uint32_t arc4random (void)
+     __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern void arc4random_buf (void *__buf, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern __uint32_t arc4random_uniform (__uint32_t __upper_bound)
+     __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern void *malloc (size_t __size) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__))
+     __attribute__ ((__alloc_size__ (1))) ;
+
+extern void *calloc (size_t __nmemb, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__alloc_size__ (1, 2))) ;
+
+
+
+
+
+
+extern void *realloc (void *__ptr, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__warn_unused_result__)) __attribute__ ((__alloc_size__ (2)));
+
+
+extern void free (void *__ptr) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern void *reallocarray (void *__ptr, size_t __nmemb, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__warn_unused_result__))
+     __attribute__ ((__alloc_size__ (2, 3)))
+    __attribute__ ((__malloc__ (__builtin_free, 1)));
+
+
+extern void *reallocarray (void *__ptr, size_t __nmemb, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__ (reallocarray, 1)));
+
+
+
+# 1 "/usr/include/alloca.h" 1 3 4
+# 24 "/usr/include/alloca.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 25 "/usr/include/alloca.h" 2 3 4
+
+
+
+
+
+
+
+extern void *alloca (size_t __size) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+# 588 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+extern void *valloc (size_t __size) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__))
+     __attribute__ ((__alloc_size__ (1))) ;
+
+
+
+
+extern int posix_memalign (void **__memptr, size_t __alignment, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+extern void *aligned_alloc (size_t __alignment, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__alloc_align__ (1)))
+     __attribute__ ((__alloc_size__ (2))) ;
+
+
+
+extern void abort (void) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+extern int atexit (void (*__func) (void)) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+extern int at_quick_exit (void (*__func) (void)) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int on_exit (void (*__func) (int __status, void *__arg), void *__arg)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern void exit (int __status) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+
+
+extern void quick_exit (int __status) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+
+
+extern void _Exit (int __status) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+
+extern char *getenv (const char *__name) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 667 "/usr/include/stdlib.h" 3 4
+extern int putenv (char *__string) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern int setenv (const char *__name, const char *__value, int __replace)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+extern int unsetenv (const char *__name) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int clearenv (void) __attribute__ ((__nothrow__ , __leaf__));
+# 695 "/usr/include/stdlib.h" 3 4
+extern char *mktemp (char *__template) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 708 "/usr/include/stdlib.h" 3 4
+extern int mkstemp (char *__template) __attribute__ ((__nonnull__ (1))) ;
+# 730 "/usr/include/stdlib.h" 3 4
+extern int mkstemps (char *__template, int __suffixlen) __attribute__ ((__nonnull__ (1))) ;
+# 751 "/usr/include/stdlib.h" 3 4
+extern char *mkdtemp (char *__template) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 804 "/usr/include/stdlib.h" 3 4
+extern int system (const char *__command) ;
+# 821 "/usr/include/stdlib.h" 3 4
+extern char *realpath (const char *__restrict __name,
+         char *__restrict __resolved) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+
+typedef int (*__compar_fn_t) (const void *, const void *);
+# 841 "/usr/include/stdlib.h" 3 4
+extern void *bsearch (const void *__key, const void *__base,
+        size_t __nmemb, size_t __size, __compar_fn_t __compar)
+     __attribute__ ((__nonnull__ (1, 2, 5))) ;
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) void *
+bsearch (const void *__key, const void *__base, size_t __nmemb, size_t __size,
+  __compar_fn_t __compar)
+{
+  size_t __l, __u, __idx;
+  const void *__p;
+  int __comparison;
+
+  __l = 0;
+  __u = __nmemb;
+  while (__l < __u)
+    {
+      __idx = (__l + __u) / 2;
+      __p = (const void *) (((const char *) __base) + (__idx * __size));
+      __comparison = (*__compar) (__key, __p);
+      if (__comparison < 0)
+ __u = __idx;
+      else if (__comparison > 0)
+ __l = __idx + 1;
+      else
+ {
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wcast-qual"
+
+   return (void *) __p;
+
+#pragma GCC diagnostic pop
+
+ }
+    }
+
+  return ((void *)0);
+}
+# 847 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+extern void qsort (void *__base, size_t __nmemb, size_t __size,
+     __compar_fn_t __compar) __attribute__ ((__nonnull__ (1, 4)));
+# 861 "/usr/include/stdlib.h" 3 4
+extern int abs (int __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+extern long int labs (long int __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+
+
+__extension__ extern long long int llabs (long long int __x)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+
+
+
+
+
+
+extern div_t div (int __numer, int __denom)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+extern ldiv_t ldiv (long int __numer, long int __denom)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+
+
+__extension__ extern lldiv_t lldiv (long long int __numer,
+        long long int __denom)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+# 893 "/usr/include/stdlib.h" 3 4
+extern char *ecvt (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+
+
+
+
+extern char *fcvt (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+
+
+
+
+extern char *gcvt (double __value, int __ndigit, char *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3))) ;
+
+
+
+
+extern char *qecvt (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+extern char *qfcvt (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+extern char *qgcvt (long double __value, int __ndigit, char *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3))) ;
+
+
+
+
+extern int ecvt_r (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign, char *__restrict __buf,
+     size_t __len) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+extern int fcvt_r (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign, char *__restrict __buf,
+     size_t __len) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+
+extern int qecvt_r (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign,
+      char *__restrict __buf, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+extern int qfcvt_r (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign,
+      char *__restrict __buf, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+
+
+
+
+
+extern int mblen (const char *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int mbtowc (wchar_t *__restrict __pwc,
+     const char *__restrict __s, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int wctomb (char *__s, wchar_t __wchar) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern size_t mbstowcs (wchar_t *__restrict __pwcs,
+   const char *__restrict __s, size_t __n) __attribute__ ((__nothrow__ , __leaf__))
+    __attribute__ ((__access__ (__read_only__, 2)));
+
+extern size_t wcstombs (char *__restrict __s,
+   const wchar_t *__restrict __pwcs, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__access__ (__write_only__, 1, 3)))
+  __attribute__ ((__access__ (__read_only__, 2)));
+
+
+
+
+
+
+extern int rpmatch (const char *__response) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 980 "/usr/include/stdlib.h" 3 4
+extern int getsubopt (char **__restrict __optionp,
+        char *const *__restrict __tokens,
+        char **__restrict __valuep)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2, 3))) ;
+# 1026 "/usr/include/stdlib.h" 3 4
+extern int getloadavg (double __loadavg[], int __nelem)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 1036 "/usr/include/stdlib.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) double
+__attribute__ ((__nothrow__ , __leaf__)) atof (const char *__nptr)
+{
+  return strtod (__nptr, (char **) ((void *)0));
+}
+# 1037 "/usr/include/stdlib.h" 2 3 4
+# 1048 "/usr/include/stdlib.h" 3 4
+
+# 22 "src/cpu/tcache.c" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 145 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long int ptrdiff_t;
+# 424 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef struct {
+  long long __max_align_ll __attribute__((__aligned__(__alignof__(long long))));
+  long double __max_align_ld __attribute__((__aligned__(__alignof__(long double))));
+# 435 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+} max_align_t;
+# 23 "src/cpu/tcache.c" 2
+# 1 "/usr/include/assert.h" 1 3 4
+# 24 "src/cpu/tcache.c" 2
+# 37 "src/cpu/tcache.c"
+_Static_assert
+# 37 "src/cpu/tcache.c"
+            (
+# 37 "src/cpu/tcache.c" 3 4
+             __builtin_offsetof (
+# 37 "src/cpu/tcache.c"
+             Decode
+# 37 "src/cpu/tcache.c" 3 4
+             , 
+# 37 "src/cpu/tcache.c"
+             snpc
+# 37 "src/cpu/tcache.c" 3 4
+             ) 
+# 37 "src/cpu/tcache.c"
+                                    <= 64, "hot fields of Decode exceed a cache line");
+
+
+
+
+
+
+typedef struct bb_t {
+  Decode *s;
+  paddr_t paddr;
+  int mmu_state;
+  
+# 48 "src/cpu/tcache.c" 3 4
+ _Bool 
+# 48 "src/cpu/tcache.c"
+      single_epoch;
+} bb_t;
+
+
+
+
+enum { BB_RECORD_TYPE_NTAKEN = 1, BB_RECORD_TYPE_TAKEN };
+
+static Decode tcache_pool[8192] = {};
+static int tc_idx = 0;
+static int tc_region = 0;
+static Decode tcache_bb_pool[(8192 / 4 + 2)] = {};
+static Decode *tcache_bb_freelist = 
+# 60 "src/cpu/tcache.c" 3 4
+                                              ((void *)0)
+# 60 "src/cpu/tcache.c"
+                                                  ;
+static int tcache_bb_nr_free = 0;
+
+
+
+
+static vaddr_t *bb_pc = 
+# 66 "src/cpu/tcache.c" 3 4
+                                  ((void *)0)
+# 66 "src/cpu/tcache.c"
+                                      ;
+static bb_t *bb_table = 
+# 67 "src/cpu/tcache.c" 3 4
+                                  ((void *)0)
+# 67 "src/cpu/tcache.c"
+                                      ;
+static uint32_t bb_cap = 0;
+static uint32_t bb_nr = 0;
+static const void *g_exec_nemu_decode;
+ uint32_t g_tcache_epoch = 0;
+
+
+
+
+
+typedef struct {
+  Decode *site;
+  Decode *target;
+} jr_entry_t;
+
+static jr_entry_t jr_site_cache[512][4] = {};
+static Decode *jr_target_cache[4096] = {};
+
+
+
+
+
+
+static uint64_t nr_region_evict = 0; static uint64_t nr_bb_evict = 0; static uint64_t nr_flush = 0; static uint64_t nr_validate = 0; static uint64_t nr_page_invalidate = 0; static uint64_t nr_trace = 0; static uint64_t nr_jr_site_hit = 0; static uint64_t nr_jr_target_hit = 0; static uint64_t nr_jr_miss = 0; static uint64_t nr_bb_lookup = 0; static uint64_t nr_bb_probe = 0; static uint64_t nr_bb_grow = 0;
+;
+;
+
+
+static inline int tcache_region_idx(int region) {
+  return (int64_t)region * 8192 / 4;
+}
+
+static inline Decode* tcache_entry_init(Decode *s, vaddr_t pc) {
+  s->tnext = s->ntnext = 
+# 100 "src/cpu/tcache.c" 3 4
+                        ((void *)0)
+# 100 "src/cpu/tcache.c"
+                            ;
+  s->type = 0;
+  s->idx_in_bb = 1;
+  s->epoch = g_tcache_epoch;
+  s->exec_cnt = 0;
+  s->bbv_id = 0;
+  s->rnext = 
+# 106 "src/cpu/tcache.c" 3 4
+            ((void *)0)
+# 106 "src/cpu/tcache.c"
+                ;
+  ;
+  s->pc = pc;
+  s->EHelper = g_exec_nemu_decode;
+  return s;
+}
+
+static inline Decode* tcache_new(vaddr_t pc) {
+  int region_end = tcache_region_idx(tc_region + 1);
+  if (tc_idx == region_end) return 
+# 115 "src/cpu/tcache.c" 3 4
+                                  ((void *)0)
+# 115 "src/cpu/tcache.c"
+                                      ;
+  
+# 116 "src/cpu/tcache.c" 3 4
+ ((void) sizeof ((
+# 116 "src/cpu/tcache.c"
+ tc_idx < region_end
+# 116 "src/cpu/tcache.c" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 116 "src/cpu/tcache.c"
+ tc_idx < region_end
+# 116 "src/cpu/tcache.c" 3 4
+ ) ; else __assert_fail (
+# 116 "src/cpu/tcache.c"
+ "tc_idx < region_end"
+# 116 "src/cpu/tcache.c" 3 4
+ , "src/cpu/tcache.c", 116, __extension__ __PRETTY_FUNCTION__); }))
+# 116 "src/cpu/tcache.c"
+                            ;
+  Decode *s = &tcache_pool[tc_idx];
+  tc_idx ++;
+  return tcache_entry_init(s, pc);
+}
+# 131 "src/cpu/tcache.c"
+static inline Decode* tcache_bb_new(vaddr_t pc) {
+  Decode *s = tcache_bb_freelist;
+  
+# 133 "src/cpu/tcache.c" 3 4
+ ((void) sizeof ((
+# 133 "src/cpu/tcache.c"
+ s != 
+# 133 "src/cpu/tcache.c" 3 4
+ ((void *)0)) ? 1 : 0), __extension__ ({ if (
+# 133 "src/cpu/tcache.c"
+ s != 
+# 133 "src/cpu/tcache.c" 3 4
+ ((void *)0)) ; else __assert_fail (
+# 133 "src/cpu/tcache.c"
+ "s != NULL"
+# 133 "src/cpu/tcache.c" 3 4
+ , "src/cpu/tcache.c", 133, __extension__ __PRETTY_FUNCTION__); }))
+# 133 "src/cpu/tcache.c"
+                  ;
+  do { int idx = s - tcache_bb_pool; do { if (!(idx >= 0 && idx < (8192 / 4 + 2))) { fflush(
+# 134 "src/cpu/tcache.c" 3 4
+ stdout
+# 134 "src/cpu/tcache.c"
+ ); fprintf(
+# 134 "src/cpu/tcache.c" 3 4
+ stderr
+# 134 "src/cpu/tcache.c"
+ , "\33[1;31m"); fprintf(
+# 134 "src/cpu/tcache.c" 3 4
+ stderr
+# 134 "src/cpu/tcache.c"
+ , "idx = %d, s = %p", idx, s); fprintf(
+# 134 "src/cpu/tcache.c" 3 4
+ stderr
+# 134 "src/cpu/tcache.c"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 134 "src/cpu/tcache.c" 3 4
+ ((void) sizeof ((
+# 134 "src/cpu/tcache.c"
+ idx >= 0 && idx < (8192 / 4 + 2)
+# 134 "src/cpu/tcache.c" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 134 "src/cpu/tcache.c"
+ idx >= 0 && idx < (8192 / 4 + 2)
+# 134 "src/cpu/tcache.c" 3 4
+ ) ; else __assert_fail (
+# 134 "src/cpu/tcache.c"
+ "idx >= 0 && idx < (8192 / 4 + 2)"
+# 134 "src/cpu/tcache.c" 3 4
+ , "src/cpu/tcache.c", 134, __extension__ __PRETTY_FUNCTION__); }))
+# 134 "src/cpu/tcache.c"
+ ; } } while (0); } while (0);
+  do { int idx = tcache_bb_freelist->tnext - tcache_bb_pool; do { if (!(idx >= 0 && idx < (8192 / 4 + 2))) { fflush(
+# 135 "src/cpu/tcache.c" 3 4
+ stdout
+# 135 "src/cpu/tcache.c"
+ ); fprintf(
+# 135 "src/cpu/tcache.c" 3 4
+ stderr
+# 135 "src/cpu/tcache.c"
+ , "\33[1;31m"); fprintf(
+# 135 "src/cpu/tcache.c" 3 4
+ stderr
+# 135 "src/cpu/tcache.c"
+ , "idx = %d, s = %p", idx, tcache_bb_freelist->tnext); fprintf(
+# 135 "src/cpu/tcache.c" 3 4
+ stderr
+# 135 "src/cpu/tcache.c"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 135 "src/cpu/tcache.c" 3 4
+ ((void) sizeof ((
+# 135 "src/cpu/tcache.c"
+ idx >= 0 && idx < (8192 / 4 + 2)
+# 135 "src/cpu/tcache.c" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 135 "src/cpu/tcache.c"
+ idx >= 0 && idx < (8192 / 4 + 2)
+# 135 "src/cpu/tcache.c" 3 4
+ ) ; else __assert_fail (
+# 135 "src/cpu/tcache.c"
+ "idx >= 0 && idx < (8192 / 4 + 2)"
+# 135 "src/cpu/tcache.c" 3 4
+ , "src/cpu/tcache.c", 135, __extension__ __PRETTY_FUNCTION__); }))
+# 135 "src/cpu/tcache.c"
+ ; } } while (0); } while (0);
+  tcache_bb_freelist = tcache_bb_freelist->tnext;
+  do { int idx = tcache_bb_freelist - tcache_bb_pool; do { if (!(idx >= 0 && idx < (8192 / 4 + 2))) { fflush(
+# 137 "src/cpu/tcache.c" 3 4
+ stdout
+# 137 "src/cpu/tcache.c"
+ ); fprintf(
+# 137 "src/cpu/tcache.c" 3 4
+ stderr
+# 137 "src/cpu/tcache.c"
+ , "\33[1;31m"); fprintf(
+# 137 "src/cpu/tcache.c" 3 4
+ stderr
+# 137 "src/cpu/tcache.c"
+ , "idx = %d, s = %p", idx, tcache_bb_freelist); fprintf(
+# 137 "src/cpu/tcache.c" 3 4
+ stderr
+# 137 "src/cpu/tcache.c"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 137 "src/cpu/tcache.c" 3 4
+ ((void) sizeof ((
+# 137 "src/cpu/tcache.c"
+ idx >= 0 && idx < (8192 / 4 + 2)
+# 137 "src/cpu/tcache.c" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 137 "src/cpu/tcache.c"
+ idx >= 0 && idx < (8192 / 4 + 2)
+# 137 "src/cpu/tcache.c" 3 4
+ ) ; else __assert_fail (
+# 137 "src/cpu/tcache.c"
+ "idx >= 0 && idx < (8192 / 4 + 2)"
+# 137 "src/cpu/tcache.c" 3 4
+ , "src/cpu/tcache.c", 137, __extension__ __PRETTY_FUNCTION__); }))
+# 137 "src/cpu/tcache.c"
+ ; } } while (0); } while (0);
+  do { int idx = tcache_bb_freelist->tnext - tcache_bb_pool; do { if (!(idx >= 0 && idx < (8192 / 4 + 2))) { fflush(
+# 138 "src/cpu/tcache.c" 3 4
+ stdout
+# 138 "src/cpu/tcache.c"
+ ); fprintf(
+# 138 "src/cpu/tcache.c" 3 4
+ stderr
+# 138 "src/cpu/tcache.c"
+ , "\33[1;31m"); fprintf(
+# 138 "src/cpu/tcache.c" 3 4
+ stderr
+# 138 "src/cpu/tcache.c"
+ , "idx = %d, s = %p", idx, tcache_bb_freelist->tnext); fprintf(
+# 138 "src/cpu/tcache.c" 3 4
+ stderr
+# 138 "src/cpu/tcache.c"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 138 "src/cpu/tcache.c" 3 4
+ ((void) sizeof ((
+# 138 "src/cpu/tcache.c"
+ idx >= 0 && idx < (8192 / 4 + 2)
+# 138 "src/cpu/tcache.c" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 138 "src/cpu/tcache.c"
+ idx >= 0 && idx < (8192 / 4 + 2)
+# 138 "src/cpu/tcache.c" 3 4
+ ) ; else __assert_fail (
+# 138 "src/cpu/tcache.c"
+ "idx >= 0 && idx < (8192 / 4 + 2)"
+# 138 "src/cpu/tcache.c" 3 4
+ , "src/cpu/tcache.c", 138, __extension__ __PRETTY_FUNCTION__); }))
+# 138 "src/cpu/tcache.c"
+ ; } } while (0); } while (0);
+  tcache_bb_nr_free --;
+  return tcache_entry_init(s, pc);
+}
+
+static inline void tcache_bb_free(Decode *s) {
+  do { int idx = s - tcache_bb_pool; do { if (!(idx >= 0 && idx < (8192 / 4 + 2))) { fflush(
+# 144 "src/cpu/tcache.c" 3 4
+ stdout
+# 144 "src/cpu/tcache.c"
+ ); fprintf(
+# 144 "src/cpu/tcache.c" 3 4
+ stderr
+# 144 "src/cpu/tcache.c"
+ , "\33[1;31m"); fprintf(
+# 144 "src/cpu/tcache.c" 3 4
+ stderr
+# 144 "src/cpu/tcache.c"
+ , "idx = %d, s = %p", idx, s); fprintf(
+# 144 "src/cpu/tcache.c" 3 4
+ stderr
+# 144 "src/cpu/tcache.c"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 144 "src/cpu/tcache.c" 3 4
+ ((void) sizeof ((
+# 144 "src/cpu/tcache.c"
+ idx >= 0 && idx < (8192 / 4 + 2)
+# 144 "src/cpu/tcache.c" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 144 "src/cpu/tcache.c"
+ idx >= 0 && idx < (8192 / 4 + 2)
+# 144 "src/cpu/tcache.c" 3 4
+ ) ; else __assert_fail (
+# 144 "src/cpu/tcache.c"
+ "idx >= 0 && idx < (8192 / 4 + 2)"
+# 144 "src/cpu/tcache.c" 3 4
+ , "src/cpu/tcache.c", 144, __extension__ __PRETTY_FUNCTION__); }))
+# 144 "src/cpu/tcache.c"
+ ; } } while (0); } while (0);
+  do { int idx = tcache_bb_freelist - tcache_bb_pool; do { if (!(idx >= 0 && idx < (8192 / 4 + 2))) { fflush(
+# 145 "src/cpu/tcache.c" 3 4
+ stdout
+# 145 "src/cpu/tcache.c"
+ ); fprintf(
+# 145 "src/cpu/tcache.c" 3 4
+ stderr
+# 145 "src/cpu/tcache.c"
+ , "\33[1;31m"); fprintf(
+# 145 "src/cpu/tcache.c" 3 4
+ stderr
+# 145 "src/cpu/tcache.c"
+ , "idx = %d, s = %p", idx, tcache_bb_freelist); fprintf(
+# 145 "src/cpu/tcache.c" 3 4
+ stderr
+# 145 "src/cpu/tcache.c"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 145 "src/cpu/tcache.c" 3 4
+ ((void) sizeof ((
+# 145 "src/cpu/tcache.c"
+ idx >= 0 && idx < (8192 / 4 + 2)
+# 145 "src/cpu/tcache.c" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 145 "src/cpu/tcache.c"
+ idx >= 0 && idx < (8192 / 4 + 2)
+# 145 "src/cpu/tcache.c" 3 4
+ ) ; else __assert_fail (
+# 145 "src/cpu/tcache.c"
+ "idx >= 0 && idx < (8192 / 4 + 2)"
+# 145 "src/cpu/tcache.c" 3 4
+ , "src/cpu/tcache.c", 145, __extension__ __PRETTY_FUNCTION__); }))
+# 145 "src/cpu/tcache.c"
+ ; } } while (0); } while (0);
+  s->type = 0;
+  s->tnext = tcache_bb_freelist;
+  tcache_bb_freelist = s;
+  tcache_bb_nr_free ++;
+  do { int idx = tcache_bb_freelist->tnext - tcache_bb_pool; do { if (!(idx >= 0 && idx < (8192 / 4 + 2))) { fflush(
+# 150 "src/cpu/tcache.c" 3 4
+ stdout
+# 150 "src/cpu/tcache.c"
+ ); fprintf(
+# 150 "src/cpu/tcache.c" 3 4
+ stderr
+# 150 "src/cpu/tcache.c"
+ , "\33[1;31m"); fprintf(
+# 150 "src/cpu/tcache.c" 3 4
+ stderr
+# 150 "src/cpu/tcache.c"
+ , "idx = %d, s = %p", idx, tcache_bb_freelist->tnext); fprintf(
+# 150 "src/cpu/tcache.c" 3 4
+ stderr
+# 150 "src/cpu/tcache.c"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 150 "src/cpu/tcache.c" 3 4
+ ((void) sizeof ((
+# 150 "src/cpu/tcache.c"
+ idx >= 0 && idx < (8192 / 4 + 2)
+# 150 "src/cpu/tcache.c" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 150 "src/cpu/tcache.c"
+ idx >= 0 && idx < (8192 / 4 + 2)
+# 150 "src/cpu/tcache.c" 3 4
+ ) ; else __assert_fail (
+# 150 "src/cpu/tcache.c"
+ "idx >= 0 && idx < (8192 / 4 + 2)"
+# 150 "src/cpu/tcache.c" 3 4
+ , "src/cpu/tcache.c", 150, __extension__ __PRETTY_FUNCTION__); }))
+# 150 "src/cpu/tcache.c"
+ ; } } while (0); } while (0);
+}
+
+
+static inline int tcache_mmu_state() {
+  return get_data_mmu_state();
+}
+
+static inline uint32_t bb_hash(vaddr_t pc) {
+
+  return ((pc / 2) * 0x9e3779b97f4a7c15ull) >> 32 & (bb_cap - 1);
+}
+
+static inline uint32_t bb_idx(bb_t *bb) {
+  return bb - bb_table;
+}
+
+
+static uint32_t bb_table_put(vaddr_t pc, const bb_t *bb) {
+  uint32_t i;
+  for (i = bb_hash(pc); bb_pc[i] != ((vaddr_t)-1ul); i = (i + 1) & (bb_cap - 1));
+  bb_pc[i] = pc;
+  bb_table[i] = *bb;
+  bb_nr ++;
+  return i;
+}
+
+static void bb_table_alloc(uint32_t cap) {
+  bb_pc = malloc(sizeof(bb_pc[0]) * cap);
+  bb_table = malloc(sizeof(bb_table[0]) * cap);
+  
+# 180 "src/cpu/tcache.c" 3 4
+ ((void) sizeof ((
+# 180 "src/cpu/tcache.c"
+ bb_pc != 
+# 180 "src/cpu/tcache.c" 3 4
+ ((void *)0) 
+# 180 "src/cpu/tcache.c"
+ && bb_table != 
+# 180 "src/cpu/tcache.c" 3 4
+ ((void *)0)) ? 1 : 0), __extension__ ({ if (
+# 180 "src/cpu/tcache.c"
+ bb_pc != 
+# 180 "src/cpu/tcache.c" 3 4
+ ((void *)0) 
+# 180 "src/cpu/tcache.c"
+ && bb_table != 
+# 180 "src/cpu/tcache.c" 3 4
+ ((void *)0)) ; else __assert_fail (
+# 180 "src/cpu/tcache.c"
+ "bb_pc != NULL && bb_table != NULL"
+# 180 "src/cpu/tcache.c" 3 4
+ , "src/cpu/tcache.c", 180, __extension__ __PRETTY_FUNCTION__); }))
+# 180 "src/cpu/tcache.c"
+                                          ;
+  memset(bb_pc, -1, sizeof(bb_pc[0]) * cap);
+  bb_cap = cap;
+  bb_nr = 0;
+}
+
+static void bb_table_grow() {
+  vaddr_t *old_pc = bb_pc;
+  bb_t *old_table = bb_table;
+  uint32_t old_cap = bb_cap;
+  bb_table_alloc(old_cap * 2);
+
+
+  uint32_t empty, i;
+  for (empty = 0; old_pc[empty] != ((vaddr_t)-1ul); empty ++);
+  for (i = 1; i <= old_cap; i ++) {
+    uint32_t idx = (empty + i) & (old_cap - 1);
+    if (old_pc[idx] != ((vaddr_t)-1ul)) { bb_table_put(old_pc[idx], &old_table[idx]); }
+  }
+  free(old_pc);
+  free(old_table);
+  nr_bb_grow ++;
+}
+
+
+static inline bb_t* bb_promote(uint32_t first, uint32_t i) {
+  if (first != i) {
+    bb_t tmp = bb_table[i];
+    bb_table[i] = bb_table[first];
+    bb_table[first] = tmp;
+  }
+  return &bb_table[first];
+}
+
+static bb_t* bb_insert(vaddr_t pc, paddr_t paddr, int mmu_state, 
+# 214 "src/cpu/tcache.c" 3 4
+                                                                _Bool 
+# 214 "src/cpu/tcache.c"
+                                                                     single_epoch, Decode *fill) {
+  if ((bb_nr + 1) * 2 > bb_cap) { bb_table_grow(); }
+  bb_t bb = { .s = fill, .paddr = paddr, .mmu_state = mmu_state, .single_epoch = single_epoch };
+  uint32_t i = bb_table_put(pc, &bb);
+  uint32_t first;
+  for (first = bb_hash(pc); bb_pc[first] != pc; first = (first + 1) & (bb_cap - 1));
+  return bb_promote(first, i);
+}
+
+static inline 
+# 223 "src/cpu/tcache.c" 3 4
+             _Bool 
+# 223 "src/cpu/tcache.c"
+                  bb_match(bb_t *bb, paddr_t paddr, int mmu_state) {
+  return paddr == ((paddr_t)-1ul) || (bb->paddr == paddr && bb->mmu_state == mmu_state);
+}
+
+
+static bb_t* bb_find(vaddr_t pc, paddr_t paddr, int mmu_state) {
+  uint32_t i, first = 
+# 229 "src/cpu/tcache.c" 3 4
+                     (4294967295U)
+# 229 "src/cpu/tcache.c"
+                               ;
+  nr_bb_lookup ++;
+  for (i = bb_hash(pc); bb_pc[i] != ((vaddr_t)-1ul); i = (i + 1) & (bb_cap - 1)) {
+    nr_bb_probe ++;
+    if (bb_pc[i] != pc) continue;
+    if (first == 
+# 234 "src/cpu/tcache.c" 3 4
+                (4294967295U)
+# 234 "src/cpu/tcache.c"
+                          ) { first = i; }
+    if (bb_match(&bb_table[i], paddr, mmu_state)) return bb_promote(first, i);
+  }
+  return 
+# 237 "src/cpu/tcache.c" 3 4
+        ((void *)0)
+# 237 "src/cpu/tcache.c"
+            ;
+}
+
+
+
+static void bb_remove(bb_t *bb) {
+  uint32_t hole = bb_idx(bb), i = hole;
+  bb_pc[hole] = ((vaddr_t)-1ul);
+  bb_nr --;
+  while (
+# 246 "src/cpu/tcache.c" 3 4
+        1
+# 246 "src/cpu/tcache.c"
+            ) {
+    i = (i + 1) & (bb_cap - 1);
+    if (bb_pc[i] == ((vaddr_t)-1ul)) return;
+
+    uint32_t home = bb_hash(bb_pc[i]);
+    if (((i - home) & (bb_cap - 1)) >= ((i - hole) & (bb_cap - 1))) {
+      bb_pc[hole] = bb_pc[i];
+      bb_table[hole] = bb_table[i];
+      bb_pc[i] = ((vaddr_t)-1ul);
+      hole = i;
+    }
+  }
+}
+
+
+
+
+static inline 
+# 263 "src/cpu/tcache.c" 3 4
+             _Bool 
+# 263 "src/cpu/tcache.c"
+                  bb_is_valid(bb_t *bb) {
+  return !bb->single_epoch || bb->s->epoch == g_tcache_epoch;
+}
+
+static void tcache_bb_fetch(Decode *_this, int is_taken, vaddr_t jpc) {
+
+  bb_t* bb = bb_find(jpc, ((paddr_t)-1ul), 0);
+  if (bb != 
+# 270 "src/cpu/tcache.c" 3 4
+           ((void *)0)
+# 270 "src/cpu/tcache.c"
+               ) {
+    if (is_taken) { _this->tnext = bb->s; }
+    else { _this->ntnext = bb->s; }
+  } else {
+    Decode *ret = tcache_bb_new(jpc);
+    if (is_taken) { ret->type = BB_RECORD_TYPE_TAKEN; _this->tnext = ret; }
+    else { ret->type = BB_RECORD_TYPE_NTAKEN; _this->ntnext = ret; }
+    ret->bb_src = _this;
+  }
+}
+
+static inline 
+# 281 "src/cpu/tcache.c" 3 4
+             _Bool 
+# 281 "src/cpu/tcache.c"
+                  tcache_in_range(Decode *s, Decode *start, Decode *end) {
+  return s >= start && s < end;
+}
+
+static inline jr_entry_t* jr_site_set(Decode *site) {
+  return jr_site_cache[(uintptr_t)(site - tcache_pool) % 512];
+}
+
+static inline Decode** jr_target_slot(vaddr_t pc) {
+  return &jr_target_cache[(pc / 2) % 4096];
+}
+
+static inline void jr_site_insert(Decode *site, Decode *target) {
+  jr_entry_t *set = jr_site_set(site);
+  memmove(&set[1], &set[0], sizeof(set[0]) * (4 - 1));
+  set[0] = (jr_entry_t){ .site = site, .target = target };
+}
+
+
+static Decode* jr_cache_find(Decode *site, vaddr_t jpc) {
+  jr_entry_t *set = jr_site_set(site);
+  int i;
+  for (i = 0; i < 4; i ++) {
+    if (set[i].site == site && set[i].target->pc == jpc) {
+      jr_entry_t e = set[i];
+      memmove(&set[1], &set[0], sizeof(set[0]) * i);
+      set[0] = e;
+      nr_jr_site_hit ++;
+      return e.target;
+    }
+  }
+  Decode *target = *jr_target_slot(jpc);
+  if (target != 
+# 313 "src/cpu/tcache.c" 3 4
+               ((void *)0) 
+# 313 "src/cpu/tcache.c"
+                    && target->pc == jpc) {
+    jr_site_insert(site, target);
+    nr_jr_target_hit ++;
+    return target;
+  }
+  return 
+# 318 "src/cpu/tcache.c" 3 4
+        ((void *)0)
+# 318 "src/cpu/tcache.c"
+            ;
+}
+
+static void jr_cache_insert(Decode *site, Decode *target) {
+  Decode *pool_end = tcache_pool + 8192;
+  if (!tcache_in_range(site, tcache_pool, pool_end) ||
+      !tcache_in_range(target, tcache_pool, pool_end)) return;
+  jr_site_insert(site, target);
+  *jr_target_slot(target->pc) = target;
+}
+
+
+static void jr_cache_evict(Decode *start, Decode *end) {
+  int i, j;
+  for (i = 0; i < 512; i ++) {
+    jr_entry_t *set = jr_site_cache[i];
+    for (j = 0; j < 4; j ++) {
+      if (tcache_in_range(set[j].site, start, end) || tcache_in_range(set[j].target, start, end)) {
+        set[j].site = 
+# 336 "src/cpu/tcache.c" 3 4
+                     ((void *)0)
+# 336 "src/cpu/tcache.c"
+                         ;
+      }
+    }
+  }
+  for (i = 0; i < 4096; i ++) {
+    if (tcache_in_range(jr_target_cache[i], start, end)) jr_target_cache[i] = 
+# 341 "src/cpu/tcache.c" 3 4
+                                                                             ((void *)0)
+# 341 "src/cpu/tcache.c"
+                                                                                 ;
+  }
+}
+
+
+static uint64_t bb_remove_if(
+# 346 "src/cpu/tcache.c" 3 4
+                            _Bool 
+# 346 "src/cpu/tcache.c"
+                                 (*cond)(bb_t *bb, const void *arg), const void *arg) {
+  uint64_t nr_remove = 0;
+  uint32_t i = 0;
+  while (i < bb_cap) {
+    if (bb_pc[i] != ((vaddr_t)-1ul) && cond(&bb_table[i], arg)) {
+
+      bb_remove(&bb_table[i]);
+      nr_remove ++;
+    } else {
+      i ++;
+    }
+  }
+  return nr_remove;
+}
+
+static 
+# 361 "src/cpu/tcache.c" 3 4
+      _Bool 
+# 361 "src/cpu/tcache.c"
+           bb_in_range(bb_t *bb, const void *arg) {
+  Decode * const *range = arg;
+  return tcache_in_range(bb->s, range[0], range[1]);
+}
+
+static 
+# 366 "src/cpu/tcache.c" 3 4
+      _Bool 
+# 366 "src/cpu/tcache.c"
+           bb_in_page(bb_t *bb, const void *arg) {
+  return (bb->paddr & ~(paddr_t)((1ul << 12) - 1)) == *(const paddr_t *)arg;
+}
+
+
+static void bb_evict(Decode *start, Decode *end) {
+  Decode *range[2] = { start, end };
+  nr_bb_evict += bb_remove_if(bb_in_range, range);
+}
+
+enum { TCACHE_BB_BUILDING, TCACHE_RUNNING };
+static int tcache_state = TCACHE_RUNNING;
+static Decode *bb_now = 
+# 378 "src/cpu/tcache.c" 3 4
+                                  ((void *)0)
+# 378 "src/cpu/tcache.c"
+                                      , *bb_now_record = 
+# 378 "src/cpu/tcache.c" 3 4
+                                                         ((void *)0)
+# 378 "src/cpu/tcache.c"
+                                                             ;
+static paddr_t bb_now_paddr = 0;
+static int bb_now_mmu_state = 0;
+static uint32_t bb_now_epoch = 0;
+static 
+# 382 "src/cpu/tcache.c" 3 4
+                 _Bool 
+# 382 "src/cpu/tcache.c"
+                      bb_now_single_epoch = 
+# 382 "src/cpu/tcache.c" 3 4
+                                            0
+# 382 "src/cpu/tcache.c"
+                                                 ;
+
+void ras_evict(Decode *start, Decode *end);
+void ras_flush();
+
+
+
+
+
+static 
+# 391 "src/cpu/tcache.c" 3 4
+      _Bool 
+# 391 "src/cpu/tcache.c"
+           tcache_evict_region(int region) {
+  Decode *start = &tcache_pool[tcache_region_idx(region)];
+  Decode *end = &tcache_pool[tcache_region_idx(region + 1)];
+  Decode *s;
+
+  bb_evict(start, end);
+  jr_cache_evict(start, end);
+  ras_evict(start, end);
+
+
+
+  for (s = tcache_bb_pool; s < tcache_bb_pool + (8192 / 4 + 2); s ++) {
+    if (s->type != 0 && tcache_in_range(s->bb_src, start, end)) {
+      if (s == bb_now_record) { s->type = 0; }
+      else { tcache_bb_free(s); }
+    }
+  }
+
+  for (s = tcache_pool; s < tcache_pool + 8192; s ++) {
+    if (tcache_in_range(s, start, end)) continue;
+    if (tcache_in_range(s->rnext, start, end)) { s->rnext = 
+# 411 "src/cpu/tcache.c" 3 4
+                                                           ((void *)0)
+# 411 "src/cpu/tcache.c"
+                                                               ; }
+    switch (s->type) {
+      case INSTR_TYPE_B:
+        if (tcache_in_range(s->ntnext, start, end)) {
+          if (tcache_bb_nr_free < 3) return 
+# 415 "src/cpu/tcache.c" 3 4
+                                                            0
+# 415 "src/cpu/tcache.c"
+                                                                 ;
+          tcache_bb_fetch(s, 
+# 416 "src/cpu/tcache.c" 3 4
+                            0
+# 416 "src/cpu/tcache.c"
+                                 , s->ntnext->pc);
+        }
+
+      case INSTR_TYPE_J:
+        if (tcache_in_range(s->tnext, start, end)) {
+          if (tcache_bb_nr_free < 3) return 
+# 421 "src/cpu/tcache.c" 3 4
+                                                            0
+# 421 "src/cpu/tcache.c"
+                                                                 ;
+          tcache_bb_fetch(s, 
+# 422 "src/cpu/tcache.c" 3 4
+                            1
+# 422 "src/cpu/tcache.c"
+                                , s->tnext->pc);
+        }
+        break;
+      case INSTR_TYPE_I:
+        if (tcache_in_range(s->tnext, start, end)) { s->tnext = s; }
+        if (tcache_in_range(s->ntnext, start, end)) { s->ntnext = s; }
+        break;
+    }
+  }
+
+  for (s = start; s < end; s ++) {
+    s->type = INSTR_TYPE_N;
+  }
+  nr_region_evict ++;
+  return 
+# 436 "src/cpu/tcache.c" 3 4
+        1
+# 436 "src/cpu/tcache.c"
+            ;
+}
+
+
+static 
+# 440 "src/cpu/tcache.c" 3 4
+      _Bool 
+# 440 "src/cpu/tcache.c"
+           tcache_next_region() {
+  int region = (tc_region + 1) % 4;
+  if (!tcache_evict_region(region)) return 
+# 442 "src/cpu/tcache.c" 3 4
+                                          0
+# 442 "src/cpu/tcache.c"
+                                               ;
+  tc_region = region;
+  tc_idx = tcache_region_idx(region);
+  return 
+# 445 "src/cpu/tcache.c" 3 4
+        1
+# 445 "src/cpu/tcache.c"
+            ;
+}
+
+void tcache_flush() {
+  tc_idx = 0;
+  tc_region = 0;
+  memset(bb_pc, -1, sizeof(bb_pc[0]) * bb_cap);
+  bb_nr = 0;
+  memset(jr_site_cache, 0, sizeof(jr_site_cache));
+  memset(jr_target_cache, 0, sizeof(jr_target_cache));
+
+  int i;
+  for (i = 0; i < 8192; i ++) {
+    tcache_pool[i].type = INSTR_TYPE_N;
+    tcache_pool[i].rnext = 
+# 459 "src/cpu/tcache.c" 3 4
+                          ((void *)0)
+# 459 "src/cpu/tcache.c"
+                              ;
+  }
+  ras_flush();
+  for (i = 0; i < (8192 / 4 + 2) - 1; i ++) {
+    tcache_bb_pool[i].list_next = &tcache_bb_pool[i + 1];
+    tcache_bb_pool[i].type = 0;
+  }
+  tcache_bb_pool[(8192 / 4 + 2) - 1].list_next = 
+# 466 "src/cpu/tcache.c" 3 4
+                                                ((void *)0)
+# 466 "src/cpu/tcache.c"
+                                                    ;
+  tcache_bb_pool[(8192 / 4 + 2) - 1].type = 0;
+  tcache_bb_freelist = &tcache_bb_pool[0];
+  tcache_bb_nr_free = (8192 / 4 + 2);
+}
+
+
+
+
+__attribute__((noinline))
+Decode* tcache_jr_fetch(Decode *s, vaddr_t jpc) {
+  Decode *mru = s->tnext;
+  Decode *target = jr_cache_find(s, jpc);
+  if (target != 
+# 479 "src/cpu/tcache.c" 3 4
+               ((void *)0)
+# 479 "src/cpu/tcache.c"
+                   ) {
+    s->tnext = target;
+  } else {
+    nr_jr_miss ++;
+    tcache_bb_fetch(s, 
+# 483 "src/cpu/tcache.c" 3 4
+                      1
+# 483 "src/cpu/tcache.c"
+                          , jpc);
+
+    jr_cache_insert(s, s->tnext);
+  }
+  if (tcache_in_range(mru, tcache_pool, tcache_pool + 8192)) { s->ntnext = mru; }
+  return s->tnext;
+}
+
+
+void tcache_ras_fill(Decode *call, Decode *ret) {
+  if (tcache_in_range(ret, tcache_pool, tcache_pool + 8192)) { call->rnext = ret; }
+}
+
+static inline void tcache_patch_and_free(Decode *bb_record, Decode *bb) {
+  Decode *src = bb_record->bb_src;
+  if (bb_record->type == BB_RECORD_TYPE_TAKEN) {
+    src->tnext = bb;
+    if (src->type == INSTR_TYPE_I) { jr_cache_insert(src, bb); }
+  }
+  if (bb_record->type == BB_RECORD_TYPE_NTAKEN) { src->ntnext = bb; }
+  tcache_bb_free(bb_record);
+}
+
+__attribute__((noinline))
+Decode* tcache_decode(Decode *s) {
+  static int idx_in_bb = 0;
+  vaddr_t thispc = s->pc;
+
+  if (tcache_state == TCACHE_RUNNING) {
+
+    s->idx_in_bb = 1;
+    save_globals(s);
+    paddr_t paddr = vaddr_ifetch_paddr(thispc);
+    int mmu_state = tcache_mmu_state();
+
+
+    bb_t *bb = bb_find(thispc, paddr, mmu_state);
+    if (bb != 
+# 520 "src/cpu/tcache.c" 3 4
+             ((void *)0)
+# 520 "src/cpu/tcache.c"
+                 ) {
+      if (bb_is_valid(bb)) {
+        bb->s->epoch = g_tcache_epoch;
+        tcache_patch_and_free(s, bb->s);
+        return bb->s;
+      }
+      bb_remove(bb);
+    }
+
+    bb_now_paddr = paddr;
+    bb_now_mmu_state = mmu_state;
+    bb_now_epoch = g_tcache_epoch;
+    bb_now_single_epoch = 
+# 532 "src/cpu/tcache.c" 3 4
+                         0
+# 532 "src/cpu/tcache.c"
+                              ;
+    pmem_set_code_page(paddr);
+    bb_now_record = s;
+    s = tcache_new(thispc);
+    idx_in_bb = 1;
+
+    if (s == 
+# 538 "src/cpu/tcache.c" 3 4
+            ((void *)0) 
+# 538 "src/cpu/tcache.c"
+                 || tcache_bb_nr_free < 3 + 2) {
+
+
+      if (!tcache_next_region() || tcache_bb_nr_free < 3 + 2) { goto full; }
+      s = tcache_new(thispc);
+    }
+
+    bb_now = s;
+    tcache_state = TCACHE_BB_BUILDING;
+  }
+
+  save_globals(s);
+  s->idx_in_bb = idx_in_bb;
+  if (__builtin_expect(bb_now_epoch != g_tcache_epoch, 0)) {
+
+    paddr_t paddr = vaddr_ifetch_paddr(thispc);
+    if (paddr - bb_now_paddr != thispc - bb_now->pc ||
+        tcache_mmu_state() != bb_now_mmu_state) { bb_now_single_epoch = 
+# 555 "src/cpu/tcache.c" 3 4
+                                                                       1
+# 555 "src/cpu/tcache.c"
+                                                                           ; }
+    bb_now_epoch = g_tcache_epoch;
+  }
+  fetch_decode(s, thispc);
+  if ((bb_now->pc ^ (s->snpc - 1)) >> 12) {
+    bb_now_single_epoch = 
+# 560 "src/cpu/tcache.c" 3 4
+                         1
+# 560 "src/cpu/tcache.c"
+                             ;
+    pmem_set_code_page(vaddr_ifetch_paddr(s->snpc - 1));
+  }
+
+  if (s->type == INSTR_TYPE_N) {
+    Decode *next = tcache_new(s->snpc);
+    if (next == 
+# 566 "src/cpu/tcache.c" 3 4
+               ((void *)0)
+# 566 "src/cpu/tcache.c"
+                   ) {
+
+
+      bb_now = bb_now_record = 
+# 569 "src/cpu/tcache.c" 3 4
+                              ((void *)0)
+# 569 "src/cpu/tcache.c"
+                                  ;
+      if (!tcache_next_region()) { goto full; }
+      goto again;
+    }
+    
+# 573 "src/cpu/tcache.c" 3 4
+   ((void) sizeof ((
+# 573 "src/cpu/tcache.c"
+   next == s + 1
+# 573 "src/cpu/tcache.c" 3 4
+   ) ? 1 : 0), __extension__ ({ if (
+# 573 "src/cpu/tcache.c"
+   next == s + 1
+# 573 "src/cpu/tcache.c" 3 4
+   ) ; else __assert_fail (
+# 573 "src/cpu/tcache.c"
+   "next == s + 1"
+# 573 "src/cpu/tcache.c" 3 4
+   , "src/cpu/tcache.c", 573, __extension__ __PRETTY_FUNCTION__); }))
+# 573 "src/cpu/tcache.c"
+                        ;
+  } else {
+
+    bb_insert(bb_now->pc, bb_now_paddr, bb_now_mmu_state, bb_now_single_epoch, bb_now);
+    tcache_patch_and_free(bb_now_record, bb_now);
+    bb_now = bb_now_record = 
+# 578 "src/cpu/tcache.c" 3 4
+                            ((void *)0)
+# 578 "src/cpu/tcache.c"
+                                ;
+
+    switch (s->type) {
+      case INSTR_TYPE_J: tcache_bb_fetch(s, 
+# 581 "src/cpu/tcache.c" 3 4
+                                           1
+# 581 "src/cpu/tcache.c"
+                                               , s->jnpc); break;
+      case INSTR_TYPE_B:
+        tcache_bb_fetch(s, 
+# 583 "src/cpu/tcache.c" 3 4
+                          1
+# 583 "src/cpu/tcache.c"
+                              , s->jnpc);
+        tcache_bb_fetch(s, 
+# 584 "src/cpu/tcache.c" 3 4
+                          0
+# 584 "src/cpu/tcache.c"
+                               , s->snpc + 0);
+        break;
+      case INSTR_TYPE_I: s->tnext = s->ntnext = s; break;
+      default: 
+# 587 "src/cpu/tcache.c" 3 4
+              ((void) sizeof ((
+# 587 "src/cpu/tcache.c"
+              0
+# 587 "src/cpu/tcache.c" 3 4
+              ) ? 1 : 0), __extension__ ({ if (
+# 587 "src/cpu/tcache.c"
+              0
+# 587 "src/cpu/tcache.c" 3 4
+              ) ; else __assert_fail (
+# 587 "src/cpu/tcache.c"
+              "0"
+# 587 "src/cpu/tcache.c" 3 4
+              , "src/cpu/tcache.c", 587, __extension__ __PRETTY_FUNCTION__); }))
+# 587 "src/cpu/tcache.c"
+                       ;
+    }
+    tcache_state = TCACHE_RUNNING;
+  }
+
+  idx_in_bb ++;
+  return s;
+
+full:
+  tcache_flush();
+  nr_flush ++;
+again:
+  if (tcache_bb_nr_free < 3) { goto full; }
+  s = tcache_bb_new(thispc);
+  s->idx_in_bb = idx_in_bb;
+  save_globals(s);
+  bb_now = bb_now_record = 
+# 603 "src/cpu/tcache.c" 3 4
+                          ((void *)0)
+# 603 "src/cpu/tcache.c"
+                              ;
+  tcache_state = TCACHE_RUNNING;
+  longjmp_exec(NEMU_EXEC_AGAIN);
+}
+
+static Decode ex = {};
+
+void tcache_handle_exception(vaddr_t jpc) {
+  tcache_bb_fetch(&ex, 
+# 611 "src/cpu/tcache.c" 3 4
+                      1
+# 611 "src/cpu/tcache.c"
+                          , jpc);
+  save_globals(ex.tnext);
+  tcache_state = TCACHE_RUNNING;
+}
+
+Decode* tcache_handle_flush(vaddr_t snpc) {
+  tcache_flush();
+  tcache_handle_exception(snpc);
+  return ex.tnext;
+}
+
+
+
+
+Decode* tcache_handle_stale(Decode *s) {
+  if (tcache_state == TCACHE_BB_BUILDING) return s + 1;
+  tcache_handle_exception(s->snpc);
+  return ex.tnext;
+}
+
+
+
+
+
+__attribute__((noinline))
+Decode* tcache_validate(Decode *s) {
+  if (s->EHelper != g_exec_nemu_decode) {
+
+    save_globals(s);
+    paddr_t paddr = vaddr_ifetch_paddr(s->pc);
+    bb_t *bb = bb_find(s->pc, paddr, tcache_mmu_state());
+    if (bb != 
+# 642 "src/cpu/tcache.c" 3 4
+             ((void *)0) 
+# 642 "src/cpu/tcache.c"
+                  && bb_is_valid(bb)) { s = bb->s; }
+    else {
+      if (bb != 
+# 644 "src/cpu/tcache.c" 3 4
+               ((void *)0)
+# 644 "src/cpu/tcache.c"
+                   ) { bb_remove(bb); }
+      s = tcache_bb_new(s->pc);
+    }
+  }
+  s->epoch = g_tcache_epoch;
+  nr_validate ++;
+  return s;
+}
+
+
+
+
+
+static bb_t* bb_find_block(Decode *s) {
+  uint32_t i;
+  for (i = bb_hash(s->pc); bb_pc[i] != ((vaddr_t)-1ul); i = (i + 1) & (bb_cap - 1)) {
+    if (bb_pc[i] == s->pc && bb_table[i].s == s) return &bb_table[i];
+  }
+  return 
+# 662 "src/cpu/tcache.c" 3 4
+        ((void *)0)
+# 662 "src/cpu/tcache.c"
+            ;
+}
+
+static inline Decode* bb_tail(Decode *s) {
+  while (s->type == INSTR_TYPE_N) s ++;
+  return s;
+}
+
+
+
+static 
+# 672 "src/cpu/tcache.c" 3 4
+      _Bool 
+# 672 "src/cpu/tcache.c"
+           trace_can_follow(Decode *s, Decode **trace, int nr_bb) {
+  if (!tcache_in_range(s, tcache_pool, tcache_pool + 8192)) return 
+# 673 "src/cpu/tcache.c" 3 4
+                                                                                0
+# 673 "src/cpu/tcache.c"
+                                                                                     ;
+  if (s->EHelper == g_exec_nemu_decode || s->idx_in_bb != 1 || s->epoch != g_tcache_epoch) return 
+# 674 "src/cpu/tcache.c" 3 4
+                                                                                                 0
+# 674 "src/cpu/tcache.c"
+                                                                                                      ;
+  int i;
+  for (i = 0; i < nr_bb; i ++) {
+    if (trace[i] == s) return 
+# 677 "src/cpu/tcache.c" 3 4
+                             0
+# 677 "src/cpu/tcache.c"
+                                  ;
+  }
+  return 
+# 679 "src/cpu/tcache.c" 3 4
+        1
+# 679 "src/cpu/tcache.c"
+            ;
+}
+
+
+static Decode* trace_hot_succ(Decode *tail) {
+  switch (tail->type) {
+    case INSTR_TYPE_J: return tail->tnext;
+    case INSTR_TYPE_B: {
+      Decode *succ = (tail->ntnext->exec_cnt > tail->tnext->exec_cnt ? tail->ntnext : tail->tnext);
+      return (succ->exec_cnt >= 64 / 2 ? succ : 
+# 688 "src/cpu/tcache.c" 3 4
+                                                                          ((void *)0)
+# 688 "src/cpu/tcache.c"
+                                                                              );
+    }
+    default: return 
+# 690 "src/cpu/tcache.c" 3 4
+                   ((void *)0)
+# 690 "src/cpu/tcache.c"
+                       ;
+  }
+}
+
+
+
+
+
+void tcache_trace_promote(Decode *head) {
+  if (profiling_state != NoProfiling || tcache_state != TCACHE_RUNNING) return;
+  if (!trace_can_follow(head, 
+# 700 "src/cpu/tcache.c" 3 4
+                             ((void *)0)
+# 700 "src/cpu/tcache.c"
+                                 , 0)) return;
+  Decode *tail = bb_tail(head);
+  if (tail->type != INSTR_TYPE_J && tail->type != INSTR_TYPE_B) return;
+  if (tail->tnext->idx_in_bb != 1 ||
+      (tail->type == INSTR_TYPE_B && tail->ntnext->idx_in_bb != 1)) return;
+
+  if (bb_find_block(head) == 
+# 706 "src/cpu/tcache.c" 3 4
+                            ((void *)0)
+# 706 "src/cpu/tcache.c"
+                                ) return;
+
+  Decode *trace[8] = { head };
+  int nr_bb = 1, nr_instr = tail->idx_in_bb;
+  
+# 710 "src/cpu/tcache.c" 3 4
+ _Bool 
+# 710 "src/cpu/tcache.c"
+      single_epoch = 
+# 710 "src/cpu/tcache.c" 3 4
+                     0
+# 710 "src/cpu/tcache.c"
+                          ;
+  while (nr_bb < 8) {
+    Decode *succ = trace_hot_succ(tail);
+    if (succ == 
+# 713 "src/cpu/tcache.c" 3 4
+               ((void *)0) 
+# 713 "src/cpu/tcache.c"
+                    || !trace_can_follow(succ, trace, nr_bb)) break;
+    trace[nr_bb ++] = succ;
+    tail = bb_tail(succ);
+    nr_instr += tail - succ + 1;
+    if (((head->pc ^ succ->pc) | (head->pc ^ (tail->snpc - 1))) >> 12) { single_epoch = 
+# 717 "src/cpu/tcache.c" 3 4
+                                                                                               1
+# 717 "src/cpu/tcache.c"
+                                                                                                   ; }
+  }
+  if (nr_bb == 1 || nr_instr > 
+# 719 "src/cpu/tcache.c" 3 4
+                              (65535)
+# 719 "src/cpu/tcache.c"
+                                        ) return;
+  if (tc_idx + nr_instr - bb_tail(head)->idx_in_bb > tcache_region_idx(tc_region + 1) ||
+      tcache_bb_nr_free < 3 + 2 * nr_bb) return;
+
+  Decode *prev = bb_tail(head);
+  int idx_in_bb = prev->idx_in_bb;
+  int i;
+  for (i = 1; i < nr_bb; i ++) {
+    Decode *copy = &tcache_pool[tc_idx], *s;
+    for (s = trace[i]; ; s ++) {
+      Decode *c = &tcache_pool[tc_idx ++];
+      *c = *s;
+      c->idx_in_bb = ++ idx_in_bb;
+      ;
+      if (s->type != INSTR_TYPE_N) break;
+    }
+
+
+    Decode *orig = bb_tail(trace[i - 1]);
+    if (orig->tnext == trace[i]) { prev->tnext = copy; }
+    if (orig->type == INSTR_TYPE_B && orig->ntnext == trace[i]) { prev->ntnext = copy; }
+
+
+    prev = &tcache_pool[tc_idx - 1];
+    orig = bb_tail(trace[i]);
+    Decode *next = (i + 1 < nr_bb ? trace[i + 1] : 
+# 744 "src/cpu/tcache.c" 3 4
+                                                  ((void *)0)
+# 744 "src/cpu/tcache.c"
+                                                      );
+    switch (prev->type) {
+      case INSTR_TYPE_J: if (next == 
+# 746 "src/cpu/tcache.c" 3 4
+                                    ((void *)0)
+# 746 "src/cpu/tcache.c"
+                                        ) { tcache_bb_fetch(prev, 
+# 746 "src/cpu/tcache.c" 3 4
+                                                                  1
+# 746 "src/cpu/tcache.c"
+                                                                      , prev->jnpc); } break;
+      case INSTR_TYPE_B:
+        if (orig->tnext != next) { tcache_bb_fetch(prev, 
+# 748 "src/cpu/tcache.c" 3 4
+                                                        1
+# 748 "src/cpu/tcache.c"
+                                                            , prev->jnpc); }
+        if (orig->ntnext != next) { tcache_bb_fetch(prev, 
+# 749 "src/cpu/tcache.c" 3 4
+                                                         0
+# 749 "src/cpu/tcache.c"
+                                                              , prev->snpc + 0); }
+        break;
+      case INSTR_TYPE_I: prev->tnext = prev->ntnext = prev; break;
+      default: 
+# 752 "src/cpu/tcache.c" 3 4
+              ((void) sizeof ((
+# 752 "src/cpu/tcache.c"
+              0
+# 752 "src/cpu/tcache.c" 3 4
+              ) ? 1 : 0), __extension__ ({ if (
+# 752 "src/cpu/tcache.c"
+              0
+# 752 "src/cpu/tcache.c" 3 4
+              ) ; else __assert_fail (
+# 752 "src/cpu/tcache.c"
+              "0"
+# 752 "src/cpu/tcache.c" 3 4
+              , "src/cpu/tcache.c", 752, __extension__ __PRETTY_FUNCTION__); }))
+# 752 "src/cpu/tcache.c"
+                       ;
+    }
+  }
+
+
+  if (single_epoch) { bb_find_block(head)->single_epoch = 
+# 757 "src/cpu/tcache.c" 3 4
+                                                         1
+# 757 "src/cpu/tcache.c"
+                                                             ; }
+  nr_trace ++;
+}
+# 774 "src/cpu/tcache.c"
+void tcache_invalidate_page(paddr_t pg) {
+  bb_remove_if(bb_in_page, &pg);
+  if (tcache_state == TCACHE_BB_BUILDING && (bb_now_paddr & ~(paddr_t)((1ul << 12) - 1)) == pg) {
+    bb_now_single_epoch = 
+# 777 "src/cpu/tcache.c" 3 4
+                         1
+# 777 "src/cpu/tcache.c"
+                             ;
+  }
+  g_tcache_epoch ++;
+  nr_page_invalidate ++;
+}
+# 793 "src/cpu/tcache.c"
+void tcache_statistic() {
+
+
+  uint64_t region_evict = nr_region_evict ; uint64_t bb_evict = nr_bb_evict ; uint64_t flush = nr_flush ; uint64_t validate = nr_validate ; uint64_t page_invalidate = nr_page_invalidate ; uint64_t trace = nr_trace ; uint64_t jr_site_hit = nr_jr_site_hit ; uint64_t jr_target_hit = nr_jr_target_hit ; uint64_t jr_miss = nr_jr_miss ; uint64_t bb_lookup = nr_bb_lookup ; uint64_t bb_probe = nr_bb_probe ; uint64_t bb_grow = nr_bb_grow ;
+  uint64_t nr_used = bb_nr ;
+  uint64_t nr_entry = bb_cap ;
+  do { printf("\33[1;34m[%s:%d,%s] " "tcache: %'lu regions evicted, %'lu basic blocks evicted, %'lu flushes, %'lu validations, " "%'lu pages invalidated, %'lu traces" "\33[0m\n", "src/cpu/tcache.c", 799, __func__, region_evict, bb_evict, flush, validate, page_invalidate, trace); ; } while (0)
+
+                             ;
+  do { printf("\33[1;34m[%s:%d,%s] " "tcache: %'lu basic block lookups, %.2f probes per lookup, %'lu of %'lu table entries used, " "%'lu table growths" "\33[0m\n", "src/cpu/tcache.c", 802, __func__, bb_lookup, bb_lookup ? (double)bb_probe / bb_lookup : 0.0, nr_used, nr_entry, bb_grow); ; } while (0)
+
+                                 ;
+  uint64_t nr_jr = jr_site_hit + jr_target_hit + jr_miss;
+  do { printf("\33[1;34m[%s:%d,%s] " "tcache: %'lu indirect jumps missing both recent targets, %.2f%% hit in the site cache, " "%.2f%% hit in the target cache" "\33[0m\n", "src/cpu/tcache.c", 806, __func__, nr_jr, nr_jr ? 100.0 * jr_site_hit / nr_jr : 0.0, nr_jr ? 100.0 * jr_target_hit / nr_jr : 0.0); ; } while (0)
+
+                                                                                             ;
+}
+
+Decode* tcache_init(const void *exec_nemu_decode, vaddr_t reset_vector) {
+  bb_table_alloc(1024);
+  tcache_flush();
+  g_exec_nemu_decode = exec_nemu_decode;
+  return tcache_bb_new(reset_vector);
+}
@@ -0,0 +1,6804 @@
+# 0 "src/engine/interpreter/fp.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "src/engine/interpreter/fp.c"
+# 17 "src/engine/interpreter/fp.c"
+# 1 "/root/repo/include/rtl/rtl.h" 1
+# 19 "/root/repo/include/rtl/rtl.h"
+# 1 "/root/repo/include/cpu/decode.h" 1
+# 20 "/root/repo/include/cpu/decode.h"
+# 1 "/root/repo/include/isa.h" 1
+# 21 "/root/repo/include/isa.h"
+# 1 "/root/repo/src/isa/riscv64/include/isa-def.h" 1
+# 20 "/root/repo/src/isa/riscv64/include/isa-def.h"
+# 1 "/root/repo/include/common.h" 1
+# 20 "/root/repo/include/common.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 1 3 4
+# 9 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 3 4
+# 1 "/usr/include/stdint.h" 1 3 4
+# 26 "/usr/include/stdint.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 33 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+# 1 "/usr/include/features.h" 1 3 4
+# 392 "/usr/include/features.h" 3 4
+# 1 "/usr/include/features-time64.h" 1 3 4
+# 20 "/usr/include/features-time64.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 21 "/usr/include/features-time64.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 22 "/usr/include/features-time64.h" 2 3 4
+# 393 "/usr/include/features.h" 2 3 4
+# 489 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 1 3 4
+# 561 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 562 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 563 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 490 "/usr/include/features.h" 2 3 4
+# 513 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h" 1 3 4
+# 11 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 2 3 4
+# 514 "/usr/include/features.h" 2 3 4
+# 34 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 2 3 4
+# 27 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 28 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 29 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+
+# 31 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+typedef unsigned char __u_char;
+typedef unsigned short int __u_short;
+typedef unsigned int __u_int;
+typedef unsigned long int __u_long;
+
+
+typedef signed char __int8_t;
+typedef unsigned char __uint8_t;
+typedef signed short int __int16_t;
+typedef unsigned short int __uint16_t;
+typedef signed int __int32_t;
+typedef unsigned int __uint32_t;
+
+typedef signed long int __int64_t;
+typedef unsigned long int __uint64_t;
+
+
+
+
+
+
+typedef __int8_t __int_least8_t;
+typedef __uint8_t __uint_least8_t;
+typedef __int16_t __int_least16_t;
+typedef __uint16_t __uint_least16_t;
+typedef __int32_t __int_least32_t;
+typedef __uint32_t __uint_least32_t;
+typedef __int64_t __int_least64_t;
+typedef __uint64_t __uint_least64_t;
+
+
+
+typedef long int __quad_t;
+typedef unsigned long int __u_quad_t;
+
+
+
+
+
+
+
+typedef long int __intmax_t;
+typedef unsigned long int __uintmax_t;
+# 141 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 1 3 4
+# 142 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/time64.h" 1 3 4
+# 143 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+typedef unsigned long int __dev_t;
+typedef unsigned int __uid_t;
+typedef unsigned int __gid_t;
+typedef unsigned long int __ino_t;
+typedef unsigned long int __ino64_t;
+typedef unsigned int __mode_t;
+typedef unsigned long int __nlink_t;
+typedef long int __off_t;
+typedef long int __off64_t;
+typedef int __pid_t;
+typedef struct { int __val[2]; } __fsid_t;
+typedef long int __clock_t;
+typedef unsigned long int __rlim_t;
+typedef unsigned long int __rlim64_t;
+typedef unsigned int __id_t;
+typedef long int __time_t;
+typedef unsigned int __useconds_t;
+typedef long int __suseconds_t;
+typedef long int __suseconds64_t;
+
+typedef int __daddr_t;
+typedef int __key_t;
+
+
+typedef int __clockid_t;
+
+
+typedef void * __timer_t;
+
+
+typedef long int __blksize_t;
+
+
+
+
+typedef long int __blkcnt_t;
+typedef long int __blkcnt64_t;
+
+
+typedef unsigned long int __fsblkcnt_t;
+typedef unsigned long int __fsblkcnt64_t;
+
+
+typedef unsigned long int __fsfilcnt_t;
+typedef unsigned long int __fsfilcnt64_t;
+
+
+typedef long int __fsword_t;
+
+typedef long int __ssize_t;
+
+
+typedef long int __syscall_slong_t;
+
+typedef unsigned long int __syscall_ulong_t;
+
+
+
+typedef __off64_t __loff_t;
+typedef char *__caddr_t;
+
+
+typedef long int __intptr_t;
+
+
+typedef unsigned int __socklen_t;
+
+
+
+
+typedef int __sig_atomic_t;
+# 28 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wchar.h" 1 3 4
+# 29 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 30 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 3 4
+typedef __int8_t int8_t;
+typedef __int16_t int16_t;
+typedef __int32_t int32_t;
+typedef __int64_t int64_t;
+# 35 "/usr/include/stdint.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 3 4
+typedef __uint8_t uint8_t;
+typedef __uint16_t uint16_t;
+typedef __uint32_t uint32_t;
+typedef __uint64_t uint64_t;
+# 38 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+
+typedef __int_least8_t int_least8_t;
+typedef __int_least16_t int_least16_t;
+typedef __int_least32_t int_least32_t;
+typedef __int_least64_t int_least64_t;
+
+
+typedef __uint_least8_t uint_least8_t;
+typedef __uint_least16_t uint_least16_t;
+typedef __uint_least32_t uint_least32_t;
+typedef __uint_least64_t uint_least64_t;
+
+
+
+
+
+typedef signed char int_fast8_t;
+
+typedef long int int_fast16_t;
+typedef long int int_fast32_t;
+typedef long int int_fast64_t;
+# 71 "/usr/include/stdint.h" 3 4
+typedef unsigned char uint_fast8_t;
+
+typedef unsigned long int uint_fast16_t;
+typedef unsigned long int uint_fast32_t;
+typedef unsigned long int uint_fast64_t;
+# 87 "/usr/include/stdint.h" 3 4
+typedef long int intptr_t;
+
+
+typedef unsigned long int uintptr_t;
+# 101 "/usr/include/stdint.h" 3 4
+typedef __intmax_t intmax_t;
+typedef __uintmax_t uintmax_t;
+# 10 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 2 3 4
+# 21 "/root/repo/include/common.h" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h" 1 3 4
+# 22 "/root/repo/include/common.h" 2
+# 1 "/usr/include/assert.h" 1 3 4
+# 66 "/usr/include/assert.h" 3 4
+
+
+
+extern void __assert_fail (const char *__assertion, const char *__file,
+      unsigned int __line, const char *__function)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+extern void __assert_perror_fail (int __errnum, const char *__file,
+      unsigned int __line, const char *__function)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+
+extern void __assert (const char *__assertion, const char *__file, int __line)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+# 23 "/root/repo/include/common.h" 2
+# 1 "/usr/include/string.h" 1 3 4
+# 26 "/usr/include/string.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 27 "/usr/include/string.h" 2 3 4
+
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 214 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long unsigned int size_t;
+# 34 "/usr/include/string.h" 2 3 4
+# 43 "/usr/include/string.h" 3 4
+extern void *memcpy (void *__restrict __dest, const void *__restrict __src,
+       size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void *memmove (void *__dest, const void *__src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+extern void *memccpy (void *__restrict __dest, const void *__restrict __src,
+        int __c, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2))) __attribute__ ((__access__ (__write_only__, 1, 4)));
+
+
+
+
+extern void *memset (void *__s, int __c, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int memcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 80 "/usr/include/string.h" 3 4
+extern int __memcmpeq (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 107 "/usr/include/string.h" 3 4
+extern void *memchr (const void *__s, int __c, size_t __n)
+      __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 141 "/usr/include/string.h" 3 4
+extern char *strcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern char *strcat (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncat (char *__restrict __dest, const char *__restrict __src,
+        size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int strncmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcoll (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern size_t strxfrm (char *__restrict __dest,
+         const char *__restrict __src, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 3 4
+struct __locale_struct
+{
+
+  struct __locale_data *__locales[13];
+
+
+  const unsigned short int *__ctype_b;
+  const int *__ctype_tolower;
+  const int *__ctype_toupper;
+
+
+  const char *__names[13];
+};
+
+typedef struct __locale_struct *__locale_t;
+# 23 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 2 3 4
+
+typedef __locale_t locale_t;
+# 173 "/usr/include/string.h" 2 3 4
+
+
+extern int strcoll_l (const char *__s1, const char *__s2, locale_t __l)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+extern size_t strxfrm_l (char *__dest, const char *__src, size_t __n,
+    locale_t __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4)))
+     __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+
+
+extern char *strdup (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern char *strndup (const char *__string, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+# 246 "/usr/include/string.h" 3 4
+extern char *strchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 273 "/usr/include/string.h" 3 4
+extern char *strrchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 293 "/usr/include/string.h" 3 4
+extern size_t strcspn (const char *__s, const char *__reject)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern size_t strspn (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 323 "/usr/include/string.h" 3 4
+extern char *strpbrk (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 350 "/usr/include/string.h" 3 4
+extern char *strstr (const char *__haystack, const char *__needle)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strtok (char *__restrict __s, const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern char *__strtok_r (char *__restrict __s,
+    const char *__restrict __delim,
+    char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+
+extern char *strtok_r (char *__restrict __s, const char *__restrict __delim,
+         char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+# 407 "/usr/include/string.h" 3 4
+extern size_t strlen (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern size_t strnlen (const char *__string, size_t __maxlen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern char *strerror (int __errnum) __attribute__ ((__nothrow__ , __leaf__));
+# 432 "/usr/include/string.h" 3 4
+extern int strerror_r (int __errnum, char *__buf, size_t __buflen) __asm__ ("" "__xpg_strerror_r") __attribute__ ((__nothrow__ , __leaf__))
+
+                        __attribute__ ((__nonnull__ (2)))
+    __attribute__ ((__access__ (__write_only__, 2, 3)));
+# 458 "/usr/include/string.h" 3 4
+extern char *strerror_l (int __errnum, locale_t __l) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+# 1 "/usr/include/strings.h" 1 3 4
+# 23 "/usr/include/strings.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 24 "/usr/include/strings.h" 2 3 4
+
+
+
+
+
+
+
+
+
+
+extern int bcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bcopy (const void *__src, void *__dest, size_t __n)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 68 "/usr/include/strings.h" 3 4
+extern char *index (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 96 "/usr/include/strings.h" 3 4
+extern char *rindex (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int ffs (int __i) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+
+extern int ffsl (long int __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+__extension__ extern int ffsll (long long int __ll)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern int strcasecmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strncasecmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+
+extern int strcasecmp_l (const char *__s1, const char *__s2, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+
+extern int strncasecmp_l (const char *__s1, const char *__s2,
+     size_t __n, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 4)));
+
+
+
+# 463 "/usr/include/string.h" 2 3 4
+
+
+
+extern void explicit_bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)))
+    __attribute__ ((__access__ (__write_only__, 1, 2)));
+
+
+
+extern char *strsep (char **__restrict __stringp,
+       const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strsignal (int __sig) __attribute__ ((__nothrow__ , __leaf__));
+# 489 "/usr/include/string.h" 3 4
+extern char *__stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern char *__stpncpy (char *__restrict __dest,
+   const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+# 539 "/usr/include/string.h" 3 4
+
+# 24 "/root/repo/include/common.h" 2
+
+# 1 "/root/repo/include/generated/autoconf.h" 1
+# 26 "/root/repo/include/common.h" 2
+# 1 "/root/repo/include/macro.h" 1
+# 27 "/root/repo/include/common.h" 2
+
+
+
+
+
+
+# 32 "/root/repo/include/common.h"
+typedef uint64_t word_t;
+typedef int64_t sword_t;
+
+
+typedef word_t rtlreg_t;
+typedef word_t vaddr_t;
+typedef uint64_t paddr_t;
+
+typedef uint16_t ioaddr_t;
+
+
+
+
+
+
+
+struct DynamicConfig {
+  
+# 49 "/root/repo/include/common.h" 3 4
+ _Bool 
+# 49 "/root/repo/include/common.h"
+      ignore_illegal_mem_access;
+  
+# 50 "/root/repo/include/common.h" 3 4
+ _Bool 
+# 50 "/root/repo/include/common.h"
+      debug_difftest;
+};
+extern struct DynamicConfig dynamic_config;
+void update_dynamic_config(void* config);
+
+# 1 "/root/repo/include/debug.h" 1
+# 20 "/root/repo/include/debug.h"
+# 1 "/usr/include/stdio.h" 1 3 4
+# 27 "/usr/include/stdio.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 28 "/usr/include/stdio.h" 2 3 4
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 34 "/usr/include/stdio.h" 2 3 4
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 1 3 4
+# 40 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+
+# 40 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+typedef __builtin_va_list __gnuc_va_list;
+# 37 "/usr/include/stdio.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h" 1 3 4
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h" 1 3 4
+# 13 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h" 3 4
+typedef struct
+{
+  int __count;
+  union
+  {
+    unsigned int __wch;
+    char __wchb[4];
+  } __value;
+} __mbstate_t;
+# 6 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h" 2 3 4
+
+
+
+
+typedef struct _G_fpos_t
+{
+  __off_t __pos;
+  __mbstate_t __state;
+} __fpos_t;
+# 40 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__fpos64_t.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/bits/types/__fpos64_t.h" 3 4
+typedef struct _G_fpos64_t
+{
+  __off64_t __pos;
+  __mbstate_t __state;
+} __fpos64_t;
+# 41 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__FILE.h" 1 3 4
+
+
+
+struct _IO_FILE;
+typedef struct _IO_FILE __FILE;
+# 42 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h" 1 3 4
+
+
+
+struct _IO_FILE;
+
+
+typedef struct _IO_FILE FILE;
+# 43 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h" 1 3 4
+# 35 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h" 3 4
+struct _IO_FILE;
+struct _IO_marker;
+struct _IO_codecvt;
+struct _IO_wide_data;
+
+
+
+
+typedef void _IO_lock_t;
+
+
+
+
+
+struct _IO_FILE
+{
+  int _flags;
+
+
+  char *_IO_read_ptr;
+  char *_IO_read_end;
+  char *_IO_read_base;
+  char *_IO_write_base;
+  char *_IO_write_ptr;
+  char *_IO_write_end;
+  char *_IO_buf_base;
+  char *_IO_buf_end;
+
+
+  char *_IO_save_base;
+  char *_IO_backup_base;
+  char *_IO_save_end;
+
+  struct _IO_marker *_markers;
+
+  struct _IO_FILE *_chain;
+
+  int _fileno;
+  int _flags2;
+  __off_t _old_offset;
+
+
+  unsigned short _cur_column;
+  signed char _vtable_offset;
+  char _shortbuf[1];
+
+  _IO_lock_t *_lock;
+
+
+
+
+
+
+
+  __off64_t _offset;
+
+  struct _IO_codecvt *_codecvt;
+  struct _IO_wide_data *_wide_data;
+  struct _IO_FILE *_freeres_list;
+  void *_freeres_buf;
+  size_t __pad5;
+  int _mode;
+
+  char _unused2[15 * sizeof (int) - 4 * sizeof (void *) - sizeof (size_t)];
+};
+# 44 "/usr/include/stdio.h" 2 3 4
+# 52 "/usr/include/stdio.h" 3 4
+typedef __gnuc_va_list va_list;
+# 63 "/usr/include/stdio.h" 3 4
+typedef __off_t off_t;
+# 77 "/usr/include/stdio.h" 3 4
+typedef __ssize_t ssize_t;
+
+
+
+
+
+
+typedef __fpos_t fpos_t;
+# 133 "/usr/include/stdio.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdio_lim.h" 1 3 4
+# 134 "/usr/include/stdio.h" 2 3 4
+# 143 "/usr/include/stdio.h" 3 4
+extern FILE *stdin;
+extern FILE *stdout;
+extern FILE *stderr;
+
+
+
+
+
+
+extern int remove (const char *__filename) __attribute__ ((__nothrow__ , __leaf__));
+
+extern int rename (const char *__old, const char *__new) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int renameat (int __oldfd, const char *__old, int __newfd,
+       const char *__new) __attribute__ ((__nothrow__ , __leaf__));
+# 178 "/usr/include/stdio.h" 3 4
+extern int fclose (FILE *__stream);
+# 188 "/usr/include/stdio.h" 3 4
+extern FILE *tmpfile (void)
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+# 205 "/usr/include/stdio.h" 3 4
+extern char *tmpnam (char[20]) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern char *tmpnam_r (char __s[20]) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 222 "/usr/include/stdio.h" 3 4
+extern char *tempnam (const char *__dir, const char *__pfx)
+   __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (__builtin_free, 1)));
+
+
+
+
+
+
+extern int fflush (FILE *__stream);
+# 239 "/usr/include/stdio.h" 3 4
+extern int fflush_unlocked (FILE *__stream);
+# 258 "/usr/include/stdio.h" 3 4
+extern FILE *fopen (const char *__restrict __filename,
+      const char *__restrict __modes)
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+
+
+
+
+extern FILE *freopen (const char *__restrict __filename,
+        const char *__restrict __modes,
+        FILE *__restrict __stream) ;
+# 293 "/usr/include/stdio.h" 3 4
+extern FILE *fdopen (int __fd, const char *__modes) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+# 308 "/usr/include/stdio.h" 3 4
+extern FILE *fmemopen (void *__s, size_t __len, const char *__modes)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+
+
+
+
+extern FILE *open_memstream (char **__bufloc, size_t *__sizeloc) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+# 328 "/usr/include/stdio.h" 3 4
+extern void setbuf (FILE *__restrict __stream, char *__restrict __buf) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int setvbuf (FILE *__restrict __stream, char *__restrict __buf,
+      int __modes, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern void setbuffer (FILE *__restrict __stream, char *__restrict __buf,
+         size_t __size) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern void setlinebuf (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern int fprintf (FILE *__restrict __stream,
+      const char *__restrict __format, ...);
+
+
+
+
+extern int printf (const char *__restrict __format, ...);
+
+extern int sprintf (char *__restrict __s,
+      const char *__restrict __format, ...) __attribute__ ((__nothrow__));
+
+
+
+
+
+extern int vfprintf (FILE *__restrict __s, const char *__restrict __format,
+       __gnuc_va_list __arg);
+
+
+
+
+extern int vprintf (const char *__restrict __format, __gnuc_va_list __arg);
+
+extern int vsprintf (char *__restrict __s, const char *__restrict __format,
+       __gnuc_va_list __arg) __attribute__ ((__nothrow__));
+
+
+
+extern int snprintf (char *__restrict __s, size_t __maxlen,
+       const char *__restrict __format, ...)
+     __attribute__ ((__nothrow__)) __attribute__ ((__format__ (__printf__, 3, 4)));
+
+extern int vsnprintf (char *__restrict __s, size_t __maxlen,
+        const char *__restrict __format, __gnuc_va_list __arg)
+     __attribute__ ((__nothrow__)) __attribute__ ((__format__ (__printf__, 3, 0)));
+# 403 "/usr/include/stdio.h" 3 4
+extern int vdprintf (int __fd, const char *__restrict __fmt,
+       __gnuc_va_list __arg)
+     __attribute__ ((__format__ (__printf__, 2, 0)));
+extern int dprintf (int __fd, const char *__restrict __fmt, ...)
+     __attribute__ ((__format__ (__printf__, 2, 3)));
+
+
+
+
+
+
+
+extern int fscanf (FILE *__restrict __stream,
+     const char *__restrict __format, ...) ;
+
+
+
+
+extern int scanf (const char *__restrict __format, ...) ;
+
+extern int sscanf (const char *__restrict __s,
+     const char *__restrict __format, ...) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 1 3 4
+# 120 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 2 3 4
+# 121 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 2 3 4
+# 431 "/usr/include/stdio.h" 2 3 4
+
+
+
+extern int fscanf (FILE *__restrict __stream, const char *__restrict __format, ...) __asm__ ("" "__isoc99_fscanf")
+
+                               ;
+extern int scanf (const char *__restrict __format, ...) __asm__ ("" "__isoc99_scanf")
+                              ;
+extern int sscanf (const char *__restrict __s, const char *__restrict __format, ...) __asm__ ("" "__isoc99_sscanf") __attribute__ ((__nothrow__ , __leaf__))
+
+                      ;
+# 459 "/usr/include/stdio.h" 3 4
+extern int vfscanf (FILE *__restrict __s, const char *__restrict __format,
+      __gnuc_va_list __arg)
+     __attribute__ ((__format__ (__scanf__, 2, 0))) ;
+
+
+
+
+
+extern int vscanf (const char *__restrict __format, __gnuc_va_list __arg)
+     __attribute__ ((__format__ (__scanf__, 1, 0))) ;
+
+
+extern int vsscanf (const char *__restrict __s,
+      const char *__restrict __format, __gnuc_va_list __arg)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__format__ (__scanf__, 2, 0)));
+
+
+
+
+
+extern int vfscanf (FILE *__restrict __s, const char *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vfscanf")
+
+
+
+     __attribute__ ((__format__ (__scanf__, 2, 0))) ;
+extern int vscanf (const char *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vscanf")
+
+     __attribute__ ((__format__ (__scanf__, 1, 0))) ;
+extern int vsscanf (const char *__restrict __s, const char *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vsscanf") __attribute__ ((__nothrow__ , __leaf__))
+
+
+
+     __attribute__ ((__format__ (__scanf__, 2, 0)));
+# 513 "/usr/include/stdio.h" 3 4
+extern int fgetc (FILE *__stream);
+extern int getc (FILE *__stream);
+
+
+
+
+
+extern int getchar (void);
+
+
+
+
+
+
+extern int getc_unlocked (FILE *__stream);
+extern int getchar_unlocked (void);
+# 538 "/usr/include/stdio.h" 3 4
+extern int fgetc_unlocked (FILE *__stream);
+# 549 "/usr/include/stdio.h" 3 4
+extern int fputc (int __c, FILE *__stream);
+extern int putc (int __c, FILE *__stream);
+
+
+
+
+
+extern int putchar (int __c);
+# 565 "/usr/include/stdio.h" 3 4
+extern int fputc_unlocked (int __c, FILE *__stream);
+
+
+
+
+
+
+
+extern int putc_unlocked (int __c, FILE *__stream);
+extern int putchar_unlocked (int __c);
+
+
+
+
+
+
+extern int getw (FILE *__stream);
+
+
+extern int putw (int __w, FILE *__stream);
+
+
+
+
+
+
+
+extern char *fgets (char *__restrict __s, int __n, FILE *__restrict __stream)
+     __attribute__ ((__access__ (__write_only__, 1, 2)));
+# 632 "/usr/include/stdio.h" 3 4
+extern __ssize_t __getdelim (char **__restrict __lineptr,
+                             size_t *__restrict __n, int __delimiter,
+                             FILE *__restrict __stream) ;
+extern __ssize_t getdelim (char **__restrict __lineptr,
+                           size_t *__restrict __n, int __delimiter,
+                           FILE *__restrict __stream) ;
+
+
+
+
+
+
+
+extern __ssize_t getline (char **__restrict __lineptr,
+                          size_t *__restrict __n,
+                          FILE *__restrict __stream) ;
+
+
+
+
+
+
+
+extern int fputs (const char *__restrict __s, FILE *__restrict __stream);
+
+
+
+
+
+extern int puts (const char *__s);
+
+
+
+
+
+
+extern int ungetc (int __c, FILE *__stream);
+
+
+
+
+
+
+extern size_t fread (void *__restrict __ptr, size_t __size,
+       size_t __n, FILE *__restrict __stream) ;
+
+
+
+
+extern size_t fwrite (const void *__restrict __ptr, size_t __size,
+        size_t __n, FILE *__restrict __s);
+# 702 "/usr/include/stdio.h" 3 4
+extern size_t fread_unlocked (void *__restrict __ptr, size_t __size,
+         size_t __n, FILE *__restrict __stream) ;
+extern size_t fwrite_unlocked (const void *__restrict __ptr, size_t __size,
+          size_t __n, FILE *__restrict __stream);
+
+
+
+
+
+
+
+extern int fseek (FILE *__stream, long int __off, int __whence);
+
+
+
+
+extern long int ftell (FILE *__stream) ;
+
+
+
+
+extern void rewind (FILE *__stream);
+# 736 "/usr/include/stdio.h" 3 4
+extern int fseeko (FILE *__stream, __off_t __off, int __whence);
+
+
+
+
+extern __off_t ftello (FILE *__stream) ;
+# 760 "/usr/include/stdio.h" 3 4
+extern int fgetpos (FILE *__restrict __stream, fpos_t *__restrict __pos);
+
+
+
+
+extern int fsetpos (FILE *__stream, const fpos_t *__pos);
+# 786 "/usr/include/stdio.h" 3 4
+extern void clearerr (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+
+extern int feof (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+extern int ferror (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+extern void clearerr_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+extern int feof_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+extern int ferror_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+
+
+extern void perror (const char *__s);
+
+
+
+
+extern int fileno (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern int fileno_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 823 "/usr/include/stdio.h" 3 4
+extern int pclose (FILE *__stream);
+
+
+
+
+
+extern FILE *popen (const char *__command, const char *__modes)
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (pclose, 1))) ;
+
+
+
+
+
+
+extern char *ctermid (char *__s) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__access__ (__write_only__, 1)));
+# 867 "/usr/include/stdio.h" 3 4
+extern void flockfile (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int ftrylockfile (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern void funlockfile (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+# 885 "/usr/include/stdio.h" 3 4
+extern int __uflow (FILE *);
+extern int __overflow (FILE *, int);
+# 902 "/usr/include/stdio.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdio.h" 1 3 4
+# 38 "/usr/include/x86_64-linux-gnu/bits/stdio.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) int
+vprintf (const char *__restrict __fmt, __gnuc_va_list __arg)
+{
+  return vfprintf (stdout, __fmt, __arg);
+}
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+getchar (void)
+{
+  return getc (stdin);
+}
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+fgetc_unlocked (FILE *__fp)
+{
+  return (__builtin_expect (((__fp)->_IO_read_ptr >= (__fp)->_IO_read_end), 0) ? __uflow (__fp) : *(unsigned char *) (__fp)->_IO_read_ptr++);
+}
+
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+getc_unlocked (FILE *__fp)
+{
+  return (__builtin_expect (((__fp)->_IO_read_ptr >= (__fp)->_IO_read_end), 0) ? __uflow (__fp) : *(unsigned char *) (__fp)->_IO_read_ptr++);
+}
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+getchar_unlocked (void)
+{
+  return (__builtin_expect (((stdin)->_IO_read_ptr >= (stdin)->_IO_read_end), 0) ? __uflow (stdin) : *(unsigned char *) (stdin)->_IO_read_ptr++);
+}
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+putchar (int __c)
+{
+  return putc (__c, stdout);
+}
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+fputc_unlocked (int __c, FILE *__stream)
+{
+  return (__builtin_expect (((__stream)->_IO_write_ptr >= (__stream)->_IO_write_end), 0) ? __overflow (__stream, (unsigned char) (__c)) : (unsigned char) (*(__stream)->_IO_write_ptr++ = (__c)));
+}
+
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+putc_unlocked (int __c, FILE *__stream)
+{
+  return (__builtin_expect (((__stream)->_IO_write_ptr >= (__stream)->_IO_write_end), 0) ? __overflow (__stream, (unsigned char) (__c)) : (unsigned char) (*(__stream)->_IO_write_ptr++ = (__c)));
+}
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+putchar_unlocked (int __c)
+{
+  return (__builtin_expect (((stdout)->_IO_write_ptr >= (stdout)->_IO_write_end), 0) ? __overflow (stdout, (unsigned char) (__c)) : (unsigned char) (*(stdout)->_IO_write_ptr++ = (__c)));
+}
+# 127 "/usr/include/x86_64-linux-gnu/bits/stdio.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) int
+__attribute__ ((__nothrow__ , __leaf__)) feof_unlocked (FILE *__stream)
+{
+  return (((__stream)->_flags & 0x0010) != 0);
+}
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+__attribute__ ((__nothrow__ , __leaf__)) ferror_unlocked (FILE *__stream)
+{
+  return (((__stream)->_flags & 0x0020) != 0);
+}
+# 903 "/usr/include/stdio.h" 2 3 4
+
+
+
+
+
+
+
+# 21 "/root/repo/include/debug.h" 2
+# 1 "/usr/include/assert.h" 1 3 4
+# 22 "/root/repo/include/debug.h" 2
+# 1 "/root/repo/include/utils.h" 1
+# 20 "/root/repo/include/utils.h"
+# 1 "/root/repo/include/common.h" 1
+# 21 "/root/repo/include/utils.h" 2
+
+
+
+
+# 24 "/root/repo/include/utils.h"
+enum { NEMU_RUNNING, NEMU_STOP, NEMU_END, NEMU_ABORT, NEMU_QUIT };
+
+typedef struct {
+  int state;
+  vaddr_t halt_pc;
+  uint32_t halt_ret;
+} NEMUState;
+
+extern NEMUState nemu_state;
+
+enum {
+  dflag_none = 0,
+  dflag_mem,
+  dflag_translate,
+  dflag_trace_bb,
+  dflag_trace_inst,
+  dflag_trace_inst_dasm,
+  dflag_exit,
+};
+
+
+
+
+uint64_t get_time();
+# 68 "/root/repo/include/utils.h"
+extern char log_bytebuf[80];
+extern char log_asmbuf[80];
+
+
+
+word_t expr(char *e, 
+# 73 "/root/repo/include/utils.h" 3 4
+                    _Bool 
+# 73 "/root/repo/include/utils.h"
+                         *success);
+
+
+void iqueue_commit(vaddr_t pc, uint8_t *instr_buf, uint8_t ilen);
+void iqueue_dump();
+
+
+
+
+
+# 82 "/root/repo/include/utils.h" 3 4
+_Bool 
+# 82 "/root/repo/include/utils.h"
+    is_gz_file(const char *filename);
+# 23 "/root/repo/include/debug.h" 2
+# 1 "/usr/include/unistd.h" 1 3 4
+# 27 "/usr/include/unistd.h" 3 4
+
+# 202 "/usr/include/unistd.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/posix_opt.h" 1 3 4
+# 203 "/usr/include/unistd.h" 2 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/environments.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/environments.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/environments.h" 2 3 4
+# 207 "/usr/include/unistd.h" 2 3 4
+# 226 "/usr/include/unistd.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 227 "/usr/include/unistd.h" 2 3 4
+
+
+
+
+
+
+# 232 "/usr/include/unistd.h" 3 4
+typedef __gid_t gid_t;
+
+
+
+
+typedef __uid_t uid_t;
+# 255 "/usr/include/unistd.h" 3 4
+typedef __useconds_t useconds_t;
+
+
+
+
+typedef __pid_t pid_t;
+# 274 "/usr/include/unistd.h" 3 4
+typedef __socklen_t socklen_t;
+# 287 "/usr/include/unistd.h" 3 4
+extern int access (const char *__name, int __type) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 309 "/usr/include/unistd.h" 3 4
+extern int faccessat (int __fd, const char *__file, int __type, int __flag)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) ;
+# 339 "/usr/include/unistd.h" 3 4
+extern __off_t lseek (int __fd, __off_t __offset, int __whence) __attribute__ ((__nothrow__ , __leaf__));
+# 358 "/usr/include/unistd.h" 3 4
+extern int close (int __fd);
+
+
+
+
+extern void closefrom (int __lowfd) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern ssize_t read (int __fd, void *__buf, size_t __nbytes)
+    __attribute__ ((__access__ (__write_only__, 2, 3)));
+
+
+
+
+
+extern ssize_t write (int __fd, const void *__buf, size_t __n)
+    __attribute__ ((__access__ (__read_only__, 2, 3)));
+# 389 "/usr/include/unistd.h" 3 4
+extern ssize_t pread (int __fd, void *__buf, size_t __nbytes,
+        __off_t __offset)
+    __attribute__ ((__access__ (__write_only__, 2, 3)));
+
+
+
+
+
+
+extern ssize_t pwrite (int __fd, const void *__buf, size_t __n,
+         __off_t __offset)
+    __attribute__ ((__access__ (__read_only__, 2, 3)));
+# 437 "/usr/include/unistd.h" 3 4
+extern int pipe (int __pipedes[2]) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 452 "/usr/include/unistd.h" 3 4
+extern unsigned int alarm (unsigned int __seconds) __attribute__ ((__nothrow__ , __leaf__));
+# 464 "/usr/include/unistd.h" 3 4
+extern unsigned int sleep (unsigned int __seconds);
+
+
+
+
+
+
+
+extern __useconds_t ualarm (__useconds_t __value, __useconds_t __interval)
+     __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern int usleep (__useconds_t __useconds);
+# 489 "/usr/include/unistd.h" 3 4
+extern int pause (void);
+
+
+
+extern int chown (const char *__file, __uid_t __owner, __gid_t __group)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+extern int fchown (int __fd, __uid_t __owner, __gid_t __group) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern int lchown (const char *__file, __uid_t __owner, __gid_t __group)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+
+
+extern int fchownat (int __fd, const char *__file, __uid_t __owner,
+       __gid_t __group, int __flag)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) ;
+
+
+
+extern int chdir (const char *__path) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+extern int fchdir (int __fd) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 531 "/usr/include/unistd.h" 3 4
+extern char *getcwd (char *__buf, size_t __size) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 545 "/usr/include/unistd.h" 3 4
+extern char *getwd (char *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) __attribute__ ((__deprecated__))
+    __attribute__ ((__access__ (__write_only__, 1)));
+
+
+
+
+extern int dup (int __fd) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern int dup2 (int __fd, int __fd2) __attribute__ ((__nothrow__ , __leaf__));
+# 564 "/usr/include/unistd.h" 3 4
+extern char **__environ;
+
+
+
+
+
+
+
+extern int execve (const char *__path, char *const __argv[],
+     char *const __envp[]) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern int fexecve (int __fd, char *const __argv[], char *const __envp[])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+
+extern int execv (const char *__path, char *const __argv[])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern int execle (const char *__path, const char *__arg, ...)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern int execl (const char *__path, const char *__arg, ...)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern int execvp (const char *__file, char *const __argv[])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern int execlp (const char *__file, const char *__arg, ...)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+# 619 "/usr/include/unistd.h" 3 4
+extern int nice (int __inc) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern void _exit (int __status) __attribute__ ((__noreturn__));
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/confname.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/confname.h" 3 4
+enum
+  {
+    _PC_LINK_MAX,
+
+    _PC_MAX_CANON,
+
+    _PC_MAX_INPUT,
+
+    _PC_NAME_MAX,
+
+    _PC_PATH_MAX,
+
+    _PC_PIPE_BUF,
+
+    _PC_CHOWN_RESTRICTED,
+
+    _PC_NO_TRUNC,
+
+    _PC_VDISABLE,
+
+    _PC_SYNC_IO,
+
+    _PC_ASYNC_IO,
+
+    _PC_PRIO_IO,
+
+    _PC_SOCK_MAXBUF,
+
+    _PC_FILESIZEBITS,
+
+    _PC_REC_INCR_XFER_SIZE,
+
+    _PC_REC_MAX_XFER_SIZE,
+
+    _PC_REC_MIN_XFER_SIZE,
+
+    _PC_REC_XFER_ALIGN,
+
+    _PC_ALLOC_SIZE_MIN,
+
+    _PC_SYMLINK_MAX,
+
+    _PC_2_SYMLINKS
+
+  };
+
+
+enum
+  {
+    _SC_ARG_MAX,
+
+    _SC_CHILD_MAX,
+
+    _SC_CLK_TCK,
+
+    _SC_NGROUPS_MAX,
+
+    _SC_OPEN_MAX,
+
+    _SC_STREAM_MAX,
+
+    _SC_TZNAME_MAX,
+
+    _SC_JOB_CONTROL,
+
+    _SC_SAVED_IDS,
+
+    _SC_REALTIME_SIGNALS,
+
+    _SC_PRIORITY_SCHEDULING,
+
+    _SC_TIMERS,
+
+    _SC_ASYNCHRONOUS_IO,
+
+    _SC_PRIORITIZED_IO,
+
+    _SC_SYNCHRONIZED_IO,
+
+    _SC_FSYNC,
+
+    _SC_MAPPED_FILES,
+
+    _SC_MEMLOCK,
+
+    _SC_MEMLOCK_RANGE,
+
+    _SC_MEMORY_PROTECTION,
+
+    _SC_MESSAGE_PASSING,
+
+    _SC_SEMAPHORES,
+
+    _SC_SHARED_MEMORY_OBJECTS,
+
+    _SC_AIO_LISTIO_MAX,
+
+    _SC_AIO_MAX,
+
+    _SC_AIO_PRIO_DELTA_MAX,
+
+    _SC_DELAYTIMER_MAX,
+
+    _SC_MQ_OPEN_MAX,
+
+    _SC_MQ_PRIO_MAX,
+
+    _SC_VERSION,
+
+    _SC_PAGESIZE,
+
+
+    _SC_RTSIG_MAX,
+
+    _SC_SEM_NSEMS_MAX,
+
+    _SC_SEM_VALUE_MAX,
+
+    _SC_SIGQUEUE_MAX,
+
+    _SC_TIMER_MAX,
+
+
+
+
+    _SC_BC_BASE_MAX,
+
+    _SC_BC_DIM_MAX,
+
+    _SC_BC_SCALE_MAX,
+
+    _SC_BC_STRING_MAX,
+
+    _SC_COLL_WEIGHTS_MAX,
+
+    _SC_EQUIV_CLASS_MAX,
+
+    _SC_EXPR_NEST_MAX,
+
+    _SC_LINE_MAX,
+
+    _SC_RE_DUP_MAX,
+
+    _SC_CHARCLASS_NAME_MAX,
+
+
+    _SC_2_VERSION,
+
+    _SC_2_C_BIND,
+
+    _SC_2_C_DEV,
+
+    _SC_2_FORT_DEV,
+
+    _SC_2_FORT_RUN,
+
+    _SC_2_SW_DEV,
+
+    _SC_2_LOCALEDEF,
+
+
+    _SC_PII,
+
+    _SC_PII_XTI,
+
+    _SC_PII_SOCKET,
+
+    _SC_PII_INTERNET,
+
+    _SC_PII_OSI,
+
+    _SC_POLL,
+
+    _SC_SELECT,
+
+    _SC_UIO_MAXIOV,
+
+    _SC_IOV_MAX = _SC_UIO_MAXIOV,
+
+    _SC_PII_INTERNET_STREAM,
+
+    _SC_PII_INTERNET_DGRAM,
+
+    _SC_PII_OSI_COTS,
+
+    _SC_PII_OSI_CLTS,
+
+    _SC_PII_OSI_M,
+
+    _SC_T_IOV_MAX,
+
+
+
+    _SC_THREADS,
+
+    _SC_THREAD_SAFE_FUNCTIONS,
+
+    _SC_GETGR_R_SIZE_MAX,
+
+    _SC_GETPW_R_SIZE_MAX,
+
+    _SC_LOGIN_NAME_MAX,
+
+    _SC_TTY_NAME_MAX,
+
+    _SC_THREAD_DESTRUCTOR_ITERATIONS,
+
+    _SC_THREAD_KEYS_MAX,
+
+    _SC_THREAD_STACK_MIN,
+
+    _SC_THREAD_THREADS_MAX,
+
+    _SC_THREAD_ATTR_STACKADDR,
+
+    _SC_THREAD_ATTR_STACKSIZE,
+
+    _SC_THREAD_PRIORITY_SCHEDULING,
+
+    _SC_THREAD_PRIO_INHERIT,
+
+    _SC_THREAD_PRIO_PROTECT,
+
+    _SC_THREAD_PROCESS_SHARED,
+
+
+    _SC_NPROCESSORS_CONF,
+
+    _SC_NPROCESSORS_ONLN,
+
+    _SC_PHYS_PAGES,
+
+    _SC_AVPHYS_PAGES,
+
+    _SC_ATEXIT_MAX,
+
+    _SC_PASS_MAX,
+
+
+    _SC_XOPEN_VERSION,
+
+    _SC_XOPEN_XCU_VERSION,
+
+    _SC_XOPEN_UNIX,
+
+    _SC_XOPEN_CRYPT,
+
+    _SC_XOPEN_ENH_I18N,
+
+    _SC_XOPEN_SHM,
+
+
+    _SC_2_CHAR_TERM,
+
+    _SC_2_C_VERSION,
+
+    _SC_2_UPE,
+
+
+    _SC_XOPEN_XPG2,
+
+    _SC_XOPEN_XPG3,
+
+    _SC_XOPEN_XPG4,
+
+
+    _SC_CHAR_BIT,
+
+    _SC_CHAR_MAX,
+
+    _SC_CHAR_MIN,
+
+    _SC_INT_MAX,
+
+    _SC_INT_MIN,
+
+    _SC_LONG_BIT,
+
+    _SC_WORD_BIT,
+
+    _SC_MB_LEN_MAX,
+
+    _SC_NZERO,
+
+    _SC_SSIZE_MAX,
+
+    _SC_SCHAR_MAX,
+
+    _SC_SCHAR_MIN,
+
+    _SC_SHRT_MAX,
+
+    _SC_SHRT_MIN,
+
+    _SC_UCHAR_MAX,
+
+    _SC_UINT_MAX,
+
+    _SC_ULONG_MAX,
+
+    _SC_USHRT_MAX,
+
+
+    _SC_NL_ARGMAX,
+
+    _SC_NL_LANGMAX,
+
+    _SC_NL_MSGMAX,
+
+    _SC_NL_NMAX,
+
+    _SC_NL_SETMAX,
+
+    _SC_NL_TEXTMAX,
+
+
+    _SC_XBS5_ILP32_OFF32,
+
+    _SC_XBS5_ILP32_OFFBIG,
+
+    _SC_XBS5_LP64_OFF64,
+
+    _SC_XBS5_LPBIG_OFFBIG,
+
+
+    _SC_XOPEN_LEGACY,
+
+    _SC_XOPEN_REALTIME,
+
+    _SC_XOPEN_REALTIME_THREADS,
+
+
+    _SC_ADVISORY_INFO,
+
+    _SC_BARRIERS,
+
+    _SC_BASE,
+
+    _SC_C_LANG_SUPPORT,
+
+    _SC_C_LANG_SUPPORT_R,
+
+    _SC_CLOCK_SELECTION,
+
+    _SC_CPUTIME,
+
+    _SC_THREAD_CPUTIME,
+
+    _SC_DEVICE_IO,
+
+    _SC_DEVICE_SPECIFIC,
+
+    _SC_DEVICE_SPECIFIC_R,
+
+    _SC_FD_MGMT,
+
+    _SC_FIFO,
+
+    _SC_PIPE,
+
+    _SC_FILE_ATTRIBUTES,
+
+    _SC_FILE_LOCKING,
+
+    _SC_FILE_SYSTEM,
+
+    _SC_MONOTONIC_CLOCK,
+
+    _SC_MULTI_PROCESS,
+
+    _SC_SINGLE_PROCESS,
+
+    _SC_NETWORKING,
+
+    _SC_READER_WRITER_LOCKS,
+
+    _SC_SPIN_LOCKS,
+
+    _SC_REGEXP,
+
+    _SC_REGEX_VERSION,
+
+    _SC_SHELL,
+
+    _SC_SIGNALS,
+
+    _SC_SPAWN,
+
+    _SC_SPORADIC_SERVER,
+
+    _SC_THREAD_SPORADIC_SERVER,
+
+    _SC_SYSTEM_DATABASE,
+
+    _SC_SYSTEM_DATABASE_R,
+
+    _SC_TIMEOUTS,
+
+    _SC_TYPED_MEMORY_OBJECTS,
+
+    _SC_USER_GROUPS,
+
+    _SC_USER_GROUPS_R,
+
+    _SC_2_PBS,
+
+    _SC_2_PBS_ACCOUNTING,
+
+    _SC_2_PBS_LOCATE,
+
+    _SC_2_PBS_MESSAGE,
+
+    _SC_2_PBS_TRACK,
+
+    _SC_SYMLOOP_MAX,
+
+    _SC_STREAMS,
+
+    _SC_2_PBS_CHECKPOINT,
+
+
+    _SC_V6_ILP32_OFF32,
+
+    _SC_V6_ILP32_OFFBIG,
+
+    _SC_V6_LP64_OFF64,
+
+    _SC_V6_LPBIG_OFFBIG,
+
+
+    _SC_HOST_NAME_MAX,
+
+    _SC_TRACE,
+
+    _SC_TRACE_EVENT_FILTER,
+
+    _SC_TRACE_INHERIT,
+
+    _SC_TRACE_LOG,
+
+
+    _SC_LEVEL1_ICACHE_SIZE,
+
+    _SC_LEVEL1_ICACHE_ASSOC,
+
+    _SC_LEVEL1_ICACHE_LINESIZE,
+
+    _SC_LEVEL1_DCACHE_SIZE,
+
+    _SC_LEVEL1_DCACHE_ASSOC,
+
+    _SC_LEVEL1_DCACHE_LINESIZE,
+
+    _SC_LEVEL2_CACHE_SIZE,
+
+    _SC_LEVEL2_CACHE_ASSOC,
+
+    _SC_LEVEL2_CACHE_LINESIZE,
+
+    _SC_LEVEL3_CACHE_SIZE,
+
+    _SC_LEVEL3_CACHE_ASSOC,
+
+    _SC_LEVEL3_CACHE_LINESIZE,
+
+    _SC_LEVEL4_CACHE_SIZE,
+
+    _SC_LEVEL4_CACHE_ASSOC,
+
+    _SC_LEVEL4_CACHE_LINESIZE,
+
+
+
+    _SC_IPV6 = _SC_LEVEL1_ICACHE_SIZE + 50,
+
+    _SC_RAW_SOCKETS,
+
+
+    _SC_V7_ILP32_OFF32,
+
+    _SC_V7_ILP32_OFFBIG,
+
+    _SC_V7_LP64_OFF64,
+
+    _SC_V7_LPBIG_OFFBIG,
+
+
+    _SC_SS_REPL_MAX,
+
+
+    _SC_TRACE_EVENT_NAME_MAX,
+
+    _SC_TRACE_NAME_MAX,
+
+    _SC_TRACE_SYS_MAX,
+
+    _SC_TRACE_USER_EVENT_MAX,
+
+
+    _SC_XOPEN_STREAMS,
+
+
+    _SC_THREAD_ROBUST_PRIO_INHERIT,
+
+    _SC_THREAD_ROBUST_PRIO_PROTECT,
+
+
+    _SC_MINSIGSTKSZ,
+
+
+    _SC_SIGSTKSZ
+
+  };
+
+
+enum
+  {
+    _CS_PATH,
+
+
+    _CS_V6_WIDTH_RESTRICTED_ENVS,
+
+
+
+    _CS_GNU_LIBC_VERSION,
+
+    _CS_GNU_LIBPTHREAD_VERSION,
+
+
+    _CS_V5_WIDTH_RESTRICTED_ENVS,
+
+
+
+    _CS_V7_WIDTH_RESTRICTED_ENVS,
+
+
+
+    _CS_LFS_CFLAGS = 1000,
+
+    _CS_LFS_LDFLAGS,
+
+    _CS_LFS_LIBS,
+
+    _CS_LFS_LINTFLAGS,
+
+    _CS_LFS64_CFLAGS,
+
+    _CS_LFS64_LDFLAGS,
+
+    _CS_LFS64_LIBS,
+
+    _CS_LFS64_LINTFLAGS,
+
+
+    _CS_XBS5_ILP32_OFF32_CFLAGS = 1100,
+
+    _CS_XBS5_ILP32_OFF32_LDFLAGS,
+
+    _CS_XBS5_ILP32_OFF32_LIBS,
+
+    _CS_XBS5_ILP32_OFF32_LINTFLAGS,
+
+    _CS_XBS5_ILP32_OFFBIG_CFLAGS,
+
+    _CS_XBS5_ILP32_OFFBIG_LDFLAGS,
+
+    _CS_XBS5_ILP32_OFFBIG_LIBS,
+
+    _CS_XBS5_ILP32_OFFBIG_LINTFLAGS,
+
+    _CS_XBS5_LP64_OFF64_CFLAGS,
+
+    _CS_XBS5_LP64_OFF64_LDFLAGS,
+
+    _CS_XBS5_LP64_OFF64_LIBS,
+
+    _CS_XBS5_LP64_OFF64_LINTFLAGS,
+
+    _CS_XBS5_LPBIG_OFFBIG_CFLAGS,
+
+    _CS_XBS5_LPBIG_OFFBIG_LDFLAGS,
+
+    _CS_XBS5_LPBIG_OFFBIG_LIBS,
+
+    _CS_XBS5_LPBIG_OFFBIG_LINTFLAGS,
+
+
+    _CS_POSIX_V6_ILP32_OFF32_CFLAGS,
+
+    _CS_POSIX_V6_ILP32_OFF32_LDFLAGS,
+
+    _CS_POSIX_V6_ILP32_OFF32_LIBS,
+
+    _CS_POSIX_V6_ILP32_OFF32_LINTFLAGS,
+
+    _CS_POSIX_V6_ILP32_OFFBIG_CFLAGS,
+
+    _CS_POSIX_V6_ILP32_OFFBIG_LDFLAGS,
+
+    _CS_POSIX_V6_ILP32_OFFBIG_LIBS,
+
+    _CS_POSIX_V6_ILP32_OFFBIG_LINTFLAGS,
+
+    _CS_POSIX_V6_LP64_OFF64_CFLAGS,
+
+    _CS_POSIX_V6_LP64_OFF64_LDFLAGS,
+
+    _CS_POSIX_V6_LP64_OFF64_LIBS,
+
+    _CS_POSIX_V6_LP64_OFF64_LINTFLAGS,
+
+    _CS_POSIX_V6_LPBIG_OFFBIG_CFLAGS,
+
+    _CS_POSIX_V6_LPBIG_OFFBIG_LDFLAGS,
+
+    _CS_POSIX_V6_LPBIG_OFFBIG_LIBS,
+
+    _CS_POSIX_V6_LPBIG_OFFBIG_LINTFLAGS,
+
+
+    _CS_POSIX_V7_ILP32_OFF32_CFLAGS,
+
+    _CS_POSIX_V7_ILP32_OFF32_LDFLAGS,
+
+    _CS_POSIX_V7_ILP32_OFF32_LIBS,
+
+    _CS_POSIX_V7_ILP32_OFF32_LINTFLAGS,
+
+    _CS_POSIX_V7_ILP32_OFFBIG_CFLAGS,
+
+    _CS_POSIX_V7_ILP32_OFFBIG_LDFLAGS,
+
+    _CS_POSIX_V7_ILP32_OFFBIG_LIBS,
+
+    _CS_POSIX_V7_ILP32_OFFBIG_LINTFLAGS,
+
+    _CS_POSIX_V7_LP64_OFF64_CFLAGS,
+
+    _CS_POSIX_V7_LP64_OFF64_LDFLAGS,
+
+    _CS_POSIX_V7_LP64_OFF64_LIBS,
+
+    _CS_POSIX_V7_LP64_OFF64_LINTFLAGS,
+
+    _CS_POSIX_V7_LPBIG_OFFBIG_CFLAGS,
+
+    _CS_POSIX_V7_LPBIG_OFFBIG_LDFLAGS,
+
+    _CS_POSIX_V7_LPBIG_OFFBIG_LIBS,
+
+    _CS_POSIX_V7_LPBIG_OFFBIG_LINTFLAGS,
+
+
+    _CS_V6_ENV,
+
+    _CS_V7_ENV
+
+  };
+# 631 "/usr/include/unistd.h" 2 3 4
+
+
+extern long int pathconf (const char *__path, int __name)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern long int fpathconf (int __fd, int __name) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern long int sysconf (int __name) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern size_t confstr (int __name, char *__buf, size_t __len) __attribute__ ((__nothrow__ , __leaf__))
+    __attribute__ ((__access__ (__write_only__, 2, 3)));
+
+
+
+
+extern __pid_t getpid (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern __pid_t getppid (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern __pid_t getpgrp (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern __pid_t __getpgid (__pid_t __pid) __attribute__ ((__nothrow__ , __leaf__));
+
+extern __pid_t getpgid (__pid_t __pid) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern int setpgid (__pid_t __pid, __pid_t __pgid) __attribute__ ((__nothrow__ , __leaf__));
+# 682 "/usr/include/unistd.h" 3 4
+extern int setpgrp (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern __pid_t setsid (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern __pid_t getsid (__pid_t __pid) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern __uid_t getuid (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern __uid_t geteuid (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern __gid_t getgid (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern __gid_t getegid (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern int getgroups (int __size, __gid_t __list[]) __attribute__ ((__nothrow__ , __leaf__))
+    __attribute__ ((__access__ (__write_only__, 2, 1)));
+# 722 "/usr/include/unistd.h" 3 4
+extern int setuid (__uid_t __uid) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern int setreuid (__uid_t __ruid, __uid_t __euid) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern int seteuid (__uid_t __uid) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+
+extern int setgid (__gid_t __gid) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern int setregid (__gid_t __rgid, __gid_t __egid) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern int setegid (__gid_t __gid) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 778 "/usr/include/unistd.h" 3 4
+extern __pid_t fork (void) __attribute__ ((__nothrow__));
+
+
+
+
+
+
+
+extern __pid_t vfork (void) __attribute__ ((__nothrow__ , __leaf__));
+# 799 "/usr/include/unistd.h" 3 4
+extern char *ttyname (int __fd) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int ttyname_r (int __fd, char *__buf, size_t __buflen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)))
+     __attribute__ ((__access__ (__write_only__, 2, 3)));
+
+
+
+extern int isatty (int __fd) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern int ttyslot (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern int link (const char *__from, const char *__to)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2))) ;
+
+
+
+
+extern int linkat (int __fromfd, const char *__from, int __tofd,
+     const char *__to, int __flags)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4))) ;
+
+
+
+
+extern int symlink (const char *__from, const char *__to)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2))) ;
+
+
+
+
+extern ssize_t readlink (const char *__restrict __path,
+    char *__restrict __buf, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)))
+     __attribute__ ((__access__ (__write_only__, 2, 3)));
+
+
+
+
+
+extern int symlinkat (const char *__from, int __tofd,
+        const char *__to) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 3))) ;
+
+
+extern ssize_t readlinkat (int __fd, const char *__restrict __path,
+      char *__restrict __buf, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)))
+     __attribute__ ((__access__ (__write_only__, 3, 4)));
+
+
+
+extern int unlink (const char *__name) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int unlinkat (int __fd, const char *__name, int __flag)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern int rmdir (const char *__path) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern __pid_t tcgetpgrp (int __fd) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int tcsetpgrp (int __fd, __pid_t __pgrp_id) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern char *getlogin (void);
+
+
+
+
+
+
+
+extern int getlogin_r (char *__name, size_t __name_len) __attribute__ ((__nonnull__ (1)))
+    __attribute__ ((__access__ (__write_only__, 1, 2)));
+
+
+
+
+extern int setlogin (const char *__name) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/getopt_posix.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/getopt_posix.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/getopt_core.h" 1 3 4
+# 28 "/usr/include/x86_64-linux-gnu/bits/getopt_core.h" 3 4
+
+
+
+
+
+
+
+
+extern char *optarg;
+# 50 "/usr/include/x86_64-linux-gnu/bits/getopt_core.h" 3 4
+extern int optind;
+
+
+
+
+extern int opterr;
+
+
+
+extern int optopt;
+# 91 "/usr/include/x86_64-linux-gnu/bits/getopt_core.h" 3 4
+extern int getopt (int ___argc, char *const *___argv, const char *__shortopts)
+       __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+
+
+# 28 "/usr/include/x86_64-linux-gnu/bits/getopt_posix.h" 2 3 4
+
+
+# 49 "/usr/include/x86_64-linux-gnu/bits/getopt_posix.h" 3 4
+
+# 904 "/usr/include/unistd.h" 2 3 4
+
+
+
+
+
+
+
+extern int gethostname (char *__name, size_t __len) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)))
+    __attribute__ ((__access__ (__write_only__, 1, 2)));
+
+
+
+
+
+
+extern int sethostname (const char *__name, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) __attribute__ ((__access__ (__read_only__, 1, 2)));
+
+
+
+extern int sethostid (long int __id) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+extern int getdomainname (char *__name, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)))
+     __attribute__ ((__access__ (__write_only__, 1, 2)));
+extern int setdomainname (const char *__name, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) __attribute__ ((__access__ (__read_only__, 1, 2)));
+
+
+
+
+extern int vhangup (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int revoke (const char *__file) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+
+
+
+extern int profil (unsigned short int *__sample_buffer, size_t __size,
+     size_t __offset, unsigned int __scale)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern int acct (const char *__name) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern char *getusershell (void) __attribute__ ((__nothrow__ , __leaf__));
+extern void endusershell (void) __attribute__ ((__nothrow__ , __leaf__));
+extern void setusershell (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern int daemon (int __nochdir, int __noclose) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+
+extern int chroot (const char *__path) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+extern char *getpass (const char *__prompt) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+extern int fsync (int __fd);
+# 1002 "/usr/include/unistd.h" 3 4
+extern long int gethostid (void);
+
+
+extern void sync (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern int getpagesize (void) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern int getdtablesize (void) __attribute__ ((__nothrow__ , __leaf__));
+# 1026 "/usr/include/unistd.h" 3 4
+extern int truncate (const char *__file, __off_t __length)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 1049 "/usr/include/unistd.h" 3 4
+extern int ftruncate (int __fd, __off_t __length) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 1070 "/usr/include/unistd.h" 3 4
+extern int brk (void *__addr) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+extern void *sbrk (intptr_t __delta) __attribute__ ((__nothrow__ , __leaf__));
+# 1091 "/usr/include/unistd.h" 3 4
+extern long int syscall (long int __sysno, ...) __attribute__ ((__nothrow__ , __leaf__));
+# 1114 "/usr/include/unistd.h" 3 4
+extern int lockf (int __fd, int __cmd, __off_t __len) ;
+# 1150 "/usr/include/unistd.h" 3 4
+extern int fdatasync (int __fildes);
+# 1159 "/usr/include/unistd.h" 3 4
+extern char *crypt (const char *__key, const char *__salt)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+# 1198 "/usr/include/unistd.h" 3 4
+int getentropy (void *__buffer, size_t __length)
+    __attribute__ ((__access__ (__write_only__, 1, 2)));
+# 1218 "/usr/include/unistd.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/unistd_ext.h" 1 3 4
+# 1219 "/usr/include/unistd.h" 2 3 4
+
+
+# 24 "/root/repo/include/debug.h" 2
+# 56 "/root/repo/include/common.h" 2
+# 21 "/root/repo/src/isa/riscv64/include/isa-def.h" 2
+
+
+
+
+
+
+
+
+# 28 "/root/repo/src/isa/riscv64/include/isa-def.h"
+struct ExecutionGuide {
+
+  
+# 30 "/root/repo/src/isa/riscv64/include/isa-def.h" 3 4
+ _Bool 
+# 30 "/root/repo/src/isa/riscv64/include/isa-def.h"
+      force_raise_exception;
+  uint64_t exception_num;
+  uint64_t mtval;
+  uint64_t stval;
+
+  
+# 35 "/root/repo/src/isa/riscv64/include/isa-def.h" 3 4
+ _Bool 
+# 35 "/root/repo/src/isa/riscv64/include/isa-def.h"
+      force_set_jump_target;
+  uint64_t jump_target;
+};
+
+struct DebugInfo {
+  uint64_t current_pc;
+};
+# 58 "/root/repo/src/isa/riscv64/include/isa-def.h"
+typedef struct {
+
+  union {
+    uint64_t _64;
+  } gpr[32];
+
+  union {
+    uint64_t _64;
+  } fpr[32];
+
+
+  uint64_t pc;
+  uint64_t mstatus, mcause, mepc;
+  uint64_t sstatus, scause, sepc;
+
+  uint64_t satp, mip, mie, mscratch, sscratch, mideleg, medeleg;
+  uint64_t mtval, stval, mtvec, stvec;
+  uint64_t mode;
+# 93 "/root/repo/src/isa/riscv64/include/isa-def.h"
+  
+# 93 "/root/repo/src/isa/riscv64/include/isa-def.h" 3 4
+ _Bool 
+# 93 "/root/repo/src/isa/riscv64/include/isa-def.h"
+      amo;
+  int mem_exception;
+
+
+  uint64_t lr_addr;
+  uint64_t lr_valid;
+
+
+
+
+
+  
+# 104 "/root/repo/src/isa/riscv64/include/isa-def.h" 3 4
+ _Bool 
+# 104 "/root/repo/src/isa/riscv64/include/isa-def.h"
+      INTR;
+
+
+  
+# 107 "/root/repo/src/isa/riscv64/include/isa-def.h" 3 4
+ _Bool 
+# 107 "/root/repo/src/isa/riscv64/include/isa-def.h"
+      guided_exec;
+  struct ExecutionGuide execution_guide;
+
+
+  struct DebugInfo debug;
+
+
+
+} riscv64_CPU_state;
+
+
+typedef struct {
+  union {
+    struct {
+      uint32_t opcode1_0 : 2;
+      uint32_t opcode6_2 : 5;
+      uint32_t rd : 5;
+      uint32_t funct3 : 3;
+      uint32_t rs1 : 5;
+      uint32_t rs2 : 5;
+      uint32_t funct7 : 7;
+    } r;
+    struct {
+      uint32_t opcode1_0 : 2;
+      uint32_t opcode6_2 : 5;
+      uint32_t rd : 5;
+      uint32_t funct3 : 3;
+      uint32_t rs1 : 5;
+      int32_t simm11_0 :12;
+    } i;
+    struct {
+      uint32_t opcode1_0 : 2;
+      uint32_t opcode6_2 : 5;
+      uint32_t imm4_0 : 5;
+      uint32_t funct3 : 3;
+      uint32_t rs1 : 5;
+      uint32_t rs2 : 5;
+      int32_t simm11_5 : 7;
+    } s;
+    struct {
+      uint32_t opcode1_0 : 2;
+      uint32_t opcode6_2 : 5;
+      uint32_t imm11 : 1;
+      uint32_t imm4_1 : 4;
+      uint32_t funct3 : 3;
+      uint32_t rs1 : 5;
+      uint32_t rs2 : 5;
+      uint32_t imm10_5 : 6;
+      int32_t simm12 : 1;
+    } b;
+    struct {
+      uint32_t opcode1_0 : 2;
+      uint32_t opcode6_2 : 5;
+      uint32_t rd : 5;
+      int32_t simm31_12 :20;
+    } u;
+    struct {
+      uint32_t opcode1_0 : 2;
+      uint32_t opcode6_2 : 5;
+      uint32_t rd : 5;
+      uint32_t imm19_12 : 8;
+      uint32_t imm11 : 1;
+      uint32_t imm10_1 :10;
+      int32_t simm20 : 1;
+    } j;
+    struct {
+      uint32_t pad7 :20;
+      uint32_t csr :12;
+    } csr;
+    struct {
+      uint32_t opcode1_0 : 2;
+      uint32_t opcode6_2 : 5;
+      uint32_t rd : 5;
+      uint32_t rm : 3;
+      uint32_t rs1 : 5;
+      uint32_t rs2 : 5;
+      uint32_t fmt : 2;
+      uint32_t funct5 : 5;
+    } fp;
+# 238 "/root/repo/src/isa/riscv64/include/isa-def.h"
+    uint32_t val;
+  } instr;
+} riscv64_ISADecodeInfo;
+
+enum { MODE_U = 0, MODE_S, MODE_H, MODE_M };
+
+int get_data_mmu_state();
+# 22 "/root/repo/include/isa.h" 2
+
+
+
+typedef riscv64_CPU_state CPU_state;
+typedef riscv64_ISADecodeInfo ISADecodeInfo;
+
+
+extern char isa_logo[];
+void init_isa();
+
+
+
+
+
+extern CPU_state cpu;
+extern rtlreg_t csr_array[4096];
+void isa_reg_display();
+word_t isa_reg_str2val(const char *name, 
+# 39 "/root/repo/include/isa.h" 3 4
+                                        _Bool 
+# 39 "/root/repo/include/isa.h"
+                                             *success);
+
+
+struct Decode;
+int isa_fetch_decode(struct Decode *s);
+void isa_hostcall(uint32_t id, rtlreg_t *dest, const rtlreg_t *src1,
+    const rtlreg_t *src2, word_t imm);
+
+
+enum { MMU_DIRECT, MMU_TRANSLATE, MMU_DYNAMIC };
+enum { MEM_TYPE_IFETCH, MEM_TYPE_READ, MEM_TYPE_WRITE, MEM_TYPE_IFETCH_READ, MEM_TYPE_WRITE_READ };
+enum { MEM_RET_OK, MEM_RET_FAIL, MEM_RET_CROSS_PAGE };
+
+
+
+
+int isa_mmu_check(vaddr_t vaddr, int len, int type);
+
+paddr_t isa_mmu_translate(vaddr_t vaddr, int len, int type);
+
+# 58 "/root/repo/include/isa.h" 3 4
+_Bool 
+# 58 "/root/repo/include/isa.h"
+    isa_pmp_check_permission(paddr_t addr, int len, int type, int mode);
+
+# 59 "/root/repo/include/isa.h" 3 4
+_Bool 
+# 59 "/root/repo/include/isa.h"
+    isa_spmp_check_permission(paddr_t addr, int len, int type, int mode);
+
+
+vaddr_t raise_intr(word_t NO, vaddr_t epc);
+
+word_t isa_query_intr();
+
+# 65 "/root/repo/include/isa.h" 3 4
+_Bool 
+# 65 "/root/repo/include/isa.h"
+    isa_has_pending_intr();
+
+
+struct CptRegs;
+void isa_restore_cpt_regs(const struct CptRegs *regs);
+
+
+
+
+# 73 "/root/repo/include/isa.h" 3 4
+_Bool 
+# 73 "/root/repo/include/isa.h"
+    isa_difftest_checkregs(CPU_state *ref_r, vaddr_t pc);
+void isa_difftest_attach();
+
+
+void isa_difftest_regcpy(void *dut, 
+# 77 "/root/repo/include/isa.h" 3 4
+                                   _Bool 
+# 77 "/root/repo/include/isa.h"
+                                        direction);
+void isa_difftest_csrcpy(void *dut, 
+# 78 "/root/repo/include/isa.h" 3 4
+                                   _Bool 
+# 78 "/root/repo/include/isa.h"
+                                        direction);
+void isa_difftest_raise_intr(word_t NO);
+void isa_difftest_uarchstatus_cpy(void *dut, 
+# 80 "/root/repo/include/isa.h" 3 4
+                                            _Bool 
+# 80 "/root/repo/include/isa.h"
+                                                 direction);
+void isa_difftest_guided_exec(void *guide);
+void isa_difftest_query_ref(void *result_buffer, uint64_t type);
+# 21 "/root/repo/include/cpu/decode.h" 2
+
+
+
+typedef struct {
+  union {
+    ;
+    ;
+    rtlreg_t *preg;
+    word_t imm;
+    sword_t simm;
+  };
+  ;
+  ;
+  ;
+  ;
+  ;
+  ;
+} Operand;
+
+enum {
+  INSTR_TYPE_N,
+  INSTR_TYPE_J,
+  INSTR_TYPE_B,
+  INSTR_TYPE_I,
+};
+
+
+
+
+
+typedef struct Decode {
+  union {
+    struct {
+      struct Decode *tnext;
+      struct Decode *ntnext;
+    };
+    struct {
+      struct Decode *list_next;
+      struct Decode *bb_src;
+    };
+  };
+  const void *EHelper;
+  ;
+  Operand dest, src1, src2;
+  vaddr_t pc;
+  uint16_t idx_in_bb;
+  uint8_t type;
+  uint32_t epoch;
+
+  vaddr_t snpc;
+  vaddr_t jnpc;
+  uint32_t exec_cnt;
+  uint32_t bbv_id;
+  struct Decode *rnext;
+  ;
+  ISADecodeInfo isa;
+  ;
+# 86 "/root/repo/include/cpu/decode.h"
+} Decode;
+# 122 "/root/repo/include/cpu/decode.h"
+static inline void decode_empty (Decode *s, int width) {}
+
+
+
+
+
+
+__attribute__((always_inline))
+static inline void pattern_decode(const char *str, int len,
+    uint32_t *key, uint32_t *mask, uint32_t *shift) {
+  uint32_t __key = 0, __mask = 0, __shift = 0;
+# 152 "/root/repo/include/cpu/decode.h"
+  if ((0) >= len) goto finish; else { char c = str[0]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail (
+# 152 "/root/repo/include/cpu/decode.h"
+ "c == '0' || c == '1' || c == '?'"
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ , "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((0) + 1) >= len) goto finish; else { char c = str[(0) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((0) + 2) >= len) goto finish; else { char c = str[(0) + 2]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((0) + 2) + 1) >= len) goto finish; else { char c = str[((0) + 2) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((0) + 4) >= len) goto finish; else { char c = str[(0) + 4]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((0) + 4) + 1) >= len) goto finish; else { char c = str[((0) + 4) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((0) + 4) + 2) >= len) goto finish; else { char c = str[((0) + 4) + 2]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((0) + 4) + 2) + 1) >= len) goto finish; else { char c = str[(((0) + 4) + 2) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((0) + 8) >= len) goto finish; else { char c = str[(0) + 8]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((0) + 8) + 1) >= len) goto finish; else { char c = str[((0) + 8) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((0) + 8) + 2) >= len) goto finish; else { char c = str[((0) + 8) + 2]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((0) + 8) + 2) + 1) >= len) goto finish; else { char c = str[(((0) + 8) + 2) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((0) + 8) + 4) >= len) goto finish; else { char c = str[((0) + 8) + 4]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((0) + 8) + 4) + 1) >= len) goto finish; else { char c = str[(((0) + 8) + 4) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((0) + 8) + 4) + 2) >= len) goto finish; else { char c = str[(((0) + 8) + 4) + 2]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((((0) + 8) + 4) + 2) + 1) >= len) goto finish; else { char c = str[((((0) + 8) + 4) + 2) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((0) + 16) >= len) goto finish; else { char c = str[(0) + 16]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((0) + 16) + 1) >= len) goto finish; else { char c = str[((0) + 16) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((0) + 16) + 2) >= len) goto finish; else { char c = str[((0) + 16) + 2]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((0) + 16) + 2) + 1) >= len) goto finish; else { char c = str[(((0) + 16) + 2) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((0) + 16) + 4) >= len) goto finish; else { char c = str[((0) + 16) + 4]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((0) + 16) + 4) + 1) >= len) goto finish; else { char c = str[(((0) + 16) + 4) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((0) + 16) + 4) + 2) >= len) goto finish; else { char c = str[(((0) + 16) + 4) + 2]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((((0) + 16) + 4) + 2) + 1) >= len) goto finish; else { char c = str[((((0) + 16) + 4) + 2) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((0) + 16) + 8) >= len) goto finish; else { char c = str[((0) + 16) + 8]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((0) + 16) + 8) + 1) >= len) goto finish; else { char c = str[(((0) + 16) + 8) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((0) + 16) + 8) + 2) >= len) goto finish; else { char c = str[(((0) + 16) + 8) + 2]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((((0) + 16) + 8) + 2) + 1) >= len) goto finish; else { char c = str[((((0) + 16) + 8) + 2) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((0) + 16) + 8) + 4) >= len) goto finish; else { char c = str[(((0) + 16) + 8) + 4]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((((0) + 16) + 8) + 4) + 1) >= len) goto finish; else { char c = str[((((0) + 16) + 8) + 4) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((((0) + 16) + 8) + 4) + 2) >= len) goto finish; else { char c = str[((((0) + 16) + 8) + 4) + 2]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((((0) + 16) + 8) + 4) + 2) + 1) >= len) goto finish; else { char c = str[(((((0) + 16) + 8) + 4) + 2) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((0) + 32) >= len) goto finish; else { char c = str[(0) + 32]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((0) + 32) + 1) >= len) goto finish; else { char c = str[((0) + 32) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((0) + 32) + 2) >= len) goto finish; else { char c = str[((0) + 32) + 2]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((0) + 32) + 2) + 1) >= len) goto finish; else { char c = str[(((0) + 32) + 2) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((0) + 32) + 4) >= len) goto finish; else { char c = str[((0) + 32) + 4]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((0) + 32) + 4) + 1) >= len) goto finish; else { char c = str[(((0) + 32) + 4) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((0) + 32) + 4) + 2) >= len) goto finish; else { char c = str[(((0) + 32) + 4) + 2]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((((0) + 32) + 4) + 2) + 1) >= len) goto finish; else { char c = str[((((0) + 32) + 4) + 2) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((0) + 32) + 8) >= len) goto finish; else { char c = str[((0) + 32) + 8]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((0) + 32) + 8) + 1) >= len) goto finish; else { char c = str[(((0) + 32) + 8) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((0) + 32) + 8) + 2) >= len) goto finish; else { char c = str[(((0) + 32) + 8) + 2]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((((0) + 32) + 8) + 2) + 1) >= len) goto finish; else { char c = str[((((0) + 32) + 8) + 2) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((0) + 32) + 8) + 4) >= len) goto finish; else { char c = str[(((0) + 32) + 8) + 4]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((((0) + 32) + 8) + 4) + 1) >= len) goto finish; else { char c = str[((((0) + 32) + 8) + 4) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((((0) + 32) + 8) + 4) + 2) >= len) goto finish; else { char c = str[((((0) + 32) + 8) + 4) + 2]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((((0) + 32) + 8) + 4) + 2) + 1) >= len) goto finish; else { char c = str[(((((0) + 32) + 8) + 4) + 2) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((0) + 32) + 16) >= len) goto finish; else { char c = str[((0) + 32) + 16]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((0) + 32) + 16) + 1) >= len) goto finish; else { char c = str[(((0) + 32) + 16) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((0) + 32) + 16) + 2) >= len) goto finish; else { char c = str[(((0) + 32) + 16) + 2]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((((0) + 32) + 16) + 2) + 1) >= len) goto finish; else { char c = str[((((0) + 32) + 16) + 2) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((0) + 32) + 16) + 4) >= len) goto finish; else { char c = str[(((0) + 32) + 16) + 4]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((((0) + 32) + 16) + 4) + 1) >= len) goto finish; else { char c = str[((((0) + 32) + 16) + 4) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((((0) + 32) + 16) + 4) + 2) >= len) goto finish; else { char c = str[((((0) + 32) + 16) + 4) + 2]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((((0) + 32) + 16) + 4) + 2) + 1) >= len) goto finish; else { char c = str[(((((0) + 32) + 16) + 4) + 2) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((0) + 32) + 16) + 8) >= len) goto finish; else { char c = str[(((0) + 32) + 16) + 8]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((((0) + 32) + 16) + 8) + 1) >= len) goto finish; else { char c = str[((((0) + 32) + 16) + 8) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((((0) + 32) + 16) + 8) + 2) >= len) goto finish; else { char c = str[((((0) + 32) + 16) + 8) + 2]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((((0) + 32) + 16) + 8) + 2) + 1) >= len) goto finish; else { char c = str[(((((0) + 32) + 16) + 8) + 2) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((((0) + 32) + 16) + 8) + 4) >= len) goto finish; else { char c = str[((((0) + 32) + 16) + 8) + 4]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((((0) + 32) + 16) + 8) + 4) + 1) >= len) goto finish; else { char c = str[(((((0) + 32) + 16) + 8) + 4) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((((0) + 32) + 16) + 8) + 4) + 2) >= len) goto finish; else { char c = str[(((((0) + 32) + 16) + 8) + 4) + 2]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((((((0) + 32) + 16) + 8) + 4) + 2) + 1) >= len) goto finish; else { char c = str[((((((0) + 32) + 16) + 8) + 4) + 2) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } };
+
+finish:
+  *key = __key >> __shift;
+  *mask = __mask >> __shift;
+  *shift = __shift;
+}
+# 20 "/root/repo/include/rtl/rtl.h" 2
+
+extern const rtlreg_t rzero;
+extern rtlreg_t tmp_reg[4];
+# 36 "/root/repo/include/rtl/rtl.h"
+enum {
+
+
+
+
+
+  RELOP_FALSE = 0 | 0 | 0 | 0,
+  RELOP_TRUE = 0 | 0 | 0 | 1,
+  RELOP_EQ = 0 | 0 | 2 | 0,
+  RELOP_NE = 0 | 0 | 2 | 1,
+
+  RELOP_LT = 0 | 4 | 0 | 0,
+  RELOP_LE = 0 | 4 | 2 | 0,
+  RELOP_GT = 0 | 4 | 2 | 1,
+  RELOP_GE = 0 | 4 | 0 | 1,
+
+  RELOP_LTU = 8 | 0 | 0 | 0,
+  RELOP_LEU = 8 | 0 | 2 | 0,
+  RELOP_GTU = 8 | 0 | 2 | 1,
+  RELOP_GEU = 8 | 0 | 0 | 1,
+};
+
+# 1 "/root/repo/include/rtl/fp.h" 1
+# 19 "/root/repo/include/rtl/fp.h"
+enum {
+  FPCALL_W32,
+  FPCALL_W64,
+  FPCALL_W128,
+  FPCALL_W80,
+};
+
+enum {
+  FPCALL_RM_RNE,
+  FPCALL_RM_RTZ,
+  FPCALL_RM_RDN,
+  FPCALL_RM_RUP,
+  FPCALL_RM_RMM,
+};
+
+enum {
+  FPCALL_EX_NX = 0x01,
+  FPCALL_EX_UF = 0x02,
+  FPCALL_EX_OF = 0x04,
+  FPCALL_EX_DZ = 0x08,
+  FPCALL_EX_NV = 0x10,
+};
+
+enum {
+  FPCALL_ADD,
+  FPCALL_SUB,
+  FPCALL_MUL,
+  FPCALL_DIV,
+  FPCALL_SQRT,
+  FPCALL_MADD,
+
+  FPCALL_I32ToF,
+  FPCALL_U32ToF,
+  FPCALL_I64ToF,
+  FPCALL_U64ToF,
+
+  FPCALL_FToI32,
+  FPCALL_FToU32,
+  FPCALL_FToI64,
+  FPCALL_FToU64,
+
+  FPCALL_F32ToF64,
+  FPCALL_F64ToF32,
+
+  FPCALL_NEED_RM,
+
+  FPCALL_MAX,
+  FPCALL_MIN,
+  FPCALL_LE,
+  FPCALL_EQ,
+  FPCALL_LT,
+};
+# 59 "/root/repo/include/rtl/rtl.h" 2
+
+enum {
+  HOSTCALL_EXIT,
+  HOSTCALL_INV,
+  HOSTCALL_PIO,
+  HOSTCALL_FP,
+  HOSTCALL_CSR,
+  HOSTCALL_TRAP,
+  HOSTCALL_PRIV,
+};
+
+void rtl_hostcall(Decode *s, uint32_t id, rtlreg_t *dest, const rtlreg_t *src1, const rtlreg_t *src2, word_t imm)
+                                     ;
+
+# 1 "/root/repo/src/engine/interpreter/rtl-basic.h" 1
+# 20 "/root/repo/src/engine/interpreter/rtl-basic.h"
+# 1 "/root/repo/src/engine/interpreter/c_op.h" 1
+# 64 "/root/repo/src/engine/interpreter/c_op.h"
+static inline 
+# 64 "/root/repo/src/engine/interpreter/c_op.h" 3 4
+             _Bool 
+# 64 "/root/repo/src/engine/interpreter/c_op.h"
+                  interpret_relop(uint32_t relop, const rtlreg_t src1, const rtlreg_t src2) {
+  switch (relop) {
+    case RELOP_FALSE: return 
+# 66 "/root/repo/src/engine/interpreter/c_op.h" 3 4
+                            0
+# 66 "/root/repo/src/engine/interpreter/c_op.h"
+                                 ;
+    case RELOP_TRUE: return 
+# 67 "/root/repo/src/engine/interpreter/c_op.h" 3 4
+                           1
+# 67 "/root/repo/src/engine/interpreter/c_op.h"
+                               ;
+    case RELOP_EQ: return src1 == src2;
+    case RELOP_NE: return src1 != src2;
+    case RELOP_LT: return (sword_t)src1 < (sword_t)src2;
+    case RELOP_LE: return (sword_t)src1 <= (sword_t)src2;
+    case RELOP_GT: return (sword_t)src1 > (sword_t)src2;
+    case RELOP_GE: return (sword_t)src1 >= (sword_t)src2;
+    case RELOP_LTU: return src1 < src2;
+    case RELOP_LEU: return src1 <= src2;
+    case RELOP_GTU: return src1 > src2;
+    case RELOP_GEU: return src1 >= src2;
+    default: do { if (!(0)) { fflush(
+# 78 "/root/repo/src/engine/interpreter/c_op.h" 3 4
+            stdout
+# 78 "/root/repo/src/engine/interpreter/c_op.h"
+            ); fprintf(
+# 78 "/root/repo/src/engine/interpreter/c_op.h" 3 4
+            stderr
+# 78 "/root/repo/src/engine/interpreter/c_op.h"
+            , "\33[1;31m"); fprintf(
+# 78 "/root/repo/src/engine/interpreter/c_op.h" 3 4
+            stderr
+# 78 "/root/repo/src/engine/interpreter/c_op.h"
+            , "unsupported relop = %d", relop); fprintf(
+# 78 "/root/repo/src/engine/interpreter/c_op.h" 3 4
+            stderr
+# 78 "/root/repo/src/engine/interpreter/c_op.h"
+            , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 78 "/root/repo/src/engine/interpreter/c_op.h" 3 4
+            ((void) sizeof ((
+# 78 "/root/repo/src/engine/interpreter/c_op.h"
+            0
+# 78 "/root/repo/src/engine/interpreter/c_op.h" 3 4
+            ) ? 1 : 0), __extension__ ({ if (
+# 78 "/root/repo/src/engine/interpreter/c_op.h"
+            0
+# 78 "/root/repo/src/engine/interpreter/c_op.h" 3 4
+            ) ; else __assert_fail (
+# 78 "/root/repo/src/engine/interpreter/c_op.h"
+            "0"
+# 78 "/root/repo/src/engine/interpreter/c_op.h" 3 4
+            , "/root/repo/src/engine/interpreter/c_op.h", 78, __extension__ __PRETTY_FUNCTION__); }))
+# 78 "/root/repo/src/engine/interpreter/c_op.h"
+            ; } } while (0);
+  }
+}
+# 21 "/root/repo/src/engine/interpreter/rtl-basic.h" 2
+# 1 "/root/repo/include/checkpoint/profiling.h" 1
+# 21 "/root/repo/include/checkpoint/profiling.h"
+enum ProfilingState {
+    NoProfiling = 0,
+    SimpointProfiling,
+    SimpointCheckpointing,
+    UniformCheckpointing
+};
+
+enum CheckpointFormat {
+    GzCheckpoint = 0,
+    ChunkedCheckpoint,
+};
+
+enum BbvFormat {
+    TextBbv = 0,
+    BinaryBbv,
+};
+
+extern int profiling_state;
+extern 
+# 39 "/root/repo/include/checkpoint/profiling.h" 3 4
+      _Bool 
+# 39 "/root/repo/include/checkpoint/profiling.h"
+           checkpoint_taking;
+extern 
+# 40 "/root/repo/include/checkpoint/profiling.h" 3 4
+      _Bool 
+# 40 "/root/repo/include/checkpoint/profiling.h"
+           checkpoint_restoring;
+extern 
+# 41 "/root/repo/include/checkpoint/profiling.h" 3 4
+      _Bool 
+# 41 "/root/repo/include/checkpoint/profiling.h"
+           checkpoint_native_restore;
+extern 
+# 42 "/root/repo/include/checkpoint/profiling.h" 3 4
+      _Bool 
+# 42 "/root/repo/include/checkpoint/profiling.h"
+           checkpoint_lazy_restore;
+extern char *checkpoint_cache_dir;
+extern uint64_t checkpoint_interval;
+extern int checkpoint_jobs;
+extern int checkpoint_format;
+extern int checkpoint_delta;
+extern int simpoint_cluster_maxk;
+extern int simpoint_bbv_format;
+extern uint64_t simpoint_shard_intervals;
+extern int simpoint_shard_jobs;
+
+extern 
+# 53 "/root/repo/include/checkpoint/profiling.h" 3 4
+      _Bool 
+# 53 "/root/repo/include/checkpoint/profiling.h"
+           profiling_started;
+extern 
+# 54 "/root/repo/include/checkpoint/profiling.h" 3 4
+      _Bool 
+# 54 "/root/repo/include/checkpoint/profiling.h"
+           force_cpt_mmode;
+# 22 "/root/repo/src/engine/interpreter/rtl-basic.h" 2
+# 1 "/root/repo/include/memory/vaddr.h" 1
+# 21 "/root/repo/include/memory/vaddr.h"
+struct Decode;
+word_t vaddr_ifetch(vaddr_t addr, int len);
+paddr_t vaddr_ifetch_paddr(vaddr_t addr);
+word_t vaddr_read(struct Decode *s, vaddr_t addr, int len, int mmu_mode);
+void vaddr_write(struct Decode *s, vaddr_t addr, int len, word_t data, int mmu_mode);
+
+word_t vaddr_read_safe(vaddr_t addr, int len);
+
+
+
+
+
+int force_raise_pf(vaddr_t vaddr, int type);
+# 23 "/root/repo/src/engine/interpreter/rtl-basic.h" 2
+# 42 "/root/repo/src/engine/interpreter/rtl-basic.h"
+static inline void rtl_add(Decode *s, rtlreg_t* dest, const rtlreg_t* src1, const rtlreg_t* src2) { *dest = ((*src1) + (*src2)); } static inline void rtl_addi(Decode *s, rtlreg_t* dest, const rtlreg_t* src1, const sword_t imm) { *dest = ((*src1) + (imm)); }
+static inline void rtl_sub(Decode *s, rtlreg_t* dest, const rtlreg_t* src1, const rtlreg_t* src2) { *dest = ((*src1) - (*src2)); } static inline void rtl_subi(Decode *s, rtlreg_t* dest, const rtlreg_t* src1, const sword_t imm) { *dest = ((*src1) - (imm)); }
+static inline void rtl_and(Decode *s, rtlreg_t* dest, const rtlreg_t* src1, const rtlreg_t* src2) { *dest = ((*src1) & (*src2)); } static inline void rtl_andi(Decode *s, rtlreg_t* dest, const rtlreg_t* src1, const sword_t imm) { *dest = ((*src1) & (imm)); }
+static inline void rtl_or(Decode *s, rtlreg_t* dest, const rtlreg_t* src1, const rtlreg_t* src2) { *dest = ((*src1) | (*src2)); } static inline void rtl_ori(Decode *s, rtlreg_t* dest, const rtlreg_t* src1, const sword_t imm) { *dest = ((*src1) | (imm)); }
+static inline void rtl_xor(Decode *s, rtlreg_t* dest, const rtlreg_t* src1, const rtlreg_t* src2) { *dest = ((*src1) ^ (*src2)); } static inline void rtl_xori(Decode *s, rtlreg_t* dest, const rtlreg_t* src1, const sword_t imm) { *dest = ((*src1) ^ (imm)); }
+static inline void rtl_shl(Decode *s, rtlreg_t* dest, const rtlreg_t* src1, const rtlreg_t* src2) { *dest = ((*src1) << ((*src2) & 0x3f)); } static inline void rtl_shli(Decode *s, rtlreg_t* dest, const rtlreg_t* src1, const sword_t imm) { *dest = ((*src1) << ((imm) & 0x3f)); }
+static inline void rtl_shr(Decode *s, rtlreg_t* dest, const rtlreg_t* src1, const rtlreg_t* src2) { *dest = ((*src1) >> ((*src2) & 0x3f)); } static inline void rtl_shri(Decode *s, rtlreg_t* dest, const rtlreg_t* src1, const sword_t imm) { *dest = ((*src1) >> ((imm) & 0x3f)); }
+static inline void rtl_sar(Decode *s, rtlreg_t* dest, const rtlreg_t* src1, const rtlreg_t* src2) { *dest = ((sword_t)(*src1) >> ((*src2) & 0x3f)); } static inline void rtl_sari(Decode *s, rtlreg_t* dest, const rtlreg_t* src1, const sword_t imm) { *dest = ((sword_t)(*src1) >> ((imm) & 0x3f)); }
+static inline void rtl_min(Decode *s, rtlreg_t* dest, const rtlreg_t* src1, const rtlreg_t* src2) { *dest = ((int64_t)(*src1) < (int64_t)(*src2) ? (*src1) : (*src2)); } static inline void rtl_mini(Decode *s, rtlreg_t* dest, const rtlreg_t* src1, const sword_t imm) { *dest = ((int64_t)(*src1) < (int64_t)(imm) ? (*src1) : (imm)); }
+static inline void rtl_max(Decode *s, rtlreg_t* dest, const rtlreg_t* src1, const rtlreg_t* src2) { *dest = ((int64_t)(*src1) > (int64_t)(*src2) ? (*src1) : (*src2)); } static inline void rtl_maxi(Decode *s, rtlreg_t* dest, const rtlreg_t* src1, const sword_t imm) { *dest = ((int64_t)(*src1) > (int64_t)(imm) ? (*src1) : (imm)); }
+static inline void rtl_minu(Decode *s, rtlreg_t* dest, const rtlreg_t* src1, const rtlreg_t* src2) { *dest = ((uint64_t)(*src1) < (uint64_t)(*src2) ? (*src1) : (*src2)); } static inline void rtl_minui(Decode *s, rtlreg_t* dest, const rtlreg_t* src1, const sword_t imm) { *dest = ((uint64_t)(*src1) < (uint64_t)(imm) ? (*src1) : (imm)); }
+static inline void rtl_maxu(Decode *s, rtlreg_t* dest, const rtlreg_t* src1, const rtlreg_t* src2) { *dest = ((uint64_t)(*src1) > (uint64_t)(*src2) ? (*src1) : (*src2)); } static inline void rtl_maxui(Decode *s, rtlreg_t* dest, const rtlreg_t* src1, const sword_t imm) { *dest = ((uint64_t)(*src1) > (uint64_t)(imm) ? (*src1) : (imm)); }
+
+
+static inline void rtl_addw(Decode *s, rtlreg_t* dest, const rtlreg_t* src1, const rtlreg_t* src2) { *dest = ((int64_t)(int32_t)((*src1) + (*src2))); } static inline void rtl_addwi(Decode *s, rtlreg_t* dest, const rtlreg_t* src1, const sword_t imm) { *dest = ((int64_t)(int32_t)((*src1) + (imm))); }
+static inline void rtl_subw(Decode *s, rtlreg_t* dest, const rtlreg_t* src1, const rtlreg_t* src2) { *dest = ((int64_t)(int32_t)((*src1) - (*src2))); } static inline void rtl_subwi(Decode *s, rtlreg_t* dest, const rtlreg_t* src1, const sword_t imm) { *dest = ((int64_t)(int32_t)((*src1) - (imm))); }
+static inline void rtl_shlw(Decode *s, rtlreg_t* dest, const rtlreg_t* src1, const rtlreg_t* src2) { *dest = ((int64_t)(int32_t)((uint32_t)(*src1) << ((*src2) & 0x1f))); } static inline void rtl_shlwi(Decode *s, rtlreg_t* dest, const rtlreg_t* src1, const sword_t imm) { *dest = ((int64_t)(int32_t)((uint32_t)(*src1) << ((imm) & 0x1f))); }
+static inline void rtl_shrw(Decode *s, rtlreg_t* dest, const rtlreg_t* src1, const rtlreg_t* src2) { *dest = ((int64_t)(int32_t)((uint32_t)(*src1) >> ((*src2) & 0x1f))); } static inline void rtl_shrwi(Decode *s, rtlreg_t* dest, const rtlreg_t* src1, const sword_t imm) { *dest = ((int64_t)(int32_t)((uint32_t)(*src1) >> ((imm) & 0x1f))); }
+static inline void rtl_sarw(Decode *s, rtlreg_t* dest, const rtlreg_t* src1, const rtlreg_t* src2) { *dest = ((int64_t)(int32_t)(( int32_t)(*src1) >> ((*src2) & 0x1f))); } static inline void rtl_sarwi(Decode *s, rtlreg_t* dest, const rtlreg_t* src1, const sword_t imm) { *dest = ((int64_t)(int32_t)(( int32_t)(*src1) >> ((imm) & 0x1f))); }
+
+
+
+
+
+
+static inline void rtl_setrelop(Decode *s, uint32_t relop, rtlreg_t *dest, const rtlreg_t *src1, const rtlreg_t *src2)
+                                                {
+  *dest = interpret_relop(relop, *src1, *src2);
+}
+
+static inline void rtl_setrelopi(Decode *s, uint32_t relop, rtlreg_t *dest, const rtlreg_t *src1, sword_t imm)
+                                       {
+  *dest = interpret_relop(relop, *src1, imm);
+}
+
+
+
+static inline void rtl_mulu_lo(Decode *s, rtlreg_t* dest, const rtlreg_t* src1, const rtlreg_t* src2) { *dest = ((*src1) * (*src2)); }
+static inline void rtl_mulu_hi(Decode *s, rtlreg_t* dest, const rtlreg_t* src1, const rtlreg_t* src2) { *dest = (((__uint128_t)(*src1) * (__uint128_t)(*src2)) >> 64); }
+static inline void rtl_muls_hi(Decode *s, rtlreg_t* dest, const rtlreg_t* src1, const rtlreg_t* src2) { *dest = (((__int128_t)(sword_t)(*src1) * (__int128_t)(sword_t)(*src2)) >> 64); }
+static inline void rtl_divu_q(Decode *s, rtlreg_t* dest, const rtlreg_t* src1, const rtlreg_t* src2) { *dest = ((*src1) / (*src2)); }
+static inline void rtl_divu_r(Decode *s, rtlreg_t* dest, const rtlreg_t* src1, const rtlreg_t* src2) { *dest = ((*src1) % (*src2)); }
+static inline void rtl_divs_q(Decode *s, rtlreg_t* dest, const rtlreg_t* src1, const rtlreg_t* src2) { *dest = ((sword_t)(*src1) / (sword_t)(*src2)); }
+static inline void rtl_divs_r(Decode *s, rtlreg_t* dest, const rtlreg_t* src1, const rtlreg_t* src2) { *dest = ((sword_t)(*src1) % (sword_t)(*src2)); }
+
+
+static inline void rtl_mulw(Decode *s, rtlreg_t* dest, const rtlreg_t* src1, const rtlreg_t* src2) { *dest = ((int64_t)(int32_t)((*src1) * (*src2))); }
+static inline void rtl_divw(Decode *s, rtlreg_t* dest, const rtlreg_t* src1, const rtlreg_t* src2) { *dest = ((int64_t)(int32_t)(( int32_t)(*src1) / ( int32_t)(*src2))); }
+static inline void rtl_divuw(Decode *s, rtlreg_t* dest, const rtlreg_t* src1, const rtlreg_t* src2) { *dest = ((int64_t)(int32_t)((uint32_t)(*src1) / (uint32_t)(*src2))); }
+static inline void rtl_remw(Decode *s, rtlreg_t* dest, const rtlreg_t* src1, const rtlreg_t* src2) { *dest = ((int64_t)(int32_t)(( int32_t)(*src1) % ( int32_t)(*src2))); }
+static inline void rtl_remuw(Decode *s, rtlreg_t* dest, const rtlreg_t* src1, const rtlreg_t* src2) { *dest = ((int64_t)(int32_t)((uint32_t)(*src1) % (uint32_t)(*src2))); }
+
+
+static inline void rtl_div64u_q(Decode *s, rtlreg_t* dest, const rtlreg_t* src1_hi, const rtlreg_t* src1_lo, const rtlreg_t* src2)
+                                                                            {
+  uint64_t dividend = ((uint64_t)(*src1_hi) << 32) | (*src1_lo);
+  uint32_t divisor = (*src2);
+  *dest = dividend / divisor;
+}
+
+static inline void rtl_div64u_r(Decode *s, rtlreg_t* dest, const rtlreg_t* src1_hi, const rtlreg_t* src1_lo, const rtlreg_t* src2)
+                                                                            {
+  uint64_t dividend = ((uint64_t)(*src1_hi) << 32) | (*src1_lo);
+  uint32_t divisor = (*src2);
+  *dest = dividend % divisor;
+}
+
+static inline void rtl_div64s_q(Decode *s, rtlreg_t* dest, const rtlreg_t* src1_hi, const rtlreg_t* src1_lo, const rtlreg_t* src2)
+                                                                            {
+  int64_t dividend = ((uint64_t)(*src1_hi) << 32) | (*src1_lo);
+  int32_t divisor = (*src2);
+  *dest = dividend / divisor;
+}
+
+static inline void rtl_div64s_r(Decode *s, rtlreg_t* dest, const rtlreg_t* src1_hi, const rtlreg_t* src1_lo, const rtlreg_t* src2)
+                                                                            {
+  int64_t dividend = ((uint64_t)(*src1_hi) << 32) | (*src1_lo);
+  int32_t divisor = (*src2);
+  *dest = dividend % divisor;
+}
+
+
+
+static inline void rtl_lm(Decode *s, rtlreg_t *dest, const rtlreg_t* addr, word_t offset, int len, int mmu_mode)
+                                          {
+  *dest = vaddr_read(s, *addr + offset, len, mmu_mode);
+
+
+
+
+
+
+}
+
+static inline void rtl_sm(Decode *s, const rtlreg_t *src1, const rtlreg_t* addr, word_t offset, int len, int mmu_mode)
+                                          {
+  vaddr_write(s, *addr + offset, len, *src1, mmu_mode);
+
+
+
+
+
+
+}
+
+static inline void rtl_lms(Decode *s, rtlreg_t *dest, const rtlreg_t* addr, word_t offset, int len, int mmu_mode)
+                                          {
+  word_t val = vaddr_read(s, *addr + offset, len, mmu_mode);
+  switch (len) {
+    case 4: *dest = (sword_t)(int32_t)val; return;
+    case 1: *dest = (sword_t)( int8_t)val; return;
+    case 2: *dest = (sword_t)(int16_t)val; return;
+    case 8: *dest = (sword_t)(int64_t)val; return;
+    default: 
+# 155 "/root/repo/src/engine/interpreter/rtl-basic.h" 3 4
+   ((void) sizeof ((
+# 155 "/root/repo/src/engine/interpreter/rtl-basic.h"
+   0
+# 155 "/root/repo/src/engine/interpreter/rtl-basic.h" 3 4
+   ) ? 1 : 0), __extension__ ({ if (
+# 155 "/root/repo/src/engine/interpreter/rtl-basic.h"
+   0
+# 155 "/root/repo/src/engine/interpreter/rtl-basic.h" 3 4
+   ) ; else __assert_fail (
+# 155 "/root/repo/src/engine/interpreter/rtl-basic.h"
+   "0"
+# 155 "/root/repo/src/engine/interpreter/rtl-basic.h" 3 4
+   , "/root/repo/src/engine/interpreter/rtl-basic.h", 155, __extension__ __PRETTY_FUNCTION__); }))
+# 155 "/root/repo/src/engine/interpreter/rtl-basic.h"
+                                             ;
+  }
+
+
+
+
+
+
+}
+
+static inline void rtl_host_lm(Decode *s, rtlreg_t* dest, const void *addr, int len) {
+  switch (len) {
+    case 4: *dest = *(uint32_t *)addr; return;
+    case 1: *dest = *( uint8_t *)addr; return;
+    case 2: *dest = *(uint16_t *)addr; return;
+    case 8: *dest = *(uint64_t *)addr; return;
+    default: 
+# 171 "/root/repo/src/engine/interpreter/rtl-basic.h" 3 4
+   ((void) sizeof ((
+# 171 "/root/repo/src/engine/interpreter/rtl-basic.h"
+   0
+# 171 "/root/repo/src/engine/interpreter/rtl-basic.h" 3 4
+   ) ? 1 : 0), __extension__ ({ if (
+# 171 "/root/repo/src/engine/interpreter/rtl-basic.h"
+   0
+# 171 "/root/repo/src/engine/interpreter/rtl-basic.h" 3 4
+   ) ; else __assert_fail (
+# 171 "/root/repo/src/engine/interpreter/rtl-basic.h"
+   "0"
+# 171 "/root/repo/src/engine/interpreter/rtl-basic.h" 3 4
+   , "/root/repo/src/engine/interpreter/rtl-basic.h", 171, __extension__ __PRETTY_FUNCTION__); }))
+# 171 "/root/repo/src/engine/interpreter/rtl-basic.h"
+                                             ;
+  }
+}
+
+static inline void rtl_host_sm(Decode *s, void *addr, const rtlreg_t *src1, int len) {
+  switch (len) {
+    case 4: *(uint32_t *)addr = *src1; return;
+    case 1: *( uint8_t *)addr = *src1; return;
+    case 2: *(uint16_t *)addr = *src1; return;
+    case 8: *(uint64_t *)addr = *src1; return;
+    default: 
+# 181 "/root/repo/src/engine/interpreter/rtl-basic.h" 3 4
+   ((void) sizeof ((
+# 181 "/root/repo/src/engine/interpreter/rtl-basic.h"
+   0
+# 181 "/root/repo/src/engine/interpreter/rtl-basic.h" 3 4
+   ) ? 1 : 0), __extension__ ({ if (
+# 181 "/root/repo/src/engine/interpreter/rtl-basic.h"
+   0
+# 181 "/root/repo/src/engine/interpreter/rtl-basic.h" 3 4
+   ) ; else __assert_fail (
+# 181 "/root/repo/src/engine/interpreter/rtl-basic.h"
+   "0"
+# 181 "/root/repo/src/engine/interpreter/rtl-basic.h" 3 4
+   , "/root/repo/src/engine/interpreter/rtl-basic.h", 181, __extension__ __PRETTY_FUNCTION__); }))
+# 181 "/root/repo/src/engine/interpreter/rtl-basic.h"
+                                             ;
+  }
+}
+
+
+extern void simpoint_profiling(uint64_t pc, 
+# 186 "/root/repo/src/engine/interpreter/rtl-basic.h" 3 4
+                                           _Bool 
+# 186 "/root/repo/src/engine/interpreter/rtl-basic.h"
+                                                is_control, uint64_t abs_instr_count);
+extern uint64_t get_abs_instr_count();
+
+static inline void rtl_j(Decode *s, vaddr_t target) {
+# 202 "/root/repo/src/engine/interpreter/rtl-basic.h"
+  cpu.pc = target;
+
+  if (profiling_state == SimpointProfiling && profiling_started) {
+    simpoint_profiling(cpu.pc, 
+# 205 "/root/repo/src/engine/interpreter/rtl-basic.h" 3 4
+                              1
+# 205 "/root/repo/src/engine/interpreter/rtl-basic.h"
+                                  , get_abs_instr_count());
+  }
+
+
+
+
+
+}
+
+static inline void rtl_jr(Decode *s, rtlreg_t *target) {
+# 227 "/root/repo/src/engine/interpreter/rtl-basic.h"
+  cpu.pc = *target;
+
+  if (profiling_state == SimpointProfiling && profiling_started) {
+    simpoint_profiling(cpu.pc, 
+# 230 "/root/repo/src/engine/interpreter/rtl-basic.h" 3 4
+                              1
+# 230 "/root/repo/src/engine/interpreter/rtl-basic.h"
+                                  , get_abs_instr_count());
+  }
+
+
+
+
+
+}
+
+static inline void rtl_jrelop(Decode *s, uint32_t relop, const rtlreg_t *src1, const rtlreg_t *src2, vaddr_t target)
+                                                                {
+  
+# 241 "/root/repo/src/engine/interpreter/rtl-basic.h" 3 4
+ _Bool 
+# 241 "/root/repo/src/engine/interpreter/rtl-basic.h"
+      is_jmp = interpret_relop(relop, *src1, *src2);
+  rtl_j(s, (is_jmp ? target : s->snpc));
+}
+# 74 "/root/repo/include/rtl/rtl.h" 2
+# 1 "/root/repo/include/rtl/pseudo.h" 1
+# 26 "/root/repo/include/rtl/pseudo.h"
+static inline void rtl_li(Decode *s, rtlreg_t* dest, const rtlreg_t imm) {
+  rtl_addi(s, dest, (&rzero), imm);
+}
+
+static inline void rtl_mv(Decode *s, rtlreg_t* dest, const rtlreg_t *src1) {
+  rtl_addi(s, dest, src1, 0);
+}
+
+static inline void rtl_not(Decode *s, rtlreg_t *dest, const rtlreg_t* src1) {
+
+
+
+
+  rtl_xori(s, dest, src1, -1);
+
+}
+
+static inline void rtl_neg(Decode *s, rtlreg_t *dest, const rtlreg_t* src1) {
+
+
+
+
+  rtl_sub(s, dest, (&rzero), src1);
+
+}
+
+static inline void rtl_sext(Decode *s, rtlreg_t* dest, const rtlreg_t* src1, int width) {
+
+
+
+
+  const int word_size = sizeof(word_t);
+  if (width == word_size) {
+    rtl_mv(s, dest, src1);
+  } else {
+
+    
+# 62 "/root/repo/include/rtl/pseudo.h" 3 4
+   ((void) sizeof ((
+# 62 "/root/repo/include/rtl/pseudo.h"
+   width == 1 || width == 2 || width == 4
+# 62 "/root/repo/include/rtl/pseudo.h" 3 4
+   ) ? 1 : 0), __extension__ ({ if (
+# 62 "/root/repo/include/rtl/pseudo.h"
+   width == 1 || width == 2 || width == 4
+# 62 "/root/repo/include/rtl/pseudo.h" 3 4
+   ) ; else __assert_fail (
+# 62 "/root/repo/include/rtl/pseudo.h"
+   "width == 1 || width == 2 || MUXDEF(CONFIG_ISA64, width == 4, false)"
+# 62 "/root/repo/include/rtl/pseudo.h" 3 4
+   , "/root/repo/include/rtl/pseudo.h", 62, __extension__ __PRETTY_FUNCTION__); }))
+# 62 "/root/repo/include/rtl/pseudo.h"
+                                                                              ;
+
+    rtl_shli(s, dest, src1, (word_size - width) * 8);
+    rtl_sari(s, dest, dest, (word_size - width) * 8);
+  }
+
+}
+
+static inline void rtl_zext(Decode *s, rtlreg_t* dest, const rtlreg_t* src1, int width) {
+
+
+
+
+  const int word_size = sizeof(word_t);
+  if (width == word_size) {
+    rtl_mv(s, dest, src1);
+  } else {
+
+    
+# 80 "/root/repo/include/rtl/pseudo.h" 3 4
+   ((void) sizeof ((
+# 80 "/root/repo/include/rtl/pseudo.h"
+   width == 1 || width == 2 || width == 4
+# 80 "/root/repo/include/rtl/pseudo.h" 3 4
+   ) ? 1 : 0), __extension__ ({ if (
+# 80 "/root/repo/include/rtl/pseudo.h"
+   width == 1 || width == 2 || width == 4
+# 80 "/root/repo/include/rtl/pseudo.h" 3 4
+   ) ; else __assert_fail (
+# 80 "/root/repo/include/rtl/pseudo.h"
+   "width == 1 || width == 2 || MUXDEF(CONFIG_ISA64, width == 4, false)"
+# 80 "/root/repo/include/rtl/pseudo.h" 3 4
+   , "/root/repo/include/rtl/pseudo.h", 80, __extension__ __PRETTY_FUNCTION__); }))
+# 80 "/root/repo/include/rtl/pseudo.h"
+                                                                              ;
+
+    rtl_shli(s, dest, src1, (word_size - width) * 8);
+    rtl_shri(s, dest, dest, (word_size - width) * 8);
+  }
+
+}
+
+static inline void rtl_msb(Decode *s, rtlreg_t* dest, const rtlreg_t* src1, int width) {
+
+
+
+
+  rtl_shri(s, dest, src1, width * 8 - 1);
+  if (width != 4) {
+    rtl_andi(s, dest, dest, 0x1);
+  }
+
+}
+
+static inline void rtl_trap(Decode *s, vaddr_t ret_pc, word_t NO) {
+  rtl_li(s, (&tmp_reg[3]), ret_pc);
+  rtl_hostcall(s, HOSTCALL_TRAP, (&tmp_reg[3]), (&tmp_reg[3]), 
+# 102 "/root/repo/include/rtl/pseudo.h" 3 4
+                                        ((void *)0)
+# 102 "/root/repo/include/rtl/pseudo.h"
+                                            , NO);
+  rtl_jr(s, (&tmp_reg[3]));
+}
+static inline void rtl_mux(Decode *s, rtlreg_t* dest, const rtlreg_t* cond, const rtlreg_t* src1, const rtlreg_t* src2) {
+
+
+  rtl_setrelopi(s, RELOP_EQ, (&tmp_reg[3]), cond, 0);
+  rtl_subi(s, (&tmp_reg[3]), (&tmp_reg[3]), 1);
+
+  rtl_and(s, (&tmp_reg[2]), src1, (&tmp_reg[3]));
+  rtl_not(s, (&tmp_reg[3]), (&tmp_reg[3]));
+  rtl_and(s, (&tmp_reg[3]), src2, (&tmp_reg[3]));
+  rtl_or(s, dest, (&tmp_reg[3]), (&tmp_reg[2]));
+}
+# 75 "/root/repo/include/rtl/rtl.h" 2
+# 18 "src/engine/interpreter/fp.c" 2
+
+# 1 "src/engine/interpreter/host-fp.h" 1
+# 18 "src/engine/interpreter/host-fp.h"
+# 1 "/usr/include/math.h" 1 3 4
+# 27 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 28 "/usr/include/math.h" 2 3 4
+
+
+
+
+
+
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/math-vector.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/math-vector.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h" 1 3 4
+# 26 "/usr/include/x86_64-linux-gnu/bits/math-vector.h" 2 3 4
+# 41 "/usr/include/math.h" 2 3 4
+# 152 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h" 1 3 4
+# 153 "/usr/include/math.h" 2 3 4
+# 163 "/usr/include/math.h" 3 4
+
+# 163 "/usr/include/math.h" 3 4
+typedef float float_t;
+typedef double double_t;
+# 204 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h" 1 3 4
+# 205 "/usr/include/math.h" 2 3 4
+# 247 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h" 1 3 4
+# 248 "/usr/include/math.h" 2 3 4
+# 312 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h" 3 4
+extern int __fpclassify (double __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+
+
+extern int __signbit (double __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+
+
+
+extern int __isinf (double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __finite (double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __isnan (double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __iseqsig (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int __issignaling (double __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+# 313 "/usr/include/math.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 1 3 4
+# 53 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+ extern double acos (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __acos (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern double asin (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __asin (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern double atan (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __atan (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern double atan2 (double __y, double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __atan2 (double __y, double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern double cos (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __cos (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern double sin (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __sin (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern double tan (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __tan (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern double cosh (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __cosh (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern double sinh (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __sinh (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern double tanh (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __tanh (double __x) __attribute__ ((__nothrow__ , __leaf__));
+# 85 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+ extern double acosh (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __acosh (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern double asinh (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __asinh (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern double atanh (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __atanh (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern double exp (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __exp (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double frexp (double __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__)); extern double __frexp (double __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double ldexp (double __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__)); extern double __ldexp (double __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern double log (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __log (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern double log10 (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __log10 (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double modf (double __x, double *__iptr) __attribute__ ((__nothrow__ , __leaf__)); extern double __modf (double __x, double *__iptr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+# 119 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+ extern double expm1 (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __expm1 (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern double log1p (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __log1p (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double logb (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __logb (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern double exp2 (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __exp2 (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern double log2 (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __log2 (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+ extern double pow (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __pow (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double sqrt (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __sqrt (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+ extern double hypot (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __hypot (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern double cbrt (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __cbrt (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern double ceil (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __ceil (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern double fabs (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __fabs (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern double floor (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __floor (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern double fmod (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __fmod (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+# 177 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern int isinf (double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+
+
+extern int finite (double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern double drem (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __drem (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern double significand (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __significand (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern double copysign (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __copysign (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern double nan (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__)); extern double __nan (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__));
+# 213 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern int isnan (double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+
+
+
+extern double j0 (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __j0 (double) __attribute__ ((__nothrow__ , __leaf__));
+extern double j1 (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __j1 (double) __attribute__ ((__nothrow__ , __leaf__));
+extern double jn (int, double) __attribute__ ((__nothrow__ , __leaf__)); extern double __jn (int, double) __attribute__ ((__nothrow__ , __leaf__));
+extern double y0 (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __y0 (double) __attribute__ ((__nothrow__ , __leaf__));
+extern double y1 (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __y1 (double) __attribute__ ((__nothrow__ , __leaf__));
+extern double yn (int, double) __attribute__ ((__nothrow__ , __leaf__)); extern double __yn (int, double) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern double erf (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __erf (double) __attribute__ ((__nothrow__ , __leaf__));
+ extern double erfc (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __erfc (double) __attribute__ ((__nothrow__ , __leaf__));
+extern double lgamma (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __lgamma (double) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern double tgamma (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __tgamma (double) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern double gamma (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __gamma (double) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern double lgamma_r (double, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__)); extern double __lgamma_r (double, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern double rint (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __rint (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double nextafter (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __nextafter (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+extern double nexttoward (double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __nexttoward (double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+# 275 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern double remainder (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __remainder (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern double scalbn (double __x, int __n) __attribute__ ((__nothrow__ , __leaf__)); extern double __scalbn (double __x, int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int ilogb (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern int __ilogb (double __x) __attribute__ ((__nothrow__ , __leaf__));
+# 293 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern double scalbln (double __x, long int __n) __attribute__ ((__nothrow__ , __leaf__)); extern double __scalbln (double __x, long int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern double nearbyint (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __nearbyint (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern double round (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __round (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern double trunc (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __trunc (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern double remquo (double __x, double __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__)); extern double __remquo (double __x, double __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long int lrint (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lrint (double __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llrint (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llrint (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long int lround (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lround (double __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llround (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llround (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern double fdim (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __fdim (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern double fmax (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __fmax (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern double fmin (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __fmin (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern double fma (double __x, double __y, double __z) __attribute__ ((__nothrow__ , __leaf__)); extern double __fma (double __x, double __y, double __z) __attribute__ ((__nothrow__ , __leaf__));
+# 435 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern double scalb (double __x, double __n) __attribute__ ((__nothrow__ , __leaf__)); extern double __scalb (double __x, double __n) __attribute__ ((__nothrow__ , __leaf__));
+# 314 "/usr/include/math.h" 2 3 4
+# 329 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h" 3 4
+extern int __fpclassifyf (float __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+
+
+extern int __signbitf (float __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+
+
+
+extern int __isinff (float __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __finitef (float __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __isnanf (float __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __iseqsigf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int __issignalingf (float __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+# 330 "/usr/include/math.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 1 3 4
+# 53 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+ extern float acosf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __acosf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern float asinf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __asinf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern float atanf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __atanf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern float atan2f (float __y, float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __atan2f (float __y, float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern float cosf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __cosf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern float sinf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __sinf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern float tanf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __tanf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern float coshf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __coshf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern float sinhf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __sinhf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern float tanhf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __tanhf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+# 85 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+ extern float acoshf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __acoshf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern float asinhf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __asinhf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern float atanhf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __atanhf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern float expf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __expf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float frexpf (float __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__)); extern float __frexpf (float __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float ldexpf (float __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__)); extern float __ldexpf (float __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern float logf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __logf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern float log10f (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __log10f (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float modff (float __x, float *__iptr) __attribute__ ((__nothrow__ , __leaf__)); extern float __modff (float __x, float *__iptr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+# 119 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+ extern float expm1f (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __expm1f (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern float log1pf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __log1pf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float logbf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __logbf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern float exp2f (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __exp2f (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern float log2f (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __log2f (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+ extern float powf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __powf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float sqrtf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __sqrtf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+ extern float hypotf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __hypotf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern float cbrtf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __cbrtf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern float ceilf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __ceilf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern float fabsf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __fabsf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern float floorf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __floorf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern float fmodf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __fmodf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
+# 177 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern int isinff (float __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+
+
+extern int finitef (float __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern float dremf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __dremf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern float significandf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __significandf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern float copysignf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __copysignf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern float nanf (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__)); extern float __nanf (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__));
+# 213 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern int isnanf (float __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+
+
+
+extern float j0f (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __j0f (float) __attribute__ ((__nothrow__ , __leaf__));
+extern float j1f (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __j1f (float) __attribute__ ((__nothrow__ , __leaf__));
+extern float jnf (int, float) __attribute__ ((__nothrow__ , __leaf__)); extern float __jnf (int, float) __attribute__ ((__nothrow__ , __leaf__));
+extern float y0f (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __y0f (float) __attribute__ ((__nothrow__ , __leaf__));
+extern float y1f (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __y1f (float) __attribute__ ((__nothrow__ , __leaf__));
+extern float ynf (int, float) __attribute__ ((__nothrow__ , __leaf__)); extern float __ynf (int, float) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern float erff (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __erff (float) __attribute__ ((__nothrow__ , __leaf__));
+ extern float erfcf (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __erfcf (float) __attribute__ ((__nothrow__ , __leaf__));
+extern float lgammaf (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __lgammaf (float) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern float tgammaf (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __tgammaf (float) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern float gammaf (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __gammaf (float) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern float lgammaf_r (float, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__)); extern float __lgammaf_r (float, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern float rintf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __rintf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float nextafterf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __nextafterf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
+
+extern float nexttowardf (float __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __nexttowardf (float __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+# 275 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern float remainderf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __remainderf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern float scalbnf (float __x, int __n) __attribute__ ((__nothrow__ , __leaf__)); extern float __scalbnf (float __x, int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int ilogbf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern int __ilogbf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+# 293 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern float scalblnf (float __x, long int __n) __attribute__ ((__nothrow__ , __leaf__)); extern float __scalblnf (float __x, long int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern float nearbyintf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __nearbyintf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern float roundf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __roundf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern float truncf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __truncf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern float remquof (float __x, float __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__)); extern float __remquof (float __x, float __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long int lrintf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lrintf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llrintf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llrintf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long int lroundf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lroundf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llroundf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llroundf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern float fdimf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __fdimf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern float fmaxf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __fmaxf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern float fminf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __fminf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern float fmaf (float __x, float __y, float __z) __attribute__ ((__nothrow__ , __leaf__)); extern float __fmaf (float __x, float __y, float __z) __attribute__ ((__nothrow__ , __leaf__));
+# 435 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern float scalbf (float __x, float __n) __attribute__ ((__nothrow__ , __leaf__)); extern float __scalbf (float __x, float __n) __attribute__ ((__nothrow__ , __leaf__));
+# 331 "/usr/include/math.h" 2 3 4
+# 398 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h" 3 4
+extern int __fpclassifyl (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+
+
+extern int __signbitl (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+
+
+
+extern int __isinfl (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __finitel (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __isnanl (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __iseqsigl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int __issignalingl (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+# 399 "/usr/include/math.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 1 3 4
+# 53 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+ extern long double acosl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __acosl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double asinl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __asinl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double atanl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __atanl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double atan2l (long double __y, long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __atan2l (long double __y, long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern long double cosl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __cosl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double sinl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __sinl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double tanl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __tanl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern long double coshl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __coshl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double sinhl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __sinhl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double tanhl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __tanhl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+# 85 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+ extern long double acoshl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __acoshl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double asinhl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __asinhl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double atanhl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __atanhl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern long double expl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __expl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern long double frexpl (long double __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__)); extern long double __frexpl (long double __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern long double ldexpl (long double __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__)); extern long double __ldexpl (long double __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern long double logl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __logl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern long double log10l (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __log10l (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern long double modfl (long double __x, long double *__iptr) __attribute__ ((__nothrow__ , __leaf__)); extern long double __modfl (long double __x, long double *__iptr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+# 119 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+ extern long double expm1l (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __expm1l (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern long double log1pl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __log1pl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern long double logbl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __logbl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern long double exp2l (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __exp2l (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern long double log2l (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __log2l (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+ extern long double powl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __powl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern long double sqrtl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __sqrtl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+ extern long double hypotl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __hypotl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern long double cbrtl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __cbrtl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long double ceill (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __ceill (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern long double fabsl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __fabsl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern long double floorl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __floorl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern long double fmodl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __fmodl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+# 177 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern int isinfl (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+
+
+extern int finitel (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern long double dreml (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __dreml (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long double significandl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __significandl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long double copysignl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __copysignl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern long double nanl (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__)); extern long double __nanl (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__));
+# 213 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern int isnanl (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+
+
+
+extern long double j0l (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __j0l (long double) __attribute__ ((__nothrow__ , __leaf__));
+extern long double j1l (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __j1l (long double) __attribute__ ((__nothrow__ , __leaf__));
+extern long double jnl (int, long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __jnl (int, long double) __attribute__ ((__nothrow__ , __leaf__));
+extern long double y0l (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __y0l (long double) __attribute__ ((__nothrow__ , __leaf__));
+extern long double y1l (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __y1l (long double) __attribute__ ((__nothrow__ , __leaf__));
+extern long double ynl (int, long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __ynl (int, long double) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern long double erfl (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __erfl (long double) __attribute__ ((__nothrow__ , __leaf__));
+ extern long double erfcl (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __erfcl (long double) __attribute__ ((__nothrow__ , __leaf__));
+extern long double lgammal (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __lgammal (long double) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern long double tgammal (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __tgammal (long double) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern long double gammal (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __gammal (long double) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern long double lgammal_r (long double, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__)); extern long double __lgammal_r (long double, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long double rintl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __rintl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern long double nextafterl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __nextafterl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+extern long double nexttowardl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __nexttowardl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+# 275 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern long double remainderl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __remainderl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long double scalbnl (long double __x, int __n) __attribute__ ((__nothrow__ , __leaf__)); extern long double __scalbnl (long double __x, int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int ilogbl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern int __ilogbl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+# 293 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern long double scalblnl (long double __x, long int __n) __attribute__ ((__nothrow__ , __leaf__)); extern long double __scalblnl (long double __x, long int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long double nearbyintl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __nearbyintl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long double roundl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __roundl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern long double truncl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __truncl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern long double remquol (long double __x, long double __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__)); extern long double __remquol (long double __x, long double __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long int lrintl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lrintl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llrintl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llrintl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long int lroundl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lroundl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llroundl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llroundl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long double fdiml (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __fdiml (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long double fmaxl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __fmaxl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern long double fminl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __fminl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern long double fmal (long double __x, long double __y, long double __z) __attribute__ ((__nothrow__ , __leaf__)); extern long double __fmal (long double __x, long double __y, long double __z) __attribute__ ((__nothrow__ , __leaf__));
+# 435 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern long double scalbl (long double __x, long double __n) __attribute__ ((__nothrow__ , __leaf__)); extern long double __scalbl (long double __x, long double __n) __attribute__ ((__nothrow__ , __leaf__));
+# 400 "/usr/include/math.h" 2 3 4
+# 481 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h" 3 4
+extern int __fpclassifyf128 (_Float128 __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+
+
+extern int __signbitf128 (_Float128 __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+
+
+
+extern int __isinff128 (_Float128 __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __finitef128 (_Float128 __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __isnanf128 (_Float128 __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __iseqsigf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int __issignalingf128 (_Float128 __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+# 482 "/usr/include/math.h" 2 3 4
+# 854 "/usr/include/math.h" 3 4
+extern int signgam;
+# 934 "/usr/include/math.h" 3 4
+enum
+  {
+    FP_NAN =
+
+      0,
+    FP_INFINITE =
+
+      1,
+    FP_ZERO =
+
+      2,
+    FP_SUBNORMAL =
+
+      3,
+    FP_NORMAL =
+
+      4
+  };
+# 1471 "/usr/include/math.h" 3 4
+
+# 19 "src/engine/interpreter/host-fp.h" 2
+# 1 "/usr/include/fenv.h" 1 3 4
+# 26 "/usr/include/fenv.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 27 "/usr/include/fenv.h" 2 3 4
+# 64 "/usr/include/fenv.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/fenv.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/fenv.h" 3 4
+enum
+  {
+    FE_INVALID =
+
+      0x01,
+    __FE_DENORM = 0x02,
+    FE_DIVBYZERO =
+
+      0x04,
+    FE_OVERFLOW =
+
+      0x08,
+    FE_UNDERFLOW =
+
+      0x10,
+    FE_INEXACT =
+
+      0x20
+  };
+
+
+
+
+
+
+
+enum
+  {
+    FE_TONEAREST =
+
+      0,
+    FE_DOWNWARD =
+
+      0x400,
+    FE_UPWARD =
+
+      0x800,
+    FE_TOWARDZERO =
+
+      0xc00
+  };
+
+
+
+typedef unsigned short int fexcept_t;
+
+
+
+
+
+
+typedef struct
+  {
+    unsigned short int __control_word;
+    unsigned short int __glibc_reserved1;
+    unsigned short int __status_word;
+    unsigned short int __glibc_reserved2;
+    unsigned short int __tags;
+    unsigned short int __glibc_reserved3;
+    unsigned int __eip;
+    unsigned short int __cs_selector;
+    unsigned int __opcode:11;
+    unsigned int __glibc_reserved4:5;
+    unsigned int __data_offset;
+    unsigned short int __data_selector;
+    unsigned short int __glibc_reserved5;
+
+    unsigned int __mxcsr;
+
+  }
+fenv_t;
+# 65 "/usr/include/fenv.h" 2 3 4
+
+
+
+
+
+
+extern int feclearexcept (int __excepts) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int fegetexceptflag (fexcept_t *__flagp, int __excepts) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int feraiseexcept (int __excepts) __attribute__ ((__nothrow__ , __leaf__));
+# 88 "/usr/include/fenv.h" 3 4
+extern int fesetexceptflag (const fexcept_t *__flagp, int __excepts) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int fetestexcept (int __excepts) __attribute__ ((__nothrow__ , __leaf__));
+# 104 "/usr/include/fenv.h" 3 4
+extern int fegetround (void) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__));
+
+
+extern int fesetround (int __rounding_direction) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern int fegetenv (fenv_t *__envp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern int feholdexcept (fenv_t *__envp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int fesetenv (const fenv_t *__envp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern int feupdateenv (const fenv_t *__envp) __attribute__ ((__nothrow__ , __leaf__));
+# 168 "/usr/include/fenv.h" 3 4
+
+# 20 "src/engine/interpreter/host-fp.h" 2
+
+
+
+
+# 23 "src/engine/interpreter/host-fp.h"
+typedef union { uint32_t v; float f; } float32_t;
+static inline float32_t float32(float f) { float32_t r = { .f = f }; return r; }
+
+static inline float32_t f32_add(float32_t a, float32_t b) { return float32(a.f + b.f); }
+static inline float32_t f32_sub(float32_t a, float32_t b) { return float32(a.f - b.f); }
+static inline float32_t f32_mul(float32_t a, float32_t b) { return float32(a.f * b.f); }
+static inline float32_t f32_div(float32_t a, float32_t b) { return float32(a.f / b.f); }
+static inline float32_t f32_sqrt(float32_t a) { return float32(sqrtf(a.f)); }
+static inline float32_t f32_mulAdd(float32_t a, float32_t b,
+    float32_t c) { return float32(fmaf(a.f, b.f, c.f)); }
+static inline float32_t f32_min(float32_t a, float32_t b) { return float32(a.f < b.f ? a.f : b.f); }
+static inline float32_t f32_max(float32_t a, float32_t b) { return float32(a.f > b.f ? a.f : b.f); }
+static inline 
+# 35 "src/engine/interpreter/host-fp.h" 3 4
+             _Bool 
+# 35 "src/engine/interpreter/host-fp.h"
+                  f32_le(float32_t a, float32_t b) { return a.f <= b.f; }
+static inline 
+# 36 "src/engine/interpreter/host-fp.h" 3 4
+             _Bool 
+# 36 "src/engine/interpreter/host-fp.h"
+                  f32_lt(float32_t a, float32_t b) { return a.f < b.f; }
+static inline 
+# 37 "src/engine/interpreter/host-fp.h" 3 4
+             _Bool 
+# 37 "src/engine/interpreter/host-fp.h"
+                  f32_eq(float32_t a, float32_t b) { return a.f == b.f; }
+static inline float32_t i32_to_f32 (rtlreg_t a) { return float32((int32_t)a); }
+static inline float32_t ui32_to_f32(rtlreg_t a) { return float32((uint32_t)a); }
+static inline float32_t i64_to_f32 (rtlreg_t a) { return float32((int64_t)a); }
+static inline float32_t ui64_to_f32(rtlreg_t a) { return float32((uint64_t)a); }
+static inline int32_t my_f32_to_i32 (float32_t a) { return llrintf(a.f); }
+static inline uint32_t my_f32_to_ui32(float32_t a) { return llrintf(a.f); }
+static inline int64_t my_f32_to_i64 (float32_t a) { return llrintf(a.f); }
+static inline uint64_t my_f32_to_ui64(float32_t a) { return llrintf(a.f); }
+
+
+typedef union { uint64_t v; double f; } float64_t;
+static inline float64_t float64(double f) { float64_t r = { .f = f }; return r; }
+
+static inline float64_t f64_add(float64_t a, float64_t b) { return float64(a.f + b.f); }
+static inline float64_t f64_sub(float64_t a, float64_t b) { return float64(a.f - b.f); }
+static inline float64_t f64_mul(float64_t a, float64_t b) { return float64(a.f * b.f); }
+static inline float64_t f64_div(float64_t a, float64_t b) { return float64(a.f / b.f); }
+static inline float64_t f64_sqrt(float64_t a) { return float64(sqrt(a.f)); }
+static inline float64_t f64_mulAdd(float64_t a, float64_t b,
+    float64_t c) { return float64(fma(a.f, b.f, c.f)); }
+static inline float64_t f64_min(float64_t a, float64_t b) { return float64(a.f < b.f ? a.f : b.f); }
+static inline float64_t f64_max(float64_t a, float64_t b) { return float64(a.f > b.f ? a.f : b.f); }
+static inline 
+# 60 "src/engine/interpreter/host-fp.h" 3 4
+             _Bool 
+# 60 "src/engine/interpreter/host-fp.h"
+                  f64_le(float64_t a, float64_t b) { return a.f <= b.f; }
+static inline 
+# 61 "src/engine/interpreter/host-fp.h" 3 4
+             _Bool 
+# 61 "src/engine/interpreter/host-fp.h"
+                  f64_lt(float64_t a, float64_t b) { return a.f < b.f; }
+static inline 
+# 62 "src/engine/interpreter/host-fp.h" 3 4
+             _Bool 
+# 62 "src/engine/interpreter/host-fp.h"
+                  f64_eq(float64_t a, float64_t b) { return a.f == b.f; }
+static inline float64_t i32_to_f64 (rtlreg_t a) { return float64((int32_t)a); }
+static inline float64_t ui32_to_f64(rtlreg_t a) { return float64((uint32_t)a); }
+static inline float64_t i64_to_f64 (rtlreg_t a) { return float64((int64_t)a); }
+static inline float64_t ui64_to_f64(rtlreg_t a) { return float64((uint64_t)a); }
+static inline int32_t my_f64_to_i32 (float64_t a) { return llrint(a.f); }
+static inline uint32_t my_f64_to_ui32(float64_t a) { return llrint(a.f); }
+static inline int64_t my_f64_to_i64 (float64_t a) { return llrint(a.f); }
+static inline uint64_t my_f64_to_ui64(float64_t a) { return llrint(a.f); }
+
+static inline float64_t f32_to_f64(float32_t a) { return float64(a.f); }
+static inline float32_t f64_to_f32(float64_t a) { return float32(a.f); }
+
+
+static inline void fp_set_rm(int rm) {
+  switch (rm) {
+    case FPCALL_RM_RNE: rm = 
+# 78 "src/engine/interpreter/host-fp.h" 3 4
+                            0
+# 78 "src/engine/interpreter/host-fp.h"
+                                        ; break;
+    case FPCALL_RM_RTZ: rm = 
+# 79 "src/engine/interpreter/host-fp.h" 3 4
+                            0xc00
+# 79 "src/engine/interpreter/host-fp.h"
+                                         ; break;
+    case FPCALL_RM_RDN: rm = 
+# 80 "src/engine/interpreter/host-fp.h" 3 4
+                            0x400
+# 80 "src/engine/interpreter/host-fp.h"
+                                       ; break;
+    case FPCALL_RM_RUP: rm = 
+# 81 "src/engine/interpreter/host-fp.h" 3 4
+                            0x800
+# 81 "src/engine/interpreter/host-fp.h"
+                                     ; break;
+    case FPCALL_RM_RMM: rm = 
+# 82 "src/engine/interpreter/host-fp.h" 3 4
+                            0
+# 82 "src/engine/interpreter/host-fp.h"
+                                        ; break;
+    default: 
+# 83 "src/engine/interpreter/host-fp.h" 3 4
+            ((void) sizeof ((
+# 83 "src/engine/interpreter/host-fp.h"
+            0
+# 83 "src/engine/interpreter/host-fp.h" 3 4
+            ) ? 1 : 0), __extension__ ({ if (
+# 83 "src/engine/interpreter/host-fp.h"
+            0
+# 83 "src/engine/interpreter/host-fp.h" 3 4
+            ) ; else __assert_fail (
+# 83 "src/engine/interpreter/host-fp.h"
+            "0"
+# 83 "src/engine/interpreter/host-fp.h" 3 4
+            , "src/engine/interpreter/host-fp.h", 83, __extension__ __PRETTY_FUNCTION__); }))
+# 83 "src/engine/interpreter/host-fp.h"
+                     ;
+  }
+  fesetround(rm);
+}
+
+static inline uint32_t fp_get_exception() {
+  uint32_t ex = 0;
+# 98 "src/engine/interpreter/host-fp.h"
+  return ex;
+}
+
+static inline void fp_clear_exception() {
+  feclearexcept(
+# 102 "src/engine/interpreter/host-fp.h" 3 4
+               (0x20 | 0x04 | 0x10 | 0x08 | 0x01)
+# 102 "src/engine/interpreter/host-fp.h"
+                            );
+}
+
+uint_fast16_t f32_classify( float32_t a )
+{
+  do { if (!(0)) { fflush(
+# 107 "src/engine/interpreter/host-fp.h" 3 4
+ stdout
+# 107 "src/engine/interpreter/host-fp.h"
+ ); fprintf(
+# 107 "src/engine/interpreter/host-fp.h" 3 4
+ stderr
+# 107 "src/engine/interpreter/host-fp.h"
+ , "\33[1;31m"); fprintf(
+# 107 "src/engine/interpreter/host-fp.h" 3 4
+ stderr
+# 107 "src/engine/interpreter/host-fp.h"
+ , "host-fp does not support f32_classify"); fprintf(
+# 107 "src/engine/interpreter/host-fp.h" 3 4
+ stderr
+# 107 "src/engine/interpreter/host-fp.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 107 "src/engine/interpreter/host-fp.h" 3 4
+ ((void) sizeof ((
+# 107 "src/engine/interpreter/host-fp.h"
+ 0
+# 107 "src/engine/interpreter/host-fp.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 107 "src/engine/interpreter/host-fp.h"
+ 0
+# 107 "src/engine/interpreter/host-fp.h" 3 4
+ ) ; else __assert_fail (
+# 107 "src/engine/interpreter/host-fp.h"
+ "0"
+# 107 "src/engine/interpreter/host-fp.h" 3 4
+ , "src/engine/interpreter/host-fp.h", 107, __extension__ __PRETTY_FUNCTION__); }))
+# 107 "src/engine/interpreter/host-fp.h"
+ ; } } while (0);
+}
+
+uint_fast16_t f64_classify( float64_t a )
+{
+  do { if (!(0)) { fflush(
+# 112 "src/engine/interpreter/host-fp.h" 3 4
+ stdout
+# 112 "src/engine/interpreter/host-fp.h"
+ ); fprintf(
+# 112 "src/engine/interpreter/host-fp.h" 3 4
+ stderr
+# 112 "src/engine/interpreter/host-fp.h"
+ , "\33[1;31m"); fprintf(
+# 112 "src/engine/interpreter/host-fp.h" 3 4
+ stderr
+# 112 "src/engine/interpreter/host-fp.h"
+ , "host-fp does not support f64_classify"); fprintf(
+# 112 "src/engine/interpreter/host-fp.h" 3 4
+ stderr
+# 112 "src/engine/interpreter/host-fp.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 112 "src/engine/interpreter/host-fp.h" 3 4
+ ((void) sizeof ((
+# 112 "src/engine/interpreter/host-fp.h"
+ 0
+# 112 "src/engine/interpreter/host-fp.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 112 "src/engine/interpreter/host-fp.h"
+ 0
+# 112 "src/engine/interpreter/host-fp.h" 3 4
+ ) ; else __assert_fail (
+# 112 "src/engine/interpreter/host-fp.h"
+ "0"
+# 112 "src/engine/interpreter/host-fp.h" 3 4
+ , "src/engine/interpreter/host-fp.h", 112, __extension__ __PRETTY_FUNCTION__); }))
+# 112 "src/engine/interpreter/host-fp.h"
+ ; } } while (0);
+}
+# 20 "src/engine/interpreter/fp.c" 2
+
+
+
+static inline rtlreg_t unbox(rtlreg_t r) {
+  return 
+# 24 "src/engine/interpreter/fp.c" 3 4
+        1
+    
+# 25 "src/engine/interpreter/fp.c"
+   ? (r & ~0xFFFFFFFF00000000) : 0x7FC00000;
+}
+
+static inline float32_t rtlToF32(rtlreg_t r) {
+  float32_t f = { .v = (uint32_t)unbox(r) };
+  return f;
+}
+
+static inline float64_t rtlToF64(rtlreg_t r) {
+  float64_t f = { .v = r };
+  return f;
+}
+
+uint32_t isa_fp_get_rm(Decode *s);
+void isa_fp_set_ex(uint32_t ex);
+void isa_fp_csr_check();
+
+
+void rtl_fpcall(Decode *s, rtlreg_t *dest, const rtlreg_t *src1, const rtlreg_t *src2, uint32_t cmd) {
+
+  uint32_t w = ((cmd) & 0x3);
+  uint32_t op = ((cmd) >> 16);
+  isa_fp_csr_check();
+  if (op < FPCALL_NEED_RM) {
+    static uint32_t last_rm = -1;
+    uint32_t rm = isa_fp_get_rm(s);
+    if (__builtin_expect(rm != last_rm, 0)) {
+      fp_set_rm(rm);
+      last_rm = rm;
+    }
+  }
+
+  if (w == FPCALL_W32) {
+    float32_t fsrc1 = rtlToF32(*src1);
+    float32_t fsrc2 = rtlToF32(*src2);
+    switch (op) {
+      case FPCALL_ADD: *dest = f32_add(fsrc1, fsrc2).v; break;
+      case FPCALL_SUB: *dest = f32_sub(fsrc1, fsrc2).v; break;
+      case FPCALL_MUL: *dest = f32_mul(fsrc1, fsrc2).v; break;
+      case FPCALL_DIV: *dest = f32_div(fsrc1, fsrc2).v; break;
+      case FPCALL_MIN: *dest = f32_min(fsrc1, fsrc2).v; break;
+      case FPCALL_MAX: *dest = f32_max(fsrc1, fsrc2).v; break;
+
+      case FPCALL_SQRT: *dest = f32_sqrt(fsrc1).v; break;
+
+      case FPCALL_MADD: *dest = f32_mulAdd(fsrc1, fsrc2, rtlToF32(*dest)).v; break;
+
+      case FPCALL_LE: *dest = f32_le(fsrc1, fsrc2); break;
+      case FPCALL_LT: *dest = f32_lt(fsrc1, fsrc2); break;
+      case FPCALL_EQ: *dest = f32_eq(fsrc1, fsrc2); break;
+
+      case FPCALL_I32ToF: *dest = i32_to_f32 (*src1).v; break;
+      case FPCALL_U32ToF: *dest = ui32_to_f32(*src1).v; break;
+      case FPCALL_I64ToF: *dest = i64_to_f32 (*src1).v; break;
+      case FPCALL_U64ToF: *dest = ui64_to_f32(*src1).v; break;
+
+      case FPCALL_FToI32: *dest = my_f32_to_i32 (fsrc1); break;
+      case FPCALL_FToU32: *dest = my_f32_to_ui32(fsrc1); break;
+      case FPCALL_FToI64: *dest = my_f32_to_i64 (fsrc1); break;
+      case FPCALL_FToU64: *dest = my_f32_to_ui64(fsrc1); break;
+      default: do { if (!(0)) { fflush(
+# 85 "src/engine/interpreter/fp.c" 3 4
+              stdout
+# 85 "src/engine/interpreter/fp.c"
+              ); fprintf(
+# 85 "src/engine/interpreter/fp.c" 3 4
+              stderr
+# 85 "src/engine/interpreter/fp.c"
+              , "\33[1;31m"); fprintf(
+# 85 "src/engine/interpreter/fp.c" 3 4
+              stderr
+# 85 "src/engine/interpreter/fp.c"
+              , "op = %d not supported", op); fprintf(
+# 85 "src/engine/interpreter/fp.c" 3 4
+              stderr
+# 85 "src/engine/interpreter/fp.c"
+              , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 85 "src/engine/interpreter/fp.c" 3 4
+              ((void) sizeof ((
+# 85 "src/engine/interpreter/fp.c"
+              0
+# 85 "src/engine/interpreter/fp.c" 3 4
+              ) ? 1 : 0), __extension__ ({ if (
+# 85 "src/engine/interpreter/fp.c"
+              0
+# 85 "src/engine/interpreter/fp.c" 3 4
+              ) ; else __assert_fail (
+# 85 "src/engine/interpreter/fp.c"
+              "0"
+# 85 "src/engine/interpreter/fp.c" 3 4
+              , "src/engine/interpreter/fp.c", 85, __extension__ __PRETTY_FUNCTION__); }))
+# 85 "src/engine/interpreter/fp.c"
+              ; } } while (0);
+    }
+  } else if (w == FPCALL_W64) {
+    float64_t fsrc1 = rtlToF64(*src1);
+    float64_t fsrc2 = rtlToF64(*src2);
+    switch (op) {
+      case FPCALL_ADD: *dest = f64_add(fsrc1, fsrc2).v; break;
+      case FPCALL_SUB: *dest = f64_sub(fsrc1, fsrc2).v; break;
+      case FPCALL_MUL: *dest = f64_mul(fsrc1, fsrc2).v; break;
+      case FPCALL_DIV: *dest = f64_div(fsrc1, fsrc2).v; break;
+      case FPCALL_MAX: *dest = f64_max(fsrc1, fsrc2).v; break;
+      case FPCALL_MIN: *dest = f64_min(fsrc1, fsrc2).v; break;
+
+      case FPCALL_SQRT: *dest = f64_sqrt(fsrc1).v; break;
+
+      case FPCALL_MADD: *dest = f64_mulAdd(fsrc1, fsrc2, rtlToF64(*dest)).v; break;
+
+      case FPCALL_LE: *dest = f64_le(fsrc1, fsrc2); break;
+      case FPCALL_LT: *dest = f64_lt(fsrc1, fsrc2); break;
+      case FPCALL_EQ: *dest = f64_eq(fsrc1, fsrc2); break;
+
+      case FPCALL_I32ToF: *dest = i32_to_f64 (*src1).v; break;
+      case FPCALL_U32ToF: *dest = ui32_to_f64(*src1).v; break;
+      case FPCALL_I64ToF: *dest = i64_to_f64 (*src1).v; break;
+      case FPCALL_U64ToF: *dest = ui64_to_f64(*src1).v; break;
+
+      case FPCALL_FToI32: *dest = my_f64_to_i32 (fsrc1); break;
+      case FPCALL_FToU32: *dest = my_f64_to_ui32(fsrc1); break;
+      case FPCALL_FToI64: *dest = my_f64_to_i64 (fsrc1); break;
+      case FPCALL_FToU64: *dest = my_f64_to_ui64(fsrc1); break;
+
+      case FPCALL_F32ToF64: *dest = f32_to_f64(rtlToF32(*src1)).v; break;
+      case FPCALL_F64ToF32: *dest = f64_to_f32(fsrc1).v; break;
+      default: do { if (!(0)) { fflush(
+# 118 "src/engine/interpreter/fp.c" 3 4
+              stdout
+# 118 "src/engine/interpreter/fp.c"
+              ); fprintf(
+# 118 "src/engine/interpreter/fp.c" 3 4
+              stderr
+# 118 "src/engine/interpreter/fp.c"
+              , "\33[1;31m"); fprintf(
+# 118 "src/engine/interpreter/fp.c" 3 4
+              stderr
+# 118 "src/engine/interpreter/fp.c"
+              , "op = %d not supported", op); fprintf(
+# 118 "src/engine/interpreter/fp.c" 3 4
+              stderr
+# 118 "src/engine/interpreter/fp.c"
+              , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 118 "src/engine/interpreter/fp.c" 3 4
+              ((void) sizeof ((
+# 118 "src/engine/interpreter/fp.c"
+              0
+# 118 "src/engine/interpreter/fp.c" 3 4
+              ) ? 1 : 0), __extension__ ({ if (
+# 118 "src/engine/interpreter/fp.c"
+              0
+# 118 "src/engine/interpreter/fp.c" 3 4
+              ) ; else __assert_fail (
+# 118 "src/engine/interpreter/fp.c"
+              "0"
+# 118 "src/engine/interpreter/fp.c" 3 4
+              , "src/engine/interpreter/fp.c", 118, __extension__ __PRETTY_FUNCTION__); }))
+# 118 "src/engine/interpreter/fp.c"
+              ; } } while (0);
+    }
+  }
+
+  uint32_t ex = fp_get_exception();
+  if (ex) {
+    isa_fp_set_ex(ex);
+    fp_clear_exception();
+  }
+
+}
+
+void rtl_fclass(Decode *s, rtlreg_t *fdest, rtlreg_t *src, int width) {
+
+  if (width == FPCALL_W32) {
+    *fdest = f32_classify(rtlToF32(*src));
+  } else if (width == FPCALL_W64) {
+    *fdest = f64_classify(rtlToF64(*src));
+  } else 
+# 136 "src/engine/interpreter/fp.c" 3 4
+        ((void) sizeof ((
+# 136 "src/engine/interpreter/fp.c"
+        0
+# 136 "src/engine/interpreter/fp.c" 3 4
+        ) ? 1 : 0), __extension__ ({ if (
+# 136 "src/engine/interpreter/fp.c"
+        0
+# 136 "src/engine/interpreter/fp.c" 3 4
+        ) ; else __assert_fail (
+# 136 "src/engine/interpreter/fp.c"
+        "0"
+# 136 "src/engine/interpreter/fp.c" 3 4
+        , "src/engine/interpreter/fp.c", 136, __extension__ __PRETTY_FUNCTION__); }))
+# 136 "src/engine/interpreter/fp.c"
+                 ;
+
+}
@@ -0,0 +1,5231 @@
+# 0 "src/isa/riscv64/difftest/ref.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "src/isa/riscv64/difftest/ref.c"
+# 17 "src/isa/riscv64/difftest/ref.c"
+# 1 "/root/repo/include/isa.h" 1
+# 21 "/root/repo/include/isa.h"
+# 1 "/root/repo/src/isa/riscv64/include/isa-def.h" 1
+# 20 "/root/repo/src/isa/riscv64/include/isa-def.h"
+# 1 "/root/repo/include/common.h" 1
+# 20 "/root/repo/include/common.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 1 3 4
+# 9 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 3 4
+# 1 "/usr/include/stdint.h" 1 3 4
+# 26 "/usr/include/stdint.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 33 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+# 1 "/usr/include/features.h" 1 3 4
+# 392 "/usr/include/features.h" 3 4
+# 1 "/usr/include/features-time64.h" 1 3 4
+# 20 "/usr/include/features-time64.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 21 "/usr/include/features-time64.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 22 "/usr/include/features-time64.h" 2 3 4
+# 393 "/usr/include/features.h" 2 3 4
+# 489 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 1 3 4
+# 561 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 562 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 563 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 490 "/usr/include/features.h" 2 3 4
+# 513 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h" 1 3 4
+# 11 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 2 3 4
+# 514 "/usr/include/features.h" 2 3 4
+# 34 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 2 3 4
+# 27 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 28 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 29 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+
+# 31 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+typedef unsigned char __u_char;
+typedef unsigned short int __u_short;
+typedef unsigned int __u_int;
+typedef unsigned long int __u_long;
+
+
+typedef signed char __int8_t;
+typedef unsigned char __uint8_t;
+typedef signed short int __int16_t;
+typedef unsigned short int __uint16_t;
+typedef signed int __int32_t;
+typedef unsigned int __uint32_t;
+
+typedef signed long int __int64_t;
+typedef unsigned long int __uint64_t;
+
+
+
+
+
+
+typedef __int8_t __int_least8_t;
+typedef __uint8_t __uint_least8_t;
+typedef __int16_t __int_least16_t;
+typedef __uint16_t __uint_least16_t;
+typedef __int32_t __int_least32_t;
+typedef __uint32_t __uint_least32_t;
+typedef __int64_t __int_least64_t;
+typedef __uint64_t __uint_least64_t;
+
+
+
+typedef long int __quad_t;
+typedef unsigned long int __u_quad_t;
+
+
+
+
+
+
+
+typedef long int __intmax_t;
+typedef unsigned long int __uintmax_t;
+# 141 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 1 3 4
+# 142 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/time64.h" 1 3 4
+# 143 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+typedef unsigned long int __dev_t;
+typedef unsigned int __uid_t;
+typedef unsigned int __gid_t;
+typedef unsigned long int __ino_t;
+typedef unsigned long int __ino64_t;
+typedef unsigned int __mode_t;
+typedef unsigned long int __nlink_t;
+typedef long int __off_t;
+typedef long int __off64_t;
+typedef int __pid_t;
+typedef struct { int __val[2]; } __fsid_t;
+typedef long int __clock_t;
+typedef unsigned long int __rlim_t;
+typedef unsigned long int __rlim64_t;
+typedef unsigned int __id_t;
+typedef long int __time_t;
+typedef unsigned int __useconds_t;
+typedef long int __suseconds_t;
+typedef long int __suseconds64_t;
+
+typedef int __daddr_t;
+typedef int __key_t;
+
+
+typedef int __clockid_t;
+
+
+typedef void * __timer_t;
+
+
+typedef long int __blksize_t;
+
+
+
+
+typedef long int __blkcnt_t;
+typedef long int __blkcnt64_t;
+
+
+typedef unsigned long int __fsblkcnt_t;
+typedef unsigned long int __fsblkcnt64_t;
+
+
+typedef unsigned long int __fsfilcnt_t;
+typedef unsigned long int __fsfilcnt64_t;
+
+
+typedef long int __fsword_t;
+
+typedef long int __ssize_t;
+
+
+typedef long int __syscall_slong_t;
+
+typedef unsigned long int __syscall_ulong_t;
+
+
+
+typedef __off64_t __loff_t;
+typedef char *__caddr_t;
+
+
+typedef long int __intptr_t;
+
+
+typedef unsigned int __socklen_t;
+
+
+
+
+typedef int __sig_atomic_t;
+# 28 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wchar.h" 1 3 4
+# 29 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 30 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 3 4
+typedef __int8_t int8_t;
+typedef __int16_t int16_t;
+typedef __int32_t int32_t;
+typedef __int64_t int64_t;
+# 35 "/usr/include/stdint.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 3 4
+typedef __uint8_t uint8_t;
+typedef __uint16_t uint16_t;
+typedef __uint32_t uint32_t;
+typedef __uint64_t uint64_t;
+# 38 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+
+typedef __int_least8_t int_least8_t;
+typedef __int_least16_t int_least16_t;
+typedef __int_least32_t int_least32_t;
+typedef __int_least64_t int_least64_t;
+
+
+typedef __uint_least8_t uint_least8_t;
+typedef __uint_least16_t uint_least16_t;
+typedef __uint_least32_t uint_least32_t;
+typedef __uint_least64_t uint_least64_t;
+
+
+
+
+
+typedef signed char int_fast8_t;
+
+typedef long int int_fast16_t;
+typedef long int int_fast32_t;
+typedef long int int_fast64_t;
+# 71 "/usr/include/stdint.h" 3 4
+typedef unsigned char uint_fast8_t;
+
+typedef unsigned long int uint_fast16_t;
+typedef unsigned long int uint_fast32_t;
+typedef unsigned long int uint_fast64_t;
+# 87 "/usr/include/stdint.h" 3 4
+typedef long int intptr_t;
+
+
+typedef unsigned long int uintptr_t;
+# 101 "/usr/include/stdint.h" 3 4
+typedef __intmax_t intmax_t;
+typedef __uintmax_t uintmax_t;
+# 10 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 2 3 4
+# 21 "/root/repo/include/common.h" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h" 1 3 4
+# 22 "/root/repo/include/common.h" 2
+# 1 "/usr/include/assert.h" 1 3 4
+# 66 "/usr/include/assert.h" 3 4
+
+
+
+extern void __assert_fail (const char *__assertion, const char *__file,
+      unsigned int __line, const char *__function)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+extern void __assert_perror_fail (int __errnum, const char *__file,
+      unsigned int __line, const char *__function)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+
+extern void __assert (const char *__assertion, const char *__file, int __line)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+# 23 "/root/repo/include/common.h" 2
+# 1 "/usr/include/string.h" 1 3 4
+# 26 "/usr/include/string.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 27 "/usr/include/string.h" 2 3 4
+
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 214 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long unsigned int size_t;
+# 34 "/usr/include/string.h" 2 3 4
+# 43 "/usr/include/string.h" 3 4
+extern void *memcpy (void *__restrict __dest, const void *__restrict __src,
+       size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void *memmove (void *__dest, const void *__src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+extern void *memccpy (void *__restrict __dest, const void *__restrict __src,
+        int __c, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2))) __attribute__ ((__access__ (__write_only__, 1, 4)));
+
+
+
+
+extern void *memset (void *__s, int __c, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int memcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 80 "/usr/include/string.h" 3 4
+extern int __memcmpeq (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 107 "/usr/include/string.h" 3 4
+extern void *memchr (const void *__s, int __c, size_t __n)
+      __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 141 "/usr/include/string.h" 3 4
+extern char *strcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern char *strcat (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncat (char *__restrict __dest, const char *__restrict __src,
+        size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int strncmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcoll (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern size_t strxfrm (char *__restrict __dest,
+         const char *__restrict __src, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 3 4
+struct __locale_struct
+{
+
+  struct __locale_data *__locales[13];
+
+
+  const unsigned short int *__ctype_b;
+  const int *__ctype_tolower;
+  const int *__ctype_toupper;
+
+
+  const char *__names[13];
+};
+
+typedef struct __locale_struct *__locale_t;
+# 23 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 2 3 4
+
+typedef __locale_t locale_t;
+# 173 "/usr/include/string.h" 2 3 4
+
+
+extern int strcoll_l (const char *__s1, const char *__s2, locale_t __l)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+extern size_t strxfrm_l (char *__dest, const char *__src, size_t __n,
+    locale_t __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4)))
+     __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+
+
+extern char *strdup (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern char *strndup (const char *__string, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+# 246 "/usr/include/string.h" 3 4
+extern char *strchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 273 "/usr/include/string.h" 3 4
+extern char *strrchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 293 "/usr/include/string.h" 3 4
+extern size_t strcspn (const char *__s, const char *__reject)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern size_t strspn (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 323 "/usr/include/string.h" 3 4
+extern char *strpbrk (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 350 "/usr/include/string.h" 3 4
+extern char *strstr (const char *__haystack, const char *__needle)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strtok (char *__restrict __s, const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern char *__strtok_r (char *__restrict __s,
+    const char *__restrict __delim,
+    char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+
+extern char *strtok_r (char *__restrict __s, const char *__restrict __delim,
+         char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+# 407 "/usr/include/string.h" 3 4
+extern size_t strlen (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern size_t strnlen (const char *__string, size_t __maxlen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern char *strerror (int __errnum) __attribute__ ((__nothrow__ , __leaf__));
+# 432 "/usr/include/string.h" 3 4
+extern int strerror_r (int __errnum, char *__buf, size_t __buflen) __asm__ ("" "__xpg_strerror_r") __attribute__ ((__nothrow__ , __leaf__))
+
+                        __attribute__ ((__nonnull__ (2)))
+    __attribute__ ((__access__ (__write_only__, 2, 3)));
+# 458 "/usr/include/string.h" 3 4
+extern char *strerror_l (int __errnum, locale_t __l) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+# 1 "/usr/include/strings.h" 1 3 4
+# 23 "/usr/include/strings.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 24 "/usr/include/strings.h" 2 3 4
+
+
+
+
+
+
+
+
+
+
+extern int bcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bcopy (const void *__src, void *__dest, size_t __n)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 68 "/usr/include/strings.h" 3 4
+extern char *index (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 96 "/usr/include/strings.h" 3 4
+extern char *rindex (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int ffs (int __i) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+
+extern int ffsl (long int __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+__extension__ extern int ffsll (long long int __ll)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern int strcasecmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strncasecmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+
+extern int strcasecmp_l (const char *__s1, const char *__s2, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+
+extern int strncasecmp_l (const char *__s1, const char *__s2,
+     size_t __n, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 4)));
+
+
+
+# 463 "/usr/include/string.h" 2 3 4
+
+
+
+extern void explicit_bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)))
+    __attribute__ ((__access__ (__write_only__, 1, 2)));
+
+
+
+extern char *strsep (char **__restrict __stringp,
+       const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strsignal (int __sig) __attribute__ ((__nothrow__ , __leaf__));
+# 489 "/usr/include/string.h" 3 4
+extern char *__stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern char *__stpncpy (char *__restrict __dest,
+   const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+# 539 "/usr/include/string.h" 3 4
+
+# 24 "/root/repo/include/common.h" 2
+
+# 1 "/root/repo/include/generated/autoconf.h" 1
+# 26 "/root/repo/include/common.h" 2
+# 1 "/root/repo/include/macro.h" 1
+# 27 "/root/repo/include/common.h" 2
+
+
+
+
+
+
+# 32 "/root/repo/include/common.h"
+typedef uint64_t word_t;
+typedef int64_t sword_t;
+
+
+typedef word_t rtlreg_t;
+typedef word_t vaddr_t;
+typedef uint64_t paddr_t;
+
+typedef uint16_t ioaddr_t;
+
+
+
+
+
+
+
+struct DynamicConfig {
+  
+# 49 "/root/repo/include/common.h" 3 4
+ _Bool 
+# 49 "/root/repo/include/common.h"
+      ignore_illegal_mem_access;
+  
+# 50 "/root/repo/include/common.h" 3 4
+ _Bool 
+# 50 "/root/repo/include/common.h"
+      debug_difftest;
+};
+extern struct DynamicConfig dynamic_config;
+void update_dynamic_config(void* config);
+
+# 1 "/root/repo/include/debug.h" 1
+# 20 "/root/repo/include/debug.h"
+# 1 "/usr/include/stdio.h" 1 3 4
+# 27 "/usr/include/stdio.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 28 "/usr/include/stdio.h" 2 3 4
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 34 "/usr/include/stdio.h" 2 3 4
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 1 3 4
+# 40 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+
+# 40 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+typedef __builtin_va_list __gnuc_va_list;
+# 37 "/usr/include/stdio.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h" 1 3 4
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h" 1 3 4
+# 13 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h" 3 4
+typedef struct
+{
+  int __count;
+  union
+  {
+    unsigned int __wch;
+    char __wchb[4];
+  } __value;
+} __mbstate_t;
+# 6 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h" 2 3 4
+
+
+
+
+typedef struct _G_fpos_t
+{
+  __off_t __pos;
+  __mbstate_t __state;
+} __fpos_t;
+# 40 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__fpos64_t.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/bits/types/__fpos64_t.h" 3 4
+typedef struct _G_fpos64_t
+{
+  __off64_t __pos;
+  __mbstate_t __state;
+} __fpos64_t;
+# 41 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__FILE.h" 1 3 4
+
+
+
+struct _IO_FILE;
+typedef struct _IO_FILE __FILE;
+# 42 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h" 1 3 4
+
+
+
+struct _IO_FILE;
+
+
+typedef struct _IO_FILE FILE;
+# 43 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h" 1 3 4
+# 35 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h" 3 4
+struct _IO_FILE;
+struct _IO_marker;
+struct _IO_codecvt;
+struct _IO_wide_data;
+
+
+
+
+typedef void _IO_lock_t;
+
+
+
+
+
+struct _IO_FILE
+{
+  int _flags;
+
+
+  char *_IO_read_ptr;
+  char *_IO_read_end;
+  char *_IO_read_base;
+  char *_IO_write_base;
+  char *_IO_write_ptr;
+  char *_IO_write_end;
+  char *_IO_buf_base;
+  char *_IO_buf_end;
+
+
+  char *_IO_save_base;
+  char *_IO_backup_base;
+  char *_IO_save_end;
+
+  struct _IO_marker *_markers;
+
+  struct _IO_FILE *_chain;
+
+  int _fileno;
+  int _flags2;
+  __off_t _old_offset;
+
+
+  unsigned short _cur_column;
+  signed char _vtable_offset;
+  char _shortbuf[1];
+
+  _IO_lock_t *_lock;
+
+
+
+
+
+
+
+  __off64_t _offset;
+
+  struct _IO_codecvt *_codecvt;
+  struct _IO_wide_data *_wide_data;
+  struct _IO_FILE *_freeres_list;
+  void *_freeres_buf;
+  size_t __pad5;
+  int _mode;
+
+  char _unused2[15 * sizeof (int) - 4 * sizeof (void *) - sizeof (size_t)];
+};
+# 44 "/usr/include/stdio.h" 2 3 4
+# 52 "/usr/include/stdio.h" 3 4
+typedef __gnuc_va_list va_list;
+# 63 "/usr/include/stdio.h" 3 4
+typedef __off_t off_t;
+# 77 "/usr/include/stdio.h" 3 4
+typedef __ssize_t ssize_t;
+
+
+
+
+
+
+typedef __fpos_t fpos_t;
+# 133 "/usr/include/stdio.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdio_lim.h" 1 3 4
+# 134 "/usr/include/stdio.h" 2 3 4
+# 143 "/usr/include/stdio.h" 3 4
+extern FILE *stdin;
+extern FILE *stdout;
+extern FILE *stderr;
+
+
+
+
+
+
+extern int remove (const char *__filename) __attribute__ ((__nothrow__ , __leaf__));
+
+extern int rename (const char *__old, const char *__new) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int renameat (int __oldfd, const char *__old, int __newfd,
+       const char *__new) __attribute__ ((__nothrow__ , __leaf__));
+# 178 "/usr/include/stdio.h" 3 4
+extern int fclose (FILE *__stream);
+# 188 "/usr/include/stdio.h" 3 4
+extern FILE *tmpfile (void)
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+# 205 "/usr/include/stdio.h" 3 4
+extern char *tmpnam (char[20]) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern char *tmpnam_r (char __s[20]) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 222 "/usr/include/stdio.h" 3 4
+extern char *tempnam (const char *__dir, const char *__pfx)
+   __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (__builtin_free, 1)));
+
+
+
+
+
+
+extern int fflush (FILE *__stream);
+# 239 "/usr/include/stdio.h" 3 4
+extern int fflush_unlocked (FILE *__stream);
+# 258 "/usr/include/stdio.h" 3 4
+extern FILE *fopen (const char *__restrict __filename,
+      const char *__restrict __modes)
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+
+
+
+
+extern FILE *freopen (const char *__restrict __filename,
+        const char *__restrict __modes,
+        FILE *__restrict __stream) ;
+# 293 "/usr/include/stdio.h" 3 4
+extern FILE *fdopen (int __fd, const char *__modes) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+# 308 "/usr/include/stdio.h" 3 4
+extern FILE *fmemopen (void *__s, size_t __len, const char *__modes)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+
+
+
+
+extern FILE *open_memstream (char **__bufloc, size_t *__sizeloc) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+# 328 "/usr/include/stdio.h" 3 4
+extern void setbuf (FILE *__restrict __stream, char *__restrict __buf) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int setvbuf (FILE *__restrict __stream, char *__restrict __buf,
+      int __modes, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern void setbuffer (FILE *__restrict __stream, char *__restrict __buf,
+         size_t __size) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern void setlinebuf (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern int fprintf (FILE *__restrict __stream,
+      const char *__restrict __format, ...);
+
+
+
+
+extern int printf (const char *__restrict __format, ...);
+
+extern int sprintf (char *__restrict __s,
+      const char *__restrict __format, ...) __attribute__ ((__nothrow__));
+
+
+
+
+
+extern int vfprintf (FILE *__restrict __s, const char *__restrict __format,
+       __gnuc_va_list __arg);
+
+
+
+
+extern int vprintf (const char *__restrict __format, __gnuc_va_list __arg);
+
+extern int vsprintf (char *__restrict __s, const char *__restrict __format,
+       __gnuc_va_list __arg) __attribute__ ((__nothrow__));
+
+
+
+extern int snprintf (char *__restrict __s, size_t __maxlen,
+       const char *__restrict __format, ...)
+     __attribute__ ((__nothrow__)) __attribute__ ((__format__ (__printf__, 3, 4)));
+
+extern int vsnprintf (char *__restrict __s, size_t __maxlen,
+        const char *__restrict __format, __gnuc_va_list __arg)
+     __attribute__ ((__nothrow__)) __attribute__ ((__format__ (__printf__, 3, 0)));
+# 403 "/usr/include/stdio.h" 3 4
+extern int vdprintf (int __fd, const char *__restrict __fmt,
+       __gnuc_va_list __arg)
+     __attribute__ ((__format__ (__printf__, 2, 0)));
+extern int dprintf (int __fd, const char *__restrict __fmt, ...)
+     __attribute__ ((__format__ (__printf__, 2, 3)));
+
+
+
+
+
+
+
+extern int fscanf (FILE *__restrict __stream,
+     const char *__restrict __format, ...) ;
+
+
+
+
+extern int scanf (const char *__restrict __format, ...) ;
+
+extern int sscanf (const char *__restrict __s,
+     const char *__restrict __format, ...) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 1 3 4
+# 120 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 2 3 4
+# 121 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 2 3 4
+# 431 "/usr/include/stdio.h" 2 3 4
+
+
+
+extern int fscanf (FILE *__restrict __stream, const char *__restrict __format, ...) __asm__ ("" "__isoc99_fscanf")
+
+                               ;
+extern int scanf (const char *__restrict __format, ...) __asm__ ("" "__isoc99_scanf")
+                              ;
+extern int sscanf (const char *__restrict __s, const char *__restrict __format, ...) __asm__ ("" "__isoc99_sscanf") __attribute__ ((__nothrow__ , __leaf__))
+
+                      ;
+# 459 "/usr/include/stdio.h" 3 4
+extern int vfscanf (FILE *__restrict __s, const char *__restrict __format,
+      __gnuc_va_list __arg)
+     __attribute__ ((__format__ (__scanf__, 2, 0))) ;
+
+
+
+
+
+extern int vscanf (const char *__restrict __format, __gnuc_va_list __arg)
+     __attribute__ ((__format__ (__scanf__, 1, 0))) ;
+
+
+extern int vsscanf (const char *__restrict __s,
+      const char *__restrict __format, __gnuc_va_list __arg)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__format__ (__scanf__, 2, 0)));
+
+
+
+
+
+extern int vfscanf (FILE *__restrict __s, const char *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vfscanf")
+
+
+
+     __attribute__ ((__format__ (__scanf__, 2, 0))) ;
+extern int vscanf (const char *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vscanf")
+
+     __attribute__ ((__format__ (__scanf__, 1, 0))) ;
+extern int vsscanf (const char *__restrict __s, const char *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vsscanf") __attribute__ ((__nothrow__ , __leaf__))
+
+
+
+     __attribute__ ((__format__ (__scanf__, 2, 0)));
+# 513 "/usr/include/stdio.h" 3 4
+extern int fgetc (FILE *__stream);
+extern int getc (FILE *__stream);
+
+
+
+
+
+extern int getchar (void);
+
+
+
+
+
+
+extern int getc_unlocked (FILE *__stream);
+extern int getchar_unlocked (void);
+# 538 "/usr/include/stdio.h" 3 4
+extern int fgetc_unlocked (FILE *__stream);
+# 549 "/usr/include/stdio.h" 3 4
+extern int fputc (int __c, FILE *__stream);
+extern int putc (int __c, FILE *__stream);
+
+
+
+
+
+extern int putchar (int __c);
+# 565 "/usr/include/stdio.h" 3 4
+extern int fputc_unlocked (int __c, FILE *__stream);
+
+
+
+
+
+
+
+extern int putc_unlocked (int __c, FILE *__stream);
+extern int putchar_unlocked (int __c);
+
+
+
+
+
+
+extern int getw (FILE *__stream);
+
+
+extern int putw (int __w, FILE *__stream);
+
+
+
+
+
+
+
+extern char *fgets (char *__restrict __s, int __n, FILE *__restrict __stream)
+     __attribute__ ((__access__ (__write_only__, 1, 2)));
+# 632 "/usr/include/stdio.h" 3 4
+extern __ssize_t __getdelim (char **__restrict __lineptr,
+                             size_t *__restrict __n, int __delimiter,
+                             FILE *__restrict __stream) ;
+extern __ssize_t getdelim (char **__restrict __lineptr,
+                           size_t *__restrict __n, int __delimiter,
+                           FILE *__restrict __stream) ;
+
+
+
+
+
+
+
+extern __ssize_t getline (char **__restrict __lineptr,
+                          size_t *__restrict __n,
+                          FILE *__restrict __stream) ;
+
+
+
+
+
+
+
+extern int fputs (const char *__restrict __s, FILE *__restrict __stream);
+
+
+
+
+
+extern int puts (const char *__s);
+
+
+
+
+
+
+extern int ungetc (int __c, FILE *__stream);
+
+
+
+
+
+
+extern size_t fread (void *__restrict __ptr, size_t __size,
+       size_t __n, FILE *__restrict __stream) ;
+
+
+
+
+extern size_t fwrite (const void *__restrict __ptr, size_t __size,
+        size_t __n, FILE *__restrict __s);
+# 702 "/usr/include/stdio.h" 3 4
+extern size_t fread_unlocked (void *__restrict __ptr, size_t __size,
+         size_t __n, FILE *__restrict __stream) ;
+extern size_t fwrite_unlocked (const void *__restrict __ptr, size_t __size,
+          size_t __n, FILE *__restrict __stream);
+
+
+
+
+
+
+
+extern int fseek (FILE *__stream, long int __off, int __whence);
+
+
+
+
+extern long int ftell (FILE *__stream) ;
+
+
+
+
+extern void rewind (FILE *__stream);
+# 736 "/usr/include/stdio.h" 3 4
+extern int fseeko (FILE *__stream, __off_t __off, int __whence);
+
+
+
+
+extern __off_t ftello (FILE *__stream) ;
+# 760 "/usr/include/stdio.h" 3 4
+extern int fgetpos (FILE *__restrict __stream, fpos_t *__restrict __pos);
+
+
+
+
+extern int fsetpos (FILE *__stream, const fpos_t *__pos);
+# 786 "/usr/include/stdio.h" 3 4
+extern void clearerr (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+
+extern int feof (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+extern int ferror (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+extern void clearerr_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+extern int feof_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+extern int ferror_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+
+
+extern void perror (const char *__s);
+
+
+
+
+extern int fileno (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern int fileno_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 823 "/usr/include/stdio.h" 3 4
+extern int pclose (FILE *__stream);
+
+
+
+
+
+extern FILE *popen (const char *__command, const char *__modes)
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (pclose, 1))) ;
+
+
+
+
+
+
+extern char *ctermid (char *__s) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__access__ (__write_only__, 1)));
+# 867 "/usr/include/stdio.h" 3 4
+extern void flockfile (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int ftrylockfile (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern void funlockfile (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+# 885 "/usr/include/stdio.h" 3 4
+extern int __uflow (FILE *);
+extern int __overflow (FILE *, int);
+# 902 "/usr/include/stdio.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdio.h" 1 3 4
+# 38 "/usr/include/x86_64-linux-gnu/bits/stdio.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) int
+vprintf (const char *__restrict __fmt, __gnuc_va_list __arg)
+{
+  return vfprintf (stdout, __fmt, __arg);
+}
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+getchar (void)
+{
+  return getc (stdin);
+}
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+fgetc_unlocked (FILE *__fp)
+{
+  return (__builtin_expect (((__fp)->_IO_read_ptr >= (__fp)->_IO_read_end), 0) ? __uflow (__fp) : *(unsigned char *) (__fp)->_IO_read_ptr++);
+}
+
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+getc_unlocked (FILE *__fp)
+{
+  return (__builtin_expect (((__fp)->_IO_read_ptr >= (__fp)->_IO_read_end), 0) ? __uflow (__fp) : *(unsigned char *) (__fp)->_IO_read_ptr++);
+}
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+getchar_unlocked (void)
+{
+  return (__builtin_expect (((stdin)->_IO_read_ptr >= (stdin)->_IO_read_end), 0) ? __uflow (stdin) : *(unsigned char *) (stdin)->_IO_read_ptr++);
+}
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+putchar (int __c)
+{
+  return putc (__c, stdout);
+}
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+fputc_unlocked (int __c, FILE *__stream)
+{
+  return (__builtin_expect (((__stream)->_IO_write_ptr >= (__stream)->_IO_write_end), 0) ? __overflow (__stream, (unsigned char) (__c)) : (unsigned char) (*(__stream)->_IO_write_ptr++ = (__c)));
+}
+
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+putc_unlocked (int __c, FILE *__stream)
+{
+  return (__builtin_expect (((__stream)->_IO_write_ptr >= (__stream)->_IO_write_end), 0) ? __overflow (__stream, (unsigned char) (__c)) : (unsigned char) (*(__stream)->_IO_write_ptr++ = (__c)));
+}
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+putchar_unlocked (int __c)
+{
+  return (__builtin_expect (((stdout)->_IO_write_ptr >= (stdout)->_IO_write_end), 0) ? __overflow (stdout, (unsigned char) (__c)) : (unsigned char) (*(stdout)->_IO_write_ptr++ = (__c)));
+}
+# 127 "/usr/include/x86_64-linux-gnu/bits/stdio.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) int
+__attribute__ ((__nothrow__ , __leaf__)) feof_unlocked (FILE *__stream)
+{
+  return (((__stream)->_flags & 0x0010) != 0);
+}
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+__attribute__ ((__nothrow__ , __leaf__)) ferror_unlocked (FILE *__stream)
+{
+  return (((__stream)->_flags & 0x0020) != 0);
+}
+# 903 "/usr/include/stdio.h" 2 3 4
+
+
+
+
+
+
+
+# 21 "/root/repo/include/debug.h" 2
+# 1 "/usr/include/assert.h" 1 3 4
+# 22 "/root/repo/include/debug.h" 2
+# 1 "/root/repo/include/utils.h" 1
+# 20 "/root/repo/include/utils.h"
+# 1 "/root/repo/include/common.h" 1
+# 21 "/root/repo/include/utils.h" 2
+
+
+
+
+# 24 "/root/repo/include/utils.h"
+enum { NEMU_RUNNING, NEMU_STOP, NEMU_END, NEMU_ABORT, NEMU_QUIT };
+
+typedef struct {
+  int state;
+  vaddr_t halt_pc;
+  uint32_t halt_ret;
+} NEMUState;
+
+extern NEMUState nemu_state;
+
+enum {
+  dflag_none = 0,
+  dflag_mem,
+  dflag_translate,
+  dflag_trace_bb,
+  dflag_trace_inst,
+  dflag_trace_inst_dasm,
+  dflag_exit,
+};
+
+
+
+
+uint64_t get_time();
+# 68 "/root/repo/include/utils.h"
+extern char log_bytebuf[80];
+extern char log_asmbuf[80];
+
+
+
+word_t expr(char *e, 
+# 73 "/root/repo/include/utils.h" 3 4
+                    _Bool 
+# 73 "/root/repo/include/utils.h"
+                         *success);
+
+
+void iqueue_commit(vaddr_t pc, uint8_t *instr_buf, uint8_t ilen);
+void iqueue_dump();
+
+
+
+
+
+# 82 "/root/repo/include/utils.h" 3 4
+_Bool 
+# 82 "/root/repo/include/utils.h"
+    is_gz_file(const char *filename);
+# 23 "/root/repo/include/debug.h" 2
+# 1 "/usr/include/unistd.h" 1 3 4
+# 27 "/usr/include/unistd.h" 3 4
+
+# 202 "/usr/include/unistd.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/posix_opt.h" 1 3 4
+# 203 "/usr/include/unistd.h" 2 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/environments.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/environments.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/environments.h" 2 3 4
+# 207 "/usr/include/unistd.h" 2 3 4
+# 226 "/usr/include/unistd.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 227 "/usr/include/unistd.h" 2 3 4
+
+
+
+
+
+
+# 232 "/usr/include/unistd.h" 3 4
+typedef __gid_t gid_t;
+
+
+
+
+typedef __uid_t uid_t;
+# 255 "/usr/include/unistd.h" 3 4
+typedef __useconds_t useconds_t;
+
+
+
+
+typedef __pid_t pid_t;
+# 274 "/usr/include/unistd.h" 3 4
+typedef __socklen_t socklen_t;
+# 287 "/usr/include/unistd.h" 3 4
+extern int access (const char *__name, int __type) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 309 "/usr/include/unistd.h" 3 4
+extern int faccessat (int __fd, const char *__file, int __type, int __flag)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) ;
+# 339 "/usr/include/unistd.h" 3 4
+extern __off_t lseek (int __fd, __off_t __offset, int __whence) __attribute__ ((__nothrow__ , __leaf__));
+# 358 "/usr/include/unistd.h" 3 4
+extern int close (int __fd);
+
+
+
+
+extern void closefrom (int __lowfd) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern ssize_t read (int __fd, void *__buf, size_t __nbytes)
+    __attribute__ ((__access__ (__write_only__, 2, 3)));
+
+
+
+
+
+extern ssize_t write (int __fd, const void *__buf, size_t __n)
+    __attribute__ ((__access__ (__read_only__, 2, 3)));
+# 389 "/usr/include/unistd.h" 3 4
+extern ssize_t pread (int __fd, void *__buf, size_t __nbytes,
+        __off_t __offset)
+    __attribute__ ((__access__ (__write_only__, 2, 3)));
+
+
+
+
+
+
+extern ssize_t pwrite (int __fd, const void *__buf, size_t __n,
+         __off_t __offset)
+    __attribute__ ((__access__ (__read_only__, 2, 3)));
+# 437 "/usr/include/unistd.h" 3 4
+extern int pipe (int __pipedes[2]) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 452 "/usr/include/unistd.h" 3 4
+extern unsigned int alarm (unsigned int __seconds) __attribute__ ((__nothrow__ , __leaf__));
+# 464 "/usr/include/unistd.h" 3 4
+extern unsigned int sleep (unsigned int __seconds);
+
+
+
+
+
+
+
+extern __useconds_t ualarm (__useconds_t __value, __useconds_t __interval)
+     __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern int usleep (__useconds_t __useconds);
+# 489 "/usr/include/unistd.h" 3 4
+extern int pause (void);
+
+
+
+extern int chown (const char *__file, __uid_t __owner, __gid_t __group)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+extern int fchown (int __fd, __uid_t __owner, __gid_t __group) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern int lchown (const char *__file, __uid_t __owner, __gid_t __group)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+
+
+extern int fchownat (int __fd, const char *__file, __uid_t __owner,
+       __gid_t __group, int __flag)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) ;
+
+
+
+extern int chdir (const char *__path) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+extern int fchdir (int __fd) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 531 "/usr/include/unistd.h" 3 4
+extern char *getcwd (char *__buf, size_t __size) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 545 "/usr/include/unistd.h" 3 4
+extern char *getwd (char *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) __attribute__ ((__deprecated__))
+    __attribute__ ((__access__ (__write_only__, 1)));
+
+
+
+
+extern int dup (int __fd) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern int dup2 (int __fd, int __fd2) __attribute__ ((__nothrow__ , __leaf__));
+# 564 "/usr/include/unistd.h" 3 4
+extern char **__environ;
+
+
+
+
+
+
+
+extern int execve (const char *__path, char *const __argv[],
+     char *const __envp[]) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern int fexecve (int __fd, char *const __argv[], char *const __envp[])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+
+extern int execv (const char *__path, char *const __argv[])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern int execle (const char *__path, const char *__arg, ...)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern int execl (const char *__path, const char *__arg, ...)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern int execvp (const char *__file, char *const __argv[])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern int execlp (const char *__file, const char *__arg, ...)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+# 619 "/usr/include/unistd.h" 3 4
+extern int nice (int __inc) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern void _exit (int __status) __attribute__ ((__noreturn__));
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/confname.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/confname.h" 3 4
+enum
+  {
+    _PC_LINK_MAX,
+
+    _PC_MAX_CANON,
+
+    _PC_MAX_INPUT,
+
+    _PC_NAME_MAX,
+
+    _PC_PATH_MAX,
+
+    _PC_PIPE_BUF,
+
+    _PC_CHOWN_RESTRICTED,
+
+    _PC_NO_TRUNC,
+
+    _PC_VDISABLE,
+
+    _PC_SYNC_IO,
+
+    _PC_ASYNC_IO,
+
+    _PC_PRIO_IO,
+
+    _PC_SOCK_MAXBUF,
+
+    _PC_FILESIZEBITS,
+
+    _PC_REC_INCR_XFER_SIZE,
+
+    _PC_REC_MAX_XFER_SIZE,
+
+    _PC_REC_MIN_XFER_SIZE,
+
+    _PC_REC_XFER_ALIGN,
+
+    _PC_ALLOC_SIZE_MIN,
+
+    _PC_SYMLINK_MAX,
+
+    _PC_2_SYMLINKS
+
+  };
+
+
+enum
+  {
+    _SC_ARG_MAX,
+
+    _SC_CHILD_MAX,
+
+    _SC_CLK_TCK,
+
+    _SC_NGROUPS_MAX,
+
+    _SC_OPEN_MAX,
+
+    _SC_STREAM_MAX,
+
+    _SC_TZNAME_MAX,
+
+    _SC_JOB_CONTROL,
+
+    _SC_SAVED_IDS,
+
+    _SC_REALTIME_SIGNALS,
+
+    _SC_PRIORITY_SCHEDULING,
+
+    _SC_TIMERS,
+
+    _SC_ASYNCHRONOUS_IO,
+
+    _SC_PRIORITIZED_IO,
+
+    _SC_SYNCHRONIZED_IO,
+
+    _SC_FSYNC,
+
+    _SC_MAPPED_FILES,
+
+    _SC_MEMLOCK,
+
+    _SC_MEMLOCK_RANGE,
+
+    _SC_MEMORY_PROTECTION,
+
+    _SC_MESSAGE_PASSING,
+
+    _SC_SEMAPHORES,
+
+    _SC_SHARED_MEMORY_OBJECTS,
+
+    _SC_AIO_LISTIO_MAX,
+
+    _SC_AIO_MAX,
+
+    _SC_AIO_PRIO_DELTA_MAX,
+
+    _SC_DELAYTIMER_MAX,
+
+    _SC_MQ_OPEN_MAX,
+
+    _SC_MQ_PRIO_MAX,
+
+    _SC_VERSION,
+
+    _SC_PAGESIZE,
+
+
+    _SC_RTSIG_MAX,
+
+    _SC_SEM_NSEMS_MAX,
+
+    _SC_SEM_VALUE_MAX,
+
+    _SC_SIGQUEUE_MAX,
+
+    _SC_TIMER_MAX,
+
+
+
+
+    _SC_BC_BASE_MAX,
+
+    _SC_BC_DIM_MAX,
+
+    _SC_BC_SCALE_MAX,
+
+    _SC_BC_STRING_MAX,
+
+    _SC_COLL_WEIGHTS_MAX,
+
+    _SC_EQUIV_CLASS_MAX,
+
+    _SC_EXPR_NEST_MAX,
+
+    _SC_LINE_MAX,
+
+    _SC_RE_DUP_MAX,
+
+    _SC_CHARCLASS_NAME_MAX,
+
+
+    _SC_2_VERSION,
+
+    _SC_2_C_BIND,
+
+    _SC_2_C_DEV,
+
+    _SC_2_FORT_DEV,
+
+    _SC_2_FORT_RUN,
+
+    _SC_2_SW_DEV,
+
+    _SC_2_LOCALEDEF,
+
+
+    _SC_PII,
+
+    _SC_PII_XTI,
+
+    _SC_PII_SOCKET,
+
+    _SC_PII_INTERNET,
+
+    _SC_PII_OSI,
+
+    _SC_POLL,
+
+    _SC_SELECT,
+
+    _SC_UIO_MAXIOV,
+
+    _SC_IOV_MAX = _SC_UIO_MAXIOV,
+
+    _SC_PII_INTERNET_STREAM,
+
+    _SC_PII_INTERNET_DGRAM,
+
+    _SC_PII_OSI_COTS,
+
+    _SC_PII_OSI_CLTS,
+
+    _SC_PII_OSI_M,
+
+    _SC_T_IOV_MAX,
+
+
+
+    _SC_THREADS,
+
+    _SC_THREAD_SAFE_FUNCTIONS,
+
+    _SC_GETGR_R_SIZE_MAX,
+
+    _SC_GETPW_R_SIZE_MAX,
+
+    _SC_LOGIN_NAME_MAX,
+
+    _SC_TTY_NAME_MAX,
+
+    _SC_THREAD_DESTRUCTOR_ITERATIONS,
+
+    _SC_THREAD_KEYS_MAX,
+
+    _SC_THREAD_STACK_MIN,
+
+    _SC_THREAD_THREADS_MAX,
+
+    _SC_THREAD_ATTR_STACKADDR,
+
+    _SC_THREAD_ATTR_STACKSIZE,
+
+    _SC_THREAD_PRIORITY_SCHEDULING,
+
+    _SC_THREAD_PRIO_INHERIT,
+
+    _SC_THREAD_PRIO_PROTECT,
+
+    _SC_THREAD_PROCESS_SHARED,
+
+
+    _SC_NPROCESSORS_CONF,
+
+    _SC_NPROCESSORS_ONLN,
+
+    _SC_PHYS_PAGES,
+
+    _SC_AVPHYS_PAGES,
+
+    _SC_ATEXIT_MAX,
+
+    _SC_PASS_MAX,
+
+
+    _SC_XOPEN_VERSION,
+
+    _SC_XOPEN_XCU_VERSION,
+
+    _SC_XOPEN_UNIX,
+
+    _SC_XOPEN_CRYPT,
+
+    _SC_XOPEN_ENH_I18N,
+
+    _SC_XOPEN_SHM,
+
+
+    _SC_2_CHAR_TERM,
+
+    _SC_2_C_VERSION,
+
+    _SC_2_UPE,
+
+
+    _SC_XOPEN_XPG2,
+
+    _SC_XOPEN_XPG3,
+
+    _SC_XOPEN_XPG4,
+
+
+    _SC_CHAR_BIT,
+
+    _SC_CHAR_MAX,
+
+    _SC_CHAR_MIN,
+
+    _SC_INT_MAX,
+
+    _SC_INT_MIN,
+
+    _SC_LONG_BIT,
+
+    _SC_WORD_BIT,
+
+    _SC_MB_LEN_MAX,
+
+    _SC_NZERO,
+
+    _SC_SSIZE_MAX,
+
+    _SC_SCHAR_MAX,
+
+    _SC_SCHAR_MIN,
+
+    _SC_SHRT_MAX,
+
+    _SC_SHRT_MIN,
+
+    _SC_UCHAR_MAX,
+
+    _SC_UINT_MAX,
+
+    _SC_ULONG_MAX,
+
+    _SC_USHRT_MAX,
+
+
+    _SC_NL_ARGMAX,
+
+    _SC_NL_LANGMAX,
+
+    _SC_NL_MSGMAX,
+
+    _SC_NL_NMAX,
+
+    _SC_NL_SETMAX,
+
+    _SC_NL_TEXTMAX,
+
+
+    _SC_XBS5_ILP32_OFF32,
+
+    _SC_XBS5_ILP32_OFFBIG,
+
+    _SC_XBS5_LP64_OFF64,
+
+    _SC_XBS5_LPBIG_OFFBIG,
+
+
+    _SC_XOPEN_LEGACY,
+
+    _SC_XOPEN_REALTIME,
+
+    _SC_XOPEN_REALTIME_THREADS,
+
+
+    _SC_ADVISORY_INFO,
+
+    _SC_BARRIERS,
+
+    _SC_BASE,
+
+    _SC_C_LANG_SUPPORT,
+
+    _SC_C_LANG_SUPPORT_R,
+
+    _SC_CLOCK_SELECTION,
+
+    _SC_CPUTIME,
+
+    _SC_THREAD_CPUTIME,
+
+    _SC_DEVICE_IO,
+
+    _SC_DEVICE_SPECIFIC,
+
+    _SC_DEVICE_SPECIFIC_R,
+
+    _SC_FD_MGMT,
+
+    _SC_FIFO,
+
+    _SC_PIPE,
+
+    _SC_FILE_ATTRIBUTES,
+
+    _SC_FILE_LOCKING,
+
+    _SC_FILE_SYSTEM,
+
+    _SC_MONOTONIC_CLOCK,
+
+    _SC_MULTI_PROCESS,
+
+    _SC_SINGLE_PROCESS,
+
+    _SC_NETWORKING,
+
+    _SC_READER_WRITER_LOCKS,
+
+    _SC_SPIN_LOCKS,
+
+    _SC_REGEXP,
+
+    _SC_REGEX_VERSION,
+
+    _SC_SHELL,
+
+    _SC_SIGNALS,
+
+    _SC_SPAWN,
+
+    _SC_SPORADIC_SERVER,
+
+    _SC_THREAD_SPORADIC_SERVER,
+
+    _SC_SYSTEM_DATABASE,
+
+    _SC_SYSTEM_DATABASE_R,
+
+    _SC_TIMEOUTS,
+
+    _SC_TYPED_MEMORY_OBJECTS,
+
+    _SC_USER_GROUPS,
+
+    _SC_USER_GROUPS_R,
+
+    _SC_2_PBS,
+
+    _SC_2_PBS_ACCOUNTING,
+
+    _SC_2_PBS_LOCATE,
+
+    _SC_2_PBS_MESSAGE,
+
+    _SC_2_PBS_TRACK,
+
+    _SC_SYMLOOP_MAX,
+
+    _SC_STREAMS,
+
+    _SC_2_PBS_CHECKPOINT,
+
+
+    _SC_V6_ILP32_OFF32,
+
+    _SC_V6_ILP32_OFFBIG,
+
+    _SC_V6_LP64_OFF64,
+
+    _SC_V6_LPBIG_OFFBIG,
+
+
+    _SC_HOST_NAME_MAX,
+
+    _SC_TRACE,
+
+    _SC_TRACE_EVENT_FILTER,
+
+    _SC_TRACE_INHERIT,
+
+    _SC_TRACE_LOG,
+
+
+    _SC_LEVEL1_ICACHE_SIZE,
+
+    _SC_LEVEL1_ICACHE_ASSOC,
+
+    _SC_LEVEL1_ICACHE_LINESIZE,
+
+    _SC_LEVEL1_DCACHE_SIZE,
+
+    _SC_LEVEL1_DCACHE_ASSOC,
+
+    _SC_LEVEL1_DCACHE_LINESIZE,
+
+    _SC_LEVEL2_CACHE_SIZE,
+
+    _SC_LEVEL2_CACHE_ASSOC,
+
+    _SC_LEVEL2_CACHE_LINESIZE,
+
+    _SC_LEVEL3_CACHE_SIZE,
+
+    _SC_LEVEL3_CACHE_ASSOC,
+
+    _SC_LEVEL3_CACHE_LINESIZE,
+
+    _SC_LEVEL4_CACHE_SIZE,
+
+    _SC_LEVEL4_CACHE_ASSOC,
+
+    _SC_LEVEL4_CACHE_LINESIZE,
+
+
+
+    _SC_IPV6 = _SC_LEVEL1_ICACHE_SIZE + 50,
+
+    _SC_RAW_SOCKETS,
+
+
+    _SC_V7_ILP32_OFF32,
+
+    _SC_V7_ILP32_OFFBIG,
+
+    _SC_V7_LP64_OFF64,
+
+    _SC_V7_LPBIG_OFFBIG,
+
+
+    _SC_SS_REPL_MAX,
+
+
+    _SC_TRACE_EVENT_NAME_MAX,
+
+    _SC_TRACE_NAME_MAX,
+
+    _SC_TRACE_SYS_MAX,
+
+    _SC_TRACE_USER_EVENT_MAX,
+
+
+    _SC_XOPEN_STREAMS,
+
+
+    _SC_THREAD_ROBUST_PRIO_INHERIT,
+
+    _SC_THREAD_ROBUST_PRIO_PROTECT,
+
+
+    _SC_MINSIGSTKSZ,
+
+
+    _SC_SIGSTKSZ
+
+  };
+
+
+enum
+  {
+    _CS_PATH,
+
+
+    _CS_V6_WIDTH_RESTRICTED_ENVS,
+
+
+
+    _CS_GNU_LIBC_VERSION,
+
+    _CS_GNU_LIBPTHREAD_VERSION,
+
+
+    _CS_V5_WIDTH_RESTRICTED_ENVS,
+
+
+
+    _CS_V7_WIDTH_RESTRICTED_ENVS,
+
+
+
+    _CS_LFS_CFLAGS = 1000,
+
+    _CS_LFS_LDFLAGS,
+
+    _CS_LFS_LIBS,
+
+    _CS_LFS_LINTFLAGS,
+
+    _CS_LFS64_CFLAGS,
+
+    _CS_LFS64_LDFLAGS,
+
+    _CS_LFS64_LIBS,
+
+    _CS_LFS64_LINTFLAGS,
+
+
+    _CS_XBS5_ILP32_OFF32_CFLAGS = 1100,
+
+    _CS_XBS5_ILP32_OFF32_LDFLAGS,
+
+    _CS_XBS5_ILP32_OFF32_LIBS,
+
+    _CS_XBS5_ILP32_OFF32_LINTFLAGS,
+
+    _CS_XBS5_ILP32_OFFBIG_CFLAGS,
+
+    _CS_XBS5_ILP32_OFFBIG_LDFLAGS,
+
+    _CS_XBS5_ILP32_OFFBIG_LIBS,
+
+    _CS_XBS5_ILP32_OFFBIG_LINTFLAGS,
+
+    _CS_XBS5_LP64_OFF64_CFLAGS,
+
+    _CS_XBS5_LP64_OFF64_LDFLAGS,
+
+    _CS_XBS5_LP64_OFF64_LIBS,
+
+    _CS_XBS5_LP64_OFF64_LINTFLAGS,
+
+    _CS_XBS5_LPBIG_OFFBIG_CFLAGS,
+
+    _CS_XBS5_LPBIG_OFFBIG_LDFLAGS,
+
+    _CS_XBS5_LPBIG_OFFBIG_LIBS,
+
+    _CS_XBS5_LPBIG_OFFBIG_LINTFLAGS,
+
+
+    _CS_POSIX_V6_ILP32_OFF32_CFLAGS,
+
+    _CS_POSIX_V6_ILP32_OFF32_LDFLAGS,
+
+    _CS_POSIX_V6_ILP32_OFF32_LIBS,
+
+    _CS_POSIX_V6_ILP32_OFF32_LINTFLAGS,
+
+    _CS_POSIX_V6_ILP32_OFFBIG_CFLAGS,
+
+    _CS_POSIX_V6_ILP32_OFFBIG_LDFLAGS,
+
+    _CS_POSIX_V6_ILP32_OFFBIG_LIBS,
+
+    _CS_POSIX_V6_ILP32_OFFBIG_LINTFLAGS,
+
+    _CS_POSIX_V6_LP64_OFF64_CFLAGS,
+
+    _CS_POSIX_V6_LP64_OFF64_LDFLAGS,
+
+    _CS_POSIX_V6_LP64_OFF64_LIBS,
+
+    _CS_POSIX_V6_LP64_OFF64_LINTFLAGS,
+
+    _CS_POSIX_V6_LPBIG_OFFBIG_CFLAGS,
+
+    _CS_POSIX_V6_LPBIG_OFFBIG_LDFLAGS,
+
+    _CS_POSIX_V6_LPBIG_OFFBIG_LIBS,
+
+    _CS_POSIX_V6_LPBIG_OFFBIG_LINTFLAGS,
+
+
+    _CS_POSIX_V7_ILP32_OFF32_CFLAGS,
+
+    _CS_POSIX_V7_ILP32_OFF32_LDFLAGS,
+
+    _CS_POSIX_V7_ILP32_OFF32_LIBS,
+
+    _CS_POSIX_V7_ILP32_OFF32_LINTFLAGS,
+
+    _CS_POSIX_V7_ILP32_OFFBIG_CFLAGS,
+
+    _CS_POSIX_V7_ILP32_OFFBIG_LDFLAGS,
+
+    _CS_POSIX_V7_ILP32_OFFBIG_LIBS,
+
+    _CS_POSIX_V7_ILP32_OFFBIG_LINTFLAGS,
+
+    _CS_POSIX_V7_LP64_OFF64_CFLAGS,
+
+    _CS_POSIX_V7_LP64_OFF64_LDFLAGS,
+
+    _CS_POSIX_V7_LP64_OFF64_LIBS,
+
+    _CS_POSIX_V7_LP64_OFF64_LINTFLAGS,
+
+    _CS_POSIX_V7_LPBIG_OFFBIG_CFLAGS,
+
+    _CS_POSIX_V7_LPBIG_OFFBIG_LDFLAGS,
+
+    _CS_POSIX_V7_LPBIG_OFFBIG_LIBS,
+
+    _CS_POSIX_V7_LPBIG_OFFBIG_LINTFLAGS,
+
+
+    _CS_V6_ENV,
+
+    _CS_V7_ENV
+
+  };
+# 631 "/usr/include/unistd.h" 2 3 4
+
+
+extern long int pathconf (const char *__path, int __name)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern long int fpathconf (int __fd, int __name) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern long int sysconf (int __name) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern size_t confstr (int __name, char *__buf, size_t __len) __attribute__ ((__nothrow__ , __leaf__))
+    __attribute__ ((__access__ (__write_only__, 2, 3)));
+
+
+
+
+extern __pid_t getpid (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern __pid_t getppid (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern __pid_t getpgrp (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern __pid_t __getpgid (__pid_t __pid) __attribute__ ((__nothrow__ , __leaf__));
+
+extern __pid_t getpgid (__pid_t __pid) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern int setpgid (__pid_t __pid, __pid_t __pgid) __attribute__ ((__nothrow__ , __leaf__));
+# 682 "/usr/include/unistd.h" 3 4
+extern int setpgrp (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern __pid_t setsid (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern __pid_t getsid (__pid_t __pid) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern __uid_t getuid (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern __uid_t geteuid (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern __gid_t getgid (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern __gid_t getegid (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern int getgroups (int __size, __gid_t __list[]) __attribute__ ((__nothrow__ , __leaf__))
+    __attribute__ ((__access__ (__write_only__, 2, 1)));
+# 722 "/usr/include/unistd.h" 3 4
+extern int setuid (__uid_t __uid) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern int setreuid (__uid_t __ruid, __uid_t __euid) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern int seteuid (__uid_t __uid) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+
+extern int setgid (__gid_t __gid) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern int setregid (__gid_t __rgid, __gid_t __egid) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern int setegid (__gid_t __gid) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 778 "/usr/include/unistd.h" 3 4
+extern __pid_t fork (void) __attribute__ ((__nothrow__));
+
+
+
+
+
+
+
+extern __pid_t vfork (void) __attribute__ ((__nothrow__ , __leaf__));
+# 799 "/usr/include/unistd.h" 3 4
+extern char *ttyname (int __fd) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int ttyname_r (int __fd, char *__buf, size_t __buflen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)))
+     __attribute__ ((__access__ (__write_only__, 2, 3)));
+
+
+
+extern int isatty (int __fd) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern int ttyslot (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern int link (const char *__from, const char *__to)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2))) ;
+
+
+
+
+extern int linkat (int __fromfd, const char *__from, int __tofd,
+     const char *__to, int __flags)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4))) ;
+
+
+
+
+extern int symlink (const char *__from, const char *__to)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2))) ;
+
+
+
+
+extern ssize_t readlink (const char *__restrict __path,
+    char *__restrict __buf, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)))
+     __attribute__ ((__access__ (__write_only__, 2, 3)));
+
+
+
+
+
+extern int symlinkat (const char *__from, int __tofd,
+        const char *__to) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 3))) ;
+
+
+extern ssize_t readlinkat (int __fd, const char *__restrict __path,
+      char *__restrict __buf, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)))
+     __attribute__ ((__access__ (__write_only__, 3, 4)));
+
+
+
+extern int unlink (const char *__name) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int unlinkat (int __fd, const char *__name, int __flag)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern int rmdir (const char *__path) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern __pid_t tcgetpgrp (int __fd) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int tcsetpgrp (int __fd, __pid_t __pgrp_id) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern char *getlogin (void);
+
+
+
+
+
+
+
+extern int getlogin_r (char *__name, size_t __name_len) __attribute__ ((__nonnull__ (1)))
+    __attribute__ ((__access__ (__write_only__, 1, 2)));
+
+
+
+
+extern int setlogin (const char *__name) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/getopt_posix.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/getopt_posix.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/getopt_core.h" 1 3 4
+# 28 "/usr/include/x86_64-linux-gnu/bits/getopt_core.h" 3 4
+
+
+
+
+
+
+
+
+extern char *optarg;
+# 50 "/usr/include/x86_64-linux-gnu/bits/getopt_core.h" 3 4
+extern int optind;
+
+
+
+
+extern int opterr;
+
+
+
+extern int optopt;
+# 91 "/usr/include/x86_64-linux-gnu/bits/getopt_core.h" 3 4
+extern int getopt (int ___argc, char *const *___argv, const char *__shortopts)
+       __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+
+
+# 28 "/usr/include/x86_64-linux-gnu/bits/getopt_posix.h" 2 3 4
+
+
+# 49 "/usr/include/x86_64-linux-gnu/bits/getopt_posix.h" 3 4
+
+# 904 "/usr/include/unistd.h" 2 3 4
+
+
+
+
+
+
+
+extern int gethostname (char *__name, size_t __len) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)))
+    __attribute__ ((__access__ (__write_only__, 1, 2)));
+
+
+
+
+
+
+extern int sethostname (const char *__name, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) __attribute__ ((__access__ (__read_only__, 1, 2)));
+
+
+
+extern int sethostid (long int __id) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+extern int getdomainname (char *__name, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)))
+     __attribute__ ((__access__ (__write_only__, 1, 2)));
+extern int setdomainname (const char *__name, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) __attribute__ ((__access__ (__read_only__, 1, 2)));
+
+
+
+
+extern int vhangup (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int revoke (const char *__file) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+
+
+
+extern int profil (unsigned short int *__sample_buffer, size_t __size,
+     size_t __offset, unsigned int __scale)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern int acct (const char *__name) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern char *getusershell (void) __attribute__ ((__nothrow__ , __leaf__));
+extern void endusershell (void) __attribute__ ((__nothrow__ , __leaf__));
+extern void setusershell (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern int daemon (int __nochdir, int __noclose) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+
+extern int chroot (const char *__path) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+extern char *getpass (const char *__prompt) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+extern int fsync (int __fd);
+# 1002 "/usr/include/unistd.h" 3 4
+extern long int gethostid (void);
+
+
+extern void sync (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern int getpagesize (void) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern int getdtablesize (void) __attribute__ ((__nothrow__ , __leaf__));
+# 1026 "/usr/include/unistd.h" 3 4
+extern int truncate (const char *__file, __off_t __length)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 1049 "/usr/include/unistd.h" 3 4
+extern int ftruncate (int __fd, __off_t __length) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 1070 "/usr/include/unistd.h" 3 4
+extern int brk (void *__addr) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+extern void *sbrk (intptr_t __delta) __attribute__ ((__nothrow__ , __leaf__));
+# 1091 "/usr/include/unistd.h" 3 4
+extern long int syscall (long int __sysno, ...) __attribute__ ((__nothrow__ , __leaf__));
+# 1114 "/usr/include/unistd.h" 3 4
+extern int lockf (int __fd, int __cmd, __off_t __len) ;
+# 1150 "/usr/include/unistd.h" 3 4
+extern int fdatasync (int __fildes);
+# 1159 "/usr/include/unistd.h" 3 4
+extern char *crypt (const char *__key, const char *__salt)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+# 1198 "/usr/include/unistd.h" 3 4
+int getentropy (void *__buffer, size_t __length)
+    __attribute__ ((__access__ (__write_only__, 1, 2)));
+# 1218 "/usr/include/unistd.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/unistd_ext.h" 1 3 4
+# 1219 "/usr/include/unistd.h" 2 3 4
+
+
+# 24 "/root/repo/include/debug.h" 2
+# 56 "/root/repo/include/common.h" 2
+# 21 "/root/repo/src/isa/riscv64/include/isa-def.h" 2
+
+
+
+
+
+
+
+
+# 28 "/root/repo/src/isa/riscv64/include/isa-def.h"
+struct ExecutionGuide {
+
+  
+# 30 "/root/repo/src/isa/riscv64/include/isa-def.h" 3 4
+ _Bool 
+# 30 "/root/repo/src/isa/riscv64/include/isa-def.h"
+      force_raise_exception;
+  uint64_t exception_num;
+  uint64_t mtval;
+  uint64_t stval;
+
+  
+# 35 "/root/repo/src/isa/riscv64/include/isa-def.h" 3 4
+ _Bool 
+# 35 "/root/repo/src/isa/riscv64/include/isa-def.h"
+      force_set_jump_target;
+  uint64_t jump_target;
+};
+
+struct DebugInfo {
+  uint64_t current_pc;
+};
+# 58 "/root/repo/src/isa/riscv64/include/isa-def.h"
+typedef struct {
+
+  union {
+    uint64_t _64;
+  } gpr[32];
+
+  union {
+    uint64_t _64;
+  } fpr[32];
+
+
+  uint64_t pc;
+  uint64_t mstatus, mcause, mepc;
+  uint64_t sstatus, scause, sepc;
+
+  uint64_t satp, mip, mie, mscratch, sscratch, mideleg, medeleg;
+  uint64_t mtval, stval, mtvec, stvec;
+  uint64_t mode;
+# 93 "/root/repo/src/isa/riscv64/include/isa-def.h"
+  
+# 93 "/root/repo/src/isa/riscv64/include/isa-def.h" 3 4
+ _Bool 
+# 93 "/root/repo/src/isa/riscv64/include/isa-def.h"
+      amo;
+  int mem_exception;
+
+
+  uint64_t lr_addr;
+  uint64_t lr_valid;
+
+
+
+
+
+  
+# 104 "/root/repo/src/isa/riscv64/include/isa-def.h" 3 4
+ _Bool 
+# 104 "/root/repo/src/isa/riscv64/include/isa-def.h"
+      INTR;
+
+
+  
+# 107 "/root/repo/src/isa/riscv64/include/isa-def.h" 3 4
+ _Bool 
+# 107 "/root/repo/src/isa/riscv64/include/isa-def.h"
+      guided_exec;
+  struct ExecutionGuide execution_guide;
+
+
+  struct DebugInfo debug;
+
+
+
+} riscv64_CPU_state;
+
+
+typedef struct {
+  union {
+    struct {
+      uint32_t opcode1_0 : 2;
+      uint32_t opcode6_2 : 5;
+      uint32_t rd : 5;
+      uint32_t funct3 : 3;
+      uint32_t rs1 : 5;
+      uint32_t rs2 : 5;
+      uint32_t funct7 : 7;
+    } r;
+    struct {
+      uint32_t opcode1_0 : 2;
+      uint32_t opcode6_2 : 5;
+      uint32_t rd : 5;
+      uint32_t funct3 : 3;
+      uint32_t rs1 : 5;
+      int32_t simm11_0 :12;
+    } i;
+    struct {
+      uint32_t opcode1_0 : 2;
+      uint32_t opcode6_2 : 5;
+      uint32_t imm4_0 : 5;
+      uint32_t funct3 : 3;
+      uint32_t rs1 : 5;
+      uint32_t rs2 : 5;
+      int32_t simm11_5 : 7;
+    } s;
+    struct {
+      uint32_t opcode1_0 : 2;
+      uint32_t opcode6_2 : 5;
+      uint32_t imm11 : 1;
+      uint32_t imm4_1 : 4;
+      uint32_t funct3 : 3;
+      uint32_t rs1 : 5;
+      uint32_t rs2 : 5;
+      uint32_t imm10_5 : 6;
+      int32_t simm12 : 1;
+    } b;
+    struct {
+      uint32_t opcode1_0 : 2;
+      uint32_t opcode6_2 : 5;
+      uint32_t rd : 5;
+      int32_t simm31_12 :20;
+    } u;
+    struct {
+      uint32_t opcode1_0 : 2;
+      uint32_t opcode6_2 : 5;
+      uint32_t rd : 5;
+      uint32_t imm19_12 : 8;
+      uint32_t imm11 : 1;
+      uint32_t imm10_1 :10;
+      int32_t simm20 : 1;
+    } j;
+    struct {
+      uint32_t pad7 :20;
+      uint32_t csr :12;
+    } csr;
+    struct {
+      uint32_t opcode1_0 : 2;
+      uint32_t opcode6_2 : 5;
+      uint32_t rd : 5;
+      uint32_t rm : 3;
+      uint32_t rs1 : 5;
+      uint32_t rs2 : 5;
+      uint32_t fmt : 2;
+      uint32_t funct5 : 5;
+    } fp;
+# 238 "/root/repo/src/isa/riscv64/include/isa-def.h"
+    uint32_t val;
+  } instr;
+} riscv64_ISADecodeInfo;
+
+enum { MODE_U = 0, MODE_S, MODE_H, MODE_M };
+
+int get_data_mmu_state();
+# 22 "/root/repo/include/isa.h" 2
+
+
+
+typedef riscv64_CPU_state CPU_state;
+typedef riscv64_ISADecodeInfo ISADecodeInfo;
+
+
+extern char isa_logo[];
+void init_isa();
+
+
+
+
+
+extern CPU_state cpu;
+extern rtlreg_t csr_array[4096];
+void isa_reg_display();
+word_t isa_reg_str2val(const char *name, 
+# 39 "/root/repo/include/isa.h" 3 4
+                                        _Bool 
+# 39 "/root/repo/include/isa.h"
+                                             *success);
+
+
+struct Decode;
+int isa_fetch_decode(struct Decode *s);
+void isa_hostcall(uint32_t id, rtlreg_t *dest, const rtlreg_t *src1,
+    const rtlreg_t *src2, word_t imm);
+
+
+enum { MMU_DIRECT, MMU_TRANSLATE, MMU_DYNAMIC };
+enum { MEM_TYPE_IFETCH, MEM_TYPE_READ, MEM_TYPE_WRITE, MEM_TYPE_IFETCH_READ, MEM_TYPE_WRITE_READ };
+enum { MEM_RET_OK, MEM_RET_FAIL, MEM_RET_CROSS_PAGE };
+
+
+
+
+int isa_mmu_check(vaddr_t vaddr, int len, int type);
+
+paddr_t isa_mmu_translate(vaddr_t vaddr, int len, int type);
+
+# 58 "/root/repo/include/isa.h" 3 4
+_Bool 
+# 58 "/root/repo/include/isa.h"
+    isa_pmp_check_permission(paddr_t addr, int len, int type, int mode);
+
+# 59 "/root/repo/include/isa.h" 3 4
+_Bool 
+# 59 "/root/repo/include/isa.h"
+    isa_spmp_check_permission(paddr_t addr, int len, int type, int mode);
+
+
+vaddr_t raise_intr(word_t NO, vaddr_t epc);
+
+word_t isa_query_intr();
+
+# 65 "/root/repo/include/isa.h" 3 4
+_Bool 
+# 65 "/root/repo/include/isa.h"
+    isa_has_pending_intr();
+
+
+struct CptRegs;
+void isa_restore_cpt_regs(const struct CptRegs *regs);
+
+
+
+
+# 73 "/root/repo/include/isa.h" 3 4
+_Bool 
+# 73 "/root/repo/include/isa.h"
+    isa_difftest_checkregs(CPU_state *ref_r, vaddr_t pc);
+void isa_difftest_attach();
+
+
+void isa_difftest_regcpy(void *dut, 
+# 77 "/root/repo/include/isa.h" 3 4
+                                   _Bool 
+# 77 "/root/repo/include/isa.h"
+                                        direction);
+void isa_difftest_csrcpy(void *dut, 
+# 78 "/root/repo/include/isa.h" 3 4
+                                   _Bool 
+# 78 "/root/repo/include/isa.h"
+                                        direction);
+void isa_difftest_raise_intr(word_t NO);
+void isa_difftest_uarchstatus_cpy(void *dut, 
+# 80 "/root/repo/include/isa.h" 3 4
+                                            _Bool 
+# 80 "/root/repo/include/isa.h"
+                                                 direction);
+void isa_difftest_guided_exec(void *guide);
+void isa_difftest_query_ref(void *result_buffer, uint64_t type);
+# 18 "src/isa/riscv64/difftest/ref.c" 2
+# 1 "/root/repo/include/cpu/cpu.h" 1
+# 21 "/root/repo/include/cpu/cpu.h"
+enum {
+  NEMU_EXEC_RUNNING = 0,
+  NEMU_EXEC_END,
+  NEMU_EXEC_AGAIN,
+  NEMU_EXEC_EXCEPTION,
+  NEMU_EXEC_SERIAL
+};
+
+void cpu_exec(uint64_t n);
+# 41 "/root/repo/include/cpu/cpu.h"
+__attribute__((noreturn)) void longjmp_exec(int cause);
+__attribute__((noreturn)) void longjmp_exception(int ex_cause);
+
+enum {
+  SYS_STATE_UPDATE = 1,
+  SYS_STATE_FLUSH_TCACHE = 2,
+  SYS_STATE_REMAP = 4,
+  SYS_STATE_FENCE_I = 8,
+};
+void set_sys_state_flag(int flag);
+void cpu_wait_for_intr();
+void mmu_tlb_flush(vaddr_t vaddr);
+void mmu_ifetch_remap();
+
+struct Decode;
+void save_globals(struct Decode *s);
+void fetch_decode(struct Decode *s, vaddr_t pc);
+# 19 "src/isa/riscv64/difftest/ref.c" 2
+# 1 "/root/repo/lib-include/difftest.h" 1
+# 22 "/root/repo/lib-include/difftest.h"
+enum { DIFFTEST_TO_DUT, DIFFTEST_TO_REF };
+# 49 "/root/repo/lib-include/difftest.h"
+struct SyncState {
+  uint64_t lrscValid;
+  uint64_t lrscAddr;
+};
+# 20 "src/isa/riscv64/difftest/ref.c" 2
+# 1 "src/isa/riscv64/difftest/../local-include/intr.h" 1
+# 20 "src/isa/riscv64/difftest/../local-include/intr.h"
+# 1 "/root/repo/include/cpu/decode.h" 1
+# 24 "/root/repo/include/cpu/decode.h"
+typedef struct {
+  union {
+    ;
+    ;
+    rtlreg_t *preg;
+    word_t imm;
+    sword_t simm;
+  };
+  ;
+  ;
+  ;
+  ;
+  ;
+  ;
+} Operand;
+
+enum {
+  INSTR_TYPE_N,
+  INSTR_TYPE_J,
+  INSTR_TYPE_B,
+  INSTR_TYPE_I,
+};
+
+
+
+
+
+typedef struct Decode {
+  union {
+    struct {
+      struct Decode *tnext;
+      struct Decode *ntnext;
+    };
+    struct {
+      struct Decode *list_next;
+      struct Decode *bb_src;
+    };
+  };
+  const void *EHelper;
+  ;
+  Operand dest, src1, src2;
+  vaddr_t pc;
+  uint16_t idx_in_bb;
+  uint8_t type;
+  uint32_t epoch;
+
+  vaddr_t snpc;
+  vaddr_t jnpc;
+  uint32_t exec_cnt;
+  uint32_t bbv_id;
+  struct Decode *rnext;
+  ;
+  ISADecodeInfo isa;
+  ;
+# 86 "/root/repo/include/cpu/decode.h"
+} Decode;
+# 122 "/root/repo/include/cpu/decode.h"
+static inline void decode_empty (Decode *s, int width) {}
+
+
+
+
+
+
+__attribute__((always_inline))
+static inline void pattern_decode(const char *str, int len,
+    uint32_t *key, uint32_t *mask, uint32_t *shift) {
+  uint32_t __key = 0, __mask = 0, __shift = 0;
+# 152 "/root/repo/include/cpu/decode.h"
+  if ((0) >= len) goto finish; else { char c = str[0]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail (
+# 152 "/root/repo/include/cpu/decode.h"
+ "c == '0' || c == '1' || c == '?'"
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ , "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((0) + 1) >= len) goto finish; else { char c = str[(0) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((0) + 2) >= len) goto finish; else { char c = str[(0) + 2]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((0) + 2) + 1) >= len) goto finish; else { char c = str[((0) + 2) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((0) + 4) >= len) goto finish; else { char c = str[(0) + 4]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((0) + 4) + 1) >= len) goto finish; else { char c = str[((0) + 4) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((0) + 4) + 2) >= len) goto finish; else { char c = str[((0) + 4) + 2]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((0) + 4) + 2) + 1) >= len) goto finish; else { char c = str[(((0) + 4) + 2) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((0) + 8) >= len) goto finish; else { char c = str[(0) + 8]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((0) + 8) + 1) >= len) goto finish; else { char c = str[((0) + 8) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((0) + 8) + 2) >= len) goto finish; else { char c = str[((0) + 8) + 2]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((0) + 8) + 2) + 1) >= len) goto finish; else { char c = str[(((0) + 8) + 2) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((0) + 8) + 4) >= len) goto finish; else { char c = str[((0) + 8) + 4]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((0) + 8) + 4) + 1) >= len) goto finish; else { char c = str[(((0) + 8) + 4) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((0) + 8) + 4) + 2) >= len) goto finish; else { char c = str[(((0) + 8) + 4) + 2]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((((0) + 8) + 4) + 2) + 1) >= len) goto finish; else { char c = str[((((0) + 8) + 4) + 2) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((0) + 16) >= len) goto finish; else { char c = str[(0) + 16]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((0) + 16) + 1) >= len) goto finish; else { char c = str[((0) + 16) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((0) + 16) + 2) >= len) goto finish; else { char c = str[((0) + 16) + 2]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((0) + 16) + 2) + 1) >= len) goto finish; else { char c = str[(((0) + 16) + 2) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((0) + 16) + 4) >= len) goto finish; else { char c = str[((0) + 16) + 4]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((0) + 16) + 4) + 1) >= len) goto finish; else { char c = str[(((0) + 16) + 4) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((0) + 16) + 4) + 2) >= len) goto finish; else { char c = str[(((0) + 16) + 4) + 2]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((((0) + 16) + 4) + 2) + 1) >= len) goto finish; else { char c = str[((((0) + 16) + 4) + 2) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((0) + 16) + 8) >= len) goto finish; else { char c = str[((0) + 16) + 8]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((0) + 16) + 8) + 1) >= len) goto finish; else { char c = str[(((0) + 16) + 8) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((0) + 16) + 8) + 2) >= len) goto finish; else { char c = str[(((0) + 16) + 8) + 2]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((((0) + 16) + 8) + 2) + 1) >= len) goto finish; else { char c = str[((((0) + 16) + 8) + 2) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((0) + 16) + 8) + 4) >= len) goto finish; else { char c = str[(((0) + 16) + 8) + 4]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((((0) + 16) + 8) + 4) + 1) >= len) goto finish; else { char c = str[((((0) + 16) + 8) + 4) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((((0) + 16) + 8) + 4) + 2) >= len) goto finish; else { char c = str[((((0) + 16) + 8) + 4) + 2]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((((0) + 16) + 8) + 4) + 2) + 1) >= len) goto finish; else { char c = str[(((((0) + 16) + 8) + 4) + 2) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((0) + 32) >= len) goto finish; else { char c = str[(0) + 32]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((0) + 32) + 1) >= len) goto finish; else { char c = str[((0) + 32) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((0) + 32) + 2) >= len) goto finish; else { char c = str[((0) + 32) + 2]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((0) + 32) + 2) + 1) >= len) goto finish; else { char c = str[(((0) + 32) + 2) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((0) + 32) + 4) >= len) goto finish; else { char c = str[((0) + 32) + 4]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((0) + 32) + 4) + 1) >= len) goto finish; else { char c = str[(((0) + 32) + 4) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((0) + 32) + 4) + 2) >= len) goto finish; else { char c = str[(((0) + 32) + 4) + 2]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((((0) + 32) + 4) + 2) + 1) >= len) goto finish; else { char c = str[((((0) + 32) + 4) + 2) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((0) + 32) + 8) >= len) goto finish; else { char c = str[((0) + 32) + 8]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((0) + 32) + 8) + 1) >= len) goto finish; else { char c = str[(((0) + 32) + 8) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((0) + 32) + 8) + 2) >= len) goto finish; else { char c = str[(((0) + 32) + 8) + 2]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((((0) + 32) + 8) + 2) + 1) >= len) goto finish; else { char c = str[((((0) + 32) + 8) + 2) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((0) + 32) + 8) + 4) >= len) goto finish; else { char c = str[(((0) + 32) + 8) + 4]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((((0) + 32) + 8) + 4) + 1) >= len) goto finish; else { char c = str[((((0) + 32) + 8) + 4) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((((0) + 32) + 8) + 4) + 2) >= len) goto finish; else { char c = str[((((0) + 32) + 8) + 4) + 2]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((((0) + 32) + 8) + 4) + 2) + 1) >= len) goto finish; else { char c = str[(((((0) + 32) + 8) + 4) + 2) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((0) + 32) + 16) >= len) goto finish; else { char c = str[((0) + 32) + 16]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((0) + 32) + 16) + 1) >= len) goto finish; else { char c = str[(((0) + 32) + 16) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((0) + 32) + 16) + 2) >= len) goto finish; else { char c = str[(((0) + 32) + 16) + 2]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((((0) + 32) + 16) + 2) + 1) >= len) goto finish; else { char c = str[((((0) + 32) + 16) + 2) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((0) + 32) + 16) + 4) >= len) goto finish; else { char c = str[(((0) + 32) + 16) + 4]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((((0) + 32) + 16) + 4) + 1) >= len) goto finish; else { char c = str[((((0) + 32) + 16) + 4) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((((0) + 32) + 16) + 4) + 2) >= len) goto finish; else { char c = str[((((0) + 32) + 16) + 4) + 2]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((((0) + 32) + 16) + 4) + 2) + 1) >= len) goto finish; else { char c = str[(((((0) + 32) + 16) + 4) + 2) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((0) + 32) + 16) + 8) >= len) goto finish; else { char c = str[(((0) + 32) + 16) + 8]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((((0) + 32) + 16) + 8) + 1) >= len) goto finish; else { char c = str[((((0) + 32) + 16) + 8) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((((0) + 32) + 16) + 8) + 2) >= len) goto finish; else { char c = str[((((0) + 32) + 16) + 8) + 2]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((((0) + 32) + 16) + 8) + 2) + 1) >= len) goto finish; else { char c = str[(((((0) + 32) + 16) + 8) + 2) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((((0) + 32) + 16) + 8) + 4) >= len) goto finish; else { char c = str[((((0) + 32) + 16) + 8) + 4]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((((0) + 32) + 16) + 8) + 4) + 1) >= len) goto finish; else { char c = str[(((((0) + 32) + 16) + 8) + 4) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if (((((((0) + 32) + 16) + 8) + 4) + 2) >= len) goto finish; else { char c = str[(((((0) + 32) + 16) + 8) + 4) + 2]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } }; if ((((((((0) + 32) + 16) + 8) + 4) + 2) + 1) >= len) goto finish; else { char c = str[((((((0) + 32) + 16) + 8) + 4) + 2) + 1]; if (c != ' ') { do { if (!(c == '0' || c == '1' || c == '?')) { fflush(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stdout
+# 152 "/root/repo/include/cpu/decode.h"
+ ); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[1;31m"); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "invalid character '%c' in pattern string", c); fprintf(
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ stderr
+# 152 "/root/repo/include/cpu/decode.h"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ((void) sizeof ((
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 152 "/root/repo/include/cpu/decode.h"
+ c == '0' || c == '1' || c == '?'
+# 152 "/root/repo/include/cpu/decode.h" 3 4
+ ) ; else __assert_fail ("c == '0' || c == '1' || c == '?'", "/root/repo/include/cpu/decode.h", 152, __extension__ __PRETTY_FUNCTION__); }))
+# 152 "/root/repo/include/cpu/decode.h"
+ ; } } while (0); __key = (__key << 1) | (c == '1' ? 1 : 0); __mask = (__mask << 1) | (c == '?' ? 0 : 1); __shift = (c == '?' ? __shift + 1 : 0); } };
+
+finish:
+  *key = __key >> __shift;
+  *mask = __mask >> __shift;
+  *shift = __shift;
+}
+# 21 "src/isa/riscv64/difftest/../local-include/intr.h" 2
+# 1 "src/isa/riscv64/difftest/../local-include/csr.h" 1
+# 111 "src/isa/riscv64/difftest/../local-include/csr.h"
+typedef union { struct {
+  uint64_t uie : 1;
+  uint64_t sie : 1;
+  uint64_t pad0: 1;
+  uint64_t mie : 1;
+  uint64_t upie: 1;
+  uint64_t spie: 1;
+  uint64_t pad1: 1;
+  uint64_t mpie: 1;
+  uint64_t spp : 1;
+  uint64_t vs: 2;
+  uint64_t mpp : 2;
+  uint64_t fs : 2;
+  uint64_t xs : 2;
+  uint64_t mprv: 1;
+  uint64_t sum : 1;
+  uint64_t mxr : 1;
+  uint64_t tvm : 1;
+  uint64_t tw : 1;
+  uint64_t tsr : 1;
+  uint64_t pad3: 9;
+  uint64_t uxl : 2;
+  uint64_t sxl : 2;
+  uint64_t sbe : 1;
+  uint64_t mbe : 1;
+  uint64_t pad4:25;
+  uint64_t sd : 1;
+}; word_t val; } mstatus_t;
+
+typedef union { struct {
+  uint64_t extensions: 26;
+  uint64_t pad : 36;
+  uint64_t mxl : 2;
+}; word_t val; } misa_t;
+
+typedef union { struct {
+}; word_t val; } mtvec_t;
+
+typedef union { struct {
+}; word_t val; } mcounteren_t;
+
+typedef union { struct {
+  uint64_t code:63;
+  uint64_t intr: 1;
+}; word_t val; } mcause_t;
+
+typedef union { struct {
+}; word_t val; } mepc_t;
+
+typedef union { struct {
+}; word_t val; } medeleg_t;
+
+typedef union { struct {
+}; word_t val; } mideleg_t;
+
+typedef union { struct {
+}; word_t val; } mhartid_t;
+
+typedef union { struct {
+}; word_t val; } mscratch_t;
+
+typedef union { struct {
+}; word_t val; } mtval_t;
+
+typedef union { struct {
+  uint64_t usie : 1;
+  uint64_t ssie : 1;
+  uint64_t hsie : 1;
+  uint64_t msie : 1;
+  uint64_t utie : 1;
+  uint64_t stie : 1;
+  uint64_t htie : 1;
+  uint64_t mtie : 1;
+  uint64_t ueie : 1;
+  uint64_t seie : 1;
+  uint64_t heie : 1;
+  uint64_t meie : 1;
+}; word_t val; } mie_t;
+
+typedef union { struct {
+  uint64_t usip : 1;
+  uint64_t ssip : 1;
+  uint64_t hsip : 1;
+  uint64_t msip : 1;
+  uint64_t utip : 1;
+  uint64_t stip : 1;
+  uint64_t htip : 1;
+  uint64_t mtip : 1;
+  uint64_t ueip : 1;
+  uint64_t seip : 1;
+  uint64_t heip : 1;
+  uint64_t meip : 1;
+}; word_t val; } mip_t;
+# 287 "src/isa/riscv64/difftest/../local-include/csr.h"
+typedef union { struct {
+}; word_t val; } pmpcfg0_t;
+
+
+typedef union { struct {
+}; word_t val; } pmpcfg2_t;
+
+typedef union { struct {
+}; word_t val; } pmpaddr0_t;
+
+typedef union { struct {
+}; word_t val; } pmpaddr1_t;
+
+typedef union { struct {
+}; word_t val; } pmpaddr2_t;
+
+typedef union { struct {
+}; word_t val; } pmpaddr3_t;
+
+typedef union { struct {
+}; word_t val; } pmpaddr4_t;
+
+typedef union { struct {
+}; word_t val; } pmpaddr5_t;
+
+typedef union { struct {
+}; word_t val; } pmpaddr6_t;
+
+typedef union { struct {
+}; word_t val; } pmpaddr7_t;
+
+typedef union { struct {
+}; word_t val; } pmpaddr8_t;
+
+typedef union { struct {
+}; word_t val; } pmpaddr9_t;
+
+typedef union { struct {
+}; word_t val; } pmpaddr10_t;
+
+typedef union { struct {
+}; word_t val; } pmpaddr11_t;
+
+typedef union { struct {
+}; word_t val; } pmpaddr12_t;
+
+typedef union { struct {
+}; word_t val; } pmpaddr13_t;
+
+typedef union { struct {
+}; word_t val; } pmpaddr14_t;
+
+typedef union { struct {
+}; word_t val; } pmpaddr15_t;
+
+
+
+
+
+
+typedef union { struct {
+}; word_t val; } spmpcfg0_t;
+
+
+typedef union { struct {
+}; word_t val; } spmpcfg2_t;
+
+typedef union { struct {
+}; word_t val; } spmpaddr0_t;
+
+typedef union { struct {
+}; word_t val; } spmpaddr1_t;
+
+typedef union { struct {
+}; word_t val; } spmpaddr2_t;
+
+typedef union { struct {
+}; word_t val; } spmpaddr3_t;
+
+typedef union { struct {
+}; word_t val; } spmpaddr4_t;
+
+typedef union { struct {
+}; word_t val; } spmpaddr5_t;
+
+typedef union { struct {
+}; word_t val; } spmpaddr6_t;
+
+typedef union { struct {
+}; word_t val; } spmpaddr7_t;
+
+typedef union { struct {
+}; word_t val; } spmpaddr8_t;
+
+typedef union { struct {
+}; word_t val; } spmpaddr9_t;
+
+typedef union { struct {
+}; word_t val; } spmpaddr10_t;
+
+typedef union { struct {
+}; word_t val; } spmpaddr11_t;
+
+typedef union { struct {
+}; word_t val; } spmpaddr12_t;
+
+typedef union { struct {
+}; word_t val; } spmpaddr13_t;
+
+typedef union { struct {
+}; word_t val; } spmpaddr14_t;
+
+typedef union { struct {
+}; word_t val; } spmpaddr15_t;
+
+typedef union { struct {
+  uint64_t uie : 1;
+  uint64_t sie : 1;
+  uint64_t pad0: 2;
+  uint64_t upie: 1;
+  uint64_t spie: 1;
+  uint64_t pad1: 2;
+  uint64_t spp : 1;
+  uint64_t pad2: 4;
+}; word_t val; } sstatus_t;
+
+typedef union { struct {
+}; word_t val; } stvec_t;
+
+typedef union { struct {
+}; word_t val; } scounteren_t;
+
+typedef union { struct {
+  uint64_t usie : 1;
+  uint64_t ssie : 1;
+  uint64_t pad0 : 2;
+  uint64_t utie : 1;
+  uint64_t stie : 1;
+  uint64_t pad1 : 2;
+  uint64_t ueie : 1;
+  uint64_t seie : 1;
+  uint64_t pad2 : 2;
+}; word_t val; } sie_t;
+
+typedef union { struct {
+  uint64_t usip : 1;
+  uint64_t ssip : 1;
+  uint64_t pad0 : 2;
+  uint64_t utip : 1;
+  uint64_t stip : 1;
+  uint64_t pad1 : 2;
+  uint64_t ueip : 1;
+  uint64_t seip : 1;
+  uint64_t pad2 : 2;
+}; word_t val; } sip_t;
+# 455 "src/isa/riscv64/difftest/../local-include/csr.h"
+typedef union { struct {
+  uint64_t ppn :44;
+  uint64_t asid:16;
+  uint64_t mode: 4;
+}; word_t val; } satp_t;
+
+typedef union { struct {
+  uint64_t code:63;
+  uint64_t intr: 1;
+}; word_t val; } scause_t;
+
+typedef union { struct {
+}; word_t val; } sepc_t;
+
+typedef union { struct {
+}; word_t val; } stval_t;
+
+typedef union { struct {
+}; word_t val; } sscratch_t;
+
+
+
+
+
+
+typedef union { struct {
+  uint64_t rnctrl : 1;
+  uint64_t svinval : 1;
+  uint64_t reserve :63;
+}; word_t val; } srnctl_t;
+
+
+typedef union { struct {
+}; word_t val; } fflags_t;
+
+typedef union { struct {
+}; word_t val; } frm_t;
+
+typedef union { struct {
+  union {
+    struct {
+      uint64_t nv: 1;
+      uint64_t dz: 1;
+      uint64_t of: 1;
+      uint64_t uf: 1;
+      uint64_t nx: 1;
+      uint64_t frm : 3;
+    };
+    struct {
+      uint64_t val: 5;
+    } fflags;
+  };
+}; word_t val; } fcsr_t;
+
+typedef union { struct {
+}; word_t val; } mtime_t;
+# 561 "src/isa/riscv64/difftest/../local-include/csr.h"
+typedef union { struct {
+}; word_t val; } mvendorid_t;
+
+typedef union { struct {
+}; word_t val; } marchid_t;
+
+typedef union { struct {
+}; word_t val; } mimpid_t;
+# 577 "src/isa/riscv64/difftest/../local-include/csr.h"
+extern mstatus_t* const mstatus; extern misa_t* const misa; extern medeleg_t* const medeleg; extern mideleg_t* const mideleg; extern mie_t* const mie; extern mtvec_t* const mtvec; extern mcounteren_t* const mcounteren; extern mscratch_t* const mscratch; extern mepc_t* const mepc; extern mcause_t* const mcause; extern mtval_t* const mtval; extern mip_t* const mip; extern pmpcfg0_t* const pmpcfg0; extern pmpcfg2_t* const pmpcfg2; extern pmpaddr0_t* const pmpaddr0; extern pmpaddr1_t* const pmpaddr1; extern pmpaddr2_t* const pmpaddr2; extern pmpaddr3_t* const pmpaddr3; extern pmpaddr4_t* const pmpaddr4; extern pmpaddr5_t* const pmpaddr5; extern pmpaddr6_t* const pmpaddr6; extern pmpaddr7_t* const pmpaddr7; extern pmpaddr8_t* const pmpaddr8; extern pmpaddr9_t* const pmpaddr9; extern pmpaddr10_t* const pmpaddr10; extern pmpaddr11_t* const pmpaddr11; extern pmpaddr12_t* const pmpaddr12; extern pmpaddr13_t* const pmpaddr13; extern pmpaddr14_t* const pmpaddr14; extern pmpaddr15_t* const pmpaddr15; extern spmpcfg0_t* const spmpcfg0; extern spmpcfg2_t* const spmpcfg2; extern spmpaddr0_t* const spmpaddr0; extern spmpaddr1_t* const spmpaddr1; extern spmpaddr2_t* const spmpaddr2; extern spmpaddr3_t* const spmpaddr3; extern spmpaddr4_t* const spmpaddr4; extern spmpaddr5_t* const spmpaddr5; extern spmpaddr6_t* const spmpaddr6; extern spmpaddr7_t* const spmpaddr7; extern spmpaddr8_t* const spmpaddr8; extern spmpaddr9_t* const spmpaddr9; extern spmpaddr10_t* const spmpaddr10; extern spmpaddr11_t* const spmpaddr11; extern spmpaddr12_t* const spmpaddr12; extern spmpaddr13_t* const spmpaddr13; extern spmpaddr14_t* const spmpaddr14; extern spmpaddr15_t* const spmpaddr15; extern mhartid_t* const mhartid; extern sstatus_t* const sstatus; extern sie_t* const sie; extern stvec_t* const stvec; extern scounteren_t* const scounteren; extern sscratch_t* const sscratch; extern sepc_t* const sepc; extern scause_t* const scause; extern stval_t* const stval; extern sip_t* const sip; extern satp_t* const satp; extern srnctl_t* const srnctl; extern fflags_t* const fflags; extern frm_t* const frm; extern fcsr_t* const fcsr; extern mtime_t* const mtime;
+
+
+
+
+  extern mvendorid_t* const mvendorid; extern marchid_t* const marchid; extern mimpid_t* const mimpid;
+
+
+word_t csrid_read(uint32_t csrid);
+void csrid_write(uint32_t csrid, word_t val);
+
+
+uint8_t pmpcfg_from_index(int idx);
+word_t pmpaddr_from_index(int idx);
+word_t pmpaddr_from_csrid(int id);
+word_t pmp_tor_mask();
+
+
+uint8_t spmpcfg_from_index(int idx);
+word_t spmpaddr_from_index(int idx);
+word_t spmpaddr_from_csrid(int id);
+word_t spmp_tor_mask();
+# 22 "src/isa/riscv64/difftest/../local-include/intr.h" 2
+
+enum {
+  EX_IAM,
+  EX_IAF,
+  EX_II,
+  EX_BP,
+  EX_LAM,
+  EX_LAF,
+  EX_SAM,
+  EX_SAF,
+  EX_ECU,
+  EX_ECS,
+  EX_RS0,
+  EX_ECM,
+  EX_IPF,
+  EX_LPF,
+  EX_RS1,
+  EX_SPF,
+
+
+
+
+
+};
+
+
+
+
+
+word_t raise_intr(word_t NO, vaddr_t epc);
+
+
+# 53 "src/isa/riscv64/difftest/../local-include/intr.h" 3 4
+_Bool 
+# 53 "src/isa/riscv64/difftest/../local-include/intr.h"
+    intr_deleg_S(word_t exceptionNO);
+# 21 "src/isa/riscv64/difftest/ref.c" 2
+# 1 "src/isa/riscv64/difftest/../local-include/csr.h" 1
+# 22 "src/isa/riscv64/difftest/ref.c" 2
+
+
+
+
+static void csr_prepare() {
+  cpu.mstatus = mstatus->val;
+  cpu.mcause = mcause->val;
+  cpu.mepc = mepc->val;
+
+  cpu.sstatus = csrid_read(0x100);
+  cpu.scause = scause->val;
+  cpu.sepc = sepc->val;
+
+  cpu.satp = satp->val;
+  cpu.mip = mip->val;
+  cpu.mie = mie->val;
+  cpu.mscratch = mscratch->val;
+  cpu.sscratch = sscratch->val;
+  cpu.mideleg = mideleg->val;
+  cpu.medeleg = medeleg->val;
+  cpu.mtval = mtval->val;
+  cpu.stval = stval->val;
+  cpu.mtvec = mtvec->val;
+  cpu.stvec = stvec->val;
+# 55 "src/isa/riscv64/difftest/ref.c"
+}
+
+static void csr_writeback() {
+  mstatus->val = cpu.mstatus;
+  mcause ->val = cpu.mcause ;
+  mepc ->val = cpu.mepc ;
+
+  scause ->val = cpu.scause ;
+  sepc ->val = cpu.sepc ;
+
+  satp->val = cpu.satp;
+  mip->val = cpu.mip;
+  mie->val = cpu.mie;
+  mscratch->val = cpu.mscratch;
+  sscratch->val = cpu.sscratch;
+  mideleg->val = cpu.mideleg;
+  medeleg->val = cpu.medeleg;
+  mtval->val = cpu.mtval;
+  stval->val = cpu.stval;
+  mtvec->val = cpu.mtvec;
+  stvec->val = cpu.stvec;
+# 85 "src/isa/riscv64/difftest/ref.c"
+}
+
+void isa_difftest_regcpy(void *dut, 
+# 87 "src/isa/riscv64/difftest/ref.c" 3 4
+                                   _Bool 
+# 87 "src/isa/riscv64/difftest/ref.c"
+                                        direction) {
+  if (direction == DIFFTEST_TO_REF) {
+    memcpy(&cpu, dut, (sizeof(uint64_t) * (32 + 32 + 1 + 6 + 11 + 1)));
+    csr_writeback();
+  } else {
+    csr_prepare();
+    memcpy(dut, &cpu, (sizeof(uint64_t) * (32 + 32 + 1 + 6 + 11 + 1)));
+  }
+}
+
+void isa_difftest_csrcpy(void *dut, 
+# 97 "src/isa/riscv64/difftest/ref.c" 3 4
+                                   _Bool 
+# 97 "src/isa/riscv64/difftest/ref.c"
+                                        direction) {
+  if (direction == DIFFTEST_TO_REF) {
+    memcpy(csr_array, dut, 4096 * sizeof(rtlreg_t));
+  } else {
+    memcpy(dut, csr_array, 4096 * sizeof(rtlreg_t));
+  }
+}
+
+void isa_difftest_uarchstatus_cpy(void *dut, 
+# 105 "src/isa/riscv64/difftest/ref.c" 3 4
+                                            _Bool 
+# 105 "src/isa/riscv64/difftest/ref.c"
+                                                 direction) {
+  if (direction == DIFFTEST_TO_REF) {
+    struct SyncState* ms = (struct SyncState*)dut;
+    cpu.lr_valid = ms->lrscValid;
+  } else {
+    struct SyncState ms;
+    ms.lrscValid = cpu.lr_valid;
+    ms.lrscAddr = cpu.lr_addr;
+    memcpy(dut, &ms, sizeof(struct SyncState));
+  }
+}
+
+void isa_difftest_raise_intr(word_t NO) {
+  cpu.pc = raise_intr(NO, cpu.pc);
+}
@@ -0,0 +1,8122 @@
+# 0 "src/monitor/image_loader.c"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "src/monitor/image_loader.c"
+# 16 "src/monitor/image_loader.c"
+# 1 "/root/repo/include/isa.h" 1
+# 21 "/root/repo/include/isa.h"
+# 1 "/root/repo/src/isa/riscv64/include/isa-def.h" 1
+# 20 "/root/repo/src/isa/riscv64/include/isa-def.h"
+# 1 "/root/repo/include/common.h" 1
+# 20 "/root/repo/include/common.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 1 3 4
+# 9 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 3 4
+# 1 "/usr/include/stdint.h" 1 3 4
+# 26 "/usr/include/stdint.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 33 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+# 1 "/usr/include/features.h" 1 3 4
+# 392 "/usr/include/features.h" 3 4
+# 1 "/usr/include/features-time64.h" 1 3 4
+# 20 "/usr/include/features-time64.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 21 "/usr/include/features-time64.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 22 "/usr/include/features-time64.h" 2 3 4
+# 393 "/usr/include/features.h" 2 3 4
+# 489 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 1 3 4
+# 561 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 562 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 563 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 490 "/usr/include/features.h" 2 3 4
+# 513 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h" 1 3 4
+# 11 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 2 3 4
+# 514 "/usr/include/features.h" 2 3 4
+# 34 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 2 3 4
+# 27 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 28 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 29 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+
+# 31 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+typedef unsigned char __u_char;
+typedef unsigned short int __u_short;
+typedef unsigned int __u_int;
+typedef unsigned long int __u_long;
+
+
+typedef signed char __int8_t;
+typedef unsigned char __uint8_t;
+typedef signed short int __int16_t;
+typedef unsigned short int __uint16_t;
+typedef signed int __int32_t;
+typedef unsigned int __uint32_t;
+
+typedef signed long int __int64_t;
+typedef unsigned long int __uint64_t;
+
+
+
+
+
+
+typedef __int8_t __int_least8_t;
+typedef __uint8_t __uint_least8_t;
+typedef __int16_t __int_least16_t;
+typedef __uint16_t __uint_least16_t;
+typedef __int32_t __int_least32_t;
+typedef __uint32_t __uint_least32_t;
+typedef __int64_t __int_least64_t;
+typedef __uint64_t __uint_least64_t;
+
+
+
+typedef long int __quad_t;
+typedef unsigned long int __u_quad_t;
+
+
+
+
+
+
+
+typedef long int __intmax_t;
+typedef unsigned long int __uintmax_t;
+# 141 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 1 3 4
+# 142 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/time64.h" 1 3 4
+# 143 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+typedef unsigned long int __dev_t;
+typedef unsigned int __uid_t;
+typedef unsigned int __gid_t;
+typedef unsigned long int __ino_t;
+typedef unsigned long int __ino64_t;
+typedef unsigned int __mode_t;
+typedef unsigned long int __nlink_t;
+typedef long int __off_t;
+typedef long int __off64_t;
+typedef int __pid_t;
+typedef struct { int __val[2]; } __fsid_t;
+typedef long int __clock_t;
+typedef unsigned long int __rlim_t;
+typedef unsigned long int __rlim64_t;
+typedef unsigned int __id_t;
+typedef long int __time_t;
+typedef unsigned int __useconds_t;
+typedef long int __suseconds_t;
+typedef long int __suseconds64_t;
+
+typedef int __daddr_t;
+typedef int __key_t;
+
+
+typedef int __clockid_t;
+
+
+typedef void * __timer_t;
+
+
+typedef long int __blksize_t;
+
+
+
+
+typedef long int __blkcnt_t;
+typedef long int __blkcnt64_t;
+
+
+typedef unsigned long int __fsblkcnt_t;
+typedef unsigned long int __fsblkcnt64_t;
+
+
+typedef unsigned long int __fsfilcnt_t;
+typedef unsigned long int __fsfilcnt64_t;
+
+
+typedef long int __fsword_t;
+
+typedef long int __ssize_t;
+
+
+typedef long int __syscall_slong_t;
+
+typedef unsigned long int __syscall_ulong_t;
+
+
+
+typedef __off64_t __loff_t;
+typedef char *__caddr_t;
+
+
+typedef long int __intptr_t;
+
+
+typedef unsigned int __socklen_t;
+
+
+
+
+typedef int __sig_atomic_t;
+# 28 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wchar.h" 1 3 4
+# 29 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 30 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 3 4
+typedef __int8_t int8_t;
+typedef __int16_t int16_t;
+typedef __int32_t int32_t;
+typedef __int64_t int64_t;
+# 35 "/usr/include/stdint.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 3 4
+typedef __uint8_t uint8_t;
+typedef __uint16_t uint16_t;
+typedef __uint32_t uint32_t;
+typedef __uint64_t uint64_t;
+# 38 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+
+typedef __int_least8_t int_least8_t;
+typedef __int_least16_t int_least16_t;
+typedef __int_least32_t int_least32_t;
+typedef __int_least64_t int_least64_t;
+
+
+typedef __uint_least8_t uint_least8_t;
+typedef __uint_least16_t uint_least16_t;
+typedef __uint_least32_t uint_least32_t;
+typedef __uint_least64_t uint_least64_t;
+
+
+
+
+
+typedef signed char int_fast8_t;
+
+typedef long int int_fast16_t;
+typedef long int int_fast32_t;
+typedef long int int_fast64_t;
+# 71 "/usr/include/stdint.h" 3 4
+typedef unsigned char uint_fast8_t;
+
+typedef unsigned long int uint_fast16_t;
+typedef unsigned long int uint_fast32_t;
+typedef unsigned long int uint_fast64_t;
+# 87 "/usr/include/stdint.h" 3 4
+typedef long int intptr_t;
+
+
+typedef unsigned long int uintptr_t;
+# 101 "/usr/include/stdint.h" 3 4
+typedef __intmax_t intmax_t;
+typedef __uintmax_t uintmax_t;
+# 10 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 2 3 4
+# 21 "/root/repo/include/common.h" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdbool.h" 1 3 4
+# 22 "/root/repo/include/common.h" 2
+# 1 "/usr/include/assert.h" 1 3 4
+# 66 "/usr/include/assert.h" 3 4
+
+
+
+extern void __assert_fail (const char *__assertion, const char *__file,
+      unsigned int __line, const char *__function)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+extern void __assert_perror_fail (int __errnum, const char *__file,
+      unsigned int __line, const char *__function)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+
+extern void __assert (const char *__assertion, const char *__file, int __line)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+# 23 "/root/repo/include/common.h" 2
+# 1 "/usr/include/string.h" 1 3 4
+# 26 "/usr/include/string.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 27 "/usr/include/string.h" 2 3 4
+
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 214 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long unsigned int size_t;
+# 34 "/usr/include/string.h" 2 3 4
+# 43 "/usr/include/string.h" 3 4
+extern void *memcpy (void *__restrict __dest, const void *__restrict __src,
+       size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void *memmove (void *__dest, const void *__src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+extern void *memccpy (void *__restrict __dest, const void *__restrict __src,
+        int __c, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2))) __attribute__ ((__access__ (__write_only__, 1, 4)));
+
+
+
+
+extern void *memset (void *__s, int __c, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int memcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 80 "/usr/include/string.h" 3 4
+extern int __memcmpeq (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 107 "/usr/include/string.h" 3 4
+extern void *memchr (const void *__s, int __c, size_t __n)
+      __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 141 "/usr/include/string.h" 3 4
+extern char *strcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern char *strcat (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncat (char *__restrict __dest, const char *__restrict __src,
+        size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int strncmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcoll (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern size_t strxfrm (char *__restrict __dest,
+         const char *__restrict __src, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 3 4
+struct __locale_struct
+{
+
+  struct __locale_data *__locales[13];
+
+
+  const unsigned short int *__ctype_b;
+  const int *__ctype_tolower;
+  const int *__ctype_toupper;
+
+
+  const char *__names[13];
+};
+
+typedef struct __locale_struct *__locale_t;
+# 23 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 2 3 4
+
+typedef __locale_t locale_t;
+# 173 "/usr/include/string.h" 2 3 4
+
+
+extern int strcoll_l (const char *__s1, const char *__s2, locale_t __l)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+extern size_t strxfrm_l (char *__dest, const char *__src, size_t __n,
+    locale_t __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4)))
+     __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+
+
+extern char *strdup (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern char *strndup (const char *__string, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+# 246 "/usr/include/string.h" 3 4
+extern char *strchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 273 "/usr/include/string.h" 3 4
+extern char *strrchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 293 "/usr/include/string.h" 3 4
+extern size_t strcspn (const char *__s, const char *__reject)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern size_t strspn (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 323 "/usr/include/string.h" 3 4
+extern char *strpbrk (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 350 "/usr/include/string.h" 3 4
+extern char *strstr (const char *__haystack, const char *__needle)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strtok (char *__restrict __s, const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern char *__strtok_r (char *__restrict __s,
+    const char *__restrict __delim,
+    char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+
+extern char *strtok_r (char *__restrict __s, const char *__restrict __delim,
+         char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+# 407 "/usr/include/string.h" 3 4
+extern size_t strlen (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern size_t strnlen (const char *__string, size_t __maxlen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern char *strerror (int __errnum) __attribute__ ((__nothrow__ , __leaf__));
+# 432 "/usr/include/string.h" 3 4
+extern int strerror_r (int __errnum, char *__buf, size_t __buflen) __asm__ ("" "__xpg_strerror_r") __attribute__ ((__nothrow__ , __leaf__))
+
+                        __attribute__ ((__nonnull__ (2)))
+    __attribute__ ((__access__ (__write_only__, 2, 3)));
+# 458 "/usr/include/string.h" 3 4
+extern char *strerror_l (int __errnum, locale_t __l) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+# 1 "/usr/include/strings.h" 1 3 4
+# 23 "/usr/include/strings.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 24 "/usr/include/strings.h" 2 3 4
+
+
+
+
+
+
+
+
+
+
+extern int bcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bcopy (const void *__src, void *__dest, size_t __n)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 68 "/usr/include/strings.h" 3 4
+extern char *index (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 96 "/usr/include/strings.h" 3 4
+extern char *rindex (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int ffs (int __i) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+
+extern int ffsl (long int __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+__extension__ extern int ffsll (long long int __ll)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern int strcasecmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strncasecmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+
+extern int strcasecmp_l (const char *__s1, const char *__s2, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+
+extern int strncasecmp_l (const char *__s1, const char *__s2,
+     size_t __n, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 4)));
+
+
+
+# 463 "/usr/include/string.h" 2 3 4
+
+
+
+extern void explicit_bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)))
+    __attribute__ ((__access__ (__write_only__, 1, 2)));
+
+
+
+extern char *strsep (char **__restrict __stringp,
+       const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strsignal (int __sig) __attribute__ ((__nothrow__ , __leaf__));
+# 489 "/usr/include/string.h" 3 4
+extern char *__stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern char *__stpncpy (char *__restrict __dest,
+   const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+# 539 "/usr/include/string.h" 3 4
+
+# 24 "/root/repo/include/common.h" 2
+
+# 1 "/root/repo/include/generated/autoconf.h" 1
+# 26 "/root/repo/include/common.h" 2
+# 1 "/root/repo/include/macro.h" 1
+# 27 "/root/repo/include/common.h" 2
+
+
+
+
+
+
+# 32 "/root/repo/include/common.h"
+typedef uint64_t word_t;
+typedef int64_t sword_t;
+
+
+typedef word_t rtlreg_t;
+typedef word_t vaddr_t;
+typedef uint64_t paddr_t;
+
+typedef uint16_t ioaddr_t;
+
+
+
+
+
+
+
+struct DynamicConfig {
+  
+# 49 "/root/repo/include/common.h" 3 4
+ _Bool 
+# 49 "/root/repo/include/common.h"
+      ignore_illegal_mem_access;
+  
+# 50 "/root/repo/include/common.h" 3 4
+ _Bool 
+# 50 "/root/repo/include/common.h"
+      debug_difftest;
+};
+extern struct DynamicConfig dynamic_config;
+void update_dynamic_config(void* config);
+
+# 1 "/root/repo/include/debug.h" 1
+# 20 "/root/repo/include/debug.h"
+# 1 "/usr/include/stdio.h" 1 3 4
+# 27 "/usr/include/stdio.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 28 "/usr/include/stdio.h" 2 3 4
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 34 "/usr/include/stdio.h" 2 3 4
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 1 3 4
+# 40 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+
+# 40 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+typedef __builtin_va_list __gnuc_va_list;
+# 37 "/usr/include/stdio.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h" 1 3 4
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h" 1 3 4
+# 13 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h" 3 4
+typedef struct
+{
+  int __count;
+  union
+  {
+    unsigned int __wch;
+    char __wchb[4];
+  } __value;
+} __mbstate_t;
+# 6 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h" 2 3 4
+
+
+
+
+typedef struct _G_fpos_t
+{
+  __off_t __pos;
+  __mbstate_t __state;
+} __fpos_t;
+# 40 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__fpos64_t.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/bits/types/__fpos64_t.h" 3 4
+typedef struct _G_fpos64_t
+{
+  __off64_t __pos;
+  __mbstate_t __state;
+} __fpos64_t;
+# 41 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__FILE.h" 1 3 4
+
+
+
+struct _IO_FILE;
+typedef struct _IO_FILE __FILE;
+# 42 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h" 1 3 4
+
+
+
+struct _IO_FILE;
+
+
+typedef struct _IO_FILE FILE;
+# 43 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h" 1 3 4
+# 35 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h" 3 4
+struct _IO_FILE;
+struct _IO_marker;
+struct _IO_codecvt;
+struct _IO_wide_data;
+
+
+
+
+typedef void _IO_lock_t;
+
+
+
+
+
+struct _IO_FILE
+{
+  int _flags;
+
+
+  char *_IO_read_ptr;
+  char *_IO_read_end;
+  char *_IO_read_base;
+  char *_IO_write_base;
+  char *_IO_write_ptr;
+  char *_IO_write_end;
+  char *_IO_buf_base;
+  char *_IO_buf_end;
+
+
+  char *_IO_save_base;
+  char *_IO_backup_base;
+  char *_IO_save_end;
+
+  struct _IO_marker *_markers;
+
+  struct _IO_FILE *_chain;
+
+  int _fileno;
+  int _flags2;
+  __off_t _old_offset;
+
+
+  unsigned short _cur_column;
+  signed char _vtable_offset;
+  char _shortbuf[1];
+
+  _IO_lock_t *_lock;
+
+
+
+
+
+
+
+  __off64_t _offset;
+
+  struct _IO_codecvt *_codecvt;
+  struct _IO_wide_data *_wide_data;
+  struct _IO_FILE *_freeres_list;
+  void *_freeres_buf;
+  size_t __pad5;
+  int _mode;
+
+  char _unused2[15 * sizeof (int) - 4 * sizeof (void *) - sizeof (size_t)];
+};
+# 44 "/usr/include/stdio.h" 2 3 4
+# 52 "/usr/include/stdio.h" 3 4
+typedef __gnuc_va_list va_list;
+# 63 "/usr/include/stdio.h" 3 4
+typedef __off_t off_t;
+# 77 "/usr/include/stdio.h" 3 4
+typedef __ssize_t ssize_t;
+
+
+
+
+
+
+typedef __fpos_t fpos_t;
+# 133 "/usr/include/stdio.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdio_lim.h" 1 3 4
+# 134 "/usr/include/stdio.h" 2 3 4
+# 143 "/usr/include/stdio.h" 3 4
+extern FILE *stdin;
+extern FILE *stdout;
+extern FILE *stderr;
+
+
+
+
+
+
+extern int remove (const char *__filename) __attribute__ ((__nothrow__ , __leaf__));
+
+extern int rename (const char *__old, const char *__new) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int renameat (int __oldfd, const char *__old, int __newfd,
+       const char *__new) __attribute__ ((__nothrow__ , __leaf__));
+# 178 "/usr/include/stdio.h" 3 4
+extern int fclose (FILE *__stream);
+# 188 "/usr/include/stdio.h" 3 4
+extern FILE *tmpfile (void)
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+# 205 "/usr/include/stdio.h" 3 4
+extern char *tmpnam (char[20]) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern char *tmpnam_r (char __s[20]) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 222 "/usr/include/stdio.h" 3 4
+extern char *tempnam (const char *__dir, const char *__pfx)
+   __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (__builtin_free, 1)));
+
+
+
+
+
+
+extern int fflush (FILE *__stream);
+# 239 "/usr/include/stdio.h" 3 4
+extern int fflush_unlocked (FILE *__stream);
+# 258 "/usr/include/stdio.h" 3 4
+extern FILE *fopen (const char *__restrict __filename,
+      const char *__restrict __modes)
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+
+
+
+
+extern FILE *freopen (const char *__restrict __filename,
+        const char *__restrict __modes,
+        FILE *__restrict __stream) ;
+# 293 "/usr/include/stdio.h" 3 4
+extern FILE *fdopen (int __fd, const char *__modes) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+# 308 "/usr/include/stdio.h" 3 4
+extern FILE *fmemopen (void *__s, size_t __len, const char *__modes)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+
+
+
+
+extern FILE *open_memstream (char **__bufloc, size_t *__sizeloc) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+# 328 "/usr/include/stdio.h" 3 4
+extern void setbuf (FILE *__restrict __stream, char *__restrict __buf) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int setvbuf (FILE *__restrict __stream, char *__restrict __buf,
+      int __modes, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern void setbuffer (FILE *__restrict __stream, char *__restrict __buf,
+         size_t __size) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern void setlinebuf (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern int fprintf (FILE *__restrict __stream,
+      const char *__restrict __format, ...);
+
+
+
+
+extern int printf (const char *__restrict __format, ...);
+
+extern int sprintf (char *__restrict __s,
+      const char *__restrict __format, ...) __attribute__ ((__nothrow__));
+
+
+
+
+
+extern int vfprintf (FILE *__restrict __s, const char *__restrict __format,
+       __gnuc_va_list __arg);
+
+
+
+
+extern int vprintf (const char *__restrict __format, __gnuc_va_list __arg);
+
+extern int vsprintf (char *__restrict __s, const char *__restrict __format,
+       __gnuc_va_list __arg) __attribute__ ((__nothrow__));
+
+
+
+extern int snprintf (char *__restrict __s, size_t __maxlen,
+       const char *__restrict __format, ...)
+     __attribute__ ((__nothrow__)) __attribute__ ((__format__ (__printf__, 3, 4)));
+
+extern int vsnprintf (char *__restrict __s, size_t __maxlen,
+        const char *__restrict __format, __gnuc_va_list __arg)
+     __attribute__ ((__nothrow__)) __attribute__ ((__format__ (__printf__, 3, 0)));
+# 403 "/usr/include/stdio.h" 3 4
+extern int vdprintf (int __fd, const char *__restrict __fmt,
+       __gnuc_va_list __arg)
+     __attribute__ ((__format__ (__printf__, 2, 0)));
+extern int dprintf (int __fd, const char *__restrict __fmt, ...)
+     __attribute__ ((__format__ (__printf__, 2, 3)));
+
+
+
+
+
+
+
+extern int fscanf (FILE *__restrict __stream,
+     const char *__restrict __format, ...) ;
+
+
+
+
+extern int scanf (const char *__restrict __format, ...) ;
+
+extern int sscanf (const char *__restrict __s,
+     const char *__restrict __format, ...) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 1 3 4
+# 120 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 2 3 4
+# 121 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 2 3 4
+# 431 "/usr/include/stdio.h" 2 3 4
+
+
+
+extern int fscanf (FILE *__restrict __stream, const char *__restrict __format, ...) __asm__ ("" "__isoc99_fscanf")
+
+                               ;
+extern int scanf (const char *__restrict __format, ...) __asm__ ("" "__isoc99_scanf")
+                              ;
+extern int sscanf (const char *__restrict __s, const char *__restrict __format, ...) __asm__ ("" "__isoc99_sscanf") __attribute__ ((__nothrow__ , __leaf__))
+
+                      ;
+# 459 "/usr/include/stdio.h" 3 4
+extern int vfscanf (FILE *__restrict __s, const char *__restrict __format,
+      __gnuc_va_list __arg)
+     __attribute__ ((__format__ (__scanf__, 2, 0))) ;
+
+
+
+
+
+extern int vscanf (const char *__restrict __format, __gnuc_va_list __arg)
+     __attribute__ ((__format__ (__scanf__, 1, 0))) ;
+
+
+extern int vsscanf (const char *__restrict __s,
+      const char *__restrict __format, __gnuc_va_list __arg)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__format__ (__scanf__, 2, 0)));
+
+
+
+
+
+extern int vfscanf (FILE *__restrict __s, const char *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vfscanf")
+
+
+
+     __attribute__ ((__format__ (__scanf__, 2, 0))) ;
+extern int vscanf (const char *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vscanf")
+
+     __attribute__ ((__format__ (__scanf__, 1, 0))) ;
+extern int vsscanf (const char *__restrict __s, const char *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vsscanf") __attribute__ ((__nothrow__ , __leaf__))
+
+
+
+     __attribute__ ((__format__ (__scanf__, 2, 0)));
+# 513 "/usr/include/stdio.h" 3 4
+extern int fgetc (FILE *__stream);
+extern int getc (FILE *__stream);
+
+
+
+
+
+extern int getchar (void);
+
+
+
+
+
+
+extern int getc_unlocked (FILE *__stream);
+extern int getchar_unlocked (void);
+# 538 "/usr/include/stdio.h" 3 4
+extern int fgetc_unlocked (FILE *__stream);
+# 549 "/usr/include/stdio.h" 3 4
+extern int fputc (int __c, FILE *__stream);
+extern int putc (int __c, FILE *__stream);
+
+
+
+
+
+extern int putchar (int __c);
+# 565 "/usr/include/stdio.h" 3 4
+extern int fputc_unlocked (int __c, FILE *__stream);
+
+
+
+
+
+
+
+extern int putc_unlocked (int __c, FILE *__stream);
+extern int putchar_unlocked (int __c);
+
+
+
+
+
+
+extern int getw (FILE *__stream);
+
+
+extern int putw (int __w, FILE *__stream);
+
+
+
+
+
+
+
+extern char *fgets (char *__restrict __s, int __n, FILE *__restrict __stream)
+     __attribute__ ((__access__ (__write_only__, 1, 2)));
+# 632 "/usr/include/stdio.h" 3 4
+extern __ssize_t __getdelim (char **__restrict __lineptr,
+                             size_t *__restrict __n, int __delimiter,
+                             FILE *__restrict __stream) ;
+extern __ssize_t getdelim (char **__restrict __lineptr,
+                           size_t *__restrict __n, int __delimiter,
+                           FILE *__restrict __stream) ;
+
+
+
+
+
+
+
+extern __ssize_t getline (char **__restrict __lineptr,
+                          size_t *__restrict __n,
+                          FILE *__restrict __stream) ;
+
+
+
+
+
+
+
+extern int fputs (const char *__restrict __s, FILE *__restrict __stream);
+
+
+
+
+
+extern int puts (const char *__s);
+
+
+
+
+
+
+extern int ungetc (int __c, FILE *__stream);
+
+
+
+
+
+
+extern size_t fread (void *__restrict __ptr, size_t __size,
+       size_t __n, FILE *__restrict __stream) ;
+
+
+
+
+extern size_t fwrite (const void *__restrict __ptr, size_t __size,
+        size_t __n, FILE *__restrict __s);
+# 702 "/usr/include/stdio.h" 3 4
+extern size_t fread_unlocked (void *__restrict __ptr, size_t __size,
+         size_t __n, FILE *__restrict __stream) ;
+extern size_t fwrite_unlocked (const void *__restrict __ptr, size_t __size,
+          size_t __n, FILE *__restrict __stream);
+
+
+
+
+
+
+
+extern int fseek (FILE *__stream, long int __off, int __whence);
+
+
+
+
+extern long int ftell (FILE *__stream) ;
+
+
+
+
+extern void rewind (FILE *__stream);
+# 736 "/usr/include/stdio.h" 3 4
+extern int fseeko (FILE *__stream, __off_t __off, int __whence);
+
+
+
+
+extern __off_t ftello (FILE *__stream) ;
+# 760 "/usr/include/stdio.h" 3 4
+extern int fgetpos (FILE *__restrict __stream, fpos_t *__restrict __pos);
+
+
+
+
+extern int fsetpos (FILE *__stream, const fpos_t *__pos);
+# 786 "/usr/include/stdio.h" 3 4
+extern void clearerr (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+
+extern int feof (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+extern int ferror (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+extern void clearerr_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+extern int feof_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+extern int ferror_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+
+
+extern void perror (const char *__s);
+
+
+
+
+extern int fileno (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern int fileno_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 823 "/usr/include/stdio.h" 3 4
+extern int pclose (FILE *__stream);
+
+
+
+
+
+extern FILE *popen (const char *__command, const char *__modes)
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (pclose, 1))) ;
+
+
+
+
+
+
+extern char *ctermid (char *__s) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__access__ (__write_only__, 1)));
+# 867 "/usr/include/stdio.h" 3 4
+extern void flockfile (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int ftrylockfile (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern void funlockfile (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+# 885 "/usr/include/stdio.h" 3 4
+extern int __uflow (FILE *);
+extern int __overflow (FILE *, int);
+# 902 "/usr/include/stdio.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdio.h" 1 3 4
+# 38 "/usr/include/x86_64-linux-gnu/bits/stdio.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) int
+vprintf (const char *__restrict __fmt, __gnuc_va_list __arg)
+{
+  return vfprintf (stdout, __fmt, __arg);
+}
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+getchar (void)
+{
+  return getc (stdin);
+}
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+fgetc_unlocked (FILE *__fp)
+{
+  return (__builtin_expect (((__fp)->_IO_read_ptr >= (__fp)->_IO_read_end), 0) ? __uflow (__fp) : *(unsigned char *) (__fp)->_IO_read_ptr++);
+}
+
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+getc_unlocked (FILE *__fp)
+{
+  return (__builtin_expect (((__fp)->_IO_read_ptr >= (__fp)->_IO_read_end), 0) ? __uflow (__fp) : *(unsigned char *) (__fp)->_IO_read_ptr++);
+}
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+getchar_unlocked (void)
+{
+  return (__builtin_expect (((stdin)->_IO_read_ptr >= (stdin)->_IO_read_end), 0) ? __uflow (stdin) : *(unsigned char *) (stdin)->_IO_read_ptr++);
+}
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+putchar (int __c)
+{
+  return putc (__c, stdout);
+}
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+fputc_unlocked (int __c, FILE *__stream)
+{
+  return (__builtin_expect (((__stream)->_IO_write_ptr >= (__stream)->_IO_write_end), 0) ? __overflow (__stream, (unsigned char) (__c)) : (unsigned char) (*(__stream)->_IO_write_ptr++ = (__c)));
+}
+
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+putc_unlocked (int __c, FILE *__stream)
+{
+  return (__builtin_expect (((__stream)->_IO_write_ptr >= (__stream)->_IO_write_end), 0) ? __overflow (__stream, (unsigned char) (__c)) : (unsigned char) (*(__stream)->_IO_write_ptr++ = (__c)));
+}
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+putchar_unlocked (int __c)
+{
+  return (__builtin_expect (((stdout)->_IO_write_ptr >= (stdout)->_IO_write_end), 0) ? __overflow (stdout, (unsigned char) (__c)) : (unsigned char) (*(stdout)->_IO_write_ptr++ = (__c)));
+}
+# 127 "/usr/include/x86_64-linux-gnu/bits/stdio.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) int
+__attribute__ ((__nothrow__ , __leaf__)) feof_unlocked (FILE *__stream)
+{
+  return (((__stream)->_flags & 0x0010) != 0);
+}
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+__attribute__ ((__nothrow__ , __leaf__)) ferror_unlocked (FILE *__stream)
+{
+  return (((__stream)->_flags & 0x0020) != 0);
+}
+# 903 "/usr/include/stdio.h" 2 3 4
+
+
+
+
+
+
+
+# 21 "/root/repo/include/debug.h" 2
+# 1 "/usr/include/assert.h" 1 3 4
+# 22 "/root/repo/include/debug.h" 2
+# 1 "/root/repo/include/utils.h" 1
+# 20 "/root/repo/include/utils.h"
+# 1 "/root/repo/include/common.h" 1
+# 21 "/root/repo/include/utils.h" 2
+
+
+
+
+# 24 "/root/repo/include/utils.h"
+enum { NEMU_RUNNING, NEMU_STOP, NEMU_END, NEMU_ABORT, NEMU_QUIT };
+
+typedef struct {
+  int state;
+  vaddr_t halt_pc;
+  uint32_t halt_ret;
+} NEMUState;
+
+extern NEMUState nemu_state;
+
+enum {
+  dflag_none = 0,
+  dflag_mem,
+  dflag_translate,
+  dflag_trace_bb,
+  dflag_trace_inst,
+  dflag_trace_inst_dasm,
+  dflag_exit,
+};
+
+
+
+
+uint64_t get_time();
+# 68 "/root/repo/include/utils.h"
+extern char log_bytebuf[80];
+extern char log_asmbuf[80];
+
+
+
+word_t expr(char *e, 
+# 73 "/root/repo/include/utils.h" 3 4
+                    _Bool 
+# 73 "/root/repo/include/utils.h"
+                         *success);
+
+
+void iqueue_commit(vaddr_t pc, uint8_t *instr_buf, uint8_t ilen);
+void iqueue_dump();
+
+
+
+
+
+# 82 "/root/repo/include/utils.h" 3 4
+_Bool 
+# 82 "/root/repo/include/utils.h"
+    is_gz_file(const char *filename);
+# 23 "/root/repo/include/debug.h" 2
+# 1 "/usr/include/unistd.h" 1 3 4
+# 27 "/usr/include/unistd.h" 3 4
+
+# 202 "/usr/include/unistd.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/posix_opt.h" 1 3 4
+# 203 "/usr/include/unistd.h" 2 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/environments.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/environments.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/environments.h" 2 3 4
+# 207 "/usr/include/unistd.h" 2 3 4
+# 226 "/usr/include/unistd.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 227 "/usr/include/unistd.h" 2 3 4
+
+
+
+
+
+
+# 232 "/usr/include/unistd.h" 3 4
+typedef __gid_t gid_t;
+
+
+
+
+typedef __uid_t uid_t;
+# 255 "/usr/include/unistd.h" 3 4
+typedef __useconds_t useconds_t;
+
+
+
+
+typedef __pid_t pid_t;
+# 274 "/usr/include/unistd.h" 3 4
+typedef __socklen_t socklen_t;
+# 287 "/usr/include/unistd.h" 3 4
+extern int access (const char *__name, int __type) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 309 "/usr/include/unistd.h" 3 4
+extern int faccessat (int __fd, const char *__file, int __type, int __flag)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) ;
+# 339 "/usr/include/unistd.h" 3 4
+extern __off_t lseek (int __fd, __off_t __offset, int __whence) __attribute__ ((__nothrow__ , __leaf__));
+# 358 "/usr/include/unistd.h" 3 4
+extern int close (int __fd);
+
+
+
+
+extern void closefrom (int __lowfd) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern ssize_t read (int __fd, void *__buf, size_t __nbytes)
+    __attribute__ ((__access__ (__write_only__, 2, 3)));
+
+
+
+
+
+extern ssize_t write (int __fd, const void *__buf, size_t __n)
+    __attribute__ ((__access__ (__read_only__, 2, 3)));
+# 389 "/usr/include/unistd.h" 3 4
+extern ssize_t pread (int __fd, void *__buf, size_t __nbytes,
+        __off_t __offset)
+    __attribute__ ((__access__ (__write_only__, 2, 3)));
+
+
+
+
+
+
+extern ssize_t pwrite (int __fd, const void *__buf, size_t __n,
+         __off_t __offset)
+    __attribute__ ((__access__ (__read_only__, 2, 3)));
+# 437 "/usr/include/unistd.h" 3 4
+extern int pipe (int __pipedes[2]) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 452 "/usr/include/unistd.h" 3 4
+extern unsigned int alarm (unsigned int __seconds) __attribute__ ((__nothrow__ , __leaf__));
+# 464 "/usr/include/unistd.h" 3 4
+extern unsigned int sleep (unsigned int __seconds);
+
+
+
+
+
+
+
+extern __useconds_t ualarm (__useconds_t __value, __useconds_t __interval)
+     __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern int usleep (__useconds_t __useconds);
+# 489 "/usr/include/unistd.h" 3 4
+extern int pause (void);
+
+
+
+extern int chown (const char *__file, __uid_t __owner, __gid_t __group)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+extern int fchown (int __fd, __uid_t __owner, __gid_t __group) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern int lchown (const char *__file, __uid_t __owner, __gid_t __group)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+
+
+extern int fchownat (int __fd, const char *__file, __uid_t __owner,
+       __gid_t __group, int __flag)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) ;
+
+
+
+extern int chdir (const char *__path) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+extern int fchdir (int __fd) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 531 "/usr/include/unistd.h" 3 4
+extern char *getcwd (char *__buf, size_t __size) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 545 "/usr/include/unistd.h" 3 4
+extern char *getwd (char *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) __attribute__ ((__deprecated__))
+    __attribute__ ((__access__ (__write_only__, 1)));
+
+
+
+
+extern int dup (int __fd) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern int dup2 (int __fd, int __fd2) __attribute__ ((__nothrow__ , __leaf__));
+# 564 "/usr/include/unistd.h" 3 4
+extern char **__environ;
+
+
+
+
+
+
+
+extern int execve (const char *__path, char *const __argv[],
+     char *const __envp[]) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern int fexecve (int __fd, char *const __argv[], char *const __envp[])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+
+extern int execv (const char *__path, char *const __argv[])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern int execle (const char *__path, const char *__arg, ...)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern int execl (const char *__path, const char *__arg, ...)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern int execvp (const char *__file, char *const __argv[])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern int execlp (const char *__file, const char *__arg, ...)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+# 619 "/usr/include/unistd.h" 3 4
+extern int nice (int __inc) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern void _exit (int __status) __attribute__ ((__noreturn__));
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/confname.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/confname.h" 3 4
+enum
+  {
+    _PC_LINK_MAX,
+
+    _PC_MAX_CANON,
+
+    _PC_MAX_INPUT,
+
+    _PC_NAME_MAX,
+
+    _PC_PATH_MAX,
+
+    _PC_PIPE_BUF,
+
+    _PC_CHOWN_RESTRICTED,
+
+    _PC_NO_TRUNC,
+
+    _PC_VDISABLE,
+
+    _PC_SYNC_IO,
+
+    _PC_ASYNC_IO,
+
+    _PC_PRIO_IO,
+
+    _PC_SOCK_MAXBUF,
+
+    _PC_FILESIZEBITS,
+
+    _PC_REC_INCR_XFER_SIZE,
+
+    _PC_REC_MAX_XFER_SIZE,
+
+    _PC_REC_MIN_XFER_SIZE,
+
+    _PC_REC_XFER_ALIGN,
+
+    _PC_ALLOC_SIZE_MIN,
+
+    _PC_SYMLINK_MAX,
+
+    _PC_2_SYMLINKS
+
+  };
+
+
+enum
+  {
+    _SC_ARG_MAX,
+
+    _SC_CHILD_MAX,
+
+    _SC_CLK_TCK,
+
+    _SC_NGROUPS_MAX,
+
+    _SC_OPEN_MAX,
+
+    _SC_STREAM_MAX,
+
+    _SC_TZNAME_MAX,
+
+    _SC_JOB_CONTROL,
+
+    _SC_SAVED_IDS,
+
+    _SC_REALTIME_SIGNALS,
+
+    _SC_PRIORITY_SCHEDULING,
+
+    _SC_TIMERS,
+
+    _SC_ASYNCHRONOUS_IO,
+
+    _SC_PRIORITIZED_IO,
+
+    _SC_SYNCHRONIZED_IO,
+
+    _SC_FSYNC,
+
+    _SC_MAPPED_FILES,
+
+    _SC_MEMLOCK,
+
+    _SC_MEMLOCK_RANGE,
+
+    _SC_MEMORY_PROTECTION,
+
+    _SC_MESSAGE_PASSING,
+
+    _SC_SEMAPHORES,
+
+    _SC_SHARED_MEMORY_OBJECTS,
+
+    _SC_AIO_LISTIO_MAX,
+
+    _SC_AIO_MAX,
+
+    _SC_AIO_PRIO_DELTA_MAX,
+
+    _SC_DELAYTIMER_MAX,
+
+    _SC_MQ_OPEN_MAX,
+
+    _SC_MQ_PRIO_MAX,
+
+    _SC_VERSION,
+
+    _SC_PAGESIZE,
+
+
+    _SC_RTSIG_MAX,
+
+    _SC_SEM_NSEMS_MAX,
+
+    _SC_SEM_VALUE_MAX,
+
+    _SC_SIGQUEUE_MAX,
+
+    _SC_TIMER_MAX,
+
+
+
+
+    _SC_BC_BASE_MAX,
+
+    _SC_BC_DIM_MAX,
+
+    _SC_BC_SCALE_MAX,
+
+    _SC_BC_STRING_MAX,
+
+    _SC_COLL_WEIGHTS_MAX,
+
+    _SC_EQUIV_CLASS_MAX,
+
+    _SC_EXPR_NEST_MAX,
+
+    _SC_LINE_MAX,
+
+    _SC_RE_DUP_MAX,
+
+    _SC_CHARCLASS_NAME_MAX,
+
+
+    _SC_2_VERSION,
+
+    _SC_2_C_BIND,
+
+    _SC_2_C_DEV,
+
+    _SC_2_FORT_DEV,
+
+    _SC_2_FORT_RUN,
+
+    _SC_2_SW_DEV,
+
+    _SC_2_LOCALEDEF,
+
+
+    _SC_PII,
+
+    _SC_PII_XTI,
+
+    _SC_PII_SOCKET,
+
+    _SC_PII_INTERNET,
+
+    _SC_PII_OSI,
+
+    _SC_POLL,
+
+    _SC_SELECT,
+
+    _SC_UIO_MAXIOV,
+
+    _SC_IOV_MAX = _SC_UIO_MAXIOV,
+
+    _SC_PII_INTERNET_STREAM,
+
+    _SC_PII_INTERNET_DGRAM,
+
+    _SC_PII_OSI_COTS,
+
+    _SC_PII_OSI_CLTS,
+
+    _SC_PII_OSI_M,
+
+    _SC_T_IOV_MAX,
+
+
+
+    _SC_THREADS,
+
+    _SC_THREAD_SAFE_FUNCTIONS,
+
+    _SC_GETGR_R_SIZE_MAX,
+
+    _SC_GETPW_R_SIZE_MAX,
+
+    _SC_LOGIN_NAME_MAX,
+
+    _SC_TTY_NAME_MAX,
+
+    _SC_THREAD_DESTRUCTOR_ITERATIONS,
+
+    _SC_THREAD_KEYS_MAX,
+
+    _SC_THREAD_STACK_MIN,
+
+    _SC_THREAD_THREADS_MAX,
+
+    _SC_THREAD_ATTR_STACKADDR,
+
+    _SC_THREAD_ATTR_STACKSIZE,
+
+    _SC_THREAD_PRIORITY_SCHEDULING,
+
+    _SC_THREAD_PRIO_INHERIT,
+
+    _SC_THREAD_PRIO_PROTECT,
+
+    _SC_THREAD_PROCESS_SHARED,
+
+
+    _SC_NPROCESSORS_CONF,
+
+    _SC_NPROCESSORS_ONLN,
+
+    _SC_PHYS_PAGES,
+
+    _SC_AVPHYS_PAGES,
+
+    _SC_ATEXIT_MAX,
+
+    _SC_PASS_MAX,
+
+
+    _SC_XOPEN_VERSION,
+
+    _SC_XOPEN_XCU_VERSION,
+
+    _SC_XOPEN_UNIX,
+
+    _SC_XOPEN_CRYPT,
+
+    _SC_XOPEN_ENH_I18N,
+
+    _SC_XOPEN_SHM,
+
+
+    _SC_2_CHAR_TERM,
+
+    _SC_2_C_VERSION,
+
+    _SC_2_UPE,
+
+
+    _SC_XOPEN_XPG2,
+
+    _SC_XOPEN_XPG3,
+
+    _SC_XOPEN_XPG4,
+
+
+    _SC_CHAR_BIT,
+
+    _SC_CHAR_MAX,
+
+    _SC_CHAR_MIN,
+
+    _SC_INT_MAX,
+
+    _SC_INT_MIN,
+
+    _SC_LONG_BIT,
+
+    _SC_WORD_BIT,
+
+    _SC_MB_LEN_MAX,
+
+    _SC_NZERO,
+
+    _SC_SSIZE_MAX,
+
+    _SC_SCHAR_MAX,
+
+    _SC_SCHAR_MIN,
+
+    _SC_SHRT_MAX,
+
+    _SC_SHRT_MIN,
+
+    _SC_UCHAR_MAX,
+
+    _SC_UINT_MAX,
+
+    _SC_ULONG_MAX,
+
+    _SC_USHRT_MAX,
+
+
+    _SC_NL_ARGMAX,
+
+    _SC_NL_LANGMAX,
+
+    _SC_NL_MSGMAX,
+
+    _SC_NL_NMAX,
+
+    _SC_NL_SETMAX,
+
+    _SC_NL_TEXTMAX,
+
+
+    _SC_XBS5_ILP32_OFF32,
+
+    _SC_XBS5_ILP32_OFFBIG,
+
+    _SC_XBS5_LP64_OFF64,
+
+    _SC_XBS5_LPBIG_OFFBIG,
+
+
+    _SC_XOPEN_LEGACY,
+
+    _SC_XOPEN_REALTIME,
+
+    _SC_XOPEN_REALTIME_THREADS,
+
+
+    _SC_ADVISORY_INFO,
+
+    _SC_BARRIERS,
+
+    _SC_BASE,
+
+    _SC_C_LANG_SUPPORT,
+
+    _SC_C_LANG_SUPPORT_R,
+
+    _SC_CLOCK_SELECTION,
+
+    _SC_CPUTIME,
+
+    _SC_THREAD_CPUTIME,
+
+    _SC_DEVICE_IO,
+
+    _SC_DEVICE_SPECIFIC,
+
+    _SC_DEVICE_SPECIFIC_R,
+
+    _SC_FD_MGMT,
+
+    _SC_FIFO,
+
+    _SC_PIPE,
+
+    _SC_FILE_ATTRIBUTES,
+
+    _SC_FILE_LOCKING,
+
+    _SC_FILE_SYSTEM,
+
+    _SC_MONOTONIC_CLOCK,
+
+    _SC_MULTI_PROCESS,
+
+    _SC_SINGLE_PROCESS,
+
+    _SC_NETWORKING,
+
+    _SC_READER_WRITER_LOCKS,
+
+    _SC_SPIN_LOCKS,
+
+    _SC_REGEXP,
+
+    _SC_REGEX_VERSION,
+
+    _SC_SHELL,
+
+    _SC_SIGNALS,
+
+    _SC_SPAWN,
+
+    _SC_SPORADIC_SERVER,
+
+    _SC_THREAD_SPORADIC_SERVER,
+
+    _SC_SYSTEM_DATABASE,
+
+    _SC_SYSTEM_DATABASE_R,
+
+    _SC_TIMEOUTS,
+
+    _SC_TYPED_MEMORY_OBJECTS,
+
+    _SC_USER_GROUPS,
+
+    _SC_USER_GROUPS_R,
+
+    _SC_2_PBS,
+
+    _SC_2_PBS_ACCOUNTING,
+
+    _SC_2_PBS_LOCATE,
+
+    _SC_2_PBS_MESSAGE,
+
+    _SC_2_PBS_TRACK,
+
+    _SC_SYMLOOP_MAX,
+
+    _SC_STREAMS,
+
+    _SC_2_PBS_CHECKPOINT,
+
+
+    _SC_V6_ILP32_OFF32,
+
+    _SC_V6_ILP32_OFFBIG,
+
+    _SC_V6_LP64_OFF64,
+
+    _SC_V6_LPBIG_OFFBIG,
+
+
+    _SC_HOST_NAME_MAX,
+
+    _SC_TRACE,
+
+    _SC_TRACE_EVENT_FILTER,
+
+    _SC_TRACE_INHERIT,
+
+    _SC_TRACE_LOG,
+
+
+    _SC_LEVEL1_ICACHE_SIZE,
+
+    _SC_LEVEL1_ICACHE_ASSOC,
+
+    _SC_LEVEL1_ICACHE_LINESIZE,
+
+    _SC_LEVEL1_DCACHE_SIZE,
+
+    _SC_LEVEL1_DCACHE_ASSOC,
+
+    _SC_LEVEL1_DCACHE_LINESIZE,
+
+    _SC_LEVEL2_CACHE_SIZE,
+
+    _SC_LEVEL2_CACHE_ASSOC,
+
+    _SC_LEVEL2_CACHE_LINESIZE,
+
+    _SC_LEVEL3_CACHE_SIZE,
+
+    _SC_LEVEL3_CACHE_ASSOC,
+
+    _SC_LEVEL3_CACHE_LINESIZE,
+
+    _SC_LEVEL4_CACHE_SIZE,
+
+    _SC_LEVEL4_CACHE_ASSOC,
+
+    _SC_LEVEL4_CACHE_LINESIZE,
+
+
+
+    _SC_IPV6 = _SC_LEVEL1_ICACHE_SIZE + 50,
+
+    _SC_RAW_SOCKETS,
+
+
+    _SC_V7_ILP32_OFF32,
+
+    _SC_V7_ILP32_OFFBIG,
+
+    _SC_V7_LP64_OFF64,
+
+    _SC_V7_LPBIG_OFFBIG,
+
+
+    _SC_SS_REPL_MAX,
+
+
+    _SC_TRACE_EVENT_NAME_MAX,
+
+    _SC_TRACE_NAME_MAX,
+
+    _SC_TRACE_SYS_MAX,
+
+    _SC_TRACE_USER_EVENT_MAX,
+
+
+    _SC_XOPEN_STREAMS,
+
+
+    _SC_THREAD_ROBUST_PRIO_INHERIT,
+
+    _SC_THREAD_ROBUST_PRIO_PROTECT,
+
+
+    _SC_MINSIGSTKSZ,
+
+
+    _SC_SIGSTKSZ
+
+  };
+
+
+enum
+  {
+    _CS_PATH,
+
+
+    _CS_V6_WIDTH_RESTRICTED_ENVS,
+
+
+
+    _CS_GNU_LIBC_VERSION,
+
+    _CS_GNU_LIBPTHREAD_VERSION,
+
+
+    _CS_V5_WIDTH_RESTRICTED_ENVS,
+
+
+
+    _CS_V7_WIDTH_RESTRICTED_ENVS,
+
+
+
+    _CS_LFS_CFLAGS = 1000,
+
+    _CS_LFS_LDFLAGS,
+
+    _CS_LFS_LIBS,
+
+    _CS_LFS_LINTFLAGS,
+
+    _CS_LFS64_CFLAGS,
+
+    _CS_LFS64_LDFLAGS,
+
+    _CS_LFS64_LIBS,
+
+    _CS_LFS64_LINTFLAGS,
+
+
+    _CS_XBS5_ILP32_OFF32_CFLAGS = 1100,
+
+    _CS_XBS5_ILP32_OFF32_LDFLAGS,
+
+    _CS_XBS5_ILP32_OFF32_LIBS,
+
+    _CS_XBS5_ILP32_OFF32_LINTFLAGS,
+
+    _CS_XBS5_ILP32_OFFBIG_CFLAGS,
+
+    _CS_XBS5_ILP32_OFFBIG_LDFLAGS,
+
+    _CS_XBS5_ILP32_OFFBIG_LIBS,
+
+    _CS_XBS5_ILP32_OFFBIG_LINTFLAGS,
+
+    _CS_XBS5_LP64_OFF64_CFLAGS,
+
+    _CS_XBS5_LP64_OFF64_LDFLAGS,
+
+    _CS_XBS5_LP64_OFF64_LIBS,
+
+    _CS_XBS5_LP64_OFF64_LINTFLAGS,
+
+    _CS_XBS5_LPBIG_OFFBIG_CFLAGS,
+
+    _CS_XBS5_LPBIG_OFFBIG_LDFLAGS,
+
+    _CS_XBS5_LPBIG_OFFBIG_LIBS,
+
+    _CS_XBS5_LPBIG_OFFBIG_LINTFLAGS,
+
+
+    _CS_POSIX_V6_ILP32_OFF32_CFLAGS,
+
+    _CS_POSIX_V6_ILP32_OFF32_LDFLAGS,
+
+    _CS_POSIX_V6_ILP32_OFF32_LIBS,
+
+    _CS_POSIX_V6_ILP32_OFF32_LINTFLAGS,
+
+    _CS_POSIX_V6_ILP32_OFFBIG_CFLAGS,
+
+    _CS_POSIX_V6_ILP32_OFFBIG_LDFLAGS,
+
+    _CS_POSIX_V6_ILP32_OFFBIG_LIBS,
+
+    _CS_POSIX_V6_ILP32_OFFBIG_LINTFLAGS,
+
+    _CS_POSIX_V6_LP64_OFF64_CFLAGS,
+
+    _CS_POSIX_V6_LP64_OFF64_LDFLAGS,
+
+    _CS_POSIX_V6_LP64_OFF64_LIBS,
+
+    _CS_POSIX_V6_LP64_OFF64_LINTFLAGS,
+
+    _CS_POSIX_V6_LPBIG_OFFBIG_CFLAGS,
+
+    _CS_POSIX_V6_LPBIG_OFFBIG_LDFLAGS,
+
+    _CS_POSIX_V6_LPBIG_OFFBIG_LIBS,
+
+    _CS_POSIX_V6_LPBIG_OFFBIG_LINTFLAGS,
+
+
+    _CS_POSIX_V7_ILP32_OFF32_CFLAGS,
+
+    _CS_POSIX_V7_ILP32_OFF32_LDFLAGS,
+
+    _CS_POSIX_V7_ILP32_OFF32_LIBS,
+
+    _CS_POSIX_V7_ILP32_OFF32_LINTFLAGS,
+
+    _CS_POSIX_V7_ILP32_OFFBIG_CFLAGS,
+
+    _CS_POSIX_V7_ILP32_OFFBIG_LDFLAGS,
+
+    _CS_POSIX_V7_ILP32_OFFBIG_LIBS,
+
+    _CS_POSIX_V7_ILP32_OFFBIG_LINTFLAGS,
+
+    _CS_POSIX_V7_LP64_OFF64_CFLAGS,
+
+    _CS_POSIX_V7_LP64_OFF64_LDFLAGS,
+
+    _CS_POSIX_V7_LP64_OFF64_LIBS,
+
+    _CS_POSIX_V7_LP64_OFF64_LINTFLAGS,
+
+    _CS_POSIX_V7_LPBIG_OFFBIG_CFLAGS,
+
+    _CS_POSIX_V7_LPBIG_OFFBIG_LDFLAGS,
+
+    _CS_POSIX_V7_LPBIG_OFFBIG_LIBS,
+
+    _CS_POSIX_V7_LPBIG_OFFBIG_LINTFLAGS,
+
+
+    _CS_V6_ENV,
+
+    _CS_V7_ENV
+
+  };
+# 631 "/usr/include/unistd.h" 2 3 4
+
+
+extern long int pathconf (const char *__path, int __name)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern long int fpathconf (int __fd, int __name) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern long int sysconf (int __name) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern size_t confstr (int __name, char *__buf, size_t __len) __attribute__ ((__nothrow__ , __leaf__))
+    __attribute__ ((__access__ (__write_only__, 2, 3)));
+
+
+
+
+extern __pid_t getpid (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern __pid_t getppid (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern __pid_t getpgrp (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern __pid_t __getpgid (__pid_t __pid) __attribute__ ((__nothrow__ , __leaf__));
+
+extern __pid_t getpgid (__pid_t __pid) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern int setpgid (__pid_t __pid, __pid_t __pgid) __attribute__ ((__nothrow__ , __leaf__));
+# 682 "/usr/include/unistd.h" 3 4
+extern int setpgrp (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern __pid_t setsid (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern __pid_t getsid (__pid_t __pid) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern __uid_t getuid (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern __uid_t geteuid (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern __gid_t getgid (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern __gid_t getegid (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern int getgroups (int __size, __gid_t __list[]) __attribute__ ((__nothrow__ , __leaf__))
+    __attribute__ ((__access__ (__write_only__, 2, 1)));
+# 722 "/usr/include/unistd.h" 3 4
+extern int setuid (__uid_t __uid) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern int setreuid (__uid_t __ruid, __uid_t __euid) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern int seteuid (__uid_t __uid) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+
+extern int setgid (__gid_t __gid) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern int setregid (__gid_t __rgid, __gid_t __egid) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern int setegid (__gid_t __gid) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 778 "/usr/include/unistd.h" 3 4
+extern __pid_t fork (void) __attribute__ ((__nothrow__));
+
+
+
+
+
+
+
+extern __pid_t vfork (void) __attribute__ ((__nothrow__ , __leaf__));
+# 799 "/usr/include/unistd.h" 3 4
+extern char *ttyname (int __fd) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int ttyname_r (int __fd, char *__buf, size_t __buflen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)))
+     __attribute__ ((__access__ (__write_only__, 2, 3)));
+
+
+
+extern int isatty (int __fd) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern int ttyslot (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern int link (const char *__from, const char *__to)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2))) ;
+
+
+
+
+extern int linkat (int __fromfd, const char *__from, int __tofd,
+     const char *__to, int __flags)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4))) ;
+
+
+
+
+extern int symlink (const char *__from, const char *__to)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2))) ;
+
+
+
+
+extern ssize_t readlink (const char *__restrict __path,
+    char *__restrict __buf, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)))
+     __attribute__ ((__access__ (__write_only__, 2, 3)));
+
+
+
+
+
+extern int symlinkat (const char *__from, int __tofd,
+        const char *__to) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 3))) ;
+
+
+extern ssize_t readlinkat (int __fd, const char *__restrict __path,
+      char *__restrict __buf, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)))
+     __attribute__ ((__access__ (__write_only__, 3, 4)));
+
+
+
+extern int unlink (const char *__name) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int unlinkat (int __fd, const char *__name, int __flag)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern int rmdir (const char *__path) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern __pid_t tcgetpgrp (int __fd) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int tcsetpgrp (int __fd, __pid_t __pgrp_id) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern char *getlogin (void);
+
+
+
+
+
+
+
+extern int getlogin_r (char *__name, size_t __name_len) __attribute__ ((__nonnull__ (1)))
+    __attribute__ ((__access__ (__write_only__, 1, 2)));
+
+
+
+
+extern int setlogin (const char *__name) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/getopt_posix.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/getopt_posix.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/getopt_core.h" 1 3 4
+# 28 "/usr/include/x86_64-linux-gnu/bits/getopt_core.h" 3 4
+
+
+
+
+
+
+
+
+extern char *optarg;
+# 50 "/usr/include/x86_64-linux-gnu/bits/getopt_core.h" 3 4
+extern int optind;
+
+
+
+
+extern int opterr;
+
+
+
+extern int optopt;
+# 91 "/usr/include/x86_64-linux-gnu/bits/getopt_core.h" 3 4
+extern int getopt (int ___argc, char *const *___argv, const char *__shortopts)
+       __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+
+
+# 28 "/usr/include/x86_64-linux-gnu/bits/getopt_posix.h" 2 3 4
+
+
+# 49 "/usr/include/x86_64-linux-gnu/bits/getopt_posix.h" 3 4
+
+# 904 "/usr/include/unistd.h" 2 3 4
+
+
+
+
+
+
+
+extern int gethostname (char *__name, size_t __len) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)))
+    __attribute__ ((__access__ (__write_only__, 1, 2)));
+
+
+
+
+
+
+extern int sethostname (const char *__name, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) __attribute__ ((__access__ (__read_only__, 1, 2)));
+
+
+
+extern int sethostid (long int __id) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+extern int getdomainname (char *__name, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)))
+     __attribute__ ((__access__ (__write_only__, 1, 2)));
+extern int setdomainname (const char *__name, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) __attribute__ ((__access__ (__read_only__, 1, 2)));
+
+
+
+
+extern int vhangup (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int revoke (const char *__file) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+
+
+
+extern int profil (unsigned short int *__sample_buffer, size_t __size,
+     size_t __offset, unsigned int __scale)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern int acct (const char *__name) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern char *getusershell (void) __attribute__ ((__nothrow__ , __leaf__));
+extern void endusershell (void) __attribute__ ((__nothrow__ , __leaf__));
+extern void setusershell (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern int daemon (int __nochdir, int __noclose) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+
+extern int chroot (const char *__path) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+extern char *getpass (const char *__prompt) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+extern int fsync (int __fd);
+# 1002 "/usr/include/unistd.h" 3 4
+extern long int gethostid (void);
+
+
+extern void sync (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern int getpagesize (void) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern int getdtablesize (void) __attribute__ ((__nothrow__ , __leaf__));
+# 1026 "/usr/include/unistd.h" 3 4
+extern int truncate (const char *__file, __off_t __length)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 1049 "/usr/include/unistd.h" 3 4
+extern int ftruncate (int __fd, __off_t __length) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 1070 "/usr/include/unistd.h" 3 4
+extern int brk (void *__addr) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+extern void *sbrk (intptr_t __delta) __attribute__ ((__nothrow__ , __leaf__));
+# 1091 "/usr/include/unistd.h" 3 4
+extern long int syscall (long int __sysno, ...) __attribute__ ((__nothrow__ , __leaf__));
+# 1114 "/usr/include/unistd.h" 3 4
+extern int lockf (int __fd, int __cmd, __off_t __len) ;
+# 1150 "/usr/include/unistd.h" 3 4
+extern int fdatasync (int __fildes);
+# 1159 "/usr/include/unistd.h" 3 4
+extern char *crypt (const char *__key, const char *__salt)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+# 1198 "/usr/include/unistd.h" 3 4
+int getentropy (void *__buffer, size_t __length)
+    __attribute__ ((__access__ (__write_only__, 1, 2)));
+# 1218 "/usr/include/unistd.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/unistd_ext.h" 1 3 4
+# 1219 "/usr/include/unistd.h" 2 3 4
+
+
+# 24 "/root/repo/include/debug.h" 2
+# 56 "/root/repo/include/common.h" 2
+# 21 "/root/repo/src/isa/riscv64/include/isa-def.h" 2
+
+
+
+
+
+
+
+
+# 28 "/root/repo/src/isa/riscv64/include/isa-def.h"
+struct ExecutionGuide {
+
+  
+# 30 "/root/repo/src/isa/riscv64/include/isa-def.h" 3 4
+ _Bool 
+# 30 "/root/repo/src/isa/riscv64/include/isa-def.h"
+      force_raise_exception;
+  uint64_t exception_num;
+  uint64_t mtval;
+  uint64_t stval;
+
+  
+# 35 "/root/repo/src/isa/riscv64/include/isa-def.h" 3 4
+ _Bool 
+# 35 "/root/repo/src/isa/riscv64/include/isa-def.h"
+      force_set_jump_target;
+  uint64_t jump_target;
+};
+
+struct DebugInfo {
+  uint64_t current_pc;
+};
+# 58 "/root/repo/src/isa/riscv64/include/isa-def.h"
+typedef struct {
+
+  union {
+    uint64_t _64;
+  } gpr[32];
+
+  union {
+    uint64_t _64;
+  } fpr[32];
+
+
+  uint64_t pc;
+  uint64_t mstatus, mcause, mepc;
+  uint64_t sstatus, scause, sepc;
+
+  uint64_t satp, mip, mie, mscratch, sscratch, mideleg, medeleg;
+  uint64_t mtval, stval, mtvec, stvec;
+  uint64_t mode;
+# 93 "/root/repo/src/isa/riscv64/include/isa-def.h"
+  
+# 93 "/root/repo/src/isa/riscv64/include/isa-def.h" 3 4
+ _Bool 
+# 93 "/root/repo/src/isa/riscv64/include/isa-def.h"
+      amo;
+  int mem_exception;
+
+
+  uint64_t lr_addr;
+  uint64_t lr_valid;
+
+
+
+
+
+  
+# 104 "/root/repo/src/isa/riscv64/include/isa-def.h" 3 4
+ _Bool 
+# 104 "/root/repo/src/isa/riscv64/include/isa-def.h"
+      INTR;
+
+
+  
+# 107 "/root/repo/src/isa/riscv64/include/isa-def.h" 3 4
+ _Bool 
+# 107 "/root/repo/src/isa/riscv64/include/isa-def.h"
+      guided_exec;
+  struct ExecutionGuide execution_guide;
+
+
+  struct DebugInfo debug;
+
+
+
+} riscv64_CPU_state;
+
+
+typedef struct {
+  union {
+    struct {
+      uint32_t opcode1_0 : 2;
+      uint32_t opcode6_2 : 5;
+      uint32_t rd : 5;
+      uint32_t funct3 : 3;
+      uint32_t rs1 : 5;
+      uint32_t rs2 : 5;
+      uint32_t funct7 : 7;
+    } r;
+    struct {
+      uint32_t opcode1_0 : 2;
+      uint32_t opcode6_2 : 5;
+      uint32_t rd : 5;
+      uint32_t funct3 : 3;
+      uint32_t rs1 : 5;
+      int32_t simm11_0 :12;
+    } i;
+    struct {
+      uint32_t opcode1_0 : 2;
+      uint32_t opcode6_2 : 5;
+      uint32_t imm4_0 : 5;
+      uint32_t funct3 : 3;
+      uint32_t rs1 : 5;
+      uint32_t rs2 : 5;
+      int32_t simm11_5 : 7;
+    } s;
+    struct {
+      uint32_t opcode1_0 : 2;
+      uint32_t opcode6_2 : 5;
+      uint32_t imm11 : 1;
+      uint32_t imm4_1 : 4;
+      uint32_t funct3 : 3;
+      uint32_t rs1 : 5;
+      uint32_t rs2 : 5;
+      uint32_t imm10_5 : 6;
+      int32_t simm12 : 1;
+    } b;
+    struct {
+      uint32_t opcode1_0 : 2;
+      uint32_t opcode6_2 : 5;
+      uint32_t rd : 5;
+      int32_t simm31_12 :20;
+    } u;
+    struct {
+      uint32_t opcode1_0 : 2;
+      uint32_t opcode6_2 : 5;
+      uint32_t rd : 5;
+      uint32_t imm19_12 : 8;
+      uint32_t imm11 : 1;
+      uint32_t imm10_1 :10;
+      int32_t simm20 : 1;
+    } j;
+    struct {
+      uint32_t pad7 :20;
+      uint32_t csr :12;
+    } csr;
+    struct {
+      uint32_t opcode1_0 : 2;
+      uint32_t opcode6_2 : 5;
+      uint32_t rd : 5;
+      uint32_t rm : 3;
+      uint32_t rs1 : 5;
+      uint32_t rs2 : 5;
+      uint32_t fmt : 2;
+      uint32_t funct5 : 5;
+    } fp;
+# 238 "/root/repo/src/isa/riscv64/include/isa-def.h"
+    uint32_t val;
+  } instr;
+} riscv64_ISADecodeInfo;
+
+enum { MODE_U = 0, MODE_S, MODE_H, MODE_M };
+
+int get_data_mmu_state();
+# 22 "/root/repo/include/isa.h" 2
+
+
+
+typedef riscv64_CPU_state CPU_state;
+typedef riscv64_ISADecodeInfo ISADecodeInfo;
+
+
+extern char isa_logo[];
+void init_isa();
+
+
+
+
+
+extern CPU_state cpu;
+extern rtlreg_t csr_array[4096];
+void isa_reg_display();
+word_t isa_reg_str2val(const char *name, 
+# 39 "/root/repo/include/isa.h" 3 4
+                                        _Bool 
+# 39 "/root/repo/include/isa.h"
+                                             *success);
+
+
+struct Decode;
+int isa_fetch_decode(struct Decode *s);
+void isa_hostcall(uint32_t id, rtlreg_t *dest, const rtlreg_t *src1,
+    const rtlreg_t *src2, word_t imm);
+
+
+enum { MMU_DIRECT, MMU_TRANSLATE, MMU_DYNAMIC };
+enum { MEM_TYPE_IFETCH, MEM_TYPE_READ, MEM_TYPE_WRITE, MEM_TYPE_IFETCH_READ, MEM_TYPE_WRITE_READ };
+enum { MEM_RET_OK, MEM_RET_FAIL, MEM_RET_CROSS_PAGE };
+
+
+
+
+int isa_mmu_check(vaddr_t vaddr, int len, int type);
+
+paddr_t isa_mmu_translate(vaddr_t vaddr, int len, int type);
+
+# 58 "/root/repo/include/isa.h" 3 4
+_Bool 
+# 58 "/root/repo/include/isa.h"
+    isa_pmp_check_permission(paddr_t addr, int len, int type, int mode);
+
+# 59 "/root/repo/include/isa.h" 3 4
+_Bool 
+# 59 "/root/repo/include/isa.h"
+    isa_spmp_check_permission(paddr_t addr, int len, int type, int mode);
+
+
+vaddr_t raise_intr(word_t NO, vaddr_t epc);
+
+word_t isa_query_intr();
+
+# 65 "/root/repo/include/isa.h" 3 4
+_Bool 
+# 65 "/root/repo/include/isa.h"
+    isa_has_pending_intr();
+
+
+struct CptRegs;
+void isa_restore_cpt_regs(const struct CptRegs *regs);
+
+
+
+
+# 73 "/root/repo/include/isa.h" 3 4
+_Bool 
+# 73 "/root/repo/include/isa.h"
+    isa_difftest_checkregs(CPU_state *ref_r, vaddr_t pc);
+void isa_difftest_attach();
+
+
+void isa_difftest_regcpy(void *dut, 
+# 77 "/root/repo/include/isa.h" 3 4
+                                   _Bool 
+# 77 "/root/repo/include/isa.h"
+                                        direction);
+void isa_difftest_csrcpy(void *dut, 
+# 78 "/root/repo/include/isa.h" 3 4
+                                   _Bool 
+# 78 "/root/repo/include/isa.h"
+                                        direction);
+void isa_difftest_raise_intr(word_t NO);
+void isa_difftest_uarchstatus_cpy(void *dut, 
+# 80 "/root/repo/include/isa.h" 3 4
+                                            _Bool 
+# 80 "/root/repo/include/isa.h"
+                                                 direction);
+void isa_difftest_guided_exec(void *guide);
+void isa_difftest_query_ref(void *result_buffer, uint64_t type);
+# 17 "src/monitor/image_loader.c" 2
+# 1 "/usr/include/stdlib.h" 1 3 4
+# 26 "/usr/include/stdlib.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 27 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 329 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+
+# 329 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef int wchar_t;
+# 33 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/waitflags.h" 1 3 4
+# 41 "/usr/include/stdlib.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h" 1 3 4
+# 42 "/usr/include/stdlib.h" 2 3 4
+# 59 "/usr/include/stdlib.h" 3 4
+typedef struct
+  {
+    int quot;
+    int rem;
+  } div_t;
+
+
+
+typedef struct
+  {
+    long int quot;
+    long int rem;
+  } ldiv_t;
+
+
+
+
+
+__extension__ typedef struct
+  {
+    long long int quot;
+    long long int rem;
+  } lldiv_t;
+# 98 "/usr/include/stdlib.h" 3 4
+extern size_t __ctype_get_mb_cur_max (void) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+extern double atof (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+extern int atoi (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+extern long int atol (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+__extension__ extern long long int atoll (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+extern double strtod (const char *__restrict __nptr,
+        char **__restrict __endptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern float strtof (const char *__restrict __nptr,
+       char **__restrict __endptr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+extern long double strtold (const char *__restrict __nptr,
+       char **__restrict __endptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 177 "/usr/include/stdlib.h" 3 4
+extern long int strtol (const char *__restrict __nptr,
+   char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+extern unsigned long int strtoul (const char *__restrict __nptr,
+      char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+__extension__
+extern long long int strtoq (const char *__restrict __nptr,
+        char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+__extension__
+extern unsigned long long int strtouq (const char *__restrict __nptr,
+           char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+__extension__
+extern long long int strtoll (const char *__restrict __nptr,
+         char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+__extension__
+extern unsigned long long int strtoull (const char *__restrict __nptr,
+     char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 361 "/usr/include/stdlib.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) int
+__attribute__ ((__nothrow__ , __leaf__)) atoi (const char *__nptr)
+{
+  return (int) strtol (__nptr, (char **) ((void *)0), 10);
+}
+extern __inline __attribute__ ((__gnu_inline__)) long int
+__attribute__ ((__nothrow__ , __leaf__)) atol (const char *__nptr)
+{
+  return strtol (__nptr, (char **) ((void *)0), 10);
+}
+
+
+__extension__ extern __inline __attribute__ ((__gnu_inline__)) long long int
+__attribute__ ((__nothrow__ , __leaf__)) atoll (const char *__nptr)
+{
+  return strtoll (__nptr, (char **) ((void *)0), 10);
+}
+# 386 "/usr/include/stdlib.h" 3 4
+extern char *l64a (long int __n) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern long int a64l (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/sys/types.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+
+
+
+
+
+
+typedef __u_char u_char;
+typedef __u_short u_short;
+typedef __u_int u_int;
+typedef __u_long u_long;
+typedef __quad_t quad_t;
+typedef __u_quad_t u_quad_t;
+typedef __fsid_t fsid_t;
+
+
+typedef __loff_t loff_t;
+
+
+
+
+typedef __ino_t ino_t;
+# 59 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+typedef __dev_t dev_t;
+# 69 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+typedef __mode_t mode_t;
+
+
+
+
+typedef __nlink_t nlink_t;
+# 103 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+typedef __id_t id_t;
+# 114 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+typedef __daddr_t daddr_t;
+typedef __caddr_t caddr_t;
+
+
+
+
+
+typedef __key_t key_t;
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h" 1 3 4
+
+
+
+
+
+
+typedef __clock_t clock_t;
+# 127 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h" 1 3 4
+
+
+
+
+
+
+typedef __clockid_t clockid_t;
+# 129 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h" 3 4
+typedef __time_t time_t;
+# 130 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h" 1 3 4
+
+
+
+
+
+
+typedef __timer_t timer_t;
+# 131 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+# 144 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 145 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+typedef unsigned long int ulong;
+typedef unsigned short int ushort;
+typedef unsigned int uint;
+
+
+
+
+
+
+
+typedef __uint8_t u_int8_t;
+typedef __uint16_t u_int16_t;
+typedef __uint32_t u_int32_t;
+typedef __uint64_t u_int64_t;
+
+
+typedef int register_t __attribute__ ((__mode__ (__word__)));
+# 176 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+# 1 "/usr/include/endian.h" 1 3 4
+# 24 "/usr/include/endian.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/endian.h" 1 3 4
+# 35 "/usr/include/x86_64-linux-gnu/bits/endian.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/endianness.h" 1 3 4
+# 36 "/usr/include/x86_64-linux-gnu/bits/endian.h" 2 3 4
+# 25 "/usr/include/endian.h" 2 3 4
+# 35 "/usr/include/endian.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 1 3 4
+# 33 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 3 4
+static __inline __uint16_t
+__bswap_16 (__uint16_t __bsx)
+{
+
+  return __builtin_bswap16 (__bsx);
+
+
+
+}
+
+
+
+
+
+
+static __inline __uint32_t
+__bswap_32 (__uint32_t __bsx)
+{
+
+  return __builtin_bswap32 (__bsx);
+
+
+
+}
+# 69 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 3 4
+__extension__ static __inline __uint64_t
+__bswap_64 (__uint64_t __bsx)
+{
+
+  return __builtin_bswap64 (__bsx);
+
+
+
+}
+# 36 "/usr/include/endian.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h" 1 3 4
+# 32 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h" 3 4
+static __inline __uint16_t
+__uint16_identity (__uint16_t __x)
+{
+  return __x;
+}
+
+static __inline __uint32_t
+__uint32_identity (__uint32_t __x)
+{
+  return __x;
+}
+
+static __inline __uint64_t
+__uint64_identity (__uint64_t __x)
+{
+  return __x;
+}
+# 37 "/usr/include/endian.h" 2 3 4
+# 177 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/sys/select.h" 1 3 4
+# 30 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/select.h" 1 3 4
+# 31 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h" 1 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h" 1 3 4
+
+
+
+
+typedef struct
+{
+  unsigned long int __val[(1024 / (8 * sizeof (unsigned long int)))];
+} __sigset_t;
+# 5 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h" 2 3 4
+
+
+typedef __sigset_t sigset_t;
+# 34 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h" 1 3 4
+
+
+
+
+
+
+
+struct timeval
+{
+
+
+
+
+  __time_t tv_sec;
+  __suseconds_t tv_usec;
+
+};
+# 38 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 1 3 4
+# 11 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 3 4
+struct timespec
+{
+
+
+
+  __time_t tv_sec;
+
+
+
+
+  __syscall_slong_t tv_nsec;
+# 31 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 3 4
+};
+# 40 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+
+
+typedef __suseconds_t suseconds_t;
+
+
+
+
+
+typedef long int __fd_mask;
+# 59 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+typedef struct
+  {
+
+
+
+
+
+
+    __fd_mask __fds_bits[1024 / (8 * (int) sizeof (__fd_mask))];
+
+
+  } fd_set;
+
+
+
+
+
+
+typedef __fd_mask fd_mask;
+# 91 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+
+# 102 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+extern int select (int __nfds, fd_set *__restrict __readfds,
+     fd_set *__restrict __writefds,
+     fd_set *__restrict __exceptfds,
+     struct timeval *__restrict __timeout);
+# 127 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+extern int pselect (int __nfds, fd_set *__restrict __readfds,
+      fd_set *__restrict __writefds,
+      fd_set *__restrict __exceptfds,
+      const struct timespec *__restrict __timeout,
+      const __sigset_t *__restrict __sigmask);
+# 153 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+
+# 180 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+
+
+typedef __blksize_t blksize_t;
+
+
+
+
+
+
+typedef __blkcnt_t blkcnt_t;
+
+
+
+typedef __fsblkcnt_t fsblkcnt_t;
+
+
+
+typedef __fsfilcnt_t fsfilcnt_t;
+# 227 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 1 3 4
+# 44 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 1 3 4
+# 21 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 2 3 4
+# 45 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h" 3 4
+typedef union
+{
+  __extension__ unsigned long long int __value64;
+  struct
+  {
+    unsigned int __low;
+    unsigned int __high;
+  } __value32;
+} __atomic_wide_counter;
+# 47 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+
+
+
+typedef struct __pthread_internal_list
+{
+  struct __pthread_internal_list *__prev;
+  struct __pthread_internal_list *__next;
+} __pthread_list_t;
+
+typedef struct __pthread_internal_slist
+{
+  struct __pthread_internal_slist *__next;
+} __pthread_slist_t;
+# 76 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 3 4
+struct __pthread_mutex_s
+{
+  int __lock;
+  unsigned int __count;
+  int __owner;
+
+  unsigned int __nusers;
+
+
+
+  int __kind;
+
+  short __spins;
+  short __elision;
+  __pthread_list_t __list;
+# 53 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 3 4
+};
+# 77 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+# 89 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 3 4
+struct __pthread_rwlock_arch_t
+{
+  unsigned int __readers;
+  unsigned int __writers;
+  unsigned int __wrphase_futex;
+  unsigned int __writers_futex;
+  unsigned int __pad3;
+  unsigned int __pad4;
+
+  int __cur_writer;
+  int __shared;
+  signed char __rwelision;
+
+
+
+
+  unsigned char __pad1[7];
+
+
+  unsigned long int __pad2;
+
+
+  unsigned int __flags;
+# 55 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 3 4
+};
+# 90 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+
+
+
+struct __pthread_cond_s
+{
+  __atomic_wide_counter __wseq;
+  __atomic_wide_counter __g1_start;
+  unsigned int __g_refs[2] ;
+  unsigned int __g_size[2];
+  unsigned int __g1_orig_size;
+  unsigned int __wrefs;
+  unsigned int __g_signals[2];
+};
+
+typedef unsigned int __tss_t;
+typedef unsigned long int __thrd_t;
+
+typedef struct
+{
+  int __data ;
+} __once_flag;
+# 24 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 2 3 4
+
+
+
+typedef unsigned long int pthread_t;
+
+
+
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_mutexattr_t;
+
+
+
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_condattr_t;
+
+
+
+typedef unsigned int pthread_key_t;
+
+
+
+typedef int pthread_once_t;
+
+
+union pthread_attr_t
+{
+  char __size[56];
+  long int __align;
+};
+
+typedef union pthread_attr_t pthread_attr_t;
+
+
+
+
+typedef union
+{
+  struct __pthread_mutex_s __data;
+  char __size[40];
+  long int __align;
+} pthread_mutex_t;
+
+
+typedef union
+{
+  struct __pthread_cond_s __data;
+  char __size[48];
+  __extension__ long long int __align;
+} pthread_cond_t;
+
+
+
+
+
+typedef union
+{
+  struct __pthread_rwlock_arch_t __data;
+  char __size[56];
+  long int __align;
+} pthread_rwlock_t;
+
+typedef union
+{
+  char __size[8];
+  long int __align;
+} pthread_rwlockattr_t;
+
+
+
+
+
+typedef volatile int pthread_spinlock_t;
+
+
+
+
+typedef union
+{
+  char __size[32];
+  long int __align;
+} pthread_barrier_t;
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_barrierattr_t;
+# 228 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+# 396 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+
+extern long int random (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern void srandom (unsigned int __seed) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern char *initstate (unsigned int __seed, char *__statebuf,
+   size_t __statelen) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern char *setstate (char *__statebuf) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+struct random_data
+  {
+    int32_t *fptr;
+    int32_t *rptr;
+    int32_t *state;
+    int rand_type;
+    int rand_deg;
+    int rand_sep;
+    int32_t *end_ptr;
+  };
+
+extern int random_r (struct random_data *__restrict __buf,
+       int32_t *__restrict __result) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int srandom_r (unsigned int __seed, struct random_data *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+extern int initstate_r (unsigned int __seed, char *__restrict __statebuf,
+   size_t __statelen,
+   struct random_data *__restrict __buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4)));
+
+extern int setstate_r (char *__restrict __statebuf,
+         struct random_data *__restrict __buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+extern int rand (void) __attribute__ ((__nothrow__ , __leaf__));
+
+extern void srand (unsigned int __seed) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int rand_r (unsigned int *__seed) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern double drand48 (void) __attribute__ ((__nothrow__ , __leaf__));
+extern double erand48 (unsigned short int __xsubi[3]) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern long int lrand48 (void) __attribute__ ((__nothrow__ , __leaf__));
+extern long int nrand48 (unsigned short int __xsubi[3])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern long int mrand48 (void) __attribute__ ((__nothrow__ , __leaf__));
+extern long int jrand48 (unsigned short int __xsubi[3])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern void srand48 (long int __seedval) __attribute__ ((__nothrow__ , __leaf__));
+extern unsigned short int *seed48 (unsigned short int __seed16v[3])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+extern void lcong48 (unsigned short int __param[7]) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+struct drand48_data
+  {
+    unsigned short int __x[3];
+    unsigned short int __old_x[3];
+    unsigned short int __c;
+    unsigned short int __init;
+    __extension__ unsigned long long int __a;
+
+  };
+
+
+extern int drand48_r (struct drand48_data *__restrict __buffer,
+        double *__restrict __result) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern int erand48_r (unsigned short int __xsubi[3],
+        struct drand48_data *__restrict __buffer,
+        double *__restrict __result) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int lrand48_r (struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern int nrand48_r (unsigned short int __xsubi[3],
+        struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int mrand48_r (struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern int jrand48_r (unsigned short int __xsubi[3],
+        struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int srand48_r (long int __seedval, struct drand48_data *__buffer)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+extern int seed48_r (unsigned short int __seed16v[3],
+       struct drand48_data *__buffer) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int lcong48_r (unsigned short int __param[7],
+        struct drand48_data *__buffer)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern __uint32_t arc4random (void)
+     __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern void arc4random_buf (void *__buf, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern __uint32_t arc4random_uniform (__uint32_t __upper_bound)
+     __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern void *malloc (size_t __size) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__))
+     __attribute__ ((__alloc_size__ (1))) ;
+
+extern void *calloc (size_t __nmemb, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__alloc_size__ (1, 2))) ;
+
+
+
+
+
+
+extern void *realloc (void *__ptr, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__warn_unused_result__)) __attribute__ ((__alloc_size__ (2)));
+
+
+extern void free (void *__ptr) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern void *reallocarray (void *__ptr, size_t __nmemb, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__warn_unused_result__))
+     __attribute__ ((__alloc_size__ (2, 3)))
+    __attribute__ ((__malloc__ (__builtin_free, 1)));
+
+
+extern void *reallocarray (void *__ptr, size_t __nmemb, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__ (reallocarray, 1)));
+
+
+
+# 1 "/usr/include/alloca.h" 1 3 4
+# 24 "/usr/include/alloca.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 25 "/usr/include/alloca.h" 2 3 4
+
+
+
+
+
+
+
+extern void *alloca (size_t __size) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+# 588 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+extern void *valloc (size_t __size) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__))
+     __attribute__ ((__alloc_size__ (1))) ;
+
+
+
+
+extern int posix_memalign (void **__memptr, size_t __alignment, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+extern void *aligned_alloc (size_t __alignment, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__alloc_align__ (1)))
+     __attribute__ ((__alloc_size__ (2))) ;
+
+
+
+extern void abort (void) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+extern int atexit (void (*__func) (void)) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+extern int at_quick_exit (void (*__func) (void)) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int on_exit (void (*__func) (int __status, void *__arg), void *__arg)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern void exit (int __status) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+
+
+extern void quick_exit (int __status) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+
+
+extern void _Exit (int __status) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+
+extern char *getenv (const char *__name) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 667 "/usr/include/stdlib.h" 3 4
+extern int putenv (char *__string) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern int setenv (const char *__name, const char *__value, int __replace)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+extern int unsetenv (const char *__name) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int clearenv (void) __attribute__ ((__nothrow__ , __leaf__));
+# 695 "/usr/include/stdlib.h" 3 4
+extern char *mktemp (char *__template) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 708 "/usr/include/stdlib.h" 3 4
+extern int mkstemp (char *__template) __attribute__ ((__nonnull__ (1))) ;
+# 730 "/usr/include/stdlib.h" 3 4
+extern int mkstemps (char *__template, int __suffixlen) __attribute__ ((__nonnull__ (1))) ;
+# 751 "/usr/include/stdlib.h" 3 4
+extern char *mkdtemp (char *__template) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 804 "/usr/include/stdlib.h" 3 4
+extern int system (const char *__command) ;
+# 821 "/usr/include/stdlib.h" 3 4
+extern char *realpath (const char *__restrict __name,
+         char *__restrict __resolved) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+
+typedef int (*__compar_fn_t) (const void *, const void *);
+# 841 "/usr/include/stdlib.h" 3 4
+extern void *bsearch (const void *__key, const void *__base,
+        size_t __nmemb, size_t __size, __compar_fn_t __compar)
+     __attribute__ ((__nonnull__ (1, 2, 5))) ;
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/stdlib-bsearch.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) void *
+bsearch (const void *__key, const void *__base, size_t __nmemb, size_t __size,
+  __compar_fn_t __compar)
+{
+  size_t __l, __u, __idx;
+  const void *__p;
+  int __comparison;
+
+  __l = 0;
+  __u = __nmemb;
+  while (__l < __u)
+    {
+      __idx = (__l + __u) / 2;
+      __p = (const void *) (((const char *) __base) + (__idx * __size));
+      __comparison = (*__compar) (__key, __p);
+      if (__comparison < 0)
+ __u = __idx;
+      else if (__comparison > 0)
+ __l = __idx + 1;
+      else
+ {
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wcast-qual"
+
+   return (void *) __p;
+
+#pragma GCC diagnostic pop
+
+ }
+    }
+
+  return ((void *)0);
+}
+# 847 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+extern void qsort (void *__base, size_t __nmemb, size_t __size,
+     __compar_fn_t __compar) __attribute__ ((__nonnull__ (1, 4)));
+# 861 "/usr/include/stdlib.h" 3 4
+extern int abs (int __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+extern long int labs (long int __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+
+
+__extension__ extern long long int llabs (long long int __x)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+
+
+
+
+
+
+extern div_t div (int __numer, int __denom)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+extern ldiv_t ldiv (long int __numer, long int __denom)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+
+
+__extension__ extern lldiv_t lldiv (long long int __numer,
+        long long int __denom)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+# 893 "/usr/include/stdlib.h" 3 4
+extern char *ecvt (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+
+
+
+
+extern char *fcvt (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+
+
+
+
+extern char *gcvt (double __value, int __ndigit, char *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3))) ;
+
+
+
+
+extern char *qecvt (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+extern char *qfcvt (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+extern char *qgcvt (long double __value, int __ndigit, char *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3))) ;
+
+
+
+
+extern int ecvt_r (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign, char *__restrict __buf,
+     size_t __len) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+extern int fcvt_r (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign, char *__restrict __buf,
+     size_t __len) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+
+extern int qecvt_r (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign,
+      char *__restrict __buf, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+extern int qfcvt_r (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign,
+      char *__restrict __buf, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+
+
+
+
+
+extern int mblen (const char *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int mbtowc (wchar_t *__restrict __pwc,
+     const char *__restrict __s, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int wctomb (char *__s, wchar_t __wchar) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern size_t mbstowcs (wchar_t *__restrict __pwcs,
+   const char *__restrict __s, size_t __n) __attribute__ ((__nothrow__ , __leaf__))
+    __attribute__ ((__access__ (__read_only__, 2)));
+
+extern size_t wcstombs (char *__restrict __s,
+   const wchar_t *__restrict __pwcs, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__access__ (__write_only__, 1, 3)))
+  __attribute__ ((__access__ (__read_only__, 2)));
+
+
+
+
+
+
+extern int rpmatch (const char *__response) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 980 "/usr/include/stdlib.h" 3 4
+extern int getsubopt (char **__restrict __optionp,
+        char *const *__restrict __tokens,
+        char **__restrict __valuep)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2, 3))) ;
+# 1026 "/usr/include/stdlib.h" 3 4
+extern int getloadavg (double __loadavg[], int __nelem)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 1036 "/usr/include/stdlib.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h" 3 4
+extern __inline __attribute__ ((__gnu_inline__)) double
+__attribute__ ((__nothrow__ , __leaf__)) atof (const char *__nptr)
+{
+  return strtod (__nptr, (char **) ((void *)0));
+}
+# 1037 "/usr/include/stdlib.h" 2 3 4
+# 1048 "/usr/include/stdlib.h" 3 4
+
+# 18 "src/monitor/image_loader.c" 2
+
+# 1 "/root/repo/include/memory/paddr.h" 1
+# 21 "/root/repo/include/memory/paddr.h"
+# 1 "/root/repo/include/memory/host.h" 1
+# 21 "/root/repo/include/memory/host.h"
+
+# 21 "/root/repo/include/memory/host.h"
+static inline word_t host_read(void *addr, int len) {
+  switch (len) {
+    case 1: return *(uint8_t *)addr;
+    case 2: return *(uint16_t *)addr;
+    case 4: return *(uint32_t *)addr;
+    case 8: return *(uint64_t *)addr;
+    default: 
+# 27 "/root/repo/include/memory/host.h" 3 4
+            ((void) sizeof ((
+# 27 "/root/repo/include/memory/host.h"
+            0
+# 27 "/root/repo/include/memory/host.h" 3 4
+            ) ? 1 : 0), __extension__ ({ if (
+# 27 "/root/repo/include/memory/host.h"
+            0
+# 27 "/root/repo/include/memory/host.h" 3 4
+            ) ; else __assert_fail (
+# 27 "/root/repo/include/memory/host.h"
+            "0"
+# 27 "/root/repo/include/memory/host.h" 3 4
+            , "/root/repo/include/memory/host.h", 27, __extension__ __PRETTY_FUNCTION__); }))
+# 27 "/root/repo/include/memory/host.h"
+                                                        ;
+  }
+}
+
+static inline void host_write(void *addr, int len, word_t data) {
+  switch (len) {
+    case 1: *(uint8_t *)addr = data; return;
+    case 2: *(uint16_t *)addr = data; return;
+    case 4: *(uint32_t *)addr = data; return;
+    case 8: *(uint64_t *)addr = data; return;
+    default: 
+# 37 "/root/repo/include/memory/host.h" 3 4
+   ((void) sizeof ((
+# 37 "/root/repo/include/memory/host.h"
+   0
+# 37 "/root/repo/include/memory/host.h" 3 4
+   ) ? 1 : 0), __extension__ ({ if (
+# 37 "/root/repo/include/memory/host.h"
+   0
+# 37 "/root/repo/include/memory/host.h" 3 4
+   ) ; else __assert_fail (
+# 37 "/root/repo/include/memory/host.h"
+   "0"
+# 37 "/root/repo/include/memory/host.h" 3 4
+   , "/root/repo/include/memory/host.h", 37, __extension__ __PRETTY_FUNCTION__); }))
+# 37 "/root/repo/include/memory/host.h"
+                                             ;
+  }
+}
+# 22 "/root/repo/include/memory/paddr.h" 2
+# 1 "/root/repo/include/memory/vaddr.h" 1
+# 21 "/root/repo/include/memory/vaddr.h"
+struct Decode;
+word_t vaddr_ifetch(vaddr_t addr, int len);
+paddr_t vaddr_ifetch_paddr(vaddr_t addr);
+word_t vaddr_read(struct Decode *s, vaddr_t addr, int len, int mmu_mode);
+void vaddr_write(struct Decode *s, vaddr_t addr, int len, word_t data, int mmu_mode);
+
+word_t vaddr_read_safe(vaddr_t addr, int len);
+
+
+
+
+
+int force_raise_pf(vaddr_t vaddr, int type);
+# 23 "/root/repo/include/memory/paddr.h" 2
+
+extern unsigned long MEMORY_SIZE;
+# 34 "/root/repo/include/memory/paddr.h"
+void init_mem();
+
+
+uint8_t* guest_to_host(paddr_t paddr);
+
+paddr_t host_to_guest(uint8_t *haddr);
+
+static inline 
+# 41 "/root/repo/include/memory/paddr.h" 3 4
+             _Bool 
+# 41 "/root/repo/include/memory/paddr.h"
+                  in_pmem(paddr_t addr) {
+  paddr_t mbase_mask = 0x80000000 - 1;
+  paddr_t msize_mask = MEMORY_SIZE - 1;
+  
+# 44 "/root/repo/include/memory/paddr.h" 3 4
+ _Bool 
+# 44 "/root/repo/include/memory/paddr.h"
+      mbase_align = (0x80000000 & mbase_mask) == 0;
+  
+# 45 "/root/repo/include/memory/paddr.h" 3 4
+ _Bool 
+# 45 "/root/repo/include/memory/paddr.h"
+      msize_align = (MEMORY_SIZE & msize_mask) == 0;
+  
+# 46 "/root/repo/include/memory/paddr.h" 3 4
+ _Bool 
+# 46 "/root/repo/include/memory/paddr.h"
+      msize_inside_mbase = msize_mask <= mbase_mask;
+  if (mbase_align && msize_align && msize_inside_mbase) {
+    return (addr & ~msize_mask) == 0x80000000;
+  } else {
+    return (addr >= 0x80000000) && (addr < (paddr_t)0x80000000 + MEMORY_SIZE);
+  }
+}
+
+word_t paddr_read(paddr_t addr, int len, int type, int mode, vaddr_t vaddr);
+void paddr_write(paddr_t addr, int len, word_t data, int mode, vaddr_t vaddr);
+uint8_t *get_pmem();
+
+void pmem_set_code_page(paddr_t addr);
+# 99 "/root/repo/include/memory/paddr.h"
+void pmem_mark_dirty(paddr_t addr, size_t len);
+const uint64_t *pmem_dirty_bitmap();
+void pmem_clear_dirty();
+# 20 "src/monitor/image_loader.c" 2
+
+# 1 "/usr/include/fcntl.h" 1 3 4
+# 28 "/usr/include/fcntl.h" 3 4
+
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/fcntl.h" 1 3 4
+# 35 "/usr/include/x86_64-linux-gnu/bits/fcntl.h" 3 4
+
+# 35 "/usr/include/x86_64-linux-gnu/bits/fcntl.h" 3 4
+struct flock
+  {
+    short int l_type;
+    short int l_whence;
+
+    __off_t l_start;
+    __off_t l_len;
+
+
+
+
+    __pid_t l_pid;
+  };
+# 61 "/usr/include/x86_64-linux-gnu/bits/fcntl.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/fcntl-linux.h" 1 3 4
+# 393 "/usr/include/x86_64-linux-gnu/bits/fcntl-linux.h" 3 4
+
+# 467 "/usr/include/x86_64-linux-gnu/bits/fcntl-linux.h" 3 4
+
+# 62 "/usr/include/x86_64-linux-gnu/bits/fcntl.h" 2 3 4
+# 36 "/usr/include/fcntl.h" 2 3 4
+# 78 "/usr/include/fcntl.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/stat.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/stat.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/struct_stat.h" 1 3 4
+# 26 "/usr/include/x86_64-linux-gnu/bits/struct_stat.h" 3 4
+struct stat
+  {
+
+
+
+    __dev_t st_dev;
+
+
+
+
+    __ino_t st_ino;
+
+
+
+
+
+
+
+    __nlink_t st_nlink;
+    __mode_t st_mode;
+
+    __uid_t st_uid;
+    __gid_t st_gid;
+
+    int __pad0;
+
+    __dev_t st_rdev;
+
+
+
+
+    __off_t st_size;
+
+
+
+    __blksize_t st_blksize;
+
+    __blkcnt_t st_blocks;
+# 74 "/usr/include/x86_64-linux-gnu/bits/struct_stat.h" 3 4
+    struct timespec st_atim;
+    struct timespec st_mtim;
+    struct timespec st_ctim;
+# 89 "/usr/include/x86_64-linux-gnu/bits/struct_stat.h" 3 4
+    __syscall_slong_t __glibc_reserved[3];
+# 99 "/usr/include/x86_64-linux-gnu/bits/struct_stat.h" 3 4
+  };
+# 26 "/usr/include/x86_64-linux-gnu/bits/stat.h" 2 3 4
+# 79 "/usr/include/fcntl.h" 2 3 4
+# 149 "/usr/include/fcntl.h" 3 4
+extern int fcntl (int __fd, int __cmd, ...);
+# 181 "/usr/include/fcntl.h" 3 4
+extern int open (const char *__file, int __oflag, ...) __attribute__ ((__nonnull__ (1)));
+# 205 "/usr/include/fcntl.h" 3 4
+extern int openat (int __fd, const char *__file, int __oflag, ...)
+     __attribute__ ((__nonnull__ (2)));
+# 227 "/usr/include/fcntl.h" 3 4
+extern int creat (const char *__file, mode_t __mode) __attribute__ ((__nonnull__ (1)));
+# 273 "/usr/include/fcntl.h" 3 4
+extern int posix_fadvise (int __fd, off_t __offset, off_t __len,
+     int __advise) __attribute__ ((__nothrow__ , __leaf__));
+# 295 "/usr/include/fcntl.h" 3 4
+extern int posix_fallocate (int __fd, off_t __offset, off_t __len);
+# 317 "/usr/include/fcntl.h" 3 4
+
+# 22 "src/monitor/image_loader.c" 2
+
+# 1 "/usr/include/zlib.h" 1 3 4
+# 34 "/usr/include/zlib.h" 3 4
+# 1 "/usr/include/zconf.h" 1 3 4
+# 250 "/usr/include/zconf.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 145 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long int ptrdiff_t;
+# 424 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef struct {
+  long long __max_align_ll __attribute__((__aligned__(__alignof__(long long))));
+  long double __max_align_ld __attribute__((__aligned__(__alignof__(long double))));
+# 435 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+} max_align_t;
+# 251 "/usr/include/zconf.h" 2 3 4
+     typedef size_t z_size_t;
+# 397 "/usr/include/zconf.h" 3 4
+typedef unsigned char Byte;
+
+typedef unsigned int uInt;
+typedef unsigned long uLong;
+
+
+
+
+
+   typedef Byte Bytef;
+
+typedef char charf;
+typedef int intf;
+typedef uInt uIntf;
+typedef uLong uLongf;
+
+
+   typedef void const *voidpc;
+   typedef void *voidpf;
+   typedef void *voidp;
+
+
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/limits.h" 1 3 4
+# 34 "/usr/lib/gcc/x86_64-linux-gnu/12/include/limits.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/syslimits.h" 1 3 4
+
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/limits.h" 1 3 4
+# 203 "/usr/lib/gcc/x86_64-linux-gnu/12/include/limits.h" 3 4
+# 1 "/usr/include/limits.h" 1 3 4
+# 26 "/usr/include/limits.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 27 "/usr/include/limits.h" 2 3 4
+# 195 "/usr/include/limits.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/posix1_lim.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/posix1_lim.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 28 "/usr/include/x86_64-linux-gnu/bits/posix1_lim.h" 2 3 4
+# 161 "/usr/include/x86_64-linux-gnu/bits/posix1_lim.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/local_lim.h" 1 3 4
+# 38 "/usr/include/x86_64-linux-gnu/bits/local_lim.h" 3 4
+# 1 "/usr/include/linux/limits.h" 1 3 4
+# 39 "/usr/include/x86_64-linux-gnu/bits/local_lim.h" 2 3 4
+# 81 "/usr/include/x86_64-linux-gnu/bits/local_lim.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min-dynamic.h" 1 3 4
+# 29 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min-dynamic.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min.h" 1 3 4
+# 30 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min-dynamic.h" 2 3 4
+# 82 "/usr/include/x86_64-linux-gnu/bits/local_lim.h" 2 3 4
+# 162 "/usr/include/x86_64-linux-gnu/bits/posix1_lim.h" 2 3 4
+# 196 "/usr/include/limits.h" 2 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/posix2_lim.h" 1 3 4
+# 200 "/usr/include/limits.h" 2 3 4
+# 204 "/usr/lib/gcc/x86_64-linux-gnu/12/include/limits.h" 2 3 4
+# 8 "/usr/lib/gcc/x86_64-linux-gnu/12/include/syslimits.h" 2 3 4
+# 35 "/usr/lib/gcc/x86_64-linux-gnu/12/include/limits.h" 2 3 4
+# 425 "/usr/include/zconf.h" 2 3 4
+# 435 "/usr/include/zconf.h" 3 4
+   typedef unsigned z_crc_t;
+# 456 "/usr/include/zconf.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 1 3 4
+# 457 "/usr/include/zconf.h" 2 3 4
+# 35 "/usr/include/zlib.h" 2 3 4
+# 81 "/usr/include/zlib.h" 3 4
+typedef voidpf (*alloc_func) (voidpf opaque, uInt items, uInt size);
+typedef void (*free_func) (voidpf opaque, voidpf address);
+
+struct internal_state;
+
+typedef struct z_stream_s {
+    Bytef *next_in;
+    uInt avail_in;
+    uLong total_in;
+
+    Bytef *next_out;
+    uInt avail_out;
+    uLong total_out;
+
+    char *msg;
+    struct internal_state *state;
+
+    alloc_func zalloc;
+    free_func zfree;
+    voidpf opaque;
+
+    int data_type;
+
+    uLong adler;
+    uLong reserved;
+} z_stream;
+
+typedef z_stream *z_streamp;
+
+
+
+
+
+typedef struct gz_header_s {
+    int text;
+    uLong time;
+    int xflags;
+    int os;
+    Bytef *extra;
+    uInt extra_len;
+    uInt extra_max;
+    Bytef *name;
+    uInt name_max;
+    Bytef *comment;
+    uInt comm_max;
+    int hcrc;
+    int done;
+
+} gz_header;
+
+typedef gz_header *gz_headerp;
+# 220 "/usr/include/zlib.h" 3 4
+extern const char * zlibVersion (void);
+# 250 "/usr/include/zlib.h" 3 4
+extern int deflate (z_streamp strm, int flush);
+# 363 "/usr/include/zlib.h" 3 4
+extern int deflateEnd (z_streamp strm);
+# 400 "/usr/include/zlib.h" 3 4
+extern int inflate (z_streamp strm, int flush);
+# 520 "/usr/include/zlib.h" 3 4
+extern int inflateEnd (z_streamp strm);
+# 610 "/usr/include/zlib.h" 3 4
+extern int deflateSetDictionary (z_streamp strm, const Bytef *dictionary, uInt dictLength)
+
+                                                               ;
+# 654 "/usr/include/zlib.h" 3 4
+extern int deflateGetDictionary (z_streamp strm, Bytef *dictionary, uInt *dictLength)
+
+                                                                ;
+# 676 "/usr/include/zlib.h" 3 4
+extern int deflateCopy (z_streamp dest, z_streamp source)
+                                                      ;
+# 694 "/usr/include/zlib.h" 3 4
+extern int deflateReset (z_streamp strm);
+# 705 "/usr/include/zlib.h" 3 4
+extern int deflateParams (z_streamp strm, int level, int strategy)
+
+                                                    ;
+# 743 "/usr/include/zlib.h" 3 4
+extern int deflateTune (z_streamp strm, int good_length, int max_lazy, int nice_length, int max_chain)
+
+
+
+                                                   ;
+# 760 "/usr/include/zlib.h" 3 4
+extern uLong deflateBound (z_streamp strm, uLong sourceLen)
+                                                        ;
+# 775 "/usr/include/zlib.h" 3 4
+extern int deflatePending (z_streamp strm, unsigned *pending, int *bits)
+
+                                                  ;
+# 790 "/usr/include/zlib.h" 3 4
+extern int deflatePrime (z_streamp strm, int bits, int value)
+
+                                                ;
+# 807 "/usr/include/zlib.h" 3 4
+extern int deflateSetHeader (z_streamp strm, gz_headerp head)
+                                                          ;
+# 886 "/usr/include/zlib.h" 3 4
+extern int inflateSetDictionary (z_streamp strm, const Bytef *dictionary, uInt dictLength)
+
+                                                               ;
+# 909 "/usr/include/zlib.h" 3 4
+extern int inflateGetDictionary (z_streamp strm, Bytef *dictionary, uInt *dictLength)
+
+                                                                ;
+# 924 "/usr/include/zlib.h" 3 4
+extern int inflateSync (z_streamp strm);
+# 943 "/usr/include/zlib.h" 3 4
+extern int inflateCopy (z_streamp dest, z_streamp source)
+                                                      ;
+# 959 "/usr/include/zlib.h" 3 4
+extern int inflateReset (z_streamp strm);
+# 969 "/usr/include/zlib.h" 3 4
+extern int inflateReset2 (z_streamp strm, int windowBits)
+                                                      ;
+# 983 "/usr/include/zlib.h" 3 4
+extern int inflatePrime (z_streamp strm, int bits, int value)
+
+                                                ;
+# 1004 "/usr/include/zlib.h" 3 4
+extern long inflateMark (z_streamp strm);
+# 1032 "/usr/include/zlib.h" 3 4
+extern int inflateGetHeader (z_streamp strm, gz_headerp head)
+                                                          ;
+# 1094 "/usr/include/zlib.h" 3 4
+typedef unsigned (*in_func) (void *, unsigned char * *)
+                                                                   ;
+typedef int (*out_func) (void *, unsigned char *, unsigned);
+
+extern int inflateBack (z_streamp strm, in_func in, void *in_desc, out_func out, void *out_desc)
+
+                                                                      ;
+# 1168 "/usr/include/zlib.h" 3 4
+extern int inflateBackEnd (z_streamp strm);
+
+
+
+
+
+
+
+extern uLong zlibCompileFlags (void);
+# 1229 "/usr/include/zlib.h" 3 4
+extern int compress (Bytef *dest, uLongf *destLen, const Bytef *source, uLong sourceLen)
+                                                                       ;
+# 1244 "/usr/include/zlib.h" 3 4
+extern int compress2 (Bytef *dest, uLongf *destLen, const Bytef *source, uLong sourceLen, int level)
+
+                                             ;
+# 1260 "/usr/include/zlib.h" 3 4
+extern uLong compressBound (uLong sourceLen);
+
+
+
+
+
+
+extern int uncompress (Bytef *dest, uLongf *destLen, const Bytef *source, uLong sourceLen)
+                                                                         ;
+# 1285 "/usr/include/zlib.h" 3 4
+extern int uncompress2 (Bytef *dest, uLongf *destLen, const Bytef *source, uLong *sourceLen)
+                                                                           ;
+# 1302 "/usr/include/zlib.h" 3 4
+typedef struct gzFile_s *gzFile;
+# 1342 "/usr/include/zlib.h" 3 4
+extern gzFile gzdopen (int fd, const char *mode);
+# 1365 "/usr/include/zlib.h" 3 4
+extern int gzbuffer (gzFile file, unsigned size);
+# 1381 "/usr/include/zlib.h" 3 4
+extern int gzsetparams (gzFile file, int level, int strategy);
+# 1392 "/usr/include/zlib.h" 3 4
+extern int gzread (gzFile file, voidp buf, unsigned len);
+# 1422 "/usr/include/zlib.h" 3 4
+extern z_size_t gzfread (voidp buf, z_size_t size, z_size_t nitems, gzFile file)
+                                                  ;
+# 1448 "/usr/include/zlib.h" 3 4
+extern int gzwrite (gzFile file, voidpc buf, unsigned len);
+
+
+
+
+
+extern z_size_t gzfwrite (voidpc buf, z_size_t size, z_size_t nitems, gzFile file)
+                                                                    ;
+# 1468 "/usr/include/zlib.h" 3 4
+extern int gzprintf (gzFile file, const char *format, ...);
+# 1483 "/usr/include/zlib.h" 3 4
+extern int gzputs (gzFile file, const char *s);
+
+
+
+
+
+
+
+extern char * gzgets (gzFile file, char *buf, int len);
+# 1505 "/usr/include/zlib.h" 3 4
+extern int gzputc (gzFile file, int c);
+
+
+
+
+
+extern int gzgetc (gzFile file);
+# 1520 "/usr/include/zlib.h" 3 4
+extern int gzungetc (int c, gzFile file);
+# 1532 "/usr/include/zlib.h" 3 4
+extern int gzflush (gzFile file, int flush);
+# 1567 "/usr/include/zlib.h" 3 4
+extern int gzrewind (gzFile file);
+# 1595 "/usr/include/zlib.h" 3 4
+extern int gzeof (gzFile file);
+# 1610 "/usr/include/zlib.h" 3 4
+extern int gzdirect (gzFile file);
+# 1631 "/usr/include/zlib.h" 3 4
+extern int gzclose (gzFile file);
+# 1644 "/usr/include/zlib.h" 3 4
+extern int gzclose_r (gzFile file);
+extern int gzclose_w (gzFile file);
+# 1656 "/usr/include/zlib.h" 3 4
+extern const char * gzerror (gzFile file, int *errnum);
+# 1672 "/usr/include/zlib.h" 3 4
+extern void gzclearerr (gzFile file);
+# 1689 "/usr/include/zlib.h" 3 4
+extern uLong adler32 (uLong adler, const Bytef *buf, uInt len);
+# 1709 "/usr/include/zlib.h" 3 4
+extern uLong adler32_z (uLong adler, const Bytef *buf, z_size_t len)
+                                                  ;
+# 1727 "/usr/include/zlib.h" 3 4
+extern uLong crc32 (uLong crc, const Bytef *buf, uInt len);
+# 1745 "/usr/include/zlib.h" 3 4
+extern uLong crc32_z (uLong crc, const Bytef *buf, z_size_t len)
+                                                ;
+# 1768 "/usr/include/zlib.h" 3 4
+extern uLong crc32_combine_op (uLong crc1, uLong crc2, uLong op);
+# 1781 "/usr/include/zlib.h" 3 4
+extern int deflateInit_ (z_streamp strm, int level, const char *version, int stream_size)
+                                                                           ;
+extern int inflateInit_ (z_streamp strm, const char *version, int stream_size)
+                                                                           ;
+extern int deflateInit2_ (z_streamp strm, int level, int method, int windowBits, int memLevel, int strategy, const char *version, int stream_size)
+
+
+                                                       ;
+extern int inflateInit2_ (z_streamp strm, int windowBits, const char *version, int stream_size)
+                                                                            ;
+extern int inflateBackInit_ (z_streamp strm, int windowBits, unsigned char *window, const char *version, int stream_size)
+
+
+                                                          ;
+# 1834 "/usr/include/zlib.h" 3 4
+struct gzFile_s {
+    unsigned have;
+    unsigned char *next;
+    off_t pos;
+};
+extern int gzgetc_ (gzFile file);
+# 1893 "/usr/include/zlib.h" 3 4
+   extern gzFile gzopen (const char *, const char *);
+   extern off_t gzseek (gzFile, off_t, int);
+   extern off_t gztell (gzFile);
+   extern off_t gzoffset (gzFile);
+   extern uLong adler32_combine (uLong, uLong, off_t);
+   extern uLong crc32_combine (uLong, uLong, off_t);
+   extern uLong crc32_combine_gen (off_t);
+# 1911 "/usr/include/zlib.h" 3 4
+extern const char * zError (int);
+extern int inflateSyncPoint (z_streamp);
+extern const z_crc_t * get_crc_table (void);
+extern int inflateUndermine (z_streamp, int);
+extern int inflateValidate (z_streamp, int);
+extern unsigned long inflateCodesUsed (z_streamp);
+extern int inflateResetKeep (z_streamp);
+extern int deflateResetKeep (z_streamp);
+
+
+
+
+
+
+extern int gzvprintf (gzFile file, const char *format, va_list va)
+
+                                                              ;
+# 24 "src/monitor/image_loader.c" 2
+# 1 "/usr/include/pthread.h" 1 3 4
+# 22 "/usr/include/pthread.h" 3 4
+# 1 "/usr/include/sched.h" 1 3 4
+# 29 "/usr/include/sched.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 30 "/usr/include/sched.h" 2 3 4
+# 43 "/usr/include/sched.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/sched.h" 1 3 4
+# 80 "/usr/include/x86_64-linux-gnu/bits/sched.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_sched_param.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/types/struct_sched_param.h" 3 4
+struct sched_param
+{
+  int sched_priority;
+};
+# 81 "/usr/include/x86_64-linux-gnu/bits/sched.h" 2 3 4
+
+
+# 102 "/usr/include/x86_64-linux-gnu/bits/sched.h" 3 4
+
+# 44 "/usr/include/sched.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/cpu-set.h" 1 3 4
+# 32 "/usr/include/x86_64-linux-gnu/bits/cpu-set.h" 3 4
+typedef unsigned long int __cpu_mask;
+
+
+
+
+
+
+typedef struct
+{
+  __cpu_mask __bits[1024 / (8 * sizeof (__cpu_mask))];
+} cpu_set_t;
+# 115 "/usr/include/x86_64-linux-gnu/bits/cpu-set.h" 3 4
+
+
+extern int __sched_cpucount (size_t __setsize, const cpu_set_t *__setp)
+     __attribute__ ((__nothrow__ , __leaf__));
+extern cpu_set_t *__sched_cpualloc (size_t __count) __attribute__ ((__nothrow__ , __leaf__)) ;
+extern void __sched_cpufree (cpu_set_t *__set) __attribute__ ((__nothrow__ , __leaf__));
+
+
+# 45 "/usr/include/sched.h" 2 3 4
+
+
+
+
+
+
+
+
+
+extern int sched_setparam (__pid_t __pid, const struct sched_param *__param)
+     __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_getparam (__pid_t __pid, struct sched_param *__param) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_setscheduler (__pid_t __pid, int __policy,
+          const struct sched_param *__param) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_getscheduler (__pid_t __pid) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_yield (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_get_priority_max (int __algorithm) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_get_priority_min (int __algorithm) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int sched_rr_get_interval (__pid_t __pid, struct timespec *__t) __attribute__ ((__nothrow__ , __leaf__));
+# 138 "/usr/include/sched.h" 3 4
+
+# 23 "/usr/include/pthread.h" 2 3 4
+# 1 "/usr/include/time.h" 1 3 4
+# 29 "/usr/include/time.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 30 "/usr/include/time.h" 2 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/time.h" 1 3 4
+# 34 "/usr/include/time.h" 2 3 4
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_tm.h" 1 3 4
+
+
+
+
+
+
+struct tm
+{
+  int tm_sec;
+  int tm_min;
+  int tm_hour;
+  int tm_mday;
+  int tm_mon;
+  int tm_year;
+  int tm_wday;
+  int tm_yday;
+  int tm_isdst;
+
+
+  long int tm_gmtoff;
+  const char *tm_zone;
+
+
+
+
+};
+# 40 "/usr/include/time.h" 2 3 4
+# 48 "/usr/include/time.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_itimerspec.h" 1 3 4
+
+
+
+
+
+
+
+struct itimerspec
+  {
+    struct timespec it_interval;
+    struct timespec it_value;
+  };
+# 49 "/usr/include/time.h" 2 3 4
+struct sigevent;
+# 68 "/usr/include/time.h" 3 4
+
+
+
+
+extern clock_t clock (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern time_t time (time_t *__timer) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double difftime (time_t __time1, time_t __time0)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern time_t mktime (struct tm *__tp) __attribute__ ((__nothrow__ , __leaf__));
+# 100 "/usr/include/time.h" 3 4
+extern size_t strftime (char *__restrict __s, size_t __maxsize,
+   const char *__restrict __format,
+   const struct tm *__restrict __tp) __attribute__ ((__nothrow__ , __leaf__));
+# 116 "/usr/include/time.h" 3 4
+extern size_t strftime_l (char *__restrict __s, size_t __maxsize,
+     const char *__restrict __format,
+     const struct tm *__restrict __tp,
+     locale_t __loc) __attribute__ ((__nothrow__ , __leaf__));
+# 132 "/usr/include/time.h" 3 4
+extern struct tm *gmtime (const time_t *__timer) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern struct tm *localtime (const time_t *__timer) __attribute__ ((__nothrow__ , __leaf__));
+# 154 "/usr/include/time.h" 3 4
+extern struct tm *gmtime_r (const time_t *__restrict __timer,
+       struct tm *__restrict __tp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern struct tm *localtime_r (const time_t *__restrict __timer,
+          struct tm *__restrict __tp) __attribute__ ((__nothrow__ , __leaf__));
+# 179 "/usr/include/time.h" 3 4
+extern char *asctime (const struct tm *__tp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern char *ctime (const time_t *__timer) __attribute__ ((__nothrow__ , __leaf__));
+# 197 "/usr/include/time.h" 3 4
+extern char *asctime_r (const struct tm *__restrict __tp,
+   char *__restrict __buf) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern char *ctime_r (const time_t *__restrict __timer,
+        char *__restrict __buf) __attribute__ ((__nothrow__ , __leaf__));
+# 217 "/usr/include/time.h" 3 4
+extern char *__tzname[2];
+extern int __daylight;
+extern long int __timezone;
+
+
+
+
+extern char *tzname[2];
+
+
+
+extern void tzset (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int daylight;
+extern long int timezone;
+# 246 "/usr/include/time.h" 3 4
+extern time_t timegm (struct tm *__tp) __attribute__ ((__nothrow__ , __leaf__));
+# 263 "/usr/include/time.h" 3 4
+extern time_t timelocal (struct tm *__tp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern int dysize (int __year) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+# 281 "/usr/include/time.h" 3 4
+extern int nanosleep (const struct timespec *__requested_time,
+        struct timespec *__remaining);
+
+
+extern int clock_getres (clockid_t __clock_id, struct timespec *__res) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int clock_gettime (clockid_t __clock_id, struct timespec *__tp)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+extern int clock_settime (clockid_t __clock_id, const struct timespec *__tp)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+# 323 "/usr/include/time.h" 3 4
+extern int clock_nanosleep (clockid_t __clock_id, int __flags,
+       const struct timespec *__req,
+       struct timespec *__rem);
+# 338 "/usr/include/time.h" 3 4
+extern int clock_getcpuclockid (pid_t __pid, clockid_t *__clock_id) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern int timer_create (clockid_t __clock_id,
+    struct sigevent *__restrict __evp,
+    timer_t *__restrict __timerid) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int timer_delete (timer_t __timerid) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int timer_settime (timer_t __timerid, int __flags,
+     const struct itimerspec *__restrict __value,
+     struct itimerspec *__restrict __ovalue) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int timer_gettime (timer_t __timerid, struct itimerspec *__value)
+     __attribute__ ((__nothrow__ , __leaf__));
+# 376 "/usr/include/time.h" 3 4
+extern int timer_getoverrun (timer_t __timerid) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern int timespec_get (struct timespec *__ts, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 452 "/usr/include/time.h" 3 4
+
+# 24 "/usr/include/pthread.h" 2 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/setjmp.h" 1 3 4
+# 26 "/usr/include/x86_64-linux-gnu/bits/setjmp.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/setjmp.h" 2 3 4
+
+
+
+
+typedef long int __jmp_buf[8];
+# 28 "/usr/include/pthread.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 29 "/usr/include/pthread.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct___jmp_buf_tag.h" 1 3 4
+# 26 "/usr/include/x86_64-linux-gnu/bits/types/struct___jmp_buf_tag.h" 3 4
+struct __jmp_buf_tag
+  {
+
+
+
+
+    __jmp_buf __jmpbuf;
+    int __mask_was_saved;
+    __sigset_t __saved_mask;
+  };
+# 32 "/usr/include/pthread.h" 2 3 4
+
+
+
+
+
+enum
+{
+  PTHREAD_CREATE_JOINABLE,
+
+  PTHREAD_CREATE_DETACHED
+
+};
+
+
+
+enum
+{
+  PTHREAD_MUTEX_TIMED_NP,
+  PTHREAD_MUTEX_RECURSIVE_NP,
+  PTHREAD_MUTEX_ERRORCHECK_NP,
+  PTHREAD_MUTEX_ADAPTIVE_NP
+
+  ,
+  PTHREAD_MUTEX_NORMAL = PTHREAD_MUTEX_TIMED_NP,
+  PTHREAD_MUTEX_RECURSIVE = PTHREAD_MUTEX_RECURSIVE_NP,
+  PTHREAD_MUTEX_ERRORCHECK = PTHREAD_MUTEX_ERRORCHECK_NP,
+  PTHREAD_MUTEX_DEFAULT = PTHREAD_MUTEX_NORMAL
+
+
+
+
+
+};
+
+
+
+
+enum
+{
+  PTHREAD_MUTEX_STALLED,
+  PTHREAD_MUTEX_STALLED_NP = PTHREAD_MUTEX_STALLED,
+  PTHREAD_MUTEX_ROBUST,
+  PTHREAD_MUTEX_ROBUST_NP = PTHREAD_MUTEX_ROBUST
+};
+
+
+
+
+
+enum
+{
+  PTHREAD_PRIO_NONE,
+  PTHREAD_PRIO_INHERIT,
+  PTHREAD_PRIO_PROTECT
+};
+# 104 "/usr/include/pthread.h" 3 4
+enum
+{
+  PTHREAD_RWLOCK_PREFER_READER_NP,
+  PTHREAD_RWLOCK_PREFER_WRITER_NP,
+  PTHREAD_RWLOCK_PREFER_WRITER_NONRECURSIVE_NP,
+  PTHREAD_RWLOCK_DEFAULT_NP = PTHREAD_RWLOCK_PREFER_READER_NP
+};
+# 124 "/usr/include/pthread.h" 3 4
+enum
+{
+  PTHREAD_INHERIT_SCHED,
+
+  PTHREAD_EXPLICIT_SCHED
+
+};
+
+
+
+enum
+{
+  PTHREAD_SCOPE_SYSTEM,
+
+  PTHREAD_SCOPE_PROCESS
+
+};
+
+
+
+enum
+{
+  PTHREAD_PROCESS_PRIVATE,
+
+  PTHREAD_PROCESS_SHARED
+
+};
+# 159 "/usr/include/pthread.h" 3 4
+struct _pthread_cleanup_buffer
+{
+  void (*__routine) (void *);
+  void *__arg;
+  int __canceltype;
+  struct _pthread_cleanup_buffer *__prev;
+};
+
+
+enum
+{
+  PTHREAD_CANCEL_ENABLE,
+
+  PTHREAD_CANCEL_DISABLE
+
+};
+enum
+{
+  PTHREAD_CANCEL_DEFERRED,
+
+  PTHREAD_CANCEL_ASYNCHRONOUS
+
+};
+# 197 "/usr/include/pthread.h" 3 4
+
+
+
+
+
+extern int pthread_create (pthread_t *__restrict __newthread,
+      const pthread_attr_t *__restrict __attr,
+      void *(*__start_routine) (void *),
+      void *__restrict __arg) __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1, 3)));
+
+
+
+
+
+extern void pthread_exit (void *__retval) __attribute__ ((__noreturn__));
+
+
+
+
+
+
+
+extern int pthread_join (pthread_t __th, void **__thread_return);
+# 269 "/usr/include/pthread.h" 3 4
+extern int pthread_detach (pthread_t __th) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern pthread_t pthread_self (void) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern int pthread_equal (pthread_t __thread1, pthread_t __thread2)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+
+
+
+extern int pthread_attr_init (pthread_attr_t *__attr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_attr_destroy (pthread_attr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_attr_getdetachstate (const pthread_attr_t *__attr,
+     int *__detachstate)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_setdetachstate (pthread_attr_t *__attr,
+     int __detachstate)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_attr_getguardsize (const pthread_attr_t *__attr,
+          size_t *__guardsize)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_setguardsize (pthread_attr_t *__attr,
+          size_t __guardsize)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_attr_getschedparam (const pthread_attr_t *__restrict __attr,
+           struct sched_param *__restrict __param)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_setschedparam (pthread_attr_t *__restrict __attr,
+           const struct sched_param *__restrict
+           __param) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_getschedpolicy (const pthread_attr_t *__restrict
+     __attr, int *__restrict __policy)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_setschedpolicy (pthread_attr_t *__attr, int __policy)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_attr_getinheritsched (const pthread_attr_t *__restrict
+      __attr, int *__restrict __inherit)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_setinheritsched (pthread_attr_t *__attr,
+      int __inherit)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_attr_getscope (const pthread_attr_t *__restrict __attr,
+      int *__restrict __scope)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_setscope (pthread_attr_t *__attr, int __scope)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_attr_getstackaddr (const pthread_attr_t *__restrict
+          __attr, void **__restrict __stackaddr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2))) __attribute__ ((__deprecated__));
+
+
+
+
+
+extern int pthread_attr_setstackaddr (pthread_attr_t *__attr,
+          void *__stackaddr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) __attribute__ ((__deprecated__));
+
+
+extern int pthread_attr_getstacksize (const pthread_attr_t *__restrict
+          __attr, size_t *__restrict __stacksize)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern int pthread_attr_setstacksize (pthread_attr_t *__attr,
+          size_t __stacksize)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_attr_getstack (const pthread_attr_t *__restrict __attr,
+      void **__restrict __stackaddr,
+      size_t *__restrict __stacksize)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+
+
+extern int pthread_attr_setstack (pthread_attr_t *__attr, void *__stackaddr,
+      size_t __stacksize) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 441 "/usr/include/pthread.h" 3 4
+extern int pthread_setschedparam (pthread_t __target_thread, int __policy,
+      const struct sched_param *__param)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3)));
+
+
+extern int pthread_getschedparam (pthread_t __target_thread,
+      int *__restrict __policy,
+      struct sched_param *__restrict __param)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+
+
+extern int pthread_setschedprio (pthread_t __target_thread, int __prio)
+     __attribute__ ((__nothrow__ , __leaf__));
+# 509 "/usr/include/pthread.h" 3 4
+extern int pthread_once (pthread_once_t *__once_control,
+    void (*__init_routine) (void)) __attribute__ ((__nonnull__ (1, 2)));
+# 521 "/usr/include/pthread.h" 3 4
+extern int pthread_setcancelstate (int __state, int *__oldstate);
+
+
+
+extern int pthread_setcanceltype (int __type, int *__oldtype);
+
+
+extern int pthread_cancel (pthread_t __th);
+
+
+
+
+extern void pthread_testcancel (void);
+
+
+
+
+struct __cancel_jmp_buf_tag
+{
+  __jmp_buf __cancel_jmp_buf;
+  int __mask_was_saved;
+};
+
+typedef struct
+{
+  struct __cancel_jmp_buf_tag __cancel_jmp_buf[1];
+  void *__pad[4];
+} __pthread_unwind_buf_t __attribute__ ((__aligned__));
+# 557 "/usr/include/pthread.h" 3 4
+struct __pthread_cleanup_frame
+{
+  void (*__cancel_routine) (void *);
+  void *__cancel_arg;
+  int __do_it;
+  int __cancel_type;
+};
+# 697 "/usr/include/pthread.h" 3 4
+extern void __pthread_register_cancel (__pthread_unwind_buf_t *__buf)
+     ;
+# 709 "/usr/include/pthread.h" 3 4
+extern void __pthread_unregister_cancel (__pthread_unwind_buf_t *__buf)
+  ;
+# 750 "/usr/include/pthread.h" 3 4
+extern void __pthread_unwind_next (__pthread_unwind_buf_t *__buf)
+     __attribute__ ((__noreturn__))
+
+     __attribute__ ((__weak__))
+
+     ;
+# 766 "/usr/include/pthread.h" 3 4
+extern int __sigsetjmp_cancel (struct __cancel_jmp_buf_tag __env[1], int __savemask) __asm__ ("" "__sigsetjmp") __attribute__ ((__nothrow__))
+
+
+                     __attribute__ ((__returns_twice__));
+# 781 "/usr/include/pthread.h" 3 4
+extern int pthread_mutex_init (pthread_mutex_t *__mutex,
+          const pthread_mutexattr_t *__mutexattr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutex_destroy (pthread_mutex_t *__mutex)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutex_trylock (pthread_mutex_t *__mutex)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutex_lock (pthread_mutex_t *__mutex)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern int pthread_mutex_timedlock (pthread_mutex_t *__restrict __mutex,
+        const struct timespec *__restrict
+        __abstime) __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1, 2)));
+# 835 "/usr/include/pthread.h" 3 4
+extern int pthread_mutex_unlock (pthread_mutex_t *__mutex)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_mutex_getprioceiling (const pthread_mutex_t *
+      __restrict __mutex,
+      int *__restrict __prioceiling)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern int pthread_mutex_setprioceiling (pthread_mutex_t *__restrict __mutex,
+      int __prioceiling,
+      int *__restrict __old_ceiling)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 3)));
+
+
+
+
+extern int pthread_mutex_consistent (pthread_mutex_t *__mutex)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 874 "/usr/include/pthread.h" 3 4
+extern int pthread_mutexattr_init (pthread_mutexattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutexattr_destroy (pthread_mutexattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutexattr_getpshared (const pthread_mutexattr_t *
+      __restrict __attr,
+      int *__restrict __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_mutexattr_setpshared (pthread_mutexattr_t *__attr,
+      int __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_mutexattr_gettype (const pthread_mutexattr_t *__restrict
+          __attr, int *__restrict __kind)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern int pthread_mutexattr_settype (pthread_mutexattr_t *__attr, int __kind)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_mutexattr_getprotocol (const pthread_mutexattr_t *
+       __restrict __attr,
+       int *__restrict __protocol)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern int pthread_mutexattr_setprotocol (pthread_mutexattr_t *__attr,
+       int __protocol)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutexattr_getprioceiling (const pthread_mutexattr_t *
+          __restrict __attr,
+          int *__restrict __prioceiling)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_mutexattr_setprioceiling (pthread_mutexattr_t *__attr,
+          int __prioceiling)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_mutexattr_getrobust (const pthread_mutexattr_t *__attr,
+     int *__robustness)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+# 946 "/usr/include/pthread.h" 3 4
+extern int pthread_mutexattr_setrobust (pthread_mutexattr_t *__attr,
+     int __robustness)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 967 "/usr/include/pthread.h" 3 4
+extern int pthread_rwlock_init (pthread_rwlock_t *__restrict __rwlock,
+    const pthread_rwlockattr_t *__restrict
+    __attr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlock_destroy (pthread_rwlock_t *__rwlock)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlock_rdlock (pthread_rwlock_t *__rwlock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlock_tryrdlock (pthread_rwlock_t *__rwlock)
+  __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern int pthread_rwlock_timedrdlock (pthread_rwlock_t *__restrict __rwlock,
+           const struct timespec *__restrict
+           __abstime) __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1, 2)));
+# 1023 "/usr/include/pthread.h" 3 4
+extern int pthread_rwlock_wrlock (pthread_rwlock_t *__rwlock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlock_trywrlock (pthread_rwlock_t *__rwlock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern int pthread_rwlock_timedwrlock (pthread_rwlock_t *__restrict __rwlock,
+           const struct timespec *__restrict
+           __abstime) __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1, 2)));
+# 1071 "/usr/include/pthread.h" 3 4
+extern int pthread_rwlock_unlock (pthread_rwlock_t *__rwlock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern int pthread_rwlockattr_init (pthread_rwlockattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlockattr_destroy (pthread_rwlockattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlockattr_getpshared (const pthread_rwlockattr_t *
+       __restrict __attr,
+       int *__restrict __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_rwlockattr_setpshared (pthread_rwlockattr_t *__attr,
+       int __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlockattr_getkind_np (const pthread_rwlockattr_t *
+       __restrict __attr,
+       int *__restrict __pref)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_rwlockattr_setkind_np (pthread_rwlockattr_t *__attr,
+       int __pref) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+extern int pthread_cond_init (pthread_cond_t *__restrict __cond,
+         const pthread_condattr_t *__restrict __cond_attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_cond_destroy (pthread_cond_t *__cond)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_cond_signal (pthread_cond_t *__cond)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_cond_broadcast (pthread_cond_t *__cond)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int pthread_cond_wait (pthread_cond_t *__restrict __cond,
+         pthread_mutex_t *__restrict __mutex)
+     __attribute__ ((__nonnull__ (1, 2)));
+# 1145 "/usr/include/pthread.h" 3 4
+extern int pthread_cond_timedwait (pthread_cond_t *__restrict __cond,
+       pthread_mutex_t *__restrict __mutex,
+       const struct timespec *__restrict __abstime)
+     __attribute__ ((__nonnull__ (1, 2, 3)));
+# 1194 "/usr/include/pthread.h" 3 4
+extern int pthread_condattr_init (pthread_condattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_condattr_destroy (pthread_condattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_condattr_getpshared (const pthread_condattr_t *
+     __restrict __attr,
+     int *__restrict __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_condattr_setpshared (pthread_condattr_t *__attr,
+     int __pshared) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_condattr_getclock (const pthread_condattr_t *
+          __restrict __attr,
+          __clockid_t *__restrict __clock_id)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_condattr_setclock (pthread_condattr_t *__attr,
+          __clockid_t __clock_id)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 1230 "/usr/include/pthread.h" 3 4
+extern int pthread_spin_init (pthread_spinlock_t *__lock, int __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_spin_destroy (pthread_spinlock_t *__lock)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_spin_lock (pthread_spinlock_t *__lock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_spin_trylock (pthread_spinlock_t *__lock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_spin_unlock (pthread_spinlock_t *__lock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int pthread_barrier_init (pthread_barrier_t *__restrict __barrier,
+     const pthread_barrierattr_t *__restrict
+     __attr, unsigned int __count)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_barrier_destroy (pthread_barrier_t *__barrier)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_barrier_wait (pthread_barrier_t *__barrier)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_barrierattr_init (pthread_barrierattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_barrierattr_destroy (pthread_barrierattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_barrierattr_getpshared (const pthread_barrierattr_t *
+        __restrict __attr,
+        int *__restrict __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_barrierattr_setpshared (pthread_barrierattr_t *__attr,
+        int __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 1297 "/usr/include/pthread.h" 3 4
+extern int pthread_key_create (pthread_key_t *__key,
+          void (*__destr_function) (void *))
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_key_delete (pthread_key_t __key) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern void *pthread_getspecific (pthread_key_t __key) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int pthread_setspecific (pthread_key_t __key,
+    const void *__pointer)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__access__ (__none__, 2)));
+
+
+
+
+extern int pthread_getcpuclockid (pthread_t __thread_id,
+      __clockid_t *__clock_id)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+# 1332 "/usr/include/pthread.h" 3 4
+extern int pthread_atfork (void (*__prepare) (void),
+      void (*__parent) (void),
+      void (*__child) (void)) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern __inline __attribute__ ((__gnu_inline__)) int
+__attribute__ ((__nothrow__ , __leaf__)) pthread_equal (pthread_t __thread1, pthread_t __thread2)
+{
+  return __thread1 == __thread2;
+}
+
+
+
+# 25 "src/monitor/image_loader.c" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/limits.h" 1 3 4
+# 26 "src/monitor/image_loader.c" 2
+# 1 "/usr/include/errno.h" 1 3 4
+# 28 "/usr/include/errno.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/errno.h" 1 3 4
+# 26 "/usr/include/x86_64-linux-gnu/bits/errno.h" 3 4
+# 1 "/usr/include/linux/errno.h" 1 3 4
+# 1 "/usr/include/x86_64-linux-gnu/asm/errno.h" 1 3 4
+# 1 "/usr/include/asm-generic/errno.h" 1 3 4
+
+
+
+
+# 1 "/usr/include/asm-generic/errno-base.h" 1 3 4
+# 6 "/usr/include/asm-generic/errno.h" 2 3 4
+# 2 "/usr/include/x86_64-linux-gnu/asm/errno.h" 2 3 4
+# 2 "/usr/include/linux/errno.h" 2 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/errno.h" 2 3 4
+# 29 "/usr/include/errno.h" 2 3 4
+
+
+
+
+
+
+
+
+extern int *__errno_location (void) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+# 52 "/usr/include/errno.h" 3 4
+
+# 27 "src/monitor/image_loader.c" 2
+# 1 "/usr/include/x86_64-linux-gnu/sys/ioctl.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/sys/ioctl.h" 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/ioctls.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/ioctls.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/asm/ioctls.h" 1 3 4
+# 1 "/usr/include/asm-generic/ioctls.h" 1 3 4
+
+
+
+
+# 1 "/usr/include/linux/ioctl.h" 1 3 4
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/asm/ioctl.h" 1 3 4
+# 1 "/usr/include/asm-generic/ioctl.h" 1 3 4
+# 2 "/usr/include/x86_64-linux-gnu/asm/ioctl.h" 2 3 4
+# 6 "/usr/include/linux/ioctl.h" 2 3 4
+# 6 "/usr/include/asm-generic/ioctls.h" 2 3 4
+# 2 "/usr/include/x86_64-linux-gnu/asm/ioctls.h" 2 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/ioctls.h" 2 3 4
+# 27 "/usr/include/x86_64-linux-gnu/sys/ioctl.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/ioctl-types.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/ioctl-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/asm/ioctls.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/ioctl-types.h" 2 3 4
+
+
+struct winsize
+  {
+    unsigned short int ws_row;
+    unsigned short int ws_col;
+    unsigned short int ws_xpixel;
+    unsigned short int ws_ypixel;
+  };
+
+
+struct termio
+  {
+    unsigned short int c_iflag;
+    unsigned short int c_oflag;
+    unsigned short int c_cflag;
+    unsigned short int c_lflag;
+    unsigned char c_line;
+    unsigned char c_cc[8];
+};
+# 30 "/usr/include/x86_64-linux-gnu/sys/ioctl.h" 2 3 4
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/sys/ttydefaults.h" 1 3 4
+# 37 "/usr/include/x86_64-linux-gnu/sys/ioctl.h" 2 3 4
+
+
+
+
+
+extern int ioctl (int __fd, unsigned long int __request, ...) __attribute__ ((__nothrow__ , __leaf__));
+# 53 "/usr/include/x86_64-linux-gnu/sys/ioctl.h" 3 4
+
+# 28 "src/monitor/image_loader.c" 2
+# 1 "/usr/include/x86_64-linux-gnu/sys/mman.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/sys/mman.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 26 "/usr/include/x86_64-linux-gnu/sys/mman.h" 2 3 4
+# 41 "/usr/include/x86_64-linux-gnu/sys/mman.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mman.h" 1 3 4
+# 31 "/usr/include/x86_64-linux-gnu/bits/mman.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mman-map-flags-generic.h" 1 3 4
+# 32 "/usr/include/x86_64-linux-gnu/bits/mman.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/mman-linux.h" 1 3 4
+# 119 "/usr/include/x86_64-linux-gnu/bits/mman-linux.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mman-shared.h" 1 3 4
+# 120 "/usr/include/x86_64-linux-gnu/bits/mman-linux.h" 2 3 4
+# 35 "/usr/include/x86_64-linux-gnu/bits/mman.h" 2 3 4
+# 42 "/usr/include/x86_64-linux-gnu/sys/mman.h" 2 3 4
+
+
+
+
+
+# 57 "/usr/include/x86_64-linux-gnu/sys/mman.h" 3 4
+extern void *mmap (void *__addr, size_t __len, int __prot,
+     int __flags, int __fd, __off_t __offset) __attribute__ ((__nothrow__ , __leaf__));
+# 76 "/usr/include/x86_64-linux-gnu/sys/mman.h" 3 4
+extern int munmap (void *__addr, size_t __len) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern int mprotect (void *__addr, size_t __len, int __prot) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern int msync (void *__addr, size_t __len, int __flags);
+
+
+
+
+extern int madvise (void *__addr, size_t __len, int __advice) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int posix_madvise (void *__addr, size_t __len, int __advice) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern int mlock (const void *__addr, size_t __len) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int munlock (const void *__addr, size_t __len) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern int mlockall (int __flags) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int munlockall (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern int mincore (void *__start, size_t __len, unsigned char *__vec)
+     __attribute__ ((__nothrow__ , __leaf__));
+# 144 "/usr/include/x86_64-linux-gnu/sys/mman.h" 3 4
+extern int shm_open (const char *__name, int __oflag, mode_t __mode);
+
+
+extern int shm_unlink (const char *__name);
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/mman_ext.h" 1 3 4
+# 151 "/usr/include/x86_64-linux-gnu/sys/mman.h" 2 3 4
+
+
+# 29 "src/monitor/image_loader.c" 2
+# 1 "/usr/include/x86_64-linux-gnu/sys/syscall.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/sys/syscall.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/asm/unistd.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/asm/unistd.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/asm/unistd_64.h" 1 3 4
+# 21 "/usr/include/x86_64-linux-gnu/asm/unistd.h" 2 3 4
+# 25 "/usr/include/x86_64-linux-gnu/sys/syscall.h" 2 3 4
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/syscall.h" 1 3 4
+# 30 "/usr/include/x86_64-linux-gnu/sys/syscall.h" 2 3 4
+# 30 "src/monitor/image_loader.c" 2
+# 1 "/usr/include/linux/userfaultfd.h" 1 3 4
+# 13 "/usr/include/linux/userfaultfd.h" 3 4
+# 1 "/usr/include/linux/types.h" 1 3 4
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/asm/types.h" 1 3 4
+# 1 "/usr/include/asm-generic/types.h" 1 3 4
+
+
+
+
+
+
+# 1 "/usr/include/asm-generic/int-ll64.h" 1 3 4
+# 12 "/usr/include/asm-generic/int-ll64.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/asm/bitsperlong.h" 1 3 4
+# 11 "/usr/include/x86_64-linux-gnu/asm/bitsperlong.h" 3 4
+# 1 "/usr/include/asm-generic/bitsperlong.h" 1 3 4
+# 12 "/usr/include/x86_64-linux-gnu/asm/bitsperlong.h" 2 3 4
+# 13 "/usr/include/asm-generic/int-ll64.h" 2 3 4
+
+
+
+
+
+
+
+typedef __signed__ char __s8;
+typedef unsigned char __u8;
+
+typedef __signed__ short __s16;
+typedef unsigned short __u16;
+
+typedef __signed__ int __s32;
+typedef unsigned int __u32;
+
+
+__extension__ typedef __signed__ long long __s64;
+__extension__ typedef unsigned long long __u64;
+# 8 "/usr/include/asm-generic/types.h" 2 3 4
+# 2 "/usr/include/x86_64-linux-gnu/asm/types.h" 2 3 4
+# 6 "/usr/include/linux/types.h" 2 3 4
+
+
+
+# 1 "/usr/include/linux/posix_types.h" 1 3 4
+
+
+
+
+# 1 "/usr/include/linux/stddef.h" 1 3 4
+# 6 "/usr/include/linux/posix_types.h" 2 3 4
+# 25 "/usr/include/linux/posix_types.h" 3 4
+typedef struct {
+ unsigned long fds_bits[1024 / (8 * sizeof(long))];
+} __kernel_fd_set;
+
+
+typedef void (*__kernel_sighandler_t)(int);
+
+
+typedef int __kernel_key_t;
+typedef int __kernel_mqd_t;
+
+# 1 "/usr/include/x86_64-linux-gnu/asm/posix_types.h" 1 3 4
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/asm/posix_types_64.h" 1 3 4
+# 11 "/usr/include/x86_64-linux-gnu/asm/posix_types_64.h" 3 4
+typedef unsigned short __kernel_old_uid_t;
+typedef unsigned short __kernel_old_gid_t;
+
+
+typedef unsigned long __kernel_old_dev_t;
+
+
+# 1 "/usr/include/asm-generic/posix_types.h" 1 3 4
+# 15 "/usr/include/asm-generic/posix_types.h" 3 4
+typedef long __kernel_long_t;
+typedef unsigned long __kernel_ulong_t;
+
+
+
+typedef __kernel_ulong_t __kernel_ino_t;
+
+
+
+typedef unsigned int __kernel_mode_t;
+
+
+
+typedef int __kernel_pid_t;
+
+
+
+typedef int __kernel_ipc_pid_t;
+
+
+
+typedef unsigned int __kernel_uid_t;
+typedef unsigned int __kernel_gid_t;
+
+
+
+typedef __kernel_long_t __kernel_suseconds_t;
+
+
+
+typedef int __kernel_daddr_t;
+
+
+
+typedef unsigned int __kernel_uid32_t;
+typedef unsigned int __kernel_gid32_t;
+# 72 "/usr/include/asm-generic/posix_types.h" 3 4
+typedef __kernel_ulong_t __kernel_size_t;
+typedef __kernel_long_t __kernel_ssize_t;
+typedef __kernel_long_t __kernel_ptrdiff_t;
+
+
+
+
+typedef struct {
+ int val[2];
+} __kernel_fsid_t;
+
+
+
+
+
+typedef __kernel_long_t __kernel_off_t;
+typedef long long __kernel_loff_t;
+typedef __kernel_long_t __kernel_old_time_t;
+typedef __kernel_long_t __kernel_time_t;
+typedef long long __kernel_time64_t;
+typedef __kernel_long_t __kernel_clock_t;
+typedef int __kernel_timer_t;
+typedef int __kernel_clockid_t;
+typedef char * __kernel_caddr_t;
+typedef unsigned short __kernel_uid16_t;
+typedef unsigned short __kernel_gid16_t;
+# 19 "/usr/include/x86_64-linux-gnu/asm/posix_types_64.h" 2 3 4
+# 8 "/usr/include/x86_64-linux-gnu/asm/posix_types.h" 2 3 4
+# 37 "/usr/include/linux/posix_types.h" 2 3 4
+# 10 "/usr/include/linux/types.h" 2 3 4
+# 27 "/usr/include/linux/types.h" 3 4
+typedef __u16 __le16;
+typedef __u16 __be16;
+typedef __u32 __le32;
+typedef __u32 __be32;
+typedef __u64 __le64;
+typedef __u64 __be64;
+
+typedef __u16 __sum16;
+typedef __u32 __wsum;
+# 51 "/usr/include/linux/types.h" 3 4
+typedef unsigned __poll_t;
+# 14 "/usr/include/linux/userfaultfd.h" 2 3 4
+# 95 "/usr/include/linux/userfaultfd.h" 3 4
+struct uffd_msg {
+ __u8 event;
+
+ __u8 reserved1;
+ __u16 reserved2;
+ __u32 reserved3;
+
+ union {
+  struct {
+   __u64 flags;
+   __u64 address;
+   union {
+    __u32 ptid;
+   } feat;
+  } pagefault;
+
+  struct {
+   __u32 ufd;
+  } fork;
+
+  struct {
+   __u64 from;
+   __u64 to;
+   __u64 len;
+  } remap;
+
+  struct {
+   __u64 start;
+   __u64 end;
+  } remove;
+
+  struct {
+
+   __u64 reserved1;
+   __u64 reserved2;
+   __u64 reserved3;
+  } reserved;
+ } arg;
+} __attribute__((packed));
+# 149 "/usr/include/linux/userfaultfd.h" 3 4
+struct uffdio_api {
+
+ __u64 api;
+# 220 "/usr/include/linux/userfaultfd.h" 3 4
+ __u64 features;
+
+ __u64 ioctls;
+};
+
+struct uffdio_range {
+ __u64 start;
+ __u64 len;
+};
+
+struct uffdio_register {
+ struct uffdio_range range;
+
+
+
+ __u64 mode;
+
+
+
+
+
+ __u64 ioctls;
+};
+
+struct uffdio_copy {
+ __u64 dst;
+ __u64 src;
+ __u64 len;
+# 256 "/usr/include/linux/userfaultfd.h" 3 4
+ __u64 mode;
+
+
+
+
+
+ __s64 copy;
+};
+
+struct uffdio_zeropage {
+ struct uffdio_range range;
+
+ __u64 mode;
+
+
+
+
+
+ __s64 zeropage;
+};
+
+struct uffdio_writeprotect {
+ struct uffdio_range range;
+# 294 "/usr/include/linux/userfaultfd.h" 3 4
+ __u64 mode;
+};
+
+struct uffdio_continue {
+ struct uffdio_range range;
+
+ __u64 mode;
+
+
+
+
+
+ __s64 mapped;
+};
+# 31 "src/monitor/image_loader.c" 2
+# 1 "/usr/include/x86_64-linux-gnu/sys/stat.h" 1 3 4
+# 99 "/usr/include/x86_64-linux-gnu/sys/stat.h" 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stat.h" 1 3 4
+# 102 "/usr/include/x86_64-linux-gnu/sys/stat.h" 2 3 4
+# 205 "/usr/include/x86_64-linux-gnu/sys/stat.h" 3 4
+extern int stat (const char *__restrict __file,
+   struct stat *__restrict __buf) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern int fstat (int __fd, struct stat *__buf) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+# 264 "/usr/include/x86_64-linux-gnu/sys/stat.h" 3 4
+extern int fstatat (int __fd, const char *__restrict __file,
+      struct stat *__restrict __buf, int __flag)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+# 313 "/usr/include/x86_64-linux-gnu/sys/stat.h" 3 4
+extern int lstat (const char *__restrict __file,
+    struct stat *__restrict __buf) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+# 352 "/usr/include/x86_64-linux-gnu/sys/stat.h" 3 4
+extern int chmod (const char *__file, __mode_t __mode)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern int lchmod (const char *__file, __mode_t __mode)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern int fchmod (int __fd, __mode_t __mode) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern int fchmodat (int __fd, const char *__file, __mode_t __mode,
+       int __flag)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) ;
+
+
+
+
+
+
+extern __mode_t umask (__mode_t __mask) __attribute__ ((__nothrow__ , __leaf__));
+# 389 "/usr/include/x86_64-linux-gnu/sys/stat.h" 3 4
+extern int mkdir (const char *__path, __mode_t __mode)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern int mkdirat (int __fd, const char *__path, __mode_t __mode)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+
+
+
+extern int mknod (const char *__path, __mode_t __mode, __dev_t __dev)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern int mknodat (int __fd, const char *__path, __mode_t __mode,
+      __dev_t __dev) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+
+
+extern int mkfifo (const char *__path, __mode_t __mode)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern int mkfifoat (int __fd, const char *__path, __mode_t __mode)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+
+
+
+extern int utimensat (int __fd, const char *__path,
+        const struct timespec __times[2],
+        int __flags)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+# 452 "/usr/include/x86_64-linux-gnu/sys/stat.h" 3 4
+extern int futimens (int __fd, const struct timespec __times[2]) __attribute__ ((__nothrow__ , __leaf__));
+# 468 "/usr/include/x86_64-linux-gnu/sys/stat.h" 3 4
+
+# 32 "src/monitor/image_loader.c" 2
+
+# 1 "/root/repo/include/checkpoint/profiling.h" 1
+# 21 "/root/repo/include/checkpoint/profiling.h"
+
+# 21 "/root/repo/include/checkpoint/profiling.h"
+enum ProfilingState {
+    NoProfiling = 0,
+    SimpointProfiling,
+    SimpointCheckpointing,
+    UniformCheckpointing
+};
+
+enum CheckpointFormat {
+    GzCheckpoint = 0,
+    ChunkedCheckpoint,
+};
+
+enum BbvFormat {
+    TextBbv = 0,
+    BinaryBbv,
+};
+
+extern int profiling_state;
+extern 
+# 39 "/root/repo/include/checkpoint/profiling.h" 3 4
+      _Bool 
+# 39 "/root/repo/include/checkpoint/profiling.h"
+           checkpoint_taking;
+extern 
+# 40 "/root/repo/include/checkpoint/profiling.h" 3 4
+      _Bool 
+# 40 "/root/repo/include/checkpoint/profiling.h"
+           checkpoint_restoring;
+extern 
+# 41 "/root/repo/include/checkpoint/profiling.h" 3 4
+      _Bool 
+# 41 "/root/repo/include/checkpoint/profiling.h"
+           checkpoint_native_restore;
+extern 
+# 42 "/root/repo/include/checkpoint/profiling.h" 3 4
+      _Bool 
+# 42 "/root/repo/include/checkpoint/profiling.h"
+           checkpoint_lazy_restore;
+extern char *checkpoint_cache_dir;
+extern uint64_t checkpoint_interval;
+extern int checkpoint_jobs;
+extern int checkpoint_format;
+extern int checkpoint_delta;
+extern int simpoint_cluster_maxk;
+extern int simpoint_bbv_format;
+extern uint64_t simpoint_shard_intervals;
+extern int simpoint_shard_jobs;
+
+extern 
+# 53 "/root/repo/include/checkpoint/profiling.h" 3 4
+      _Bool 
+# 53 "/root/repo/include/checkpoint/profiling.h"
+           profiling_started;
+extern 
+# 54 "/root/repo/include/checkpoint/profiling.h" 3 4
+      _Bool 
+# 54 "/root/repo/include/checkpoint/profiling.h"
+           force_cpt_mmode;
+# 34 "src/monitor/image_loader.c" 2
+# 1 "/root/repo/include/checkpoint/cpt_format.h" 1
+# 40 "/root/repo/include/checkpoint/cpt_format.h"
+typedef struct {
+  char magic[8];
+  uint32_t version;
+  uint32_t chunk_size;
+  uint64_t mem_size;
+  uint64_t inst_count;
+  uint64_t regs_offset;
+  uint64_t index_offset;
+  uint64_t nr_chunks;
+  uint64_t parent_offset;
+} CptHeader;
+
+typedef struct CptRegs {
+  uint64_t pc;
+  uint64_t mode;
+  uint64_t mtime;
+  uint64_t mtimecmp;
+  uint64_t gpr[32];
+  uint64_t fpr[32];
+  uint64_t csr[4096];
+} CptRegs;
+
+typedef struct {
+  uint64_t addr;
+  uint64_t offset;
+  uint64_t size;
+  uint64_t page_mask;
+} CptChunk;
+# 35 "src/monitor/image_loader.c" 2
+
+
+
+
+long load_gz_img(const char *filename) {
+  gzFile compressed_mem = gzopen(filename, "rb");
+  do { if (!(compressed_mem)) { fflush(
+# 41 "src/monitor/image_loader.c" 3 4
+ stdout
+# 41 "src/monitor/image_loader.c"
+ ); fprintf(
+# 41 "src/monitor/image_loader.c" 3 4
+ stderr
+# 41 "src/monitor/image_loader.c"
+ , "\33[1;31m"); fprintf(
+# 41 "src/monitor/image_loader.c" 3 4
+ stderr
+# 41 "src/monitor/image_loader.c"
+ , "Can not open '%s'", filename); fprintf(
+# 41 "src/monitor/image_loader.c" 3 4
+ stderr
+# 41 "src/monitor/image_loader.c"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 41 "src/monitor/image_loader.c" 3 4
+ ((void) sizeof ((
+# 41 "src/monitor/image_loader.c"
+ compressed_mem
+# 41 "src/monitor/image_loader.c" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 41 "src/monitor/image_loader.c"
+ compressed_mem
+# 41 "src/monitor/image_loader.c" 3 4
+ ) ; else __assert_fail (
+# 41 "src/monitor/image_loader.c"
+ "compressed_mem"
+# 41 "src/monitor/image_loader.c" 3 4
+ , "src/monitor/image_loader.c", 41, __extension__ __PRETTY_FUNCTION__); }))
+# 41 "src/monitor/image_loader.c"
+ ; } } while (0);
+
+  const uint32_t chunk_size = 16384;
+  uint8_t *temp_page = (uint8_t *)calloc(chunk_size, sizeof(long));
+  uint8_t *pmem_start = (uint8_t *)guest_to_host((0x80000000 + 0x0));
+  uint8_t *pmem_current;
+
+
+  uint64_t curr_size = 0;
+  while (curr_size < MEMORY_SIZE) {
+    uint32_t bytes_read = gzread(compressed_mem, temp_page, chunk_size);
+    if (bytes_read == 0) {
+      break;
+    }
+    for (uint32_t x = 0; x < bytes_read; x++) {
+      pmem_current = pmem_start + curr_size + x;
+      uint8_t read_data = *(temp_page + x);
+      if (read_data != 0 || *pmem_current != 0) {
+        *pmem_current = read_data;
+      }
+    }
+    curr_size += bytes_read;
+  }
+
+
+  uint32_t left_bytes = gzread(compressed_mem, temp_page, chunk_size);
+  do { if (!(left_bytes == 0)) { fflush(
+# 67 "src/monitor/image_loader.c" 3 4
+ stdout
+# 67 "src/monitor/image_loader.c"
+ ); fprintf(
+# 67 "src/monitor/image_loader.c" 3 4
+ stderr
+# 67 "src/monitor/image_loader.c"
+ , "\33[1;31m"); fprintf(
+# 67 "src/monitor/image_loader.c" 3 4
+ stderr
+# 67 "src/monitor/image_loader.c"
+ , "File size is larger than buf_size!\n"); fprintf(
+# 67 "src/monitor/image_loader.c" 3 4
+ stderr
+# 67 "src/monitor/image_loader.c"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 67 "src/monitor/image_loader.c" 3 4
+ ((void) sizeof ((
+# 67 "src/monitor/image_loader.c"
+ left_bytes == 0
+# 67 "src/monitor/image_loader.c" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 67 "src/monitor/image_loader.c"
+ left_bytes == 0
+# 67 "src/monitor/image_loader.c" 3 4
+ ) ; else __assert_fail (
+# 67 "src/monitor/image_loader.c"
+ "left_bytes == 0"
+# 67 "src/monitor/image_loader.c" 3 4
+ , "src/monitor/image_loader.c", 67, __extension__ __PRETTY_FUNCTION__); }))
+# 67 "src/monitor/image_loader.c"
+ ; } } while (0);
+
+  free(temp_page);
+  do { if (!(!gzclose(compressed_mem))) { fflush(
+# 70 "src/monitor/image_loader.c" 3 4
+ stdout
+# 70 "src/monitor/image_loader.c"
+ ); fprintf(
+# 70 "src/monitor/image_loader.c" 3 4
+ stderr
+# 70 "src/monitor/image_loader.c"
+ , "\33[1;31m"); fprintf(
+# 70 "src/monitor/image_loader.c" 3 4
+ stderr
+# 70 "src/monitor/image_loader.c"
+ , "Error closing '%s'\n", filename); fprintf(
+# 70 "src/monitor/image_loader.c" 3 4
+ stderr
+# 70 "src/monitor/image_loader.c"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 70 "src/monitor/image_loader.c" 3 4
+ ((void) sizeof ((
+# 70 "src/monitor/image_loader.c"
+ !gzclose(compressed_mem)
+# 70 "src/monitor/image_loader.c" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 70 "src/monitor/image_loader.c"
+ !gzclose(compressed_mem)
+# 70 "src/monitor/image_loader.c" 3 4
+ ) ; else __assert_fail (
+# 70 "src/monitor/image_loader.c"
+ "!gzclose(compressed_mem)"
+# 70 "src/monitor/image_loader.c" 3 4
+ , "src/monitor/image_loader.c", 70, __extension__ __PRETTY_FUNCTION__); }))
+# 70 "src/monitor/image_loader.c"
+ ; } } while (0);
+  return curr_size;
+}
+
+static void cpt_read_header(int fd, const char *filename, CptHeader *header) {
+  do { if (!(pread(fd, header, sizeof(*header), 0) == sizeof(*header) && !memcmp(header->magic, "NEMUCPT", sizeof(header->magic)) && header->version == 2 && header->chunk_size == (4096 * 64))) { fflush(
+# 75 "src/monitor/image_loader.c" 3 4
+ stdout
+# 75 "src/monitor/image_loader.c"
+ ); fprintf(
+# 75 "src/monitor/image_loader.c" 3 4
+ stderr
+# 75 "src/monitor/image_loader.c"
+ , "\33[1;31m"); fprintf(
+# 75 "src/monitor/image_loader.c" 3 4
+ stderr
+# 75 "src/monitor/image_loader.c"
+ , "Unsupported checkpoint '%s'", filename); fprintf(
+# 75 "src/monitor/image_loader.c" 3 4
+ stderr
+# 75 "src/monitor/image_loader.c"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 75 "src/monitor/image_loader.c" 3 4
+ ((void) sizeof ((
+# 75 "src/monitor/image_loader.c"
+ pread(fd, header, sizeof(*header), 0) == sizeof(*header) && !memcmp(header->magic, "NEMUCPT", sizeof(header->magic)) && header->version == 2 && header->chunk_size == (4096 * 64)
+# 75 "src/monitor/image_loader.c" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 75 "src/monitor/image_loader.c"
+ pread(fd, header, sizeof(*header), 0) == sizeof(*header) && !memcmp(header->magic, "NEMUCPT", sizeof(header->magic)) && header->version == 2 && header->chunk_size == (4096 * 64)
+# 75 "src/monitor/image_loader.c" 3 4
+ ) ; else __assert_fail (
+# 75 "src/monitor/image_loader.c"
+ "pread(fd, header, sizeof(*header), 0) == sizeof(*header) && !memcmp(header->magic, \"NEMUCPT\", sizeof(header->magic)) && header->version == 2 && header->chunk_size == (4096 * 64)"
+# 75 "src/monitor/image_loader.c" 3 4
+ , "src/monitor/image_loader.c", 75, __extension__ __PRETTY_FUNCTION__); }))
+# 75 "src/monitor/image_loader.c"
+ ; } } while (0)
+
+                                              ;
+  do { if (!(header->mem_size <= MEMORY_SIZE && header->mem_size % 4096 == 0)) { fflush(
+# 78 "src/monitor/image_loader.c" 3 4
+ stdout
+# 78 "src/monitor/image_loader.c"
+ ); fprintf(
+# 78 "src/monitor/image_loader.c" 3 4
+ stderr
+# 78 "src/monitor/image_loader.c"
+ , "\33[1;31m"); fprintf(
+# 78 "src/monitor/image_loader.c" 3 4
+ stderr
+# 78 "src/monitor/image_loader.c"
+ , "Checkpoint size 0x%lx is larger than the memory or not page-aligned", header->mem_size); fprintf(
+# 78 "src/monitor/image_loader.c" 3 4
+ stderr
+# 78 "src/monitor/image_loader.c"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 78 "src/monitor/image_loader.c" 3 4
+ ((void) sizeof ((
+# 78 "src/monitor/image_loader.c"
+ header->mem_size <= MEMORY_SIZE && header->mem_size % 4096 == 0
+# 78 "src/monitor/image_loader.c" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 78 "src/monitor/image_loader.c"
+ header->mem_size <= MEMORY_SIZE && header->mem_size % 4096 == 0
+# 78 "src/monitor/image_loader.c" 3 4
+ ) ; else __assert_fail (
+# 78 "src/monitor/image_loader.c"
+ "header->mem_size <= MEMORY_SIZE && header->mem_size % 4096 == 0"
+# 78 "src/monitor/image_loader.c" 3 4
+ , "src/monitor/image_loader.c", 78, __extension__ __PRETTY_FUNCTION__); }))
+# 78 "src/monitor/image_loader.c"
+ ; } } while (0)
+                                                                                              ;
+}
+
+
+static void cpt_parent_path(int fd, const char *filename, const CptHeader *header, char *parent) {
+  const char *slash = strrchr(filename, '/');
+  int dir_len = slash ? slash - filename + 1 : 0;
+  memcpy(parent, filename, dir_len);
+  ssize_t len = pread(fd, parent + dir_len, 
+# 87 "src/monitor/image_loader.c" 3 4
+                                           4096 
+# 87 "src/monitor/image_loader.c"
+                                                    - dir_len, header->parent_offset);
+  do { if (!(len > 0 && memchr(parent + dir_len, '\0', len))) { fflush(
+# 88 "src/monitor/image_loader.c" 3 4
+ stdout
+# 88 "src/monitor/image_loader.c"
+ ); fprintf(
+# 88 "src/monitor/image_loader.c" 3 4
+ stderr
+# 88 "src/monitor/image_loader.c"
+ , "\33[1;31m"); fprintf(
+# 88 "src/monitor/image_loader.c" 3 4
+ stderr
+# 88 "src/monitor/image_loader.c"
+ , "Can not read the parent of '%s'", filename); fprintf(
+# 88 "src/monitor/image_loader.c" 3 4
+ stderr
+# 88 "src/monitor/image_loader.c"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 88 "src/monitor/image_loader.c" 3 4
+ ((void) sizeof ((
+# 88 "src/monitor/image_loader.c"
+ len > 0 && memchr(parent + dir_len, '\0', len)
+# 88 "src/monitor/image_loader.c" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 88 "src/monitor/image_loader.c"
+ len > 0 && memchr(parent + dir_len, '\0', len)
+# 88 "src/monitor/image_loader.c" 3 4
+ ) ; else __assert_fail (
+# 88 "src/monitor/image_loader.c"
+ "len > 0 && memchr(parent + dir_len, '\\0', len)"
+# 88 "src/monitor/image_loader.c" 3 4
+ , "src/monitor/image_loader.c", 88, __extension__ __PRETTY_FUNCTION__); }))
+# 88 "src/monitor/image_loader.c"
+ ; } } while (0);
+}
+
+
+
+static CptChunk *cpt_read_index(int fd, const char *filename, const CptHeader *header) {
+  struct stat st;
+  do { if (!(fstat(fd, &st) == 0)) { fflush(
+# 95 "src/monitor/image_loader.c" 3 4
+ stdout
+# 95 "src/monitor/image_loader.c"
+ ); fprintf(
+# 95 "src/monitor/image_loader.c" 3 4
+ stderr
+# 95 "src/monitor/image_loader.c"
+ , "\33[1;31m"); fprintf(
+# 95 "src/monitor/image_loader.c" 3 4
+ stderr
+# 95 "src/monitor/image_loader.c"
+ , "Can not stat '%s'", filename); fprintf(
+# 95 "src/monitor/image_loader.c" 3 4
+ stderr
+# 95 "src/monitor/image_loader.c"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 95 "src/monitor/image_loader.c" 3 4
+ ((void) sizeof ((
+# 95 "src/monitor/image_loader.c"
+ fstat(fd, &st) == 0
+# 95 "src/monitor/image_loader.c" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 95 "src/monitor/image_loader.c"
+ fstat(fd, &st) == 0
+# 95 "src/monitor/image_loader.c" 3 4
+ ) ; else __assert_fail (
+# 95 "src/monitor/image_loader.c"
+ "fstat(fd, &st) == 0"
+# 95 "src/monitor/image_loader.c" 3 4
+ , "src/monitor/image_loader.c", 95, __extension__ __PRETTY_FUNCTION__); }))
+# 95 "src/monitor/image_loader.c"
+ ; } } while (0);
+  uint64_t file_size = st.st_size;
+  do { if (!(header->nr_chunks <= (header->mem_size + (4096 * 64) - 1) / (4096 * 64) && header->index_offset <= file_size && header->nr_chunks * sizeof(CptChunk) <= file_size - header->index_offset)) { fflush(
+# 97 "src/monitor/image_loader.c" 3 4
+ stdout
+# 97 "src/monitor/image_loader.c"
+ ); fprintf(
+# 97 "src/monitor/image_loader.c" 3 4
+ stderr
+# 97 "src/monitor/image_loader.c"
+ , "\33[1;31m"); fprintf(
+# 97 "src/monitor/image_loader.c" 3 4
+ stderr
+# 97 "src/monitor/image_loader.c"
+ , "Corrupted chunk index of '%s'", filename); fprintf(
+# 97 "src/monitor/image_loader.c" 3 4
+ stderr
+# 97 "src/monitor/image_loader.c"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 97 "src/monitor/image_loader.c" 3 4
+ ((void) sizeof ((
+# 97 "src/monitor/image_loader.c"
+ header->nr_chunks <= (header->mem_size + (4096 * 64) - 1) / (4096 * 64) && header->index_offset <= file_size && header->nr_chunks * sizeof(CptChunk) <= file_size - header->index_offset
+# 97 "src/monitor/image_loader.c" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 97 "src/monitor/image_loader.c"
+ header->nr_chunks <= (header->mem_size + (4096 * 64) - 1) / (4096 * 64) && header->index_offset <= file_size && header->nr_chunks * sizeof(CptChunk) <= file_size - header->index_offset
+# 97 "src/monitor/image_loader.c" 3 4
+ ) ; else __assert_fail (
+# 97 "src/monitor/image_loader.c"
+ "header->nr_chunks <= (header->mem_size + (4096 * 64) - 1) / (4096 * 64) && header->index_offset <= file_size && header->nr_chunks * sizeof(CptChunk) <= file_size - header->index_offset"
+# 97 "src/monitor/image_loader.c" 3 4
+ , "src/monitor/image_loader.c", 97, __extension__ __PRETTY_FUNCTION__); }))
+# 97 "src/monitor/image_loader.c"
+ ; } } while (0)
+
+
+                                                ;
+
+  size_t index_size = header->nr_chunks * sizeof(CptChunk);
+  CptChunk *index = (CptChunk *)malloc(index_size);
+  do { if (!(pread(fd, index, index_size, header->index_offset) == (ssize_t)index_size)) { fflush(
+# 104 "src/monitor/image_loader.c" 3 4
+ stdout
+# 104 "src/monitor/image_loader.c"
+ ); fprintf(
+# 104 "src/monitor/image_loader.c" 3 4
+ stderr
+# 104 "src/monitor/image_loader.c"
+ , "\33[1;31m"); fprintf(
+# 104 "src/monitor/image_loader.c" 3 4
+ stderr
+# 104 "src/monitor/image_loader.c"
+ , "Can not read the chunk index of '%s'", filename); fprintf(
+# 104 "src/monitor/image_loader.c" 3 4
+ stderr
+# 104 "src/monitor/image_loader.c"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 104 "src/monitor/image_loader.c" 3 4
+ ((void) sizeof ((
+# 104 "src/monitor/image_loader.c"
+ pread(fd, index, index_size, header->index_offset) == (ssize_t)index_size
+# 104 "src/monitor/image_loader.c" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 104 "src/monitor/image_loader.c"
+ pread(fd, index, index_size, header->index_offset) == (ssize_t)index_size
+# 104 "src/monitor/image_loader.c" 3 4
+ ) ; else __assert_fail (
+# 104 "src/monitor/image_loader.c"
+ "pread(fd, index, index_size, header->index_offset) == (ssize_t)index_size"
+# 104 "src/monitor/image_loader.c" 3 4
+ , "src/monitor/image_loader.c", 104, __extension__ __PRETTY_FUNCTION__); }))
+# 104 "src/monitor/image_loader.c"
+ ; } } while (0)
+                                                       ;
+  for (uint64_t i = 0; i < header->nr_chunks; i ++) {
+    const CptChunk *c = &index[i];
+
+
+    do { if (!(c->page_mask != 0 && c->addr % (4096 * 64) == 0 && c->addr < header->mem_size && (64 - __builtin_clzl(c->page_mask)) * 4096 <= header->mem_size - c->addr)) { fflush(
+# 110 "src/monitor/image_loader.c" 3 4
+   stdout
+# 110 "src/monitor/image_loader.c"
+   ); fprintf(
+# 110 "src/monitor/image_loader.c" 3 4
+   stderr
+# 110 "src/monitor/image_loader.c"
+   , "\33[1;31m"); fprintf(
+# 110 "src/monitor/image_loader.c" 3 4
+   stderr
+# 110 "src/monitor/image_loader.c"
+   , "Chunk at 0x%lx is out of the memory of '%s'", c->addr, filename); fprintf(
+# 110 "src/monitor/image_loader.c" 3 4
+   stderr
+# 110 "src/monitor/image_loader.c"
+   , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 110 "src/monitor/image_loader.c" 3 4
+   ((void) sizeof ((
+# 110 "src/monitor/image_loader.c"
+   c->page_mask != 0 && c->addr % (4096 * 64) == 0 && c->addr < header->mem_size && (64 - __builtin_clzl(c->page_mask)) * 4096 <= header->mem_size - c->addr
+# 110 "src/monitor/image_loader.c" 3 4
+   ) ? 1 : 0), __extension__ ({ if (
+# 110 "src/monitor/image_loader.c"
+   c->page_mask != 0 && c->addr % (4096 * 64) == 0 && c->addr < header->mem_size && (64 - __builtin_clzl(c->page_mask)) * 4096 <= header->mem_size - c->addr
+# 110 "src/monitor/image_loader.c" 3 4
+   ) ; else __assert_fail (
+# 110 "src/monitor/image_loader.c"
+   "c->page_mask != 0 && c->addr % (4096 * 64) == 0 && c->addr < header->mem_size && (64 - __builtin_clzl(c->page_mask)) * 4096 <= header->mem_size - c->addr"
+# 110 "src/monitor/image_loader.c" 3 4
+   , "src/monitor/image_loader.c", 110, __extension__ __PRETTY_FUNCTION__); }))
+# 110 "src/monitor/image_loader.c"
+   ; } } while (0)
+
+                                                                         ;
+    do { if (!(c->offset <= file_size && c->size <= file_size - c->offset)) { fflush(
+# 113 "src/monitor/image_loader.c" 3 4
+   stdout
+# 113 "src/monitor/image_loader.c"
+   ); fprintf(
+# 113 "src/monitor/image_loader.c" 3 4
+   stderr
+# 113 "src/monitor/image_loader.c"
+   , "\33[1;31m"); fprintf(
+# 113 "src/monitor/image_loader.c" 3 4
+   stderr
+# 113 "src/monitor/image_loader.c"
+   , "Chunk at 0x%lx is out of '%s'", c->addr, filename); fprintf(
+# 113 "src/monitor/image_loader.c" 3 4
+   stderr
+# 113 "src/monitor/image_loader.c"
+   , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 113 "src/monitor/image_loader.c" 3 4
+   ((void) sizeof ((
+# 113 "src/monitor/image_loader.c"
+   c->offset <= file_size && c->size <= file_size - c->offset
+# 113 "src/monitor/image_loader.c" 3 4
+   ) ? 1 : 0), __extension__ ({ if (
+# 113 "src/monitor/image_loader.c"
+   c->offset <= file_size && c->size <= file_size - c->offset
+# 113 "src/monitor/image_loader.c" 3 4
+   ) ; else __assert_fail (
+# 113 "src/monitor/image_loader.c"
+   "c->offset <= file_size && c->size <= file_size - c->offset"
+# 113 "src/monitor/image_loader.c" 3 4
+   , "src/monitor/image_loader.c", 113, __extension__ __PRETTY_FUNCTION__); }))
+# 113 "src/monitor/image_loader.c"
+   ; } } while (0)
+                                                           ;
+  }
+  return index;
+}
+
+typedef struct {
+  uint8_t *pages;
+  uint8_t *buf;
+  uint64_t buf_size;
+} CptChunkBuf;
+
+
+static void cpt_unpack_chunk(int fd, const CptChunk *c, uint8_t *dst, CptChunkBuf *b) {
+  if (b->pages == 
+# 127 "src/monitor/image_loader.c" 3 4
+                 ((void *)0)
+# 127 "src/monitor/image_loader.c"
+                     ) {
+    b->pages = (uint8_t *)malloc((4096 * 64));
+  }
+  if (c->size > b->buf_size) {
+    b->buf_size = c->size;
+    b->buf = (uint8_t *)realloc(b->buf, b->buf_size);
+  }
+  do { if (!(pread(fd, b->buf, c->size, c->offset) == (ssize_t)c->size)) { fflush(
+# 134 "src/monitor/image_loader.c" 3 4
+ stdout
+# 134 "src/monitor/image_loader.c"
+ ); fprintf(
+# 134 "src/monitor/image_loader.c" 3 4
+ stderr
+# 134 "src/monitor/image_loader.c"
+ , "\33[1;31m"); fprintf(
+# 134 "src/monitor/image_loader.c" 3 4
+ stderr
+# 134 "src/monitor/image_loader.c"
+ , "Can not read chunk at 0x%lx", c->addr); fprintf(
+# 134 "src/monitor/image_loader.c" 3 4
+ stderr
+# 134 "src/monitor/image_loader.c"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 134 "src/monitor/image_loader.c" 3 4
+ ((void) sizeof ((
+# 134 "src/monitor/image_loader.c"
+ pread(fd, b->buf, c->size, c->offset) == (ssize_t)c->size
+# 134 "src/monitor/image_loader.c" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 134 "src/monitor/image_loader.c"
+ pread(fd, b->buf, c->size, c->offset) == (ssize_t)c->size
+# 134 "src/monitor/image_loader.c" 3 4
+ ) ; else __assert_fail (
+# 134 "src/monitor/image_loader.c"
+ "pread(fd, b->buf, c->size, c->offset) == (ssize_t)c->size"
+# 134 "src/monitor/image_loader.c" 3 4
+ , "src/monitor/image_loader.c", 134, __extension__ __PRETTY_FUNCTION__); }))
+# 134 "src/monitor/image_loader.c"
+ ; } } while (0);
+
+
+  
+# 137 "src/monitor/image_loader.c" 3 4
+ _Bool 
+# 137 "src/monitor/image_loader.c"
+      full = c->page_mask == ~0ul;
+  uLongf len = (4096 * 64);
+  int ret = uncompress(full ? dst : b->pages, &len, b->buf, c->size);
+  do { if (!(ret == 
+# 140 "src/monitor/image_loader.c" 3 4
+ 0 
+# 140 "src/monitor/image_loader.c"
+ && len == __builtin_popcountl(c->page_mask) * 4096)) { fflush(
+# 140 "src/monitor/image_loader.c" 3 4
+ stdout
+# 140 "src/monitor/image_loader.c"
+ ); fprintf(
+# 140 "src/monitor/image_loader.c" 3 4
+ stderr
+# 140 "src/monitor/image_loader.c"
+ , "\33[1;31m"); fprintf(
+# 140 "src/monitor/image_loader.c" 3 4
+ stderr
+# 140 "src/monitor/image_loader.c"
+ , "Corrupted chunk at 0x%lx", c->addr); fprintf(
+# 140 "src/monitor/image_loader.c" 3 4
+ stderr
+# 140 "src/monitor/image_loader.c"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 140 "src/monitor/image_loader.c" 3 4
+ ((void) sizeof ((
+# 140 "src/monitor/image_loader.c"
+ ret == 
+# 140 "src/monitor/image_loader.c" 3 4
+ 0 
+# 140 "src/monitor/image_loader.c"
+ && len == __builtin_popcountl(c->page_mask) * 4096
+# 140 "src/monitor/image_loader.c" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 140 "src/monitor/image_loader.c"
+ ret == 
+# 140 "src/monitor/image_loader.c" 3 4
+ 0 
+# 140 "src/monitor/image_loader.c"
+ && len == __builtin_popcountl(c->page_mask) * 4096
+# 140 "src/monitor/image_loader.c" 3 4
+ ) ; else __assert_fail (
+# 140 "src/monitor/image_loader.c"
+ "ret == 0 && len == __builtin_popcountl(c->page_mask) * 4096"
+# 140 "src/monitor/image_loader.c" 3 4
+ , "src/monitor/image_loader.c", 140, __extension__ __PRETTY_FUNCTION__); }))
+# 140 "src/monitor/image_loader.c"
+ ; } } while (0)
+                                          ;
+  if (full) return;
+
+  uint8_t *src = b->pages;
+  for (int p = 0; p < 64; p++) {
+    if (c->page_mask & (1ul << p)) {
+      memcpy(dst + p * 4096, src, 4096);
+      src += 4096;
+    }
+  }
+}
+
+typedef struct {
+  int fd;
+  const CptChunk *index;
+  uint64_t nr_chunks;
+  uint64_t next;
+} CptLoader;
+
+static void *load_cpt_chunks(void *arg) {
+  CptLoader *l = (CptLoader *)arg;
+  uint8_t *pmem_start = (uint8_t *)guest_to_host((0x80000000 + 0x0));
+  CptChunkBuf b = {};
+  uint64_t i;
+  while ((i = __atomic_fetch_add(&l->next, 1, 0)) < l->nr_chunks) {
+    cpt_unpack_chunk(l->fd, &l->index[i], pmem_start + l->index[i].addr, &b);
+  }
+  free(b.buf);
+  free(b.pages);
+  return 
+# 170 "src/monitor/image_loader.c" 3 4
+        ((void *)0)
+# 170 "src/monitor/image_loader.c"
+            ;
+}
+
+
+
+static void cpt_zero_missing(const CptChunk *index, uint64_t nr_chunks, uint64_t mem_size) {
+  uint8_t *pmem_start = (uint8_t *)guest_to_host((0x80000000 + 0x0));
+  uint64_t nr_pages = mem_size / 4096;
+  uint64_t *stored = (uint64_t *)calloc((nr_pages + 64 - 1) / 64, sizeof(uint64_t));
+  for (uint64_t i = 0; i < nr_chunks; i++) {
+    stored[index[i].addr / (4096 * 64)] = index[i].page_mask;
+  }
+
+  for (uint64_t p = 0; p < nr_pages; ) {
+    if (((stored[(p) / 64] >> ((p) % 64)) & 1)) { p++; continue; }
+    uint64_t start = p;
+    while (p < nr_pages && !((stored[(p) / 64] >> ((p) % 64)) & 1)) p++;
+    uint8_t *addr = pmem_start + start * 4096;
+    size_t len = (p - start) * 4096;
+    if (madvise(addr, len, 
+# 189 "src/monitor/image_loader.c" 3 4
+                          4
+# 189 "src/monitor/image_loader.c"
+                                       ) != 0) memset(addr, 0, len);
+  }
+
+  free(stored);
+}
+
+long load_cpt_img(const char *filename) {
+  int fd = open(filename, 
+# 196 "src/monitor/image_loader.c" 3 4
+                         00
+# 196 "src/monitor/image_loader.c"
+                                 );
+  do { if (!(fd >= 0)) { fflush(
+# 197 "src/monitor/image_loader.c" 3 4
+ stdout
+# 197 "src/monitor/image_loader.c"
+ ); fprintf(
+# 197 "src/monitor/image_loader.c" 3 4
+ stderr
+# 197 "src/monitor/image_loader.c"
+ , "\33[1;31m"); fprintf(
+# 197 "src/monitor/image_loader.c" 3 4
+ stderr
+# 197 "src/monitor/image_loader.c"
+ , "Can not open '%s'", filename); fprintf(
+# 197 "src/monitor/image_loader.c" 3 4
+ stderr
+# 197 "src/monitor/image_loader.c"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 197 "src/monitor/image_loader.c" 3 4
+ ((void) sizeof ((
+# 197 "src/monitor/image_loader.c"
+ fd >= 0
+# 197 "src/monitor/image_loader.c" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 197 "src/monitor/image_loader.c"
+ fd >= 0
+# 197 "src/monitor/image_loader.c" 3 4
+ ) ; else __assert_fail (
+# 197 "src/monitor/image_loader.c"
+ "fd >= 0"
+# 197 "src/monitor/image_loader.c" 3 4
+ , "src/monitor/image_loader.c", 197, __extension__ __PRETTY_FUNCTION__); }))
+# 197 "src/monitor/image_loader.c"
+ ; } } while (0);
+  CptHeader header;
+  cpt_read_header(fd, filename, &header);
+
+
+  if (header.parent_offset != 0) {
+    char parent[
+# 203 "src/monitor/image_loader.c" 3 4
+               4096
+# 203 "src/monitor/image_loader.c"
+                       ];
+    cpt_parent_path(fd, filename, &header, parent);
+    do { printf("\33[1;34m[%s:%d,%s] " "Loading the parent checkpoint %s" "\33[0m\n", "src/monitor/image_loader.c", 205, __func__, parent); ; } while (0);
+    load_cpt_img(parent);
+  }
+
+  CptChunk *index = cpt_read_index(fd, filename, &header);
+  if (header.parent_offset == 0) {
+    cpt_zero_missing(index, header.nr_chunks, header.mem_size);
+  }
+
+
+  CptLoader loader = { .fd = fd, .index = index, .nr_chunks = header.nr_chunks, .next = 0 };
+  long nr_threads = sysconf(
+# 216 "src/monitor/image_loader.c" 3 4
+                           _SC_NPROCESSORS_ONLN
+# 216 "src/monitor/image_loader.c"
+                                               );
+  if (nr_threads > 64) nr_threads = 64;
+  if (nr_threads > (long)header.nr_chunks) nr_threads = header.nr_chunks;
+  pthread_t threads[64];
+  for (long t = 1; t < nr_threads; t++) {
+    do { if (!(pthread_create(&threads[t], 
+# 221 "src/monitor/image_loader.c" 3 4
+   ((void *)0)
+# 221 "src/monitor/image_loader.c"
+   , load_cpt_chunks, &loader) == 0)) { fflush(
+# 221 "src/monitor/image_loader.c" 3 4
+   stdout
+# 221 "src/monitor/image_loader.c"
+   ); fprintf(
+# 221 "src/monitor/image_loader.c" 3 4
+   stderr
+# 221 "src/monitor/image_loader.c"
+   , "\33[1;31m"); fprintf(
+# 221 "src/monitor/image_loader.c" 3 4
+   stderr
+# 221 "src/monitor/image_loader.c"
+   , "Can not create loader thread"); fprintf(
+# 221 "src/monitor/image_loader.c" 3 4
+   stderr
+# 221 "src/monitor/image_loader.c"
+   , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 221 "src/monitor/image_loader.c" 3 4
+   ((void) sizeof ((
+# 221 "src/monitor/image_loader.c"
+   pthread_create(&threads[t], 
+# 221 "src/monitor/image_loader.c" 3 4
+   ((void *)0)
+# 221 "src/monitor/image_loader.c"
+   , load_cpt_chunks, &loader) == 0
+# 221 "src/monitor/image_loader.c" 3 4
+   ) ? 1 : 0), __extension__ ({ if (
+# 221 "src/monitor/image_loader.c"
+   pthread_create(&threads[t], 
+# 221 "src/monitor/image_loader.c" 3 4
+   ((void *)0)
+# 221 "src/monitor/image_loader.c"
+   , load_cpt_chunks, &loader) == 0
+# 221 "src/monitor/image_loader.c" 3 4
+   ) ; else __assert_fail (
+# 221 "src/monitor/image_loader.c"
+   "pthread_create(&threads[t], ((void *)0), load_cpt_chunks, &loader) == 0"
+# 221 "src/monitor/image_loader.c" 3 4
+   , "src/monitor/image_loader.c", 221, __extension__ __PRETTY_FUNCTION__); }))
+# 221 "src/monitor/image_loader.c"
+   ; } } while (0);
+  }
+  load_cpt_chunks(&loader);
+  for (long t = 1; t < nr_threads; t++) {
+    pthread_join(threads[t], 
+# 225 "src/monitor/image_loader.c" 3 4
+                            ((void *)0)
+# 225 "src/monitor/image_loader.c"
+                                );
+  }
+  do { printf("\33[1;34m[%s:%d,%s] " "Loaded %lu chunks with %ld threads, taken @ instruction count %lu" "\33[0m\n", "src/monitor/image_loader.c", 227, __func__, header.nr_chunks, nr_threads, header.inst_count); ; } while (0)
+                                                      ;
+
+  free(index);
+  close(fd);
+  return header.mem_size;
+}
+
+
+
+
+typedef struct {
+  int fd;
+  CptChunk *index;
+  int32_t *chunk_idx;
+} CptLazyFile;
+
+static CptLazyFile *lazy_files = 
+# 244 "src/monitor/image_loader.c" 3 4
+                                ((void *)0)
+# 244 "src/monitor/image_loader.c"
+                                    ;
+static int nr_lazy_files = 0;
+static uint64_t nr_pmem_chunks = 0;
+static uint64_t nr_lazy_loaded = 0;
+
+static void cpt_lazy_open(const char *filename) {
+  int fd = open(filename, 
+# 250 "src/monitor/image_loader.c" 3 4
+                         00
+# 250 "src/monitor/image_loader.c"
+                                 );
+  do { if (!(fd >= 0)) { fflush(
+# 251 "src/monitor/image_loader.c" 3 4
+ stdout
+# 251 "src/monitor/image_loader.c"
+ ); fprintf(
+# 251 "src/monitor/image_loader.c" 3 4
+ stderr
+# 251 "src/monitor/image_loader.c"
+ , "\33[1;31m"); fprintf(
+# 251 "src/monitor/image_loader.c" 3 4
+ stderr
+# 251 "src/monitor/image_loader.c"
+ , "Can not open '%s'", filename); fprintf(
+# 251 "src/monitor/image_loader.c" 3 4
+ stderr
+# 251 "src/monitor/image_loader.c"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 251 "src/monitor/image_loader.c" 3 4
+ ((void) sizeof ((
+# 251 "src/monitor/image_loader.c"
+ fd >= 0
+# 251 "src/monitor/image_loader.c" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 251 "src/monitor/image_loader.c"
+ fd >= 0
+# 251 "src/monitor/image_loader.c" 3 4
+ ) ; else __assert_fail (
+# 251 "src/monitor/image_loader.c"
+ "fd >= 0"
+# 251 "src/monitor/image_loader.c" 3 4
+ , "src/monitor/image_loader.c", 251, __extension__ __PRETTY_FUNCTION__); }))
+# 251 "src/monitor/image_loader.c"
+ ; } } while (0);
+  CptHeader header;
+  cpt_read_header(fd, filename, &header);
+  if (header.parent_offset != 0) {
+    char parent[
+# 255 "src/monitor/image_loader.c" 3 4
+               4096
+# 255 "src/monitor/image_loader.c"
+                       ];
+    cpt_parent_path(fd, filename, &header, parent);
+    cpt_lazy_open(parent);
+  }
+
+  lazy_files = (CptLazyFile *)realloc(lazy_files, sizeof(CptLazyFile) * (nr_lazy_files + 1));
+  CptLazyFile *f = &lazy_files[nr_lazy_files ++];
+  f->fd = fd;
+  f->index = cpt_read_index(fd, filename, &header);
+  f->chunk_idx = (int32_t *)malloc(sizeof(int32_t) * nr_pmem_chunks);
+  memset(f->chunk_idx, -1, sizeof(int32_t) * nr_pmem_chunks);
+  for (uint64_t i = 0; i < header.nr_chunks; i ++) {
+    f->chunk_idx[f->index[i].addr / (4096 * 64)] = i;
+  }
+  do { printf("\33[1;34m[%s:%d,%s] " "Opened checkpoint %s with %lu chunks, taken @ instruction count %lu" "\33[0m\n", "src/monitor/image_loader.c", 269, __func__, filename, header.nr_chunks, header.inst_count); ; } while (0)
+                                                    ;
+}
+
+
+
+static int cpt_lazy_ioctl(int uffd, uintptr_t start, uint64_t len, const uint8_t *src, int64_t *done) {
+  int ret;
+  if (src != 
+# 277 "src/monitor/image_loader.c" 3 4
+            ((void *)0)
+# 277 "src/monitor/image_loader.c"
+                ) {
+    struct uffdio_copy copy = { .dst = start, .src = (uintptr_t)src, .len = len, .mode = 0, .copy = 0 };
+    ret = ioctl(uffd, 
+# 279 "src/monitor/image_loader.c" 3 4
+                     (((2U|1U) << (((0 +8)+8)+14)) | (((0xAA)) << (0 +8)) | ((((0x03))) << 0) | ((((sizeof(struct uffdio_copy)))) << ((0 +8)+8)))
+# 279 "src/monitor/image_loader.c"
+                                , &copy);
+    *done = copy.copy;
+  } else {
+    struct uffdio_zeropage zero = { .range = { .start = start, .len = len }, .mode = 0, .zeropage = 0 };
+    ret = ioctl(uffd, 
+# 283 "src/monitor/image_loader.c" 3 4
+                     (((2U|1U) << (((0 +8)+8)+14)) | (((0xAA)) << (0 +8)) | ((((0x04))) << 0) | ((((sizeof(struct uffdio_zeropage)))) << ((0 +8)+8)))
+# 283 "src/monitor/image_loader.c"
+                                    , &zero);
+    *done = zero.zeropage;
+  }
+  return ret;
+}
+
+
+
+static void cpt_lazy_fill(int uffd, uintptr_t start, uint64_t len, const uint8_t *src) {
+  int64_t done;
+  if (cpt_lazy_ioctl(uffd, start, len, src, &done) == 0) return;
+  uint64_t off = done > 0 ? done & ~(uint64_t)(4096 - 1) : 0;
+  for (; off < len; off += 4096) {
+    int ret;
+    while ((ret = cpt_lazy_ioctl(uffd, start + off, 4096, src ? src + off : 
+# 297 "src/monitor/image_loader.c" 3 4
+                                                                                    ((void *)0)
+# 297 "src/monitor/image_loader.c"
+                                                                                        , &done)) != 0 && 
+# 297 "src/monitor/image_loader.c" 3 4
+                                                                                                          (*__errno_location ()) 
+# 297 "src/monitor/image_loader.c"
+                                                                                                                == 
+# 297 "src/monitor/image_loader.c" 3 4
+                                                                                                                   11
+# 297 "src/monitor/image_loader.c"
+                                                                                                                         );
+    do { if (!(ret == 0 || 
+# 298 "src/monitor/image_loader.c" 3 4
+   (*__errno_location ()) 
+# 298 "src/monitor/image_loader.c"
+   == 
+# 298 "src/monitor/image_loader.c" 3 4
+   17
+# 298 "src/monitor/image_loader.c"
+   )) { fflush(
+# 298 "src/monitor/image_loader.c" 3 4
+   stdout
+# 298 "src/monitor/image_loader.c"
+   ); fprintf(
+# 298 "src/monitor/image_loader.c" 3 4
+   stderr
+# 298 "src/monitor/image_loader.c"
+   , "\33[1;31m"); fprintf(
+# 298 "src/monitor/image_loader.c" 3 4
+   stderr
+# 298 "src/monitor/image_loader.c"
+   , "Failed to load the page at host address 0x%lx", start + off); fprintf(
+# 298 "src/monitor/image_loader.c" 3 4
+   stderr
+# 298 "src/monitor/image_loader.c"
+   , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 298 "src/monitor/image_loader.c" 3 4
+   ((void) sizeof ((
+# 298 "src/monitor/image_loader.c"
+   ret == 0 || 
+# 298 "src/monitor/image_loader.c" 3 4
+   (*__errno_location ()) 
+# 298 "src/monitor/image_loader.c"
+   == 
+# 298 "src/monitor/image_loader.c" 3 4
+   17) ? 1 : 0), __extension__ ({ if (
+# 298 "src/monitor/image_loader.c"
+   ret == 0 || 
+# 298 "src/monitor/image_loader.c" 3 4
+   (*__errno_location ()) 
+# 298 "src/monitor/image_loader.c"
+   == 
+# 298 "src/monitor/image_loader.c" 3 4
+   17) ; else __assert_fail (
+# 298 "src/monitor/image_loader.c"
+   "ret == 0 || (*__errno_location ()) == 17"
+# 298 "src/monitor/image_loader.c" 3 4
+   , "src/monitor/image_loader.c", 298, __extension__ __PRETTY_FUNCTION__); }))
+# 298 "src/monitor/image_loader.c"
+   ; } } while (0);
+  }
+}
+
+static void *cpt_lazy_handler(void *arg) {
+  int uffd = (intptr_t)arg;
+  uint8_t *pmem = get_pmem();
+  uint8_t *chunk = (uint8_t *)aligned_alloc(4096, (4096 * 64));
+  uint8_t *loaded = (uint8_t *)calloc(nr_pmem_chunks, 1);
+  CptChunkBuf b = {};
+
+  while (
+# 309 "src/monitor/image_loader.c" 3 4
+        1
+# 309 "src/monitor/image_loader.c"
+            ) {
+    struct uffd_msg msg;
+    ssize_t n = read(uffd, &msg, sizeof(msg));
+    if (n < 0 && 
+# 312 "src/monitor/image_loader.c" 3 4
+                (*__errno_location ()) 
+# 312 "src/monitor/image_loader.c"
+                      == 
+# 312 "src/monitor/image_loader.c" 3 4
+                         4
+# 312 "src/monitor/image_loader.c"
+                              ) continue;
+    do { if (!(n == sizeof(msg))) { fflush(
+# 313 "src/monitor/image_loader.c" 3 4
+   stdout
+# 313 "src/monitor/image_loader.c"
+   ); fprintf(
+# 313 "src/monitor/image_loader.c" 3 4
+   stderr
+# 313 "src/monitor/image_loader.c"
+   , "\33[1;31m"); fprintf(
+# 313 "src/monitor/image_loader.c" 3 4
+   stderr
+# 313 "src/monitor/image_loader.c"
+   , "Failed to read userfaultfd"); fprintf(
+# 313 "src/monitor/image_loader.c" 3 4
+   stderr
+# 313 "src/monitor/image_loader.c"
+   , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 313 "src/monitor/image_loader.c" 3 4
+   ((void) sizeof ((
+# 313 "src/monitor/image_loader.c"
+   n == sizeof(msg)
+# 313 "src/monitor/image_loader.c" 3 4
+   ) ? 1 : 0), __extension__ ({ if (
+# 313 "src/monitor/image_loader.c"
+   n == sizeof(msg)
+# 313 "src/monitor/image_loader.c" 3 4
+   ) ; else __assert_fail (
+# 313 "src/monitor/image_loader.c"
+   "n == sizeof(msg)"
+# 313 "src/monitor/image_loader.c" 3 4
+   , "src/monitor/image_loader.c", 313, __extension__ __PRETTY_FUNCTION__); }))
+# 313 "src/monitor/image_loader.c"
+   ; } } while (0);
+    if (msg.event != 
+# 314 "src/monitor/image_loader.c" 3 4
+                    0x12
+# 314 "src/monitor/image_loader.c"
+                                        ) continue;
+
+    uint64_t i = (msg.arg.pagefault.address - (uintptr_t)pmem) / (4096 * 64);
+    uint64_t len = MEMORY_SIZE - i * (4096 * 64);
+    if (len > (4096 * 64)) len = (4096 * 64);
+    struct uffdio_range range = { .start = (uintptr_t)pmem + i * (4096 * 64), .len = len };
+    if (loaded[i]) {
+
+      ioctl(uffd, 
+# 322 "src/monitor/image_loader.c" 3 4
+                 (((2U) << (((0 +8)+8)+14)) | (((0xAA)) << (0 +8)) | ((((0x02))) << 0) | ((((sizeof(struct uffdio_range)))) << ((0 +8)+8)))
+# 322 "src/monitor/image_loader.c"
+                            , &range);
+      continue;
+    }
+
+    
+# 326 "src/monitor/image_loader.c" 3 4
+   _Bool 
+# 326 "src/monitor/image_loader.c"
+        stored = 
+# 326 "src/monitor/image_loader.c" 3 4
+                 0
+# 326 "src/monitor/image_loader.c"
+                      ;
+    for (int f = 0; f < nr_lazy_files; f ++) {
+      int32_t idx = lazy_files[f].chunk_idx[i];
+      if (idx < 0) continue;
+      if (!stored) memset(chunk, 0, (4096 * 64));
+      stored = 
+# 331 "src/monitor/image_loader.c" 3 4
+              1
+# 331 "src/monitor/image_loader.c"
+                  ;
+      cpt_unpack_chunk(lazy_files[f].fd, &lazy_files[f].index[idx], chunk, &b);
+    }
+    cpt_lazy_fill(uffd, range.start, len, stored ? chunk : 
+# 334 "src/monitor/image_loader.c" 3 4
+                                                          ((void *)0)
+# 334 "src/monitor/image_loader.c"
+                                                              );
+
+    loaded[i] = 1;
+    __atomic_fetch_add(&nr_lazy_loaded, 1, 0);
+  }
+  return 
+# 339 "src/monitor/image_loader.c" 3 4
+        ((void *)0)
+# 339 "src/monitor/image_loader.c"
+            ;
+}
+
+static void cpt_lazy_statistic() {
+  do { printf("\33[1;34m[%s:%d,%s] " "Lazily loaded %lu of %lu chunks of the checkpoint" "\33[0m\n", "src/monitor/image_loader.c", 343, __func__, nr_lazy_loaded, nr_pmem_chunks); ; } while (0);
+}
+
+long load_cpt_img_lazy(const char *filename) {
+  int uffd = syscall(
+# 347 "src/monitor/image_loader.c" 3 4
+                    323
+# 347 "src/monitor/image_loader.c"
+                                   , 
+# 347 "src/monitor/image_loader.c" 3 4
+                                     02000000
+# 347 "src/monitor/image_loader.c"
+                                              );
+  struct uffdio_api api = { .api = 
+# 348 "src/monitor/image_loader.c" 3 4
+                                  ((__u64)0xAA)
+# 348 "src/monitor/image_loader.c"
+                                          , .features = 0 };
+  if (uffd < 0 || ioctl(uffd, 
+# 349 "src/monitor/image_loader.c" 3 4
+                             (((2U|1U) << (((0 +8)+8)+14)) | (((0xAA)) << (0 +8)) | ((((0x3F))) << 0) | ((((sizeof(struct uffdio_api)))) << ((0 +8)+8)))
+# 349 "src/monitor/image_loader.c"
+                                       , &api) != 0) {
+    do { printf("\33[1;34m[%s:%d,%s] " "userfaultfd is not available, load the checkpoint eagerly" "\33[0m\n", "src/monitor/image_loader.c", 350, __func__); ; } while (0);
+    if (uffd >= 0) close(uffd);
+    return load_cpt_img(filename);
+  }
+
+  nr_pmem_chunks = (MEMORY_SIZE + (4096 * 64) - 1) / (4096 * 64);
+  cpt_lazy_open(filename);
+
+
+
+  uint8_t *pmem = get_pmem();
+  do { if (!(madvise(pmem, MEMORY_SIZE, 
+# 361 "src/monitor/image_loader.c" 3 4
+ 4
+# 361 "src/monitor/image_loader.c"
+ ) == 0)) { fflush(
+# 361 "src/monitor/image_loader.c" 3 4
+ stdout
+# 361 "src/monitor/image_loader.c"
+ ); fprintf(
+# 361 "src/monitor/image_loader.c" 3 4
+ stderr
+# 361 "src/monitor/image_loader.c"
+ , "\33[1;31m"); fprintf(
+# 361 "src/monitor/image_loader.c" 3 4
+ stderr
+# 361 "src/monitor/image_loader.c"
+ , "Failed to drop the pages of pmem"); fprintf(
+# 361 "src/monitor/image_loader.c" 3 4
+ stderr
+# 361 "src/monitor/image_loader.c"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 361 "src/monitor/image_loader.c" 3 4
+ ((void) sizeof ((
+# 361 "src/monitor/image_loader.c"
+ madvise(pmem, MEMORY_SIZE, 
+# 361 "src/monitor/image_loader.c" 3 4
+ 4
+# 361 "src/monitor/image_loader.c"
+ ) == 0
+# 361 "src/monitor/image_loader.c" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 361 "src/monitor/image_loader.c"
+ madvise(pmem, MEMORY_SIZE, 
+# 361 "src/monitor/image_loader.c" 3 4
+ 4
+# 361 "src/monitor/image_loader.c"
+ ) == 0
+# 361 "src/monitor/image_loader.c" 3 4
+ ) ; else __assert_fail (
+# 361 "src/monitor/image_loader.c"
+ "madvise(pmem, MEMORY_SIZE, 4) == 0"
+# 361 "src/monitor/image_loader.c" 3 4
+ , "src/monitor/image_loader.c", 361, __extension__ __PRETTY_FUNCTION__); }))
+# 361 "src/monitor/image_loader.c"
+ ; } } while (0);
+  struct uffdio_register reg = {
+    .range = { .start = (uintptr_t)pmem, .len = MEMORY_SIZE },
+    .mode = 
+# 364 "src/monitor/image_loader.c" 3 4
+           ((__u64)1<<0)
+# 364 "src/monitor/image_loader.c"
+                                       ,
+  };
+  do { if (!(ioctl(uffd, 
+# 366 "src/monitor/image_loader.c" 3 4
+ (((2U|1U) << (((0 +8)+8)+14)) | (((0xAA)) << (0 +8)) | ((((0x00))) << 0) | ((((sizeof(struct uffdio_register)))) << ((0 +8)+8)))
+# 366 "src/monitor/image_loader.c"
+ , &reg) == 0)) { fflush(
+# 366 "src/monitor/image_loader.c" 3 4
+ stdout
+# 366 "src/monitor/image_loader.c"
+ ); fprintf(
+# 366 "src/monitor/image_loader.c" 3 4
+ stderr
+# 366 "src/monitor/image_loader.c"
+ , "\33[1;31m"); fprintf(
+# 366 "src/monitor/image_loader.c" 3 4
+ stderr
+# 366 "src/monitor/image_loader.c"
+ , "Failed to register pmem to userfaultfd"); fprintf(
+# 366 "src/monitor/image_loader.c" 3 4
+ stderr
+# 366 "src/monitor/image_loader.c"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 366 "src/monitor/image_loader.c" 3 4
+ ((void) sizeof ((
+# 366 "src/monitor/image_loader.c"
+ ioctl(uffd, 
+# 366 "src/monitor/image_loader.c" 3 4
+ (((2U|1U) << (((0 +8)+8)+14)) | (((0xAA)) << (0 +8)) | ((((0x00))) << 0) | ((((sizeof(struct uffdio_register)))) << ((0 +8)+8)))
+# 366 "src/monitor/image_loader.c"
+ , &reg) == 0
+# 366 "src/monitor/image_loader.c" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 366 "src/monitor/image_loader.c"
+ ioctl(uffd, 
+# 366 "src/monitor/image_loader.c" 3 4
+ (((2U|1U) << (((0 +8)+8)+14)) | (((0xAA)) << (0 +8)) | ((((0x00))) << 0) | ((((sizeof(struct uffdio_register)))) << ((0 +8)+8)))
+# 366 "src/monitor/image_loader.c"
+ , &reg) == 0
+# 366 "src/monitor/image_loader.c" 3 4
+ ) ; else __assert_fail (
+# 366 "src/monitor/image_loader.c"
+ "ioctl(uffd, (((2U|1U) << (((0+8)+8)+14)) | (((0xAA)) << (0+8)) | ((((0x00))) << 0) | ((((sizeof(struct uffdio_register)))) << ((0+8)+8))), &reg) == 0"
+# 366 "src/monitor/image_loader.c" 3 4
+ , "src/monitor/image_loader.c", 366, __extension__ __PRETTY_FUNCTION__); }))
+# 366 "src/monitor/image_loader.c"
+ ; } } while (0);
+
+  pthread_t thread;
+  do { if (!(pthread_create(&thread, 
+# 369 "src/monitor/image_loader.c" 3 4
+ ((void *)0)
+# 369 "src/monitor/image_loader.c"
+ , cpt_lazy_handler, (void *)(intptr_t)uffd) == 0)) { fflush(
+# 369 "src/monitor/image_loader.c" 3 4
+ stdout
+# 369 "src/monitor/image_loader.c"
+ ); fprintf(
+# 369 "src/monitor/image_loader.c" 3 4
+ stderr
+# 369 "src/monitor/image_loader.c"
+ , "\33[1;31m"); fprintf(
+# 369 "src/monitor/image_loader.c" 3 4
+ stderr
+# 369 "src/monitor/image_loader.c"
+ , "Can not create the lazy loader thread"); fprintf(
+# 369 "src/monitor/image_loader.c" 3 4
+ stderr
+# 369 "src/monitor/image_loader.c"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 369 "src/monitor/image_loader.c" 3 4
+ ((void) sizeof ((
+# 369 "src/monitor/image_loader.c"
+ pthread_create(&thread, 
+# 369 "src/monitor/image_loader.c" 3 4
+ ((void *)0)
+# 369 "src/monitor/image_loader.c"
+ , cpt_lazy_handler, (void *)(intptr_t)uffd) == 0
+# 369 "src/monitor/image_loader.c" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 369 "src/monitor/image_loader.c"
+ pthread_create(&thread, 
+# 369 "src/monitor/image_loader.c" 3 4
+ ((void *)0)
+# 369 "src/monitor/image_loader.c"
+ , cpt_lazy_handler, (void *)(intptr_t)uffd) == 0
+# 369 "src/monitor/image_loader.c" 3 4
+ ) ; else __assert_fail (
+# 369 "src/monitor/image_loader.c"
+ "pthread_create(&thread, ((void *)0), cpt_lazy_handler, (void *)(intptr_t)uffd) == 0"
+# 369 "src/monitor/image_loader.c" 3 4
+ , "src/monitor/image_loader.c", 369, __extension__ __PRETTY_FUNCTION__); }))
+# 369 "src/monitor/image_loader.c"
+ ; } } while (0)
+                                              ;
+  pthread_detach(thread);
+  atexit(cpt_lazy_statistic);
+  return MEMORY_SIZE;
+}
+
+
+
+static 
+# 378 "src/monitor/image_loader.c" 3 4
+      _Bool 
+# 378 "src/monitor/image_loader.c"
+           is_cpt_file(const char *filename) {
+  char magic[sizeof("NEMUCPT")] = {};
+  FILE *fp = fopen(filename, "rb");
+  if (fp == 
+# 381 "src/monitor/image_loader.c" 3 4
+           ((void *)0)
+# 381 "src/monitor/image_loader.c"
+               ) {
+    return 
+# 382 "src/monitor/image_loader.c" 3 4
+          0
+# 382 "src/monitor/image_loader.c"
+               ;
+  }
+  
+# 384 "src/monitor/image_loader.c" 3 4
+ _Bool 
+# 384 "src/monitor/image_loader.c"
+      ret = fread(magic, sizeof(magic), 1, fp) == 1 && !memcmp(magic, "NEMUCPT", sizeof(magic));
+  fclose(fp);
+  return ret;
+}
+
+
+
+# 390 "src/monitor/image_loader.c" 3 4
+_Bool 
+# 390 "src/monitor/image_loader.c"
+    load_cpt_regs(const char *filename, CptRegs *regs) {
+  if (!is_cpt_file(filename)) {
+    return 
+# 392 "src/monitor/image_loader.c" 3 4
+          0
+# 392 "src/monitor/image_loader.c"
+               ;
+  }
+  int fd = open(filename, 
+# 394 "src/monitor/image_loader.c" 3 4
+                         00
+# 394 "src/monitor/image_loader.c"
+                                 );
+  do { if (!(fd >= 0)) { fflush(
+# 395 "src/monitor/image_loader.c" 3 4
+ stdout
+# 395 "src/monitor/image_loader.c"
+ ); fprintf(
+# 395 "src/monitor/image_loader.c" 3 4
+ stderr
+# 395 "src/monitor/image_loader.c"
+ , "\33[1;31m"); fprintf(
+# 395 "src/monitor/image_loader.c" 3 4
+ stderr
+# 395 "src/monitor/image_loader.c"
+ , "Can not open '%s'", filename); fprintf(
+# 395 "src/monitor/image_loader.c" 3 4
+ stderr
+# 395 "src/monitor/image_loader.c"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 395 "src/monitor/image_loader.c" 3 4
+ ((void) sizeof ((
+# 395 "src/monitor/image_loader.c"
+ fd >= 0
+# 395 "src/monitor/image_loader.c" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 395 "src/monitor/image_loader.c"
+ fd >= 0
+# 395 "src/monitor/image_loader.c" 3 4
+ ) ; else __assert_fail (
+# 395 "src/monitor/image_loader.c"
+ "fd >= 0"
+# 395 "src/monitor/image_loader.c" 3 4
+ , "src/monitor/image_loader.c", 395, __extension__ __PRETTY_FUNCTION__); }))
+# 395 "src/monitor/image_loader.c"
+ ; } } while (0);
+  CptHeader header;
+  do { if (!(pread(fd, &header, sizeof(header), 0) == sizeof(header) && header.version == 2 && pread(fd, regs, sizeof(*regs), header.regs_offset) == sizeof(*regs))) { fflush(
+# 397 "src/monitor/image_loader.c" 3 4
+ stdout
+# 397 "src/monitor/image_loader.c"
+ ); fprintf(
+# 397 "src/monitor/image_loader.c" 3 4
+ stderr
+# 397 "src/monitor/image_loader.c"
+ , "\33[1;31m"); fprintf(
+# 397 "src/monitor/image_loader.c" 3 4
+ stderr
+# 397 "src/monitor/image_loader.c"
+ , "Can not read the registers of '%s'", filename); fprintf(
+# 397 "src/monitor/image_loader.c" 3 4
+ stderr
+# 397 "src/monitor/image_loader.c"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 397 "src/monitor/image_loader.c" 3 4
+ ((void) sizeof ((
+# 397 "src/monitor/image_loader.c"
+ pread(fd, &header, sizeof(header), 0) == sizeof(header) && header.version == 2 && pread(fd, regs, sizeof(*regs), header.regs_offset) == sizeof(*regs)
+# 397 "src/monitor/image_loader.c" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 397 "src/monitor/image_loader.c"
+ pread(fd, &header, sizeof(header), 0) == sizeof(header) && header.version == 2 && pread(fd, regs, sizeof(*regs), header.regs_offset) == sizeof(*regs)
+# 397 "src/monitor/image_loader.c" 3 4
+ ) ; else __assert_fail (
+# 397 "src/monitor/image_loader.c"
+ "pread(fd, &header, sizeof(header), 0) == sizeof(header) && header.version == 2 && pread(fd, regs, sizeof(*regs), header.regs_offset) == sizeof(*regs)"
+# 397 "src/monitor/image_loader.c" 3 4
+ , "src/monitor/image_loader.c", 397, __extension__ __PRETTY_FUNCTION__); }))
+# 397 "src/monitor/image_loader.c"
+ ; } } while (0)
+
+                                                     ;
+  close(fd);
+  return 
+# 401 "src/monitor/image_loader.c" 3 4
+        1
+# 401 "src/monitor/image_loader.c"
+            ;
+}
+
+
+
+
+
+
+static void cpt_cache_hash(const char *filename, uint32_t *crc, uint32_t *adler) {
+  int fd = open(filename, 
+# 410 "src/monitor/image_loader.c" 3 4
+                         00
+# 410 "src/monitor/image_loader.c"
+                                 );
+  do { if (!(fd >= 0)) { fflush(
+# 411 "src/monitor/image_loader.c" 3 4
+ stdout
+# 411 "src/monitor/image_loader.c"
+ ); fprintf(
+# 411 "src/monitor/image_loader.c" 3 4
+ stderr
+# 411 "src/monitor/image_loader.c"
+ , "\33[1;31m"); fprintf(
+# 411 "src/monitor/image_loader.c" 3 4
+ stderr
+# 411 "src/monitor/image_loader.c"
+ , "Can not open '%s'", filename); fprintf(
+# 411 "src/monitor/image_loader.c" 3 4
+ stderr
+# 411 "src/monitor/image_loader.c"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 411 "src/monitor/image_loader.c" 3 4
+ ((void) sizeof ((
+# 411 "src/monitor/image_loader.c"
+ fd >= 0
+# 411 "src/monitor/image_loader.c" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 411 "src/monitor/image_loader.c"
+ fd >= 0
+# 411 "src/monitor/image_loader.c" 3 4
+ ) ; else __assert_fail (
+# 411 "src/monitor/image_loader.c"
+ "fd >= 0"
+# 411 "src/monitor/image_loader.c" 3 4
+ , "src/monitor/image_loader.c", 411, __extension__ __PRETTY_FUNCTION__); }))
+# 411 "src/monitor/image_loader.c"
+ ; } } while (0);
+  if (is_cpt_file(filename)) {
+    CptHeader header;
+    cpt_read_header(fd, filename, &header);
+    if (header.parent_offset != 0) {
+      char parent[
+# 416 "src/monitor/image_loader.c" 3 4
+                 4096
+# 416 "src/monitor/image_loader.c"
+                         ];
+      cpt_parent_path(fd, filename, &header, parent);
+      cpt_cache_hash(parent, crc, adler);
+    }
+  }
+
+  const size_t buf_size = 1 << 20;
+  uint8_t *buf = (uint8_t *)malloc(buf_size);
+  ssize_t len;
+  while ((len = read(fd, buf, buf_size)) > 0) {
+    *crc = crc32(*crc, buf, len);
+    *adler = adler32(*adler, buf, len);
+  }
+  do { if (!(len == 0)) { fflush(
+# 429 "src/monitor/image_loader.c" 3 4
+ stdout
+# 429 "src/monitor/image_loader.c"
+ ); fprintf(
+# 429 "src/monitor/image_loader.c" 3 4
+ stderr
+# 429 "src/monitor/image_loader.c"
+ , "\33[1;31m"); fprintf(
+# 429 "src/monitor/image_loader.c" 3 4
+ stderr
+# 429 "src/monitor/image_loader.c"
+ , "Can not read '%s'", filename); fprintf(
+# 429 "src/monitor/image_loader.c" 3 4
+ stderr
+# 429 "src/monitor/image_loader.c"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 429 "src/monitor/image_loader.c" 3 4
+ ((void) sizeof ((
+# 429 "src/monitor/image_loader.c"
+ len == 0
+# 429 "src/monitor/image_loader.c" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 429 "src/monitor/image_loader.c"
+ len == 0
+# 429 "src/monitor/image_loader.c" 3 4
+ ) ; else __assert_fail (
+# 429 "src/monitor/image_loader.c"
+ "len == 0"
+# 429 "src/monitor/image_loader.c" 3 4
+ , "src/monitor/image_loader.c", 429, __extension__ __PRETTY_FUNCTION__); }))
+# 429 "src/monitor/image_loader.c"
+ ; } } while (0);
+  free(buf);
+  close(fd);
+}
+
+static 
+# 434 "src/monitor/image_loader.c" 3 4
+      _Bool 
+# 434 "src/monitor/image_loader.c"
+           is_zero_page(const uint8_t *page) {
+  const uint64_t *p = (const uint64_t *)page;
+  for (int i = 0; i < 4096 / sizeof(uint64_t); i ++) {
+    if (p[i] != 0) return 
+# 437 "src/monitor/image_loader.c" 3 4
+                         0
+# 437 "src/monitor/image_loader.c"
+                              ;
+  }
+  return 
+# 439 "src/monitor/image_loader.c" 3 4
+        1
+# 439 "src/monitor/image_loader.c"
+            ;
+}
+
+
+
+static void cpt_cache_fill(const char *filename, const char *path) {
+  uint8_t *pmem = get_pmem();
+  if (is_cpt_file(filename)) load_cpt_img(filename);
+  else load_gz_img(filename);
+
+  char tmp[
+# 449 "src/monitor/image_loader.c" 3 4
+          4096 
+# 449 "src/monitor/image_loader.c"
+                   + 8];
+  snprintf(tmp, sizeof(tmp), "%s.XXXXXX", path);
+  int fd = mkstemp(tmp);
+  do { if (!(fd >= 0)) { fflush(
+# 452 "src/monitor/image_loader.c" 3 4
+ stdout
+# 452 "src/monitor/image_loader.c"
+ ); fprintf(
+# 452 "src/monitor/image_loader.c" 3 4
+ stderr
+# 452 "src/monitor/image_loader.c"
+ , "\33[1;31m"); fprintf(
+# 452 "src/monitor/image_loader.c" 3 4
+ stderr
+# 452 "src/monitor/image_loader.c"
+ , "Can not create '%s'", tmp); fprintf(
+# 452 "src/monitor/image_loader.c" 3 4
+ stderr
+# 452 "src/monitor/image_loader.c"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 452 "src/monitor/image_loader.c" 3 4
+ ((void) sizeof ((
+# 452 "src/monitor/image_loader.c"
+ fd >= 0
+# 452 "src/monitor/image_loader.c" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 452 "src/monitor/image_loader.c"
+ fd >= 0
+# 452 "src/monitor/image_loader.c" 3 4
+ ) ; else __assert_fail (
+# 452 "src/monitor/image_loader.c"
+ "fd >= 0"
+# 452 "src/monitor/image_loader.c" 3 4
+ , "src/monitor/image_loader.c", 452, __extension__ __PRETTY_FUNCTION__); }))
+# 452 "src/monitor/image_loader.c"
+ ; } } while (0);
+  for (uint64_t start = 0; start < MEMORY_SIZE; ) {
+    if (is_zero_page(pmem + start)) {
+      start += 4096;
+      continue;
+    }
+    uint64_t end = start + 4096;
+    while (end < MEMORY_SIZE && !is_zero_page(pmem + end)) end += 4096;
+    for (uint64_t off = start; off < end; ) {
+      ssize_t len = pwrite(fd, pmem + off, end - off, off);
+      do { if (!(len > 0)) { fflush(
+# 462 "src/monitor/image_loader.c" 3 4
+     stdout
+# 462 "src/monitor/image_loader.c"
+     ); fprintf(
+# 462 "src/monitor/image_loader.c" 3 4
+     stderr
+# 462 "src/monitor/image_loader.c"
+     , "\33[1;31m"); fprintf(
+# 462 "src/monitor/image_loader.c" 3 4
+     stderr
+# 462 "src/monitor/image_loader.c"
+     , "Write failed on '%s'", tmp); fprintf(
+# 462 "src/monitor/image_loader.c" 3 4
+     stderr
+# 462 "src/monitor/image_loader.c"
+     , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 462 "src/monitor/image_loader.c" 3 4
+     ((void) sizeof ((
+# 462 "src/monitor/image_loader.c"
+     len > 0
+# 462 "src/monitor/image_loader.c" 3 4
+     ) ? 1 : 0), __extension__ ({ if (
+# 462 "src/monitor/image_loader.c"
+     len > 0
+# 462 "src/monitor/image_loader.c" 3 4
+     ) ; else __assert_fail (
+# 462 "src/monitor/image_loader.c"
+     "len > 0"
+# 462 "src/monitor/image_loader.c" 3 4
+     , "src/monitor/image_loader.c", 462, __extension__ __PRETTY_FUNCTION__); }))
+# 462 "src/monitor/image_loader.c"
+     ; } } while (0);
+      off += len;
+    }
+    start = end;
+  }
+  do { if (!(ftruncate(fd, MEMORY_SIZE) == 0 && fchmod(fd, 0644) == 0 && rename(tmp, path) == 0)) { fflush(
+# 467 "src/monitor/image_loader.c" 3 4
+ stdout
+# 467 "src/monitor/image_loader.c"
+ ); fprintf(
+# 467 "src/monitor/image_loader.c" 3 4
+ stderr
+# 467 "src/monitor/image_loader.c"
+ , "\33[1;31m"); fprintf(
+# 467 "src/monitor/image_loader.c" 3 4
+ stderr
+# 467 "src/monitor/image_loader.c"
+ , "Can not write '%s'", path); fprintf(
+# 467 "src/monitor/image_loader.c" 3 4
+ stderr
+# 467 "src/monitor/image_loader.c"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 467 "src/monitor/image_loader.c" 3 4
+ ((void) sizeof ((
+# 467 "src/monitor/image_loader.c"
+ ftruncate(fd, MEMORY_SIZE) == 0 && fchmod(fd, 0644) == 0 && rename(tmp, path) == 0
+# 467 "src/monitor/image_loader.c" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 467 "src/monitor/image_loader.c"
+ ftruncate(fd, MEMORY_SIZE) == 0 && fchmod(fd, 0644) == 0 && rename(tmp, path) == 0
+# 467 "src/monitor/image_loader.c" 3 4
+ ) ; else __assert_fail (
+# 467 "src/monitor/image_loader.c"
+ "ftruncate(fd, MEMORY_SIZE) == 0 && fchmod(fd, 0644) == 0 && rename(tmp, path) == 0"
+# 467 "src/monitor/image_loader.c" 3 4
+ , "src/monitor/image_loader.c", 467, __extension__ __PRETTY_FUNCTION__); }))
+# 467 "src/monitor/image_loader.c"
+ ; } } while (0)
+                                 ;
+  close(fd);
+}
+
+static long load_cached_img(const char *filename) {
+  uint32_t crc = crc32(0, 
+# 473 "src/monitor/image_loader.c" 3 4
+                         ((void *)0)
+# 473 "src/monitor/image_loader.c"
+                             , 0), adler = adler32(0, 
+# 473 "src/monitor/image_loader.c" 3 4
+                                                      ((void *)0)
+# 473 "src/monitor/image_loader.c"
+                                                          , 0);
+  cpt_cache_hash(filename, &crc, &adler);
+  char path[
+# 475 "src/monitor/image_loader.c" 3 4
+           4096
+# 475 "src/monitor/image_loader.c"
+                   ];
+  snprintf(path, sizeof(path), "%s/%08x%08x_%lx.img", checkpoint_cache_dir, crc, adler, (uint64_t)MEMORY_SIZE);
+
+  int fd = open(path, 
+# 478 "src/monitor/image_loader.c" 3 4
+                     00
+# 478 "src/monitor/image_loader.c"
+                             );
+  if (fd < 0) {
+    cpt_cache_fill(filename, path);
+    do { printf("\33[1;34m[%s:%d,%s] " "Cached checkpoint %s as %s" "\33[0m\n", "src/monitor/image_loader.c", 481, __func__, filename, path); ; } while (0);
+    fd = open(path, 
+# 482 "src/monitor/image_loader.c" 3 4
+                   00
+# 482 "src/monitor/image_loader.c"
+                           );
+    do { if (!(fd >= 0)) { fflush(
+# 483 "src/monitor/image_loader.c" 3 4
+   stdout
+# 483 "src/monitor/image_loader.c"
+   ); fprintf(
+# 483 "src/monitor/image_loader.c" 3 4
+   stderr
+# 483 "src/monitor/image_loader.c"
+   , "\33[1;31m"); fprintf(
+# 483 "src/monitor/image_loader.c" 3 4
+   stderr
+# 483 "src/monitor/image_loader.c"
+   , "Can not open '%s'", path); fprintf(
+# 483 "src/monitor/image_loader.c" 3 4
+   stderr
+# 483 "src/monitor/image_loader.c"
+   , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 483 "src/monitor/image_loader.c" 3 4
+   ((void) sizeof ((
+# 483 "src/monitor/image_loader.c"
+   fd >= 0
+# 483 "src/monitor/image_loader.c" 3 4
+   ) ? 1 : 0), __extension__ ({ if (
+# 483 "src/monitor/image_loader.c"
+   fd >= 0
+# 483 "src/monitor/image_loader.c" 3 4
+   ) ; else __assert_fail (
+# 483 "src/monitor/image_loader.c"
+   "fd >= 0"
+# 483 "src/monitor/image_loader.c" 3 4
+   , "src/monitor/image_loader.c", 483, __extension__ __PRETTY_FUNCTION__); }))
+# 483 "src/monitor/image_loader.c"
+   ; } } while (0);
+  } else {
+    do { printf("\33[1;34m[%s:%d,%s] " "Found checkpoint %s in cache as %s" "\33[0m\n", "src/monitor/image_loader.c", 485, __func__, filename, path); ; } while (0);
+  }
+
+  struct stat st;
+  do { if (!(fstat(fd, &st) == 0 && st.st_size == MEMORY_SIZE)) { fflush(
+# 489 "src/monitor/image_loader.c" 3 4
+ stdout
+# 489 "src/monitor/image_loader.c"
+ ); fprintf(
+# 489 "src/monitor/image_loader.c" 3 4
+ stderr
+# 489 "src/monitor/image_loader.c"
+ , "\33[1;31m"); fprintf(
+# 489 "src/monitor/image_loader.c" 3 4
+ stderr
+# 489 "src/monitor/image_loader.c"
+ , "The size of '%s' is not the memory size", path); fprintf(
+# 489 "src/monitor/image_loader.c" 3 4
+ stderr
+# 489 "src/monitor/image_loader.c"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 489 "src/monitor/image_loader.c" 3 4
+ ((void) sizeof ((
+# 489 "src/monitor/image_loader.c"
+ fstat(fd, &st) == 0 && st.st_size == MEMORY_SIZE
+# 489 "src/monitor/image_loader.c" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 489 "src/monitor/image_loader.c"
+ fstat(fd, &st) == 0 && st.st_size == MEMORY_SIZE
+# 489 "src/monitor/image_loader.c" 3 4
+ ) ; else __assert_fail (
+# 489 "src/monitor/image_loader.c"
+ "fstat(fd, &st) == 0 && st.st_size == MEMORY_SIZE"
+# 489 "src/monitor/image_loader.c" 3 4
+ , "src/monitor/image_loader.c", 489, __extension__ __PRETTY_FUNCTION__); }))
+# 489 "src/monitor/image_loader.c"
+ ; } } while (0);
+  uint8_t *pmem = get_pmem();
+  void *ret = mmap(pmem, MEMORY_SIZE, 
+# 491 "src/monitor/image_loader.c" 3 4
+                                     0x1 
+# 491 "src/monitor/image_loader.c"
+                                               | 
+# 491 "src/monitor/image_loader.c" 3 4
+                                                 0x2
+# 491 "src/monitor/image_loader.c"
+                                                           , 
+# 491 "src/monitor/image_loader.c" 3 4
+                                                             0x02 
+# 491 "src/monitor/image_loader.c"
+                                                                         | 
+# 491 "src/monitor/image_loader.c" 3 4
+                                                                           0x10
+# 491 "src/monitor/image_loader.c"
+                                                                                    , fd, 0);
+  do { if (!(ret == pmem)) { fflush(
+# 492 "src/monitor/image_loader.c" 3 4
+ stdout
+# 492 "src/monitor/image_loader.c"
+ ); fprintf(
+# 492 "src/monitor/image_loader.c" 3 4
+ stderr
+# 492 "src/monitor/image_loader.c"
+ , "\33[1;31m"); fprintf(
+# 492 "src/monitor/image_loader.c" 3 4
+ stderr
+# 492 "src/monitor/image_loader.c"
+ , "Can not map '%s' to pmem", path); fprintf(
+# 492 "src/monitor/image_loader.c" 3 4
+ stderr
+# 492 "src/monitor/image_loader.c"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 492 "src/monitor/image_loader.c" 3 4
+ ((void) sizeof ((
+# 492 "src/monitor/image_loader.c"
+ ret == pmem
+# 492 "src/monitor/image_loader.c" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 492 "src/monitor/image_loader.c"
+ ret == pmem
+# 492 "src/monitor/image_loader.c" 3 4
+ ) ; else __assert_fail (
+# 492 "src/monitor/image_loader.c"
+ "ret == pmem"
+# 492 "src/monitor/image_loader.c" 3 4
+ , "src/monitor/image_loader.c", 492, __extension__ __PRETTY_FUNCTION__); }))
+# 492 "src/monitor/image_loader.c"
+ ; } } while (0);
+  close(fd);
+  return MEMORY_SIZE;
+}
+
+
+
+
+
+
+long load_img(char* img_name, char *which_img, uint64_t load_start, size_t img_size) {
+  char *loading_img = img_name;
+  do { printf("\33[1;34m[%s:%d,%s] " "Loading %s: %s\n" "\33[0m\n", "src/monitor/image_loader.c", 504, __func__, which_img, img_name); ; } while (0);
+  if (img_name == 
+# 505 "src/monitor/image_loader.c" 3 4
+                 ((void *)0)
+# 505 "src/monitor/image_loader.c"
+                     ) {
+    do { printf("\33[1;34m[%s:%d,%s] " "No image is given. Use the default built-in image/restorer." "\33[0m\n", "src/monitor/image_loader.c", 506, __func__); ; } while (0);
+    return 4096;
+  }
+
+
+
+  if (checkpoint_restoring && checkpoint_cache_dir != 
+# 512 "src/monitor/image_loader.c" 3 4
+                                                     ((void *)0) 
+# 512 "src/monitor/image_loader.c"
+                                                          && (is_cpt_file(loading_img) || is_gz_file(loading_img))) {
+    return load_cached_img(loading_img);
+  }
+
+
+  if (is_cpt_file(loading_img)) {
+
+      do { printf("\33[1;34m[%s:%d,%s] " "Loading chunked checkpoint %s" "\33[0m\n", "src/monitor/image_loader.c", 519, __func__, loading_img); ; } while (0);
+      return checkpoint_lazy_restore ? load_cpt_img_lazy(loading_img) : load_cpt_img(loading_img);
+
+
+
+  }
+
+  if (is_gz_file(loading_img)) {
+
+      do { printf("\33[1;34m[%s:%d,%s] " "Loading GZ image %s" "\33[0m\n", "src/monitor/image_loader.c", 528, __func__, loading_img); ; } while (0);
+      return load_gz_img(loading_img);
+
+
+
+  }
+
+  FILE *fp = fopen(loading_img, "rb");
+  do { if (!(fp)) { fflush(
+# 536 "src/monitor/image_loader.c" 3 4
+ stdout
+# 536 "src/monitor/image_loader.c"
+ ); fprintf(
+# 536 "src/monitor/image_loader.c" 3 4
+ stderr
+# 536 "src/monitor/image_loader.c"
+ , "\33[1;31m"); fprintf(
+# 536 "src/monitor/image_loader.c" 3 4
+ stderr
+# 536 "src/monitor/image_loader.c"
+ , "Can not open '%s'", loading_img); fprintf(
+# 536 "src/monitor/image_loader.c" 3 4
+ stderr
+# 536 "src/monitor/image_loader.c"
+ , "\33[0m\n"); extern void isa_reg_display(); extern void monitor_statistic(); isa_reg_display(); monitor_statistic(); 
+# 536 "src/monitor/image_loader.c" 3 4
+ ((void) sizeof ((
+# 536 "src/monitor/image_loader.c"
+ fp
+# 536 "src/monitor/image_loader.c" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 536 "src/monitor/image_loader.c"
+ fp
+# 536 "src/monitor/image_loader.c" 3 4
+ ) ; else __assert_fail (
+# 536 "src/monitor/image_loader.c"
+ "fp"
+# 536 "src/monitor/image_loader.c" 3 4
+ , "src/monitor/image_loader.c", 536, __extension__ __PRETTY_FUNCTION__); }))
+# 536 "src/monitor/image_loader.c"
+ ; } } while (0);
+
+  size_t size;
+  fseek(fp, 0, 
+# 539 "src/monitor/image_loader.c" 3 4
+              2
+# 539 "src/monitor/image_loader.c"
+                      );
+  size = ftell(fp);
+  fseek(fp, 0, 
+# 541 "src/monitor/image_loader.c" 3 4
+              0
+# 541 "src/monitor/image_loader.c"
+                      );
+  if (img_size != 0 && (size > img_size)) {
+    do { printf("\33[1;34m[%s:%d,%s] " "Warning: size is larger than img_size(upper limit), please check if code is missing. size:%lx img_size:%lx" "\33[0m\n", "src/monitor/image_loader.c", 543, __func__, size, img_size); ; } while (0);
+    size = img_size;
+  }
+
+  int ret = fread(guest_to_host(load_start), size, 1, fp);
+  
+# 548 "src/monitor/image_loader.c" 3 4
+ ((void) sizeof ((
+# 548 "src/monitor/image_loader.c"
+ ret == 1
+# 548 "src/monitor/image_loader.c" 3 4
+ ) ? 1 : 0), __extension__ ({ if (
+# 548 "src/monitor/image_loader.c"
+ ret == 1
+# 548 "src/monitor/image_loader.c" 3 4
+ ) ; else __assert_fail (
+# 548 "src/monitor/image_loader.c"
+ "ret == 1"
+# 548 "src/monitor/image_loader.c" 3 4
+ , "src/monitor/image_loader.c", 548, __extension__ __PRETTY_FUNCTION__); }))
+# 548 "src/monitor/image_loader.c"
+                 ;
+  do { printf("\33[1;34m[%s:%d,%s] " "Read %lu bytes from file %s to 0x%lx" "\33[0m\n", "src/monitor/image_loader.c", 549, __func__, size, img_name, load_start); ; } while (0);
+
+  fclose(fp);
+  return size;
+}
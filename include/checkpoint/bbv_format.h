@@ -0,0 +1,60 @@
+/***************************************************************************************
+* Copyright (c) 2020-2022 Institute of Computing Technology, Chinese Academy of Sciences
+*
+* NEMU is licensed under Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*          http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+* EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+* MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+*
+* See the Mulan PSL v2 for more details.
+***************************************************************************************/
+
+#ifndef __CHECKPOINT_BBV_FORMAT_H__
+#define __CHECKPOINT_BBV_FORMAT_H__
+
+#include <stdint.h>
+
+// The binary BBV stream, compressed by gzip as a whole:
+//
+//   BbvHeader | interval | interval | ...
+//
+// An interval is the number of its basic blocks followed by an (id, count)
+// pair for each of them, all as LEB128 varints. The ids are ascending and
+// stored as the delta on the previous id, so most of them take one byte.
+// It is the same BBV as a line "T:id:count :id:count ..." of the text format.
+
+#define BBV_MAGIC "NEMUBBV"
+#define BBV_VERSION 1
+#define BBV_VARINT_MAX 10 // bytes of a uint64_t varint at most
+
+typedef struct {
+  char magic[8];
+  uint32_t version;
+  uint32_t reserved;
+  uint64_t interval_size; // instructions in an interval
+} BbvHeader;
+
+static inline int bbv_put_varint(uint8_t *p, uint64_t v) {
+  int n = 0;
+  while (v >= 0x80) {
+    p[n ++] = (v & 0x7f) | 0x80;
+    v >>= 7;
+  }
+  p[n ++] = v;
+  return n;
+}
+
+static inline int bbv_get_varint(const uint8_t *p, uint64_t *v) {
+  int n = 0;
+  *v = 0;
+  do {
+    *v |= (uint64_t)(p[n] & 0x7f) << (7 * n);
+  } while (p[n ++] & 0x80);
+  return n;
+}
+
+#endif
@@ -0,0 +1,69 @@
+/***************************************************************************************
+* Copyright (c) 2020-2022 Institute of Computing Technology, Chinese Academy of Sciences
+*
+* NEMU is licensed under Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*          http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+* EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+* MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+*
+* See the Mulan PSL v2 for more details.
+***************************************************************************************/
+
+#ifndef __CHECKPOINT_CPT_FORMAT_H__
+#define __CHECKPOINT_CPT_FORMAT_H__
+
+#include <stdint.h>
+
+// The chunked checkpoint container:
+//
+//   CptHeader | CptRegs | parent path | compressed chunks ... | CptChunk index[nr_chunks]
+//
+// pmem is split into chunks of CPT_CHUNK_SIZE bytes. A chunk with only zero
+// pages is not stored at all. The non-zero pages of the other chunks are
+// packed in the order of their addresses and compressed by zlib independently,
+// so the chunks can be compressed, decompressed and located in parallel.
+//
+// A delta checkpoint stores the pages written since its parent checkpoint,
+// zero or not, and the memory is the parent's one with these pages replaced.
+// The path of the parent is relative to the directory of the delta.
+
+#define CPT_MAGIC "NEMUCPT"
+#define CPT_VERSION 2
+#define CPT_PAGE_SIZE 4096
+#define CPT_CHUNK_PAGES 64 // one bit per page in CptChunk.page_mask
+#define CPT_CHUNK_SIZE (CPT_PAGE_SIZE * CPT_CHUNK_PAGES)
+
+typedef struct {
+  char magic[8];
+  uint32_t version;
+  uint32_t chunk_size;
+  uint64_t mem_size;      // bytes of pmem covered by the checkpoint
+  uint64_t inst_count;    // the instruction count when it is taken
+  uint64_t regs_offset;   // file offset of CptRegs
+  uint64_t index_offset;  // file offset of the chunk index
+  uint64_t nr_chunks;     // the number of chunks stored
+  uint64_t parent_offset; // file offset of the NUL-terminated parent path, 0 if it is not a delta
+} CptHeader;
+
+typedef struct CptRegs {
+  uint64_t pc;
+  uint64_t mode;
+  uint64_t mtime;
+  uint64_t mtimecmp;
+  uint64_t gpr[32];
+  uint64_t fpr[32];
+  uint64_t csr[4096];
+} CptRegs;
+
+typedef struct {
+  uint64_t addr;      // offset of the chunk in pmem
+  uint64_t offset;    // file offset of the compressed pages
+  uint64_t size;      // bytes of the compressed pages
+  uint64_t page_mask; // bit i is set if page i of the chunk is stored
+} CptChunk;
+
+#endif
@@ -25,10 +25,30 @@ enum ProfilingState {
     UniformCheckpointing
 };
 
+enum CheckpointFormat {
+    GzCheckpoint = 0,   // the whole pmem in a gzip stream
+    ChunkedCheckpoint,  // the chunked container in checkpoint/cpt_format.h
+};
+
+enum BbvFormat {
+    TextBbv = 0,        // lines of "T:id:count ..." in gzip, as SimPoint reads
+    BinaryBbv,          // the varint stream in checkpoint/bbv_format.h
+};
+
 extern int profiling_state;
 extern bool checkpoint_taking;
 extern bool checkpoint_restoring;
+extern bool checkpoint_native_restore;
+extern bool checkpoint_lazy_restore;
+extern char *checkpoint_cache_dir;
 extern uint64_t checkpoint_interval;
+extern int checkpoint_jobs;
+extern int checkpoint_format;
+extern int checkpoint_delta;
+extern int simpoint_cluster_maxk;
+extern int simpoint_bbv_format;
+extern uint64_t simpoint_shard_intervals;
+extern int simpoint_shard_jobs;
 
 extern bool profiling_started;
 extern bool force_cpt_mmode;
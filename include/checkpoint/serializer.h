@@ -22,6 +22,9 @@
 
 #include <string>
 #include <map>
+#include <deque>
+#include <sys/types.h>
+#include <checkpoint/cpt_format.h>
 
 
 class Serializer
@@ -34,6 +37,8 @@ class Serializer
 
     void serializeRegs();
 
+    bool unserializeRegs(CptRegs &regs);
+
     explicit Serializer();
 
     void init();
@@ -42,8 +47,19 @@ class Serializer
 
     void notify_taken(uint64_t i);
 
+    void joinWriters();
+
+    void takeSimpointCandidates(const std::string &simpoints_dir);
+
   private:
 
+    void writePMem(const std::string &filepath);
+
+    void writeChunkedPMem(const std::string &filepath, uint64_t inst_count,
+                          const uint64_t *dirty, const std::string &parent);
+
+    void waitWriter();
+
     uint64_t intervalSize{10 * 1000 * 1000};
 
     int cptID;
@@ -57,9 +73,24 @@ class Serializer
 
     bool regDumped{false};
 
+    // the registers dumped, also stored in the chunked checkpoints
+    CptRegs cptRegs;
+
     std::map<uint64_t, double> simpoint2Weights;
 
     uint64_t nextUniformPoint;
+
+    // the processes writing checkpoints, the oldest first
+    std::deque<pid_t> cptWriters;
+
+    // the previous checkpoint, which the next delta is based on
+    std::string prevCptPath;
+    int nrDeltas{0};
+
+    // in a single pass, a candidate is taken at the point of each interval,
+    // and the ones of the simpoints are kept after clustering
+    bool takingCandidates{false};
+    std::string candidatesPath;
 };
 
 extern Serializer serializer;
@@ -41,7 +41,11 @@
 #ifndef __CPU_SIMPLE_PROBES_SIMPOINT_HH__
 #define __CPU_SIMPLE_PROBES_SIMPOINT_HH__
 
+#include <deque>
+#include <string>
 #include <unordered_map>
+#include <vector>
+#include <zlib.h>
 #include <base/output.h>
 
 namespace SimPointNS {
@@ -84,6 +88,9 @@ class SimPoint
 
     virtual void init();
 
+    /** Close the BBVs at the end of profiling, and pick the simpoints */
+    void finish();
+
     /**
      * Profile basic blocks for SimPoints.
      * Called at every macro inst to increment basic block inst counts and
@@ -93,7 +100,44 @@ class SimPoint
 
     void profile_with_abs_icount(Addr pc, bool is_control, bool is_last_uop, uint64_t abs_icount);
 
+    /**
+     * Profile the basic block entered at pc, whose id is cached in *bb_id
+     * by the tcache, so bbMap is only looked up on its first sight.
+     */
+    void profile_bb(Addr pc, uint32_t *bb_id, uint64_t abs_icount);
+
   private:
+    /** Look up the id of a basic block, adding it if it is new */
+    uint32_t lookupBB(const BasicBlockRange &bb, uint64_t insts);
+
+    /** Output the BBV of the interval and clear the counts */
+    void endInterval();
+
+    /** Output the BBV of the interval as a line of text */
+    void writeTextInterval();
+
+    /** Output the BBV of the interval to the stream or bbvFile */
+    void writeInterval();
+
+    /** Append the BBV of the interval to buf as varints, and clear the counts */
+    void packInterval(std::vector<uint8_t> &buf);
+
+    /**
+     * Only find the ends of the intervals while fast-forwarding a sharded
+     * profiling, and fork a worker to profile each shard. Return false
+     * in the worker, which profiles from here as usual.
+     */
+    bool forwardShard(uint64_t abs_icount);
+
+    /** Write the intervals of the shard profiled by a worker, and exit */
+    void endShard();
+
+    /** Wait for the oldest shard worker */
+    void waitShard();
+
+    /** Output the intervals of the shards in order, with the ids of the blocks unified */
+    void stitchShards();
+
     uint64_t lastICount{0};
     /** SimPoint profiling interval size in instructions */
     uint64_t intervalSize;
@@ -104,6 +148,26 @@ class SimPoint
     uint64_t intervalDrift;
     /** Pointer to SimPoint BBV output stream */
     NEMUNS::OutputStream *simpointStream;
+    /** The binary BBV stream, used instead of simpointStream if not null */
+    gzFile bbvFile{nullptr};
+    /** The varints of the interval being written to bbvFile */
+    std::vector<uint8_t> bbvBuf;
+    /** Paths of the BBVs and the simpoints clustered from them */
+    std::string bbvPath;
+    std::string outputPath;
+
+    /** Intervals in a shard, 0 if the profiling is not sharded */
+    uint64_t shardIntervals{0};
+    /** Whether it is a worker profiling a shard */
+    bool inShard{false};
+    /** Intervals ended, in the whole run or in the shard of a worker */
+    uint64_t nrIntervals{0};
+    /** The shard the worker profiles, or the number of shards forked */
+    uint64_t shardID{0};
+    std::deque<pid_t> shardWorkers;
+    std::string shardsPath;
+    /** The intervals profiled by a worker, packed as in bbvFile */
+    std::vector<uint8_t> shardBuf;
 
     /** Basic Block information */
     struct BBInfo
@@ -112,12 +176,14 @@ class SimPoint
         uint64_t id;
         /** Num of static insts in BB */
         uint64_t insts;
-        /** Accumulated dynamic inst count executed by BB */
-        uint64_t count;
     };
 
     /** Hash table containing all previously seen basic blocks */
     ::std::unordered_map<BasicBlockRange, BBInfo> bbMap;
+    /** Accumulated dynamic inst count executed by BB, indexed by id */
+    ::std::vector<uint64_t> bbCounts;
+    /** First PC of BB indexed by id, to check the ids cached in the tcache */
+    ::std::vector<Addr> bbStarts;
     /** Currently executing basic block */
     BasicBlockRange currentBBV;
     /** inst count in current basic block */
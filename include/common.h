@@ -39,6 +39,11 @@ typedef MUXDEF(PMEM64, uint64_t, uint32_t) paddr_t;
 #define FMT_PADDR MUXDEF(PMEM64, "0x%016lx", "0x%08x")
 typedef uint16_t ioaddr_t;
 
+// the state of a hart, private to the host thread running the hart;
+// initial-exec keeps the offsets out of the instructions, which overflow
+// when GCC folds large constants into them, and ld relaxes it for the binary
+#define hart_local MUXDEF(CONFIG_SMP, __thread __attribute__((tls_model("initial-exec"))), )
+
 #define CP printf("%s: %d\n", __FILE__, __LINE__);fflush( stdout );
 struct DynamicConfig {
   bool ignore_illegal_mem_access;
@@ -22,19 +22,35 @@ enum {
   NEMU_EXEC_RUNNING = 0, // unused by longjmp()
   NEMU_EXEC_END,
   NEMU_EXEC_AGAIN,
-  NEMU_EXEC_EXCEPTION
+  NEMU_EXEC_EXCEPTION,
+  NEMU_EXEC_SERIAL // run the instruction in the serial part of the round
 };
 
 void cpu_exec(uint64_t n);
+#ifdef CONFIG_SMP
+extern hart_local int g_hart_id;
+void smp_start_harts();
+void smp_join_harts();
+void smp_hart_exec();
+#ifdef CONFIG_SMP_LOCKSTEP
+uint64_t smp_round();
+void smp_end_parallel(bool serial);
+void smp_end_serial();
+#endif
+#endif
 __attribute__((noreturn)) void longjmp_exec(int cause);
 __attribute__((noreturn)) void longjmp_exception(int ex_cause);
 
 enum {
   SYS_STATE_UPDATE = 1,
   SYS_STATE_FLUSH_TCACHE = 2,
+  SYS_STATE_REMAP = 4, // the translation of instruction fetch is changed
+  SYS_STATE_FENCE_I = 8,
 };
 void set_sys_state_flag(int flag);
+void cpu_wait_for_intr();
 void mmu_tlb_flush(vaddr_t vaddr);
+void mmu_ifetch_remap();
 
 struct Decode;
 void save_globals(struct Decode *s);
@@ -44,6 +44,10 @@ enum {
   INSTR_TYPE_I, // indirect
 };
 
+// The fields used by every instruction executed are put first, within DECODE_HOT_SIZE
+// bytes, and the others used on decoding, per basic block or by a few instructions follow.
+#define DECODE_HOT_SIZE 64
+
 typedef struct Decode {
   union {
     struct {
@@ -55,14 +59,20 @@ typedef struct Decode {
       struct Decode *bb_src;    // pointer recording the source of basic block direction
     };
   };
-  vaddr_t pc;
-  vaddr_t snpc; // sequential next pc
   IFDEF (CONFIG_PERF_OPT, const void *EHelper);
   IFNDEF(CONFIG_PERF_OPT, void (*EHelper)(struct Decode *));
   Operand dest, src1, src2;
-  vaddr_t jnpc;
+  vaddr_t pc;
   uint16_t idx_in_bb; // the number of instruction in the basic block, start from 1
   uint8_t type;
+  IFDEF(CONFIG_PERF_OPT, uint32_t epoch); // tcache epoch when it is decoded or validated
+
+  vaddr_t snpc; // sequential next pc
+  vaddr_t jnpc;
+  IFDEF(CONFIG_PERF_OPT, uint32_t exec_cnt); // times it is entered as a basic block
+  IFDEF(CONFIG_PERF_OPT, uint32_t bbv_id); // id of the basic block in the simpoint BBV, 0 if it is not seen
+  IFDEF(CONFIG_PERF_OPT, struct Decode *rnext); // return site of a call, cached when it returns
+  IFDEF(CONFIG_ENGINE_JIT, const void *jit_code); // host code translated from the basic block
   ISADecodeInfo isa;
   IFDEF(CONFIG_DEBUG, char logbuf[80]);
   #ifdef CONFIG_RVV
@@ -0,0 +1,35 @@
+/***************************************************************************************
+* Copyright (c) 2020-2022 Institute of Computing Technology, Chinese Academy of Sciences
+*
+* NEMU is licensed under Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*          http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+* EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+* MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+*
+* See the Mulan PSL v2 for more details.
+***************************************************************************************/
+
+#ifndef __DEVICE_EVENT_H__
+#define __DEVICE_EVENT_H__
+
+#include <common.h>
+
+// Events are keyed on the number of guest instructions executed.
+#define EVENT_NONE UINT64_MAX
+
+typedef void (*event_handler_t) ();
+
+int add_event(event_handler_t h);
+// schedule the event at the instruction count `when`, replacing its previous deadline
+void event_schedule(int id, uint64_t when);
+void event_cancel(int id);
+// the earliest deadline, or EVENT_NONE
+uint64_t event_next();
+// fire the events whose deadline is not later than `now`
+void event_run(uint64_t now);
+
+#endif
@@ -0,0 +1,61 @@
+#define CONFIG_ISA_riscv64 1
+#define CONFIG_ISA "riscv64"
+#define CONFIG_ILEN_MIN 2
+#define CONFIG_ISA64 1
+#define CONFIG_CLINT_MMIO 0x38000000
+#define CONFIG_RVB 1
+#define CONFIG_RVK 1
+#define CONFIG_RV_DEBUG 1
+#define CONFIG_RV_PMP_CSR 1
+#define CONFIG_RV_PMP_NUM 16
+#define CONFIG_RV_SPMP_CSR 1
+#define CONFIG_RV_SPMP_NUM 16
+#define CONFIG_RV_SVINVAL 1
+#define CONFIG_MISA_UNCHANGEABLE 1
+#define CONFIG_XTVEC_VECTORED_MODE 1
+#define CONFIG_RV_ARCH_CSRS 1
+#define CONFIG_MVENDORID_VALUE 0x0
+#define CONFIG_MARCHID_VALUE 0x0
+#define CONFIG_MIMPID_VALUE 0x0
+#define CONFIG_ENGINE_INTERPRETER 1
+#define CONFIG_ENGINE "interpreter"
+#define CONFIG_MODE_SYSTEM 1
+#define CONFIG_CC_GCC 1
+#define CONFIG_CC "gcc"
+#define CONFIG_CC_O2 1
+#define CONFIG_CC_OPT "-O2"
+#define CONFIG_CC_LTO 1
+#define CONFIG_DIFFTEST_REF_PATH "none"
+#define CONFIG_DIFFTEST_REF_NAME "none"
+#define CONFIG_MBASE 0x80000000
+#define CONFIG_MSIZE 0x90000000
+#define CONFIG_PADDRBITS 36
+#define CONFIG_BBL_OFFSET_WITH_CPT 0xa0000
+#define CONFIG_PC_RESET_OFFSET 0x0
+#define CONFIG_USE_MMAP 1
+#define CONFIG_MEM_COMPRESS 1
+#define CONFIG_DEVICE 1
+#define CONFIG_EVENT_QUEUE 1
+#define CONFIG_EVENT_IPS 100000000
+#define CONFIG_IDLE_FAST_FORWARD 1
+#define CONFIG_HAS_PORT_IO 1
+#define CONFIG_HAS_UARTLITE 1
+#define CONFIG_UARTLITE_PORT 0x3f8
+#define CONFIG_UARTLITE_MMIO 0x40600000
+#define CONFIG_HAS_TIMER 1
+#define CONFIG_RTC_PORT 0x48
+#define CONFIG_RTC_MMIO 0xa1000048
+#define CONFIG_HAS_SDCARD 1
+#define CONFIG_SDCARD_CTL_MMIO 0x40002000
+#define CONFIG_SDCARD_IMG_PATH ""
+#define CONFIG_FPU_HOST 1
+#define CONFIG_AC_SOFT 1
+#define CONFIG_TIMER_GETTIMEOFDAY 1
+#define CONFIG_REPORT_ILLEGAL_INSTR 1
+#define CONFIG_RT_CHECK 1
+#define CONFIG_PERF_OPT 1
+#define CONFIG_TCACHE_SIZE 8192
+#define CONFIG_TCACHE_REGIONS 4
+#define CONFIG_TCACHE_TRACE_THRESHOLD 64
+#define CONFIG_BB_TABLE_SIZE 1024
+#define CONFIG_ENABLE_INSTR_CNT 1
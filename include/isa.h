@@ -28,10 +28,13 @@ typedef concat(__ISA__, _ISADecodeInfo) ISADecodeInfo;
 // monitor
 extern char isa_logo[];
 void init_isa();
+#ifdef CONFIG_SMP
+void isa_init_hart(int id);
+#endif
 
 // reg
-extern CPU_state cpu;
-extern rtlreg_t csr_array[4096];
+extern hart_local CPU_state cpu;
+extern hart_local rtlreg_t csr_array[4096];
 void isa_reg_display();
 word_t isa_reg_str2val(const char *name, bool *success);
 
@@ -59,6 +62,11 @@ bool isa_spmp_check_permission(paddr_t addr, int len, int type, int mode);
 vaddr_t raise_intr(word_t NO, vaddr_t epc);
 #define INTR_EMPTY ((word_t)-1)
 word_t isa_query_intr();
+bool isa_has_pending_intr(); // whether wfi should resume, regardless of the global enables
+
+// checkpoint
+struct CptRegs;
+void isa_restore_cpt_regs(const struct CptRegs *regs);
 
 // difftest
   // for dut
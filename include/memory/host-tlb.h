@@ -18,9 +18,24 @@
 
 #include <common.h>
 
+#define HOSTTLB_SIZE_SHIFT 12
+#define HOSTTLB_SIZE (1 << HOSTTLB_SIZE_SHIFT)
+
+typedef struct {
+  uint8_t *offset; // offset from the guest virtual address of the data page to the host virtual address
+  vaddr_t gvpn; // guest virtual page number
+} HostTLBEntry;
+
 struct Decode;
 word_t hosttlb_read(struct Decode *s, vaddr_t vaddr, int len, int type);
 void hosttlb_write(struct Decode *s, vaddr_t vaddr, int len, word_t data);
+paddr_t hosttlb_ifetch_paddr(vaddr_t vaddr);
+void hosttlb_write_protect(paddr_t paddr);
+#ifdef CONFIG_SMP_LOCKSTEP
+void hosttlb_drop_page(paddr_t paddr);
+void hosttlb_drop_private();
+#endif
+HostTLBEntry* hosttlb_table(int type);
 void hosttlb_init();
 void hosttlb_flush(vaddr_t vaddr);
 
@@ -17,10 +17,17 @@
 #define __IMAGE_LOADER_H__
 
 #include<stddef.h>
+#include<stdbool.h>
+#include<checkpoint/cpt_format.h>
 
 
 long load_gz_img(const char *filename);
 
+long load_cpt_img(const char *filename);
+long load_cpt_img_lazy(const char *filename);
+
+bool load_cpt_regs(const char *filename, CptRegs *regs);
+
 long load_img(char* img_name, char *which_img, uint64_t load_start, size_t img_size);
 
 #endif //  __IMAGE_LOADER_H__
\ No newline at end of file
@@ -18,6 +18,8 @@
 #define __MEMORY_PADDR_H__
 
 #include <common.h>
+#include <memory/host.h>
+#include <memory/vaddr.h>
 
 extern unsigned long MEMORY_SIZE;
 
@@ -52,6 +54,52 @@ static inline bool in_pmem(paddr_t addr) {
 word_t paddr_read(paddr_t addr, int len, int type, int mode, vaddr_t vaddr);
 void paddr_write(paddr_t addr, int len, word_t data, int mode, vaddr_t vaddr);
 uint8_t *get_pmem();
+#ifdef CONFIG_PERF_OPT
+void pmem_set_code_page(paddr_t addr);
+#endif
+#ifdef CONFIG_SMP
+uint8_t *pmem_atomic_addr(paddr_t addr);
+
+// Every store to pmem bumps the version of its line, so sc can tell
+// whether the line is written after lr, even if the value is restored.
+// Lines sharing a version only cause spurious sc failures.
+#define PMEM_LINE_SHIFT 6
+#define PMEM_NR_LINE_VERSION (1 << 16)
+extern uint32_t pmem_line_version_table[PMEM_NR_LINE_VERSION];
+
+static inline uint32_t *pmem_line_version(void *haddr) {
+  return &pmem_line_version_table[((uintptr_t)haddr >> PMEM_LINE_SHIFT) % PMEM_NR_LINE_VERSION];
+}
+
+static inline void pmem_line_store(void *haddr, int len) {
+  uint8_t *last = (uint8_t *)haddr + len - 1;
+  __atomic_fetch_add(pmem_line_version(haddr), 1, __ATOMIC_SEQ_CST);
+  if (unlikely(((uintptr_t)haddr ^ (uintptr_t)last) >> PMEM_LINE_SHIFT)) {
+    __atomic_fetch_add(pmem_line_version(last), 1, __ATOMIC_SEQ_CST);
+  }
+}
+
+#ifdef CONFIG_SMP_LOCKSTEP
+// whether the stores of the hart go to its private copies of the pages
+extern hart_local bool pmem_buffered;
+uint8_t *pmem_hart_addr(paddr_t addr);
+void pmem_buffer_reset();
+void pmem_commit();
+#endif
+
+// called before a store through the host TLB
+static inline void pmem_host_store(void *haddr, int len) {
+#ifdef CONFIG_SMP_LOCKSTEP
+  // the mask of the bytes written follows the private copy of the page
+  if (pmem_buffered) { host_write((uint8_t *)haddr + PAGE_SIZE, len, -1); return; }
+#endif
+  pmem_line_store(haddr, len);
+}
+#else
+void pmem_mark_dirty(paddr_t addr, size_t len);
+const uint64_t *pmem_dirty_bitmap();
+void pmem_clear_dirty();
+#endif
 
 #ifdef CONFIG_DIFFTEST_STORE_COMMIT
 
@@ -20,6 +20,7 @@
 
 struct Decode;
 word_t vaddr_ifetch(vaddr_t addr, int len);
+paddr_t vaddr_ifetch_paddr(vaddr_t addr);
 word_t vaddr_read(struct Decode *s, vaddr_t addr, int len, int mmu_mode);
 void vaddr_write(struct Decode *s, vaddr_t addr, int len, word_t data, int mmu_mode);
 
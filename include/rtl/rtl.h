@@ -19,7 +19,7 @@
 #include <cpu/decode.h>
 
 extern const rtlreg_t rzero;
-extern rtlreg_t tmp_reg[4];
+extern hart_local rtlreg_t tmp_reg[4];
 
 #define dsrc1 (id_src1->preg)
 #define dsrc2 (id_src2->preg)
@@ -48,7 +48,9 @@ void PathManager::init() {
     cptID = cpt_id;
   }
 
-  if (profiling_state == SimpointCheckpointing || checkpoint_taking) {
+  // the candidates of a single pass are not numbered
+  if (profiling_state == SimpointCheckpointing ||
+      (checkpoint_taking && profiling_state != SimpointProfiling)) {
     cptID = 0;
   }
 
@@ -18,7 +18,17 @@
 int profiling_state = NoProfiling;
 bool checkpoint_taking = false;
 bool checkpoint_restoring = false;
+bool checkpoint_native_restore = false; // restore the registers in NEMU instead of the gcpt restorer
+bool checkpoint_lazy_restore = false; // load the chunks of cpt when they are touched
+char *checkpoint_cache_dir = NULL; // the cache of decompressed cpts shared by NEMUs
 uint64_t checkpoint_interval = 0;
+int checkpoint_jobs = 0; // the max number of checkpoints written in background, 0 to write them inline
+int checkpoint_format = GzCheckpoint;
+int checkpoint_delta = 0; // the max number of delta checkpoints chained after a full one
+int simpoint_cluster_maxk = 0; // cluster the BBVs into up to this many simpoints, 0 to leave it to SimPoint
+int simpoint_bbv_format = TextBbv;
+uint64_t simpoint_shard_intervals = 0; // profile the shards of this many intervals in parallel, 0 to profile serially
+int simpoint_shard_jobs = 0; // the max number of shard workers, 0 for the number of host cores
 
 bool profiling_started = false;
 bool force_cpt_mmode = false;
@@ -26,4 +36,5 @@ bool force_cpt_mmode = false;
 #ifdef CONFIG_SHARE
 // empty definition on share
 void simpoint_profiling(uint64_t pc, bool is_control, uint64_t abs_instr_count) {}
+void simpoint_profiling_bb(uint64_t pc, uint32_t *bb_id, uint64_t abs_instr_count) {}
 #endif 
\ No newline at end of file
@@ -0,0 +1,35 @@
+/***************************************************************************************
+* Copyright (c) 2020-2022 Institute of Computing Technology, Chinese Academy of Sciences
+*
+* NEMU is licensed under Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*          http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+* EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+* MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+*
+* See the Mulan PSL v2 for more details.
+***************************************************************************************/
+
+#include <isa.h>
+#include <cpu/cpu.h>
+#include <memory/image_loader.h>
+
+#if defined(CONFIG_MODE_SYSTEM) && !defined(CONFIG_SHARE)
+bool load_gcpt_regs(CptRegs *regs);
+
+// Set up the harts from the registers of a checkpoint loaded into pmem, and
+// start from its pc directly, instead of running the gcpt restorer.
+void unserialize(const char *cpt) {
+  static CptRegs regs;
+  if (!load_cpt_regs(cpt, &regs) && !load_gcpt_regs(&regs)) {
+    panic("No registers are found in checkpoint %s", cpt);
+  }
+
+  isa_restore_cpt_regs(&regs);
+  set_sys_state_flag(SYS_STATE_UPDATE);
+  Log("Restored checkpoint %s natively, start from pc 0x%lx in mode %lu", cpt, regs.pc, regs.mode);
+}
+#endif
@@ -27,15 +27,22 @@
 #include <isa.h>
 #include <common.h>
 
+#include <atomic>
 #include <cinttypes>
+#include <filesystem>
 #include <iostream>
 #include <zlib.h>
 #include <limits>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include <fstream>
 #include <gcpt_restore/src/restore_rom_addr.h>
 
+#include <sys/wait.h>
+#include <unistd.h>
+
 using std::cout;
 using std::cerr;
 using std::endl;
@@ -43,6 +50,10 @@ using std::fstream;
 using std::string;
 using std::to_string;
 using std::numeric_limits;
+using std::vector;
+
+// a simpoint is taken after this many instructions in its interval
+static const uint64_t SimpointCptOffset = 100000;
 
 Serializer::Serializer() :
     IntRegStartAddr(INT_REG_CPT_ADDR - BOOT_CODE),
@@ -61,12 +72,20 @@ uint8_t* guest_to_host(paddr_t paddr);
 #include <debug.h>
 extern bool log_enable();
 extern unsigned long MEMORY_SIZE;
+#ifndef CONFIG_SMP
+void pmem_mark_dirty(paddr_t addr, size_t len);
+const uint64_t *pmem_dirty_bitmap();
+void pmem_clear_dirty();
+#endif
+#ifdef CONFIG_MEM_COMPRESS
+long load_cpt_img(const char *filename);
+#endif
+bool load_cpt_regs(const char *filename, CptRegs *regs);
 }
 
 void Serializer::serializePMem(uint64_t inst_count) {
   // We must dump registers before memory to store them in the Generic Arch CPT
   assert(regDumped);
-  const size_t PMEM_SIZE = MEMORY_SIZE;
   uint8_t *pmem = get_pmem();
 
   assert(restorer);
@@ -81,15 +100,72 @@ void Serializer::serializePMem(uint64_t inst_count) {
   Log("Put gcpt restorer %s to start of pmem", restorer);
 
   string filepath;
+  string suffix = checkpoint_format == ChunkedCheckpoint ? "_.cpt" : "_.gz";
   if (profiling_state == SimpointCheckpointing) {
       filepath = pathManager.getOutputPath() + "_" + \
                         to_string(simpoint2Weights.begin()->first) + "_" + \
-                        to_string(simpoint2Weights.begin()->second) + "_.gz";
+                        to_string(simpoint2Weights.begin()->second) + suffix;
+  } else if (takingCandidates) {
+      filepath = candidatesPath + "_" + \
+                        to_string((nextUniformPoint - SimpointCptOffset) / intervalSize) + suffix;
   } else {
       filepath = pathManager.getOutputPath() + "_" + \
-                        to_string(inst_count) + "_.gz";
+                        to_string(inst_count) + suffix;
   }
 
+  // A delta stores the pages written since the previous checkpoint, including
+  // the ones of the restorer and the registers written above.
+  const uint64_t *dirty = nullptr;
+  string parent;
+#ifndef CONFIG_SMP
+  if (checkpoint_delta > 0 && !prevCptPath.empty() && nrDeltas < checkpoint_delta) {
+    pmem_mark_dirty(BOOT_CODE, CSR_CPT_ADDR + 4096 * 8 - BOOT_CODE);
+    dirty = pmem_dirty_bitmap();
+    parent = std::filesystem::path(prevCptPath).lexically_relative(
+        std::filesystem::path(filepath).parent_path());
+    nrDeltas ++;
+  } else {
+    nrDeltas = 0;
+  }
+#endif
+  prevCptPath = filepath;
+
+  if (checkpoint_jobs > 0) {
+    // The child process writes the snapshot of pmem shared copy-on-write,
+    // and the simulation goes on in this process.
+    while (cptWriters.size() >= (size_t)checkpoint_jobs) {
+      Log("Waiting for %lu checkpoints being written", cptWriters.size());
+      waitWriter();
+    }
+    fflush(stdout);
+    pid_t pid = fork();
+    if (pid < 0) {
+      xpanic("Failed to fork the checkpoint writer\n");
+    } else if (pid == 0) {
+      if (checkpoint_format == ChunkedCheckpoint) writeChunkedPMem(filepath, inst_count, dirty, parent);
+      else writePMem(filepath);
+      fflush(stdout);
+      _exit(0);
+    }
+    cptWriters.push_back(pid);
+    Log("Checkpoint %s is written by process %d", filepath.c_str(), pid);
+  } else if (checkpoint_format == ChunkedCheckpoint) {
+    writeChunkedPMem(filepath, inst_count, dirty, parent);
+  } else {
+    writePMem(filepath);
+  }
+#ifndef CONFIG_SMP
+  if (checkpoint_delta > 0) {
+    pmem_clear_dirty();
+  }
+#endif
+  regDumped = false;
+}
+
+void Serializer::writePMem(const string &filepath) {
+  const size_t PMEM_SIZE = MEMORY_SIZE;
+  uint8_t *pmem = get_pmem();
+
   gzFile compressed_mem = gzopen(filepath.c_str(), "wb");
   if (compressed_mem == nullptr) {
     cerr << "Failed to open " << filepath << endl;
@@ -114,7 +190,139 @@ void Serializer::serializePMem(uint64_t inst_count) {
     xpanic("Close failed on physical memory checkpoint file\n");
   }
   Log("Checkpoint done!\n");
-  regDumped = false;
+}
+
+// Pack the pages of a chunk in dirty_mask, or the non-zero ones for a full
+// checkpoint, and compress them into buf. Return the mask of the pages packed.
+static uint64_t compress_chunk(const uint8_t *chunk, size_t size, const uint64_t *dirty_mask,
+                               vector<uint8_t> &pages, vector<uint8_t> &buf) {
+  uint64_t mask = 0;
+  size_t packed = 0;
+  for (size_t p = 0; p * CPT_PAGE_SIZE < size; p++) {
+    const uint64_t *page = (const uint64_t *)(chunk + p * CPT_PAGE_SIZE);
+    if (dirty_mask) {
+      if (!(*dirty_mask & (1ul << p))) continue;
+    } else {
+      size_t i = 0;
+      while (i < CPT_PAGE_SIZE / sizeof(uint64_t) && page[i] == 0) i++;
+      if (i == CPT_PAGE_SIZE / sizeof(uint64_t)) continue;
+    }
+    mask |= 1ul << p;
+    memcpy(pages.data() + packed, page, CPT_PAGE_SIZE);
+    packed += CPT_PAGE_SIZE;
+  }
+  if (mask == 0) return 0;
+
+  uLongf len = compressBound(packed);
+  buf.resize(len);
+  if (compress2(buf.data(), &len, pages.data(), packed, Z_DEFAULT_COMPRESSION) != Z_OK) {
+    xpanic("Failed to compress checkpoint chunk\n");
+  }
+  buf.resize(len);
+  return mask;
+}
+
+void Serializer::writeChunkedPMem(const string &filepath, uint64_t inst_count,
+                                  const uint64_t *dirty, const string &parent) {
+  const uint64_t PMEM_SIZE = MEMORY_SIZE;
+  assert(PMEM_SIZE % CPT_PAGE_SIZE == 0);
+  const uint64_t nr_chunks = (PMEM_SIZE + CPT_CHUNK_SIZE - 1) / CPT_CHUNK_SIZE;
+  uint8_t *pmem = get_pmem();
+
+  FILE *fp = fopen(filepath.c_str(), "wb");
+  if (fp == nullptr) {
+    cerr << "Failed to open " << filepath << endl;
+    xpanic("Can't open physical memory checkpoint file!\n");
+  } else {
+    cout << "Opening " << filepath << " as checkpoint output file" << endl;
+  }
+
+  CptHeader header = {};
+  memcpy(header.magic, CPT_MAGIC, sizeof(CPT_MAGIC));
+  header.version = CPT_VERSION;
+  header.chunk_size = CPT_CHUNK_SIZE;
+  header.mem_size = PMEM_SIZE;
+  header.inst_count = inst_count;
+  header.regs_offset = sizeof(header);
+  header.parent_offset = dirty ? header.regs_offset + sizeof(cptRegs) : 0;
+  // the header is written again when the index is known
+  if (fwrite(&header, sizeof(header), 1, fp) != 1 || fwrite(&cptRegs, sizeof(cptRegs), 1, fp) != 1 ||
+      (dirty && fwrite(parent.c_str(), parent.size() + 1, 1, fp) != 1)) {
+    xpanic("Write failed on physical memory checkpoint file\n");
+  }
+
+  // The chunks are compressed by the threads a batch at a time,
+  // and written in the order of their addresses.
+  unsigned nr_threads = std::max(1u, std::thread::hardware_concurrency());
+  const uint64_t batch_size = nr_threads * 4;
+  vector<vector<uint8_t>> bufs(batch_size);
+  vector<uint64_t> masks(batch_size);
+  vector<CptChunk> index;
+  uint64_t offset = header.regs_offset + sizeof(cptRegs) + (dirty ? parent.size() + 1 : 0);
+
+  for (uint64_t first = 0; first < nr_chunks; first += batch_size) {
+    uint64_t n = std::min(batch_size, nr_chunks - first);
+    std::atomic<uint64_t> next{0};
+    auto worker = [&]() {
+      // not thread_local, which is gone in the atexit handlers of the main thread
+      vector<uint8_t> pages(CPT_CHUNK_SIZE);
+      for (uint64_t i; (i = next++) < n; ) {
+        uint64_t addr = (first + i) * CPT_CHUNK_SIZE;
+        masks[i] = compress_chunk(pmem + addr, std::min<uint64_t>(CPT_CHUNK_SIZE, PMEM_SIZE - addr),
+                                  dirty ? &dirty[first + i] : nullptr, pages, bufs[i]);
+      }
+    };
+    vector<std::thread> threads;
+    for (unsigned t = 1; t < nr_threads; t++) {
+      threads.emplace_back(worker);
+    }
+    worker();
+    for (auto &t : threads) {
+      t.join();
+    }
+
+    for (uint64_t i = 0; i < n; i++) {
+      if (masks[i] == 0) continue;
+      if (fwrite(bufs[i].data(), 1, bufs[i].size(), fp) != bufs[i].size()) {
+        xpanic("Write failed on physical memory checkpoint file\n");
+      }
+      index.push_back({(first + i) * CPT_CHUNK_SIZE, offset, bufs[i].size(), masks[i]});
+      offset += bufs[i].size();
+    }
+  }
+
+  header.index_offset = offset;
+  header.nr_chunks = index.size();
+  if (fwrite(index.data(), sizeof(CptChunk), index.size(), fp) != index.size() ||
+      fseek(fp, 0, SEEK_SET) != 0 || fwrite(&header, sizeof(header), 1, fp) != 1) {
+    xpanic("Write failed on physical memory checkpoint file\n");
+  }
+  if (fclose(fp)) {
+    xpanic("Close failed on physical memory checkpoint file\n");
+  }
+  Log("Written %lu %s chunks of %lu, 0x%lx bytes with %u threads",
+      header.nr_chunks, dirty ? "dirty" : "non-zero", nr_chunks,
+      offset + index.size() * sizeof(CptChunk), nr_threads);
+  if (dirty) {
+    Log("The checkpoint is a delta on %s", parent.c_str());
+  }
+  Log("Checkpoint done!\n");
+}
+
+// wait for the oldest checkpoint writer
+void Serializer::waitWriter() {
+  pid_t pid = cptWriters.front();
+  cptWriters.pop_front();
+  int status;
+  if (waitpid(pid, &status, 0) != pid || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+    xpanic("Checkpoint writer %d failed\n", pid);
+  }
+}
+
+void Serializer::joinWriters() {
+  while (!cptWriters.empty()) {
+    waitWriter();
+  }
 }
 
 extern void csr_writeback();
@@ -123,6 +331,7 @@ void Serializer::serializeRegs() {
   auto *intRegCpt = (uint64_t *) (get_pmem() + IntRegStartAddr);
   for (unsigned i = 0; i < 32; i++) {
     *(intRegCpt + i) = cpu.gpr[i]._64;
+    cptRegs.gpr[i] = cpu.gpr[i]._64;
   }
   Log("Writing int registers to checkpoint memory @[0x%x, 0x%x) [0x%x, 0x%x)",
       INT_REG_CPT_ADDR, INT_REG_CPT_ADDR + 32 * 8,
@@ -133,6 +342,7 @@ void Serializer::serializeRegs() {
   auto *floatRegCpt = (uint64_t *) (get_pmem() + FloatRegStartAddr);
   for (unsigned i = 0; i < 32; i++) {
     *(floatRegCpt + i) = cpu.fpr[i]._64;
+    cptRegs.fpr[i] = cpu.fpr[i]._64;
   }
   Log("Writing float registers to checkpoint memory @[0x%x, 0x%x) [0x%x, 0x%x)",
       FLOAT_REG_CPT_ADDR, FLOAT_REG_CPT_ADDR + 32 * 8,
@@ -142,6 +352,7 @@ void Serializer::serializeRegs() {
 
   auto *pc = (uint64_t *) (get_pmem() + PCAddr);
   *pc = cpu.pc;
+  cptRegs.pc = cpu.pc;
   Log("Writing PC: 0x%lx at addr 0x%x", cpu.pc, PC_CPT_ADDR);
 
 
@@ -163,6 +374,7 @@ void Serializer::serializeRegs() {
     }
 
     *(csrCpt + i) = val;
+    cptRegs.csr[i] = val;
 
     if (csr_array[i] != 0) {
       Log("CSR 0x%x: 0x%lx", i, *(csrCpt + i));
@@ -180,20 +392,40 @@ void Serializer::serializeRegs() {
 
   auto *mode_flag = (uint64_t *) (get_pmem() + CptFlagAddr + 8);
   *mode_flag = cpu.mode;
+  cptRegs.mode = cpu.mode;
   Log("Record mode flag: 0x%lx at addr 0x%x", cpu.mode, BOOT_FLAGS+8);
 
   auto *mtime = (uint64_t *) (get_pmem() + CptFlagAddr + 16);
   extern word_t paddr_read(paddr_t addr, int len, int type, int mode, vaddr_t vaddr);
   *mtime = ::paddr_read(CLINT_MMIO+0xBFF8, 8, MEM_TYPE_READ, MODE_M, CLINT_MMIO+0xBFF8);
+  cptRegs.mtime = *mtime;
   Log("Record time: 0x%lx at addr 0x%x", cpu.mode, BOOT_FLAGS+16);
 
   auto *mtime_cmp = (uint64_t *) (get_pmem() + CptFlagAddr + 24);
   *mtime_cmp = ::paddr_read(CLINT_MMIO+0x4000, 8, MEM_TYPE_READ, MODE_M, CLINT_MMIO+0x4000);
+  cptRegs.mtimecmp = *mtime_cmp;
   Log("Record time: 0x%lx at addr 0x%x", cpu.mode, BOOT_FLAGS+24);
 
   regDumped = true;
 }
 
+// Read the registers dumped by serializeRegs() from pmem,
+// return false if there are not.
+bool Serializer::unserializeRegs(CptRegs &regs) {
+  uint8_t *pmem = get_pmem();
+  if (*(uint64_t *)(pmem + CptFlagAddr) != CPT_MAGIC_BUMBER) {
+    return false;
+  }
+  memcpy(regs.gpr, pmem + IntRegStartAddr, sizeof(regs.gpr));
+  memcpy(regs.fpr, pmem + FloatRegStartAddr, sizeof(regs.fpr));
+  memcpy(regs.csr, pmem + CSRStartAddr, sizeof(regs.csr));
+  regs.pc = *(uint64_t *)(pmem + PCAddr);
+  regs.mode = *(uint64_t *)(pmem + CptFlagAddr + 8);
+  regs.mtime = *(uint64_t *)(pmem + CptFlagAddr + 16);
+  regs.mtimecmp = *(uint64_t *)(pmem + CptFlagAddr + 24);
+  return true;
+}
+
 void Serializer::serialize(uint64_t inst_count) {
   pathManager.setOutputDir();
 //  isa_reg_display();
@@ -225,12 +457,31 @@ void Serializer::init() {
 
       Log("Simpoint %lu: @ %lu, weight: %f", simpoint_id, simpoint_location, weight);
     }
+  } else if (profiling_state == SimpointProfiling && checkpoint_taking) {
+    assert(checkpoint_interval);
+    intervalSize = checkpoint_interval;
+    takingCandidates = true;
+    nextUniformPoint = SimpointCptOffset;
+    candidatesPath = pathManager.getOutputPath() + "candidates/";
+    std::filesystem::create_directories(candidatesPath);
+    // the candidates are deltas on each other as possible
+    checkpoint_format = ChunkedCheckpoint;
+    IFNDEF(CONFIG_SMP, if (checkpoint_delta == 0) checkpoint_delta = 16);
+    Log("Taking simpoint candidates with profiling interval %lu to %s",
+        checkpoint_interval, candidatesPath.c_str());
   } else if (checkpoint_taking) {
     assert(checkpoint_interval);
     intervalSize = checkpoint_interval;
     Log("Taking uniform checkpionts with interval %lu", checkpoint_interval);
     nextUniformPoint = intervalSize;
   }
+
+  if (checkpoint_delta > 0) {
+    if (checkpoint_format != ChunkedCheckpoint) {
+      xpanic("Delta checkpoints are only supported by --cpt-format=cpt\n");
+    }
+    IFDEF(CONFIG_SMP, xpanic("Delta checkpoints are not supported with CONFIG_SMP\n"));
+  }
 }
 
 bool Serializer::shouldTakeCpt(uint64_t num_insts) {
@@ -242,7 +493,11 @@ bool Serializer::shouldTakeCpt(uint64_t num_insts) {
   extern bool profiling_started;
 
   if (profiling_state == SimpointCheckpointing) {
-      uint64_t next_point = simpoint2Weights.begin()->first * intervalSize + 100000;
+      // all simpoints are taken
+      if (simpoint2Weights.empty()) {
+          return false;
+      }
+      uint64_t next_point = simpoint2Weights.begin()->first * intervalSize + SimpointCptOffset;
       if (num_insts >= next_point) {
           Log("Should take cpt now: %lu", num_insts);
           return true;
@@ -267,18 +522,86 @@ void Serializer::notify_taken(uint64_t i) {
         pathManager.incCptID();
     }
 
+  } else if (takingCandidates) {
+    nextUniformPoint += intervalSize;
   } else if (checkpoint_taking) {
     nextUniformPoint += intervalSize;
     pathManager.incCptID();
   }
 }
 
+// Materialize the candidates of the simpoints picked into the checkpoints,
+// named and numbered as the ones taken with -S, and drop the candidates.
+void Serializer::takeSimpointCandidates(const string &simpoints_dir) {
+  assert(takingCandidates);
+  joinWriters();
+
+#ifdef CONFIG_MEM_COMPRESS
+  auto simpoints_file = fstream(simpoints_dir + "/simpoints0");
+  auto weights_file = fstream(simpoints_dir + "/weights0");
+  if (!simpoints_file || !weights_file) {
+    xpanic("No simpoints are found in %s\n", simpoints_dir.c_str());
+  }
+  uint64_t simpoint_location, simpoint_id, weight_id;
+  double weight;
+  while (simpoints_file >> simpoint_location >> simpoint_id) {
+    assert(weights_file >> weight >> weight_id);
+    assert(weight_id == simpoint_id);
+    simpoint2Weights[simpoint_location] = weight;
+  }
+
+  int id = 0;
+  for (auto &simpoint : simpoint2Weights) {
+    string candidate = candidatesPath + "_" + to_string(simpoint.first) + "_.cpt";
+    if (!std::filesystem::exists(candidate)) {
+      Log("Simpoint @ %lu is not taken, the run ends before it", simpoint.first);
+      continue;
+    }
+    CptHeader header;
+    FILE *fp = fopen(candidate.c_str(), "rb");
+    if (fp == nullptr || fread(&header, sizeof(header), 1, fp) != 1) {
+      xpanic("Can not read candidate %s\n", candidate.c_str());
+    }
+    fclose(fp);
+
+    load_cpt_img(candidate.c_str());
+    load_cpt_regs(candidate.c_str(), &cptRegs);
+
+    string dir = pathManager.getWorkloadPath() + to_string(id ++) + "/";
+    std::filesystem::create_directories(dir);
+    writeChunkedPMem(dir + "_" + to_string(simpoint.first) + "_" + to_string(simpoint.second) + "_.cpt",
+                     header.inst_count, nullptr, "");
+  }
+  std::filesystem::remove_all(candidatesPath);
+  Log("Taken %d simpoints from the candidates", id);
+#else
+  // the candidates are loaded with the chunked cpt loader of CONFIG_MEM_COMPRESS
+  xpanic("Taking simpoint candidates requires CONFIG_MEM_COMPRESS\n");
+#endif
+}
+
 Serializer serializer;
 
 extern "C" {
 
+static void join_serializer() {
+  serializer.joinWriters();
+}
+
 void init_serializer() {
   serializer.init();
+  // the checkpoints being written in background are finished before NEMU exits
+  if (checkpoint_jobs > 0) {
+    atexit(join_serializer);
+  }
+}
+
+void take_simpoint_candidates(const char *simpoints_dir) {
+  serializer.takeSimpointCandidates(simpoints_dir);
+}
+
+bool load_gcpt_regs(CptRegs *regs) {
+  return serializer.unserializeRegs(*regs);
 }
 
 bool try_take_cpt(uint64_t icount) {
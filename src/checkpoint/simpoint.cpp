@@ -40,12 +40,20 @@
 
 #include "checkpoint/path_manager.h"
 #include <cassert>
+#include <cstring>
 #include <debug.h>
 #include <vector>
 #include <algorithm>
+#include <filesystem>
+#include <fstream>
 #include <iostream>
+#include <iterator>
+#include <fcntl.h>
+#include <sys/wait.h>
+#include <unistd.h>
 #include "checkpoint/simpoint.h"
 #include "checkpoint/profiling.h"
+#include "checkpoint/bbv_format.h"
 
 namespace SimPointNS
 {
@@ -54,6 +62,8 @@ extern "C" {
 #include <debug.h>
 extern bool log_enable();
 extern FILE *log_fp;
+void simpoint_cluster(const char *bbv_file, const char *output_dir, int max_k);
+void take_simpoint_candidates(const char *simpoints_dir);
 }
 
 SimPoint::SimPoint()
@@ -69,7 +79,38 @@ SimPoint::SimPoint()
 }
 
 SimPoint::~SimPoint() {
-  NEMUNS::simout.close(simpointStream);
+  if (simpointStream)
+    NEMUNS::simout.close(simpointStream);
+}
+
+void
+SimPoint::finish() {
+  // the last shard ends with the run
+  if (inShard) {
+    endShard();
+  }
+  if (shardIntervals) {
+    stitchShards();
+  }
+
+  // the BBVs are complete when the stream is closed
+  if (bbvFile) {
+    if (gzclose(bbvFile) != Z_OK) {
+      xpanic("Close failed on BBV file %s\n", bbvPath.c_str());
+    }
+    bbvFile = nullptr;
+  } else {
+    NEMUNS::simout.close(simpointStream);
+    simpointStream = nullptr;
+  }
+
+  if (simpoint_cluster_maxk > 0) {
+    simpoint_cluster(bbvPath.c_str(), outputPath.c_str(), simpoint_cluster_maxk);
+  }
+  // in a single pass, the simpoints are taken from the candidates
+  if (checkpoint_taking) {
+    take_simpoint_candidates(outputPath.c_str());
+  }
 }
 
 void
@@ -78,7 +119,30 @@ SimPoint::init() {
     assert(checkpoint_interval);
     intervalSize = checkpoint_interval;
     Log("Doing simpoint profiling with interval %lu", intervalSize);
-    auto path = pathManager.getOutputPath() + "/simpoint_bbv.gz";
+    outputPath = pathManager.getOutputPath();
+    if (simpoint_shard_intervals > 0) {
+      shardIntervals = simpoint_shard_intervals;
+      shardsPath = outputPath + "shards/";
+      std::filesystem::create_directories(shardsPath);
+      Log("Profiling shards of %lu intervals with up to %d workers", shardIntervals, simpoint_shard_jobs);
+    }
+    if (simpoint_bbv_format == BinaryBbv) {
+      bbvPath = outputPath + "/simpoint_bbv.bin.gz";
+      bbvFile = gzopen(bbvPath.c_str(), "wb");
+      if (!bbvFile)
+        xpanic("unable to open SimPoint profile_file %s\n", bbvPath.c_str());
+      gzbuffer(bbvFile, 1 << 20);
+      BbvHeader header = {};
+      memcpy(header.magic, BBV_MAGIC, sizeof(BBV_MAGIC));
+      header.version = BBV_VERSION;
+      header.interval_size = intervalSize;
+      if (gzwrite(bbvFile, &header, sizeof(header)) != sizeof(header))
+        xpanic("Write failed on BBV file %s\n", bbvPath.c_str());
+      return;
+    }
+
+    bbvPath = outputPath + "/simpoint_bbv.gz";
+    auto path = bbvPath;
 
     using NEMUNS::simout;
     simpointStream = simout.create(path, false);
@@ -111,54 +175,249 @@ SimPoint::profile(Addr pc, bool is_control, bool is_last_uop, unsigned instr_cou
   // If inst is control inst, assume end of basic block.
   if (is_control) {
     currentBBV.second = pc;
-
-    auto map_itr = bbMap.find(currentBBV);
-    if (map_itr == bbMap.end()) {
-      // If a new (previously unseen) basic block is found,
-      // add a new unique id, record num of insts and insert into bbMap.
-      BBInfo info;
-      info.id = bbMap.size() + 1;
-      info.insts = currentBBVInstCount;
-      info.count = currentBBVInstCount;
-      bbMap.insert(::std::make_pair(currentBBV, info));
-    } else {
-      // If basic block is seen before, just increment the count by the
-      // number of insts in basic block.
-      BBInfo &info = map_itr->second;
-      info.count += currentBBVInstCount;
-    }
+    bbCounts[lookupBB(currentBBV, currentBBVInstCount)] += currentBBVInstCount;
     currentBBVInstCount = 0;
 
     // Reached end of interval if the sum of the current inst count
     // (intervalCount) and the excessive inst count from the previous
     // interval (intervalDrift) is greater than/equal to the interval size.
     if (intervalCount + intervalDrift >= intervalSize) {
-      // summarize interval and display BBV info
-      std::vector<std::pair<uint64_t, uint64_t> > counts;
-      for (auto map_itr = bbMap.begin(); map_itr != bbMap.end();
-           ++map_itr) {
-        BBInfo &info = map_itr->second;
-        if (info.count != 0) {
-          counts.push_back(std::make_pair(info.id, info.count));
-          info.count = 0;
-        }
+      endInterval();
+    }
+  }
+}
+
+void
+SimPoint::profile_bb(Addr pc, uint32_t *bb_id, uint64_t abs_icount) {
+  if (unlikely(shardIntervals && !inShard) && forwardShard(abs_icount)) {
+    return;
+  }
+
+  unsigned exec_count = abs_icount - lastICount;
+  lastICount = abs_icount;
+
+  // a basic block always starts and ends at the pc it is entered at,
+  // as the one profiled with is_control in profile()
+  uint32_t id = *bb_id;
+  if (unlikely(id == 0 || id >= bbStarts.size() || bbStarts[id] != pc)) {
+    id = *bb_id = lookupBB(BasicBlockRange(pc, pc), exec_count);
+  }
+  bbCounts[id] += exec_count;
+  intervalCount += exec_count;
+
+  if (intervalCount + intervalDrift >= intervalSize) {
+    endInterval();
+  }
+}
+
+uint32_t
+SimPoint::lookupBB(const BasicBlockRange &bb, uint64_t insts) {
+  auto map_itr = bbMap.find(bb);
+  if (map_itr != bbMap.end()) {
+    return map_itr->second.id;
+  }
+
+  // If a new (previously unseen) basic block is found,
+  // add a new unique id, record num of insts and insert into bbMap.
+  if (bbCounts.empty()) {
+    // id 0 is never used
+    bbCounts.push_back(0);
+    bbStarts.push_back(0);
+  }
+  BBInfo info;
+  info.id = bbMap.size() + 1;
+  info.insts = insts;
+  bbMap.insert(::std::make_pair(bb, info));
+  bbCounts.push_back(0);
+  bbStarts.push_back(bb.first);
+  return info.id;
+}
+
+void
+SimPoint::endInterval() {
+  if (inShard) {
+    packInterval(shardBuf);
+  } else {
+    writeInterval();
+  }
+  Log("Simpoint profilied %lu instrs", intervalCount);
+
+  intervalDrift = (intervalCount + intervalDrift) - intervalSize;
+  intervalCount = 0;
+  nrIntervals++;
+  if (inShard && nrIntervals == shardIntervals) {
+    endShard();
+  }
+}
+
+void
+SimPoint::writeInterval() {
+  if (bbvFile) {
+    bbvBuf.clear();
+    packInterval(bbvBuf);
+    if (gzwrite(bbvFile, bbvBuf.data(), bbvBuf.size()) != (int)bbvBuf.size())
+      xpanic("Write failed on BBV file %s\n", bbvPath.c_str());
+  } else {
+    writeTextInterval();
+  }
+}
+
+void
+SimPoint::packInterval(std::vector<uint8_t> &buf) {
+  // the number of the blocks goes before them, so leave the room for it
+  size_t start = buf.size();
+  buf.resize(start + BBV_VARINT_MAX + bbCounts.size() * 2 * BBV_VARINT_MAX);
+  size_t len = start + BBV_VARINT_MAX;
+  uint64_t nr_blocks = 0, prev_id = 0;
+  for (uint64_t id = 1; id < bbCounts.size(); id++) {
+    if (bbCounts[id] != 0) {
+      len += bbv_put_varint(&buf[len], id - prev_id);
+      len += bbv_put_varint(&buf[len], bbCounts[id]);
+      prev_id = id;
+      nr_blocks ++;
+      bbCounts[id] = 0;
+    }
+  }
+  uint8_t head[BBV_VARINT_MAX];
+  int head_len = bbv_put_varint(head, nr_blocks);
+  memmove(&buf[start + head_len], &buf[start + BBV_VARINT_MAX], len - start - BBV_VARINT_MAX);
+  memcpy(&buf[start], head, head_len);
+  buf.resize(len - BBV_VARINT_MAX + head_len);
+}
+
+bool
+SimPoint::forwardShard(uint64_t abs_icount) {
+  if (nrIntervals == shardID * shardIntervals) {
+    while (shardWorkers.size() >= (size_t)simpoint_shard_jobs) {
+      waitShard();
+    }
+    // the buffered outputs would be written again by the worker
+    fflush(NULL);
+    pid_t pid = fork();
+    if (pid < 0) {
+      xpanic("Failed to fork the shard worker\n");
+    } else if (pid == 0) {
+      // The guest output, the logs and the statistics come from the parent,
+      // which runs the whole workload. The devices write to stderr.
+      int null_fd = open("/dev/null", O_WRONLY);
+      if (null_fd < 0 || dup2(null_fd, STDOUT_FILENO) < 0 || dup2(null_fd, STDERR_FILENO) < 0) {
+        _exit(1);
       }
-      std::sort(counts.begin(), counts.end());
-
-      // Print output BBV info
-      *simpointStream->stream() << "T";
-      for (auto cnt_itr = counts.begin(); cnt_itr != counts.end();
-           ++cnt_itr) {
-        *simpointStream->stream() << ":" << cnt_itr->first
-                                  << ":" << cnt_itr->second << " ";
+      close(null_fd);
+      log_fp = nullptr;
+      // the streams belong to the parent
+      inShard = true;
+      nrIntervals = 0;
+      simpointStream = nullptr;
+      bbvFile = nullptr;
+      shardWorkers.clear();
+      return false;
+    }
+    shardWorkers.push_back(pid);
+    shardID++;
+  }
+
+  intervalCount += abs_icount - lastICount;
+  lastICount = abs_icount;
+  if (intervalCount + intervalDrift >= intervalSize) {
+    intervalDrift = (intervalCount + intervalDrift) - intervalSize;
+    intervalCount = 0;
+    nrIntervals++;
+  }
+  return true;
+}
+
+void
+SimPoint::endShard() {
+  // the blocks in the order of their ids in the shard
+  std::vector<BasicBlockRange> blocks(bbMap.size());
+  for (auto &bb : bbMap) {
+    blocks[bb.second.id - 1] = bb.first;
+  }
+  std::vector<uint8_t> buf((1 + blocks.size() * 2) * BBV_VARINT_MAX);
+  size_t len = bbv_put_varint(&buf[0], blocks.size());
+  for (auto &bb : blocks) {
+    len += bbv_put_varint(&buf[len], bb.first);
+    len += bbv_put_varint(&buf[len], bb.second);
+  }
+
+  std::string path = shardsPath + std::to_string(shardID);
+  FILE *fp = fopen(path.c_str(), "wb");
+  if (fp == nullptr || fwrite(buf.data(), 1, len, fp) != len ||
+      fwrite(shardBuf.data(), 1, shardBuf.size(), fp) != shardBuf.size() || fclose(fp)) {
+    xpanic("Write failed on shard %s\n", path.c_str());
+  }
+  Log("Profiled shard %lu of %lu intervals with %lu basic blocks", shardID, nrIntervals, blocks.size());
+  fflush(NULL);
+  _exit(0);
+}
+
+void
+SimPoint::waitShard() {
+  pid_t pid = shardWorkers.front();
+  shardWorkers.pop_front();
+  int status;
+  if (waitpid(pid, &status, 0) != pid || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+    xpanic("Shard worker %d failed\n", pid);
+  }
+}
+
+void
+SimPoint::stitchShards() {
+  while (!shardWorkers.empty()) {
+    waitShard();
+  }
+
+  // The ids are given in the order of the first sight of the blocks in the
+  // shards, which is the order they are seen without sharding, so the BBVs
+  // are the same as the ones profiled in one process.
+  uint64_t nr_intervals = 0;
+  std::vector<uint32_t> ids;
+  for (uint64_t shard = 0; shard < shardID; shard++) {
+    std::string path = shardsPath + std::to_string(shard);
+    std::ifstream file(path, std::ios::binary);
+    std::vector<uint8_t> buf((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    if (!file) {
+      xpanic("Can not read shard %s\n", path.c_str());
+    }
+
+    const uint8_t *p = buf.data(), *end = buf.data() + buf.size();
+    uint64_t nr_blocks, first, second;
+    p += bbv_get_varint(p, &nr_blocks);
+    ids.assign(nr_blocks + 1, 0);
+    for (uint64_t i = 1; i <= nr_blocks; i++) {
+      p += bbv_get_varint(p, &first);
+      p += bbv_get_varint(p, &second);
+      ids[i] = lookupBB(BasicBlockRange(first, second), 0);
+    }
+    while (p < end) {
+      uint64_t id = 0, delta, count;
+      p += bbv_get_varint(p, &nr_blocks);
+      for (uint64_t i = 0; i < nr_blocks; i++) {
+        p += bbv_get_varint(p, &delta);
+        p += bbv_get_varint(p, &count);
+        id += delta;
+        bbCounts[ids[id]] = count;
       }
-      *simpointStream->stream() << "\n";
-      Log("Simpoint profilied %lu instrs", intervalCount);
+      writeInterval();
+      nr_intervals++;
+    }
+  }
+  std::filesystem::remove_all(shardsPath);
+  Log("Stitched %lu intervals from %lu shards", nr_intervals, shardID);
+}
 
-      intervalDrift = (intervalCount + intervalDrift) - intervalSize;
-      intervalCount = 0;
+void
+SimPoint::writeTextInterval() {
+  // summarize interval and display BBV info, in the order of the ids
+  *simpointStream->stream() << "T";
+  for (uint64_t id = 1; id < bbCounts.size(); id++) {
+    if (bbCounts[id] != 0) {
+      *simpointStream->stream() << ":" << id << ":" << bbCounts[id] << " ";
+      bbCounts[id] = 0;
     }
   }
+  *simpointStream->stream() << "\n";
 }
 
 }
@@ -167,12 +426,23 @@ SimPointNS::SimPoint simpoit_obj;
 
 extern "C" {
 
+static void simpoint_finish() {
+  simpoit_obj.finish();
+}
+
 void simpoint_init() {
   simpoit_obj.init();
+  if (profiling_state == SimpointProfiling) {
+    atexit(simpoint_finish);
+  }
 }
 
 void simpoint_profiling(uint64_t pc, bool is_control, uint64_t abs_instr_count) {
   simpoit_obj.profile_with_abs_icount(pc, is_control, true, abs_instr_count);
 }
 
+void simpoint_profiling_bb(uint64_t pc, uint32_t *bb_id, uint64_t abs_instr_count) {
+  simpoit_obj.profile_bb(pc, bb_id, abs_instr_count);
+}
+
 }
\ No newline at end of file
@@ -0,0 +1,310 @@
+/***************************************************************************************
+* Copyright (c) 2020-2022 Institute of Computing Technology, Chinese Academy of Sciences
+*
+* NEMU is licensed under Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*          http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+* EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+* MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+*
+* See the Mulan PSL v2 for more details.
+***************************************************************************************/
+
+// Clustering of the simpoint BBVs, which picks the simpoints as SimPoint 3.2
+// does with its default options: the BBVs are normalized and randomly projected
+// to 15 dimensions, k-means is run from 5 seeds for each k up to max_k,
+// and the smallest k whose BIC reaches 90% of the range of the BICs is chosen.
+// The seeds are picked as k-means++ does instead of sampled uniformly, which
+// misses the small clusters less. The runs of k-means are independent, so they
+// are spread over host threads.
+
+#include <algorithm>
+#include <atomic>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include <zlib.h>
+
+extern "C" {
+#include <debug.h>
+}
+#include <checkpoint/bbv_format.h>
+
+namespace {
+
+const int projDims = 15;
+const int numInitSeeds = 5;
+const int maxIters = 100;
+const double bicThreshold = 0.9;
+const uint64_t projSeed = 2042712918;
+const uint64_t initSeed = 493575226;
+
+typedef std::vector<std::pair<uint64_t, double>> SparseBBV;
+
+struct KMeansRun {
+  std::vector<int> assign;
+  std::vector<double> centers;
+  double distortion;
+};
+
+bool readVarint(gzFile bbv, uint64_t &v) {
+  v = 0;
+  for (int shift = 0; shift < 64; shift += 7) {
+    int c = gzgetc(bbv);
+    if (c < 0) return false;
+    v |= (uint64_t)(c & 0x7f) << shift;
+    if (!(c & 0x80)) return true;
+  }
+  return false;
+}
+
+// Read the intervals of a binary BBV file, see checkpoint/bbv_format.h.
+void readBinaryBBV(gzFile bbv, const char *path, std::vector<SparseBBV> &intervals) {
+  uint64_t nr_blocks;
+  while (readVarint(bbv, nr_blocks)) {
+    SparseBBV v;
+    double total = 0;
+    uint64_t id = 0, delta, count;
+    for (uint64_t i = 0; i < nr_blocks; i ++) {
+      if (!readVarint(bbv, delta) || !readVarint(bbv, count)) {
+        xpanic("Truncated interval %zu in BBV file %s\n", intervals.size(), path);
+      }
+      id += delta;
+      v.emplace_back(id, count);
+      total += count;
+    }
+    for (auto &e : v) e.second /= total;
+    intervals.push_back(std::move(v));
+  }
+}
+
+// Read the intervals of a BBV file, in lines of "T:id:count :id:count ...",
+// or in the binary format.
+bool readBBV(const char *path, std::vector<SparseBBV> &intervals) {
+  gzFile bbv = gzopen(path, "rb");
+  if (bbv == NULL) return false;
+
+  BbvHeader header;
+  if (gzread(bbv, &header, sizeof(header)) == sizeof(header) &&
+      !memcmp(header.magic, BBV_MAGIC, sizeof(header.magic))) {
+    if (header.version != BBV_VERSION) {
+      xpanic("Unsupported version %u of BBV file %s\n", header.version, path);
+    }
+    readBinaryBBV(bbv, path, intervals);
+    gzclose(bbv);
+    return true;
+  }
+  gzrewind(bbv);
+
+  std::string line;
+  char buf[65536];
+  while (true) {
+    line.clear();
+    while (gzgets(bbv, buf, sizeof(buf)) != NULL) {
+      line += buf;
+      if (line.back() == '\n') break;
+    }
+    if (line.empty()) break;
+    if (line[0] != 'T') continue;
+
+    SparseBBV v;
+    double total = 0;
+    const char *p = line.c_str() + 1;
+    while (*p == ':') {
+      char *end;
+      uint64_t id = strtoull(p + 1, &end, 10);
+      uint64_t count = strtoull(end + 1, &end, 10);
+      v.emplace_back(id, count);
+      total += count;
+      for (p = end; *p == ' '; p ++);
+    }
+    // the BBVs are compared by the fractions of the instructions
+    for (auto &e : v) e.second /= total;
+    intervals.push_back(std::move(v));
+  }
+  gzclose(bbv);
+  return true;
+}
+
+// The element of the random projection matrix at row id and column dim, in
+// [-1, 1). It is hashed from (id, dim) by splitmix64, so the rows are made on
+// the fly instead of kept for every id up to the largest one.
+inline double projElement(uint64_t id, int dim) {
+  uint64_t z = projSeed + (id * projDims + dim + 1) * 0x9e3779b97f4a7c15ull;
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+  z ^= z >> 31;
+  return (z >> 11) * 0x1.0p-52 - 1;
+}
+
+inline double dist2(const double *a, const double *b) {
+  double d = 0;
+  for (int i = 0; i < projDims; i ++) {
+    d += (a[i] - b[i]) * (a[i] - b[i]);
+  }
+  return d;
+}
+
+KMeansRun kmeans(const std::vector<double> &data, int n, int k, uint64_t seed) {
+  std::mt19937_64 rng(seed);
+  KMeansRun r;
+  r.assign.assign(n, -1);
+  r.centers.resize(k * projDims);
+
+  // the initial centers are sampled from the points as k-means++ does,
+  // each with the probability proportional to its distance to the centers
+  std::vector<double> min_d(n, DBL_MAX);
+  int pick = rng() % n;
+  for (int c = 0; c < k; c ++) {
+    std::copy_n(&data[pick * projDims], projDims, &r.centers[c * projDims]);
+    double total = 0;
+    for (int i = 0; i < n; i ++) {
+      min_d[i] = std::min(min_d[i], dist2(&data[i * projDims], &r.centers[c * projDims]));
+      total += min_d[i];
+    }
+    double x = std::uniform_real_distribution<double>(0, total)(rng);
+    for (pick = 0; pick < n - 1 && (x -= min_d[pick]) > 0; pick ++);
+  }
+
+  std::vector<double> sum(k * projDims);
+  std::vector<int> size(k);
+  for (int iter = 0; iter < maxIters; iter ++) {
+    bool changed = false;
+    r.distortion = 0;
+    for (int i = 0; i < n; i ++) {
+      int best = 0;
+      double best_d = DBL_MAX;
+      for (int c = 0; c < k; c ++) {
+        double d = dist2(&data[i * projDims], &r.centers[c * projDims]);
+        if (d < best_d) { best_d = d; best = c; }
+      }
+      changed |= r.assign[i] != best;
+      r.assign[i] = best;
+      r.distortion += best_d;
+    }
+    if (!changed) break;
+
+    // an empty cluster keeps its center
+    std::fill(sum.begin(), sum.end(), 0);
+    std::fill(size.begin(), size.end(), 0);
+    for (int i = 0; i < n; i ++) {
+      size[r.assign[i]] ++;
+      for (int d = 0; d < projDims; d ++) sum[r.assign[i] * projDims + d] += data[i * projDims + d];
+    }
+    for (int c = 0; c < k; c ++) {
+      if (size[c] == 0) continue;
+      for (int d = 0; d < projDims; d ++) r.centers[c * projDims + d] = sum[c * projDims + d] / size[c];
+    }
+  }
+  return r;
+}
+
+// BIC of the clustering as identical spherical Gaussians, as in X-means
+double bic(const KMeansRun &r, int n, int k) {
+  std::vector<int> size(k);
+  for (int a : r.assign) size[a] ++;
+
+  double variance = n > k ? r.distortion / ((double)projDims * (n - k)) : 0;
+  variance = std::max(variance, 1e-12);
+  double likelihood = -0.5 * n * projDims * log(2 * M_PI * variance) - 0.5 * projDims * (n - k);
+  for (int c = 0; c < k; c ++) {
+    if (size[c] > 0) likelihood += size[c] * log((double)size[c] / n);
+  }
+  double params = (k - 1) + (double)k * projDims + 1;
+  return likelihood - 0.5 * params * log((double)n);
+}
+
+}
+
+extern "C" {
+
+// Pick the simpoints from the BBVs in bbv_file with up to max_k clusters,
+// and write them to simpoints0 and weights0 in output_dir.
+void simpoint_cluster(const char *bbv_file, const char *output_dir, int max_k) {
+  std::vector<SparseBBV> intervals;
+  if (!readBBV(bbv_file, intervals)) {
+    xpanic("Can not open BBV file %s\n", bbv_file);
+  }
+  int n = intervals.size();
+  if (n == 0) {
+    xpanic("No interval is found in BBV file %s\n", bbv_file);
+  }
+  if (max_k > n) max_k = n;
+
+  // random projection to projDims dimensions
+  std::vector<double> data(n * projDims, 0);
+  for (int i = 0; i < n; i ++) {
+    for (auto &e : intervals[i]) {
+      for (int d = 0; d < projDims; d ++) data[i * projDims + d] += e.second * projElement(e.first, d);
+    }
+  }
+  intervals.clear();
+
+  // each run has its own seed, so the result does not depend on the threads
+  int nr_runs = max_k * numInitSeeds;
+  std::vector<KMeansRun> runs(nr_runs);
+  std::atomic<int> next(0);
+  auto worker = [&]() {
+    int i;
+    while ((i = next.fetch_add(1)) < nr_runs) {
+      int k = i / numInitSeeds + 1;
+      runs[i] = kmeans(data, n, k, initSeed + i);
+    }
+  };
+  int nr_threads = std::max(1, std::min((int)std::thread::hardware_concurrency(), nr_runs));
+  std::vector<std::thread> threads;
+  for (int t = 1; t < nr_threads; t ++) threads.emplace_back(worker);
+  worker();
+  for (auto &t : threads) t.join();
+
+  // the run with the least distortion is kept for each k
+  std::vector<int> best(max_k + 1);
+  std::vector<double> bics(max_k + 1);
+  double min_bic = DBL_MAX, max_bic = -DBL_MAX;
+  for (int k = 1; k <= max_k; k ++) {
+    best[k] = (k - 1) * numInitSeeds;
+    for (int s = 1; s < numInitSeeds; s ++) {
+      int i = (k - 1) * numInitSeeds + s;
+      if (runs[i].distortion < runs[best[k]].distortion) best[k] = i;
+    }
+    bics[k] = bic(runs[best[k]], n, k);
+    min_bic = std::min(min_bic, bics[k]);
+    max_bic = std::max(max_bic, bics[k]);
+  }
+  int k = 1;
+  while (k < max_k && bics[k] < min_bic + bicThreshold * (max_bic - min_bic)) k ++;
+  const KMeansRun &r = runs[best[k]];
+
+  // the simpoint of a cluster is the interval closest to its center
+  std::vector<int> simpoint(k, -1), size(k, 0);
+  std::vector<double> simpoint_d(k, DBL_MAX);
+  for (int i = 0; i < n; i ++) {
+    int c = r.assign[i];
+    size[c] ++;
+    double d = dist2(&data[i * projDims], &r.centers[c * projDims]);
+    if (d < simpoint_d[c]) { simpoint_d[c] = d; simpoint[c] = i; }
+  }
+
+  std::string dir(output_dir);
+  std::ofstream simpoints_file(dir + "/simpoints0"), weights_file(dir + "/weights0");
+  if (!simpoints_file || !weights_file) {
+    xpanic("Can not write simpoints in %s\n", output_dir);
+  }
+  for (int c = 0; c < k; c ++) {
+    if (size[c] == 0) continue;
+    simpoints_file << simpoint[c] << " " << c << "\n";
+    weights_file << (double)size[c] / n << " " << c << "\n";
+  }
+  Log("Clustered %d intervals of %s into %d simpoints with %d threads, written to %s",
+      n, bbv_file, k, nr_threads, output_dir);
+}
+
+}
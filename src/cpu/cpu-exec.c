@@ -19,7 +19,11 @@
 #include <cpu/exec.h>
 #include <cpu/difftest.h>
 #include <cpu/decode.h>
+#include <memory/paddr.h>
 #include <memory/host-tlb.h>
+#ifdef CONFIG_EVENT_QUEUE
+#include <device/event.h>
+#endif
 #include <isa-all-instr.h>
 #include <locale.h>
 #include <setjmp.h>
@@ -37,12 +41,12 @@
 #define BATCH_SIZE 1
 #endif
 
-CPU_state cpu = {};
-uint64_t g_nr_guest_instr = 0;
+hart_local CPU_state cpu = {};
+hart_local uint64_t g_nr_guest_instr = 0;
 static uint64_t g_timer = 0; // unit: us
 static bool g_print_step = false;
 const rtlreg_t rzero = 0;
-rtlreg_t tmp_reg[4];
+hart_local rtlreg_t tmp_reg[4];
 
 #ifdef CONFIG_DEBUG
 static inline void debug_hook(vaddr_t pc, const char *asmbuf) {
@@ -54,10 +58,25 @@ static inline void debug_hook(vaddr_t pc, const char *asmbuf) {
 }
 #endif
 
-static jmp_buf jbuf_exec = {};
-static uint64_t n_remain_total;
-static int n_remain;
-static Decode *prev_s;
+static hart_local jmp_buf jbuf_exec = {};
+static hart_local uint64_t n_remain_total;
+static hart_local int n_remain;
+static hart_local int n_batch; // the number of instructions passed to the running execute()
+static hart_local Decode *prev_s;
+#ifdef CONFIG_SMP_LOCKSTEP
+static hart_local uint64_t quantum_end = CONFIG_SMP_QUANTUM; // the instruction count to end the round at
+#endif
+#ifdef CONFIG_IDLE_FAST_FORWARD
+static bool cpu_idle = false;
+static uint64_t g_nr_idle_instr = 0; // instructions skipped while waiting for interrupts
+#endif
+// whether the end of a basic block is profiled or checked for cpts, so execute()
+// only tests this when neither is on, such as when fast-forwarding to the profiling
+static bool bb_hooks = false;
+
+void update_bb_hooks() {
+  bb_hooks = profiling_started && (profiling_state == SimpointProfiling || checkpoint_taking);
+}
 
 void save_globals(Decode *s) {
   IFDEF(CONFIG_PERF_OPT, prev_s = s);
@@ -65,48 +84,109 @@ void save_globals(Decode *s) {
 
 uint64_t get_abs_instr_count () {
 #if defined(CONFIG_ENABLE_INSTR_CNT)
-  int n_batch = n_remain_total >= BATCH_SIZE ? BATCH_SIZE : n_remain_total;
+#ifdef CONFIG_PERF_OPT
   uint32_t n_executed = n_batch - n_remain;
   return n_executed + g_nr_guest_instr;
+#else
+  return g_nr_guest_instr;
+#endif
 #endif
   return 0;
 }
 
+#ifdef CONFIG_EVENT_QUEUE
+// the instruction count the events are keyed on, including the skipped ones
+uint64_t get_virtual_time() {
+  return get_abs_instr_count() + MUXDEF(CONFIG_IDLE_FAST_FORWARD, g_nr_idle_instr, 0);
+}
+#endif
+
 static void update_instr_cnt() {
 #if defined(CONFIG_ENABLE_INSTR_CNT)
-  int n_batch = n_remain_total >= BATCH_SIZE ? BATCH_SIZE : n_remain_total;
   uint32_t n_executed = n_batch - n_remain;
   n_remain_total -= (n_remain_total > n_executed) ? n_executed : n_remain_total;
   IFNDEF(CONFIG_DEBUG, g_nr_guest_instr += n_executed);
 
-  n_remain = n_batch > n_remain_total ? n_remain_total : n_batch; // clean n_remain
+  // clean n_remain, and count the rest of the batch from here
+  n_batch = n_batch > n_remain_total ? n_remain_total : n_batch;
+  n_remain = n_batch;
   // Loge("n_remain = %i, n_remain_total = %lu\n", n_remain, n_remain_total);
 #endif
 }
 
+#ifdef CONFIG_SMP
+// the statistics of the other harts are added here when they exit
+static uint64_t g_nr_guest_instr_harts = 0;
+static uint64_t nr_ras_hit_harts = 0;
+static uint64_t nr_ras_miss_harts = 0;
+#endif
+
 void monitor_statistic() {
   update_instr_cnt();
   setlocale(LC_NUMERIC, "");
   Log("host time spent = %'ld us", g_timer);
 #ifdef CONFIG_ENABLE_INSTR_CNT
-  Log("total guest instructions = %'ld", g_nr_guest_instr);
-  if (g_timer > 0) Log("simulation frequency = %'ld instr/s", g_nr_guest_instr * 1000000 / g_timer);
+  uint64_t nr_guest_instr = g_nr_guest_instr IFDEF(CONFIG_SMP, + g_nr_guest_instr_harts);
+  Log("total guest instructions = %'ld", nr_guest_instr);
+  IFDEF(CONFIG_IDLE_FAST_FORWARD, Log("idle instructions skipped = %'ld", g_nr_idle_instr));
+  if (g_timer > 0) Log("simulation frequency = %'ld instr/s", nr_guest_instr * 1000000 / g_timer);
   else Log("Finish running in less than 1 us and can not calculate the simulation frequency");
 #else
   Log("CONFIG_ENABLE_INSTR_CNT is not defined");
 #endif
+#ifdef CONFIG_PERF_OPT
+  void tcache_statistic();
+  tcache_statistic();
+  void ras_statistic();
+  ras_statistic();
+#endif
+#ifdef CONFIG_ENGINE_JIT
+  void jit_statistic();
+  jit_statistic();
+#endif
 }
 
-static word_t g_ex_cause = 0;
-static int g_sys_state_flag = 0;
+static hart_local word_t g_ex_cause = 0;
+static hart_local int g_sys_state_flag = 0;
 
 void set_sys_state_flag(int flag) {
   g_sys_state_flag |= flag;
 }
 
+#ifdef CONFIG_IDLE_FAST_FORWARD
+void cpu_wait_for_intr() {
+  cpu_idle = true;
+  set_sys_state_flag(SYS_STATE_UPDATE); // go back to cpu_exec()
+}
+
+// Nothing can happen before the next event while the hart is waiting for
+// interrupts, so jump to it instead of running the idle loop.
+// Return whether the hart is still waiting.
+static bool idle_fast_forward() {
+  uint64_t next = event_next();
+  if (isa_has_pending_intr() || next == EVENT_NONE) {
+    cpu_idle = false;
+    return false;
+  }
+  uint64_t now = get_virtual_time();
+  if (next > now) g_nr_idle_instr += next - now;
+  return true;
+}
+#endif
+
+// Decoded instructions are kept in the trace cache,
+// and they are validated against the new translation before executed again.
+void mmu_ifetch_remap() {
+#ifdef CONFIG_PERF_OPT
+  extern hart_local uint32_t g_tcache_epoch;
+  g_tcache_epoch ++;
+#endif
+}
+
 void mmu_tlb_flush(vaddr_t vaddr) {
   hosttlb_flush(vaddr);
-  if (vaddr == 0) set_sys_state_flag(SYS_STATE_FLUSH_TCACHE);
+  mmu_ifetch_remap();
+  set_sys_state_flag(SYS_STATE_REMAP);
 }
 
 _Noreturn
@@ -128,27 +208,44 @@ void longjmp_exception(int ex_cause) {
 #ifdef CONFIG_PERF_OPT
 #define FILL_EXEC_TABLE(name) [concat(EXEC_ID_, name)] = &&concat(exec_, name),
 
-#define rtl_j(s, target) do { \
-  IFDEF(CONFIG_ENABLE_INSTR_CNT, n -= s->idx_in_bb); \
-  s = s->tnext; \
-  goto end_of_bb; \
+// Basic blocks are entered at their first instruction. Other targets are
+// links inside a trace, which go on without the per basic block actions.
+#define bb_link(s, next) do { \
+  Decode *_next = (next); \
+  if (likely(_next->idx_in_bb == 1)) { \
+    IFDEF(CONFIG_ENABLE_INSTR_CNT, n -= s->idx_in_bb); \
+    s = _next; \
+    goto end_of_bb; \
+  } \
+  s = _next; \
+  goto finish_label; \
 } while (0)
+
+#define rtl_j(s, target) bb_link(s, s->tnext)
 #define rtl_jr(s, target) do { \
   IFDEF(CONFIG_ENABLE_INSTR_CNT, n -= s->idx_in_bb); \
   s = jr_fetch(s, *(target)); \
   goto end_of_bb; \
 } while (0)
-#define rtl_jrelop(s, relop, src1, src2, target) do { \
+#define rtl_jrelop(s, relop, src1, src2, target) \
+  bb_link(s, interpret_relop(relop, *src1, *src2) ? s->tnext : s->ntnext)
+#define rtl_ras_push(s) ras_push(s)
+#define rtl_ret(s, target) do { \
   IFDEF(CONFIG_ENABLE_INSTR_CNT, n -= s->idx_in_bb); \
-  if (interpret_relop(relop, *src1, *src2)) s = s->tnext; \
-  else s = s->ntnext; \
+  s = ras_fetch(s, *(target)); \
   goto end_of_bb; \
 } while (0)
 
 #define rtl_priv_next(s) do { \
   if (g_sys_state_flag) { \
-    s = (g_sys_state_flag & SYS_STATE_FLUSH_TCACHE) ? \
-      tcache_handle_flush(s->snpc) : s + 1; \
+    if (g_sys_state_flag & SYS_STATE_FLUSH_TCACHE) { \
+      IFDEF(CONFIG_ENABLE_INSTR_CNT, n -= s->idx_in_bb); \
+      s = tcache_handle_flush(s->snpc); \
+    } else if (g_sys_state_flag & (SYS_STATE_REMAP | SYS_STATE_FENCE_I)) { \
+      Decode *next = tcache_handle_stale(s); \
+      IFDEF(CONFIG_ENABLE_INSTR_CNT, if (next != s + 1) n -= s->idx_in_bb); \
+      s = next; \
+    } else { s = s + 1; } \
     g_sys_state_flag = 0; \
     goto end_of_loop; \
   } \
@@ -170,6 +267,13 @@ Decode* tcache_jr_fetch(Decode *s, vaddr_t jpc);
 Decode* tcache_decode(Decode *s);
 void tcache_handle_exception(vaddr_t jpc);
 Decode* tcache_handle_flush(vaddr_t snpc);
+Decode* tcache_handle_stale(Decode *s);
+Decode* tcache_validate(Decode *s);
+void tcache_trace_promote(Decode *s);
+void tcache_ras_fill(Decode *call, Decode *ret);
+void jit_init(const void **exec_table, const void *exec_nemu_decode, int *n_remain, bool *bb_hooks);
+void jit_compile(Decode *s);
+extern hart_local uint32_t g_tcache_epoch;
 
 static inline
 Decode* jr_fetch(Decode *s, vaddr_t target) {
@@ -178,7 +282,71 @@ Decode* jr_fetch(Decode *s, vaddr_t target) {
   return tcache_jr_fetch(s, target);
 }
 
+// Calls push their return address, and returns are predicted by it.
+// The return site is cached in the call after the first return.
+#define RAS_SIZE 32
+#define RAS_MAX_UNWIND 4
+
+typedef struct {
+  vaddr_t pc;
+  Decode *call;
+} ras_entry_t;
+
+static hart_local ras_entry_t ras[RAS_SIZE] = {};
+static hart_local int ras_top = 0;
+static hart_local uint64_t nr_ras_hit = 0;
+static hart_local uint64_t nr_ras_miss = 0;
+
+void ras_statistic() {
+  Log("ras: %'lu returns predicted, %'lu missed", nr_ras_hit IFDEF(CONFIG_SMP, + nr_ras_hit_harts),
+      nr_ras_miss IFDEF(CONFIG_SMP, + nr_ras_miss_harts));
+}
+
+// The calls in the entries are in the trace cache, so the entries
+// are dropped when the calls are evicted or the trace cache is flushed.
+void ras_evict(Decode *start, Decode *end) {
+  int i;
+  for (i = 0; i < RAS_SIZE; i ++) {
+    if (ras[i].call >= start && ras[i].call < end) { ras[i].call = NULL; }
+  }
+}
+
+void ras_flush() {
+  memset(ras, 0, sizeof(ras));
+  ras_top = 0;
+}
+
+static inline void ras_push(Decode *s) {
+  ras_top = (ras_top + 1) % RAS_SIZE;
+  ras[ras_top] = (ras_entry_t){ .pc = s->snpc, .call = s };
+}
+
+// The prediction is checked against the real target. Frames skipped by
+// longjmp() are popped if the target is found in the entries below the top.
+// Otherwise the stack is kept, and the return is fetched as other indirect jumps.
+static inline Decode* ras_fetch(Decode *s, vaddr_t target) {
+  int i;
+  for (i = 0; i < RAS_MAX_UNWIND; i ++) {
+    ras_entry_t *e = &ras[(ras_top + RAS_SIZE - i) % RAS_SIZE];
+    if (likely(e->pc == target && e->call != NULL)) {
+      ras_top = (ras_top + RAS_SIZE - i - 1) % RAS_SIZE;
+      Decode *ret = e->call->rnext;
+      if (likely(ret != NULL && ret->pc == target)) {
+        nr_ras_hit ++;
+        return ret;
+      }
+      nr_ras_miss ++;
+      ret = jr_fetch(s, target);
+      tcache_ras_fill(e->call, ret);
+      return ret;
+    }
+  }
+  nr_ras_miss ++;
+  return jr_fetch(s, target);
+}
+
 static inline void debug_difftest(Decode *_this, Decode *next) {
+  IFDEF(CONFIG_ENGINE_JIT, if (_this == NULL) return); // checked by jit_exec()
   IFDEF(CONFIG_IQUEUE, iqueue_commit(_this->pc, (void *)&_this->isa.instr.val, _this->snpc - _this->pc));
   IFDEF(CONFIG_DEBUG, debug_hook(_this->pc, _this->logbuf));
   IFDEF(CONFIG_DIFFTEST, save_globals(next));
@@ -186,10 +354,44 @@ static inline void debug_difftest(Decode *_this, Decode *next) {
   IFDEF(CONFIG_DIFFTEST, difftest_step(_this->pc, next->pc));
 }
 
-uint64_t per_bb_profile(Decode *s) {
+#ifdef CONFIG_ENGINE_JIT
+#ifdef CONFIG_DIFFTEST
+// the host code being run, whose exception is raised in the middle of it
+static hart_local Decode *jit_s = NULL;
+
+// let the reference run the instructions before the one raising the exception
+static void jit_difftest_exception() {
+  Decode *p;
+  for (p = jit_s; jit_s != NULL && p < prev_s; p ++) ref_difftest_exec(1);
+  jit_s = NULL;
+}
+#endif
+
+// The instructions run by the host code are checked together after it returns. Without
+// chaining, it runs one basic block, and returns either in it or after its tail.
+static inline Decode* jit_exec(Decode *s) {
+#ifdef CONFIG_DIFFTEST
+  jit_s = s;
+  Decode *next = ((Decode* (*)())s->jit_code)();
+  jit_s = NULL;
+  Decode *tail = s;
+  while (tail->type == INSTR_TYPE_N) tail ++;
+  save_globals(next);
+  cpu.pc = next->pc;
+  difftest_step_n(s->pc, next->pc, (next > s && next <= tail) ? next - s : tail - s + 1);
+  return next;
+#else
+  return ((Decode* (*)())s->jit_code)();
+#endif
+}
+#endif
+
+// kept out of execute(), as it is only called with bb_hooks
+static __attribute__((noinline)) void per_bb_profile(Decode *s) {
   uint64_t abs_inst_count = get_abs_instr_count();
   if (profiling_state == SimpointProfiling && profiling_started) {
-    simpoint_profiling(s->pc, true, abs_inst_count);
+    extern void simpoint_profiling_bb(uint64_t pc, uint32_t *bb_id, uint64_t abs_instr_count);
+    simpoint_profiling_bb(s->pc, &s->bbv_id, abs_inst_count);
   }
 
   extern bool able_to_take_cpt();
@@ -203,7 +405,6 @@ uint64_t per_bb_profile(Decode *s) {
       Log("Should take checkpoint on pc 0x%lx", s->pc);
     }
   }
-  return abs_inst_count;
 }
 
 static int execute(int n) {
@@ -211,16 +412,20 @@ static int execute(int n) {
   static const void* local_exec_table[TOTAL_INSTR] = {
     MAP(INSTR_LIST, FILL_EXEC_TABLE)
   };
-  static int init_flag = 0;
+  static hart_local int init_flag = 0;
   Decode *s = prev_s;
+  // n_remain is used by longjmp() before the end of the first basic block
+  IFDEF(CONFIG_ENABLE_INSTR_CNT, n_remain = n);
 
   if (likely(init_flag == 0)) {
     g_exec_table = local_exec_table;
     extern Decode* tcache_init(const void *exec_nemu_decode, vaddr_t reset_vector);
     s = tcache_init(&&exec_nemu_decode, cpu.pc);
+    IFDEF(CONFIG_ENGINE_JIT, jit_init(g_exec_table, &&exec_nemu_decode, &n_remain, &bb_hooks));
     IFDEF(CONFIG_MODE_SYSTEM, hosttlb_init());
     init_flag = 1;
   }
+  if (unlikely(s->epoch != g_tcache_epoch)) s = tcache_validate(s);
 
   __attribute__((unused)) Decode *this_s = NULL;
   while (true) {
@@ -248,14 +453,35 @@ def_EHelper(nemu_decode) {
 end_of_bb:
     IFDEF(CONFIG_ENABLE_INSTR_CNT, n_remain = n);
     IFNDEF(CONFIG_ENABLE_INSTR_CNT, n --);
+    // decoded instructions may be stale after the translation is changed
+    if (unlikely(s->epoch != g_tcache_epoch)) s = tcache_validate(s);
+#if CONFIG_TCACHE_TRACE_THRESHOLD > 0 || defined(CONFIG_ENGINE_JIT)
+    uint32_t exec_cnt = ++ s->exec_cnt;
+#if CONFIG_TCACHE_TRACE_THRESHOLD > 0
+    if (unlikely(exec_cnt == CONFIG_TCACHE_TRACE_THRESHOLD)) tcache_trace_promote(s);
+#endif
+    IFDEF(CONFIG_ENGINE_JIT, if (unlikely(exec_cnt == CONFIG_JIT_THRESHOLD)) jit_compile(s));
+#endif
 
     // Here is per bb action
-    uint64_t abs_inst_count = per_bb_profile(s);
+    if (unlikely(bb_hooks)) per_bb_profile(s);
     Logtb("prev pc = 0x%lx, pc = 0x%lx", prev_s->pc, s->pc);
-    Logtb("Executed %ld instructions in total, pc: 0x%lx\n", (int64_t) abs_inst_count, prev_s->pc);
+    Logtb("Executed %ld instructions in total, pc: 0x%lx\n", (int64_t) get_abs_instr_count(), prev_s->pc);
 
     if (unlikely(n <= 0)) break;
 
+#ifdef CONFIG_ENGINE_JIT
+    // the host code returns the first instruction it does not run, which is
+    // the next basic block if it ends with a translated branch or jump
+    if (s->jit_code != NULL) {
+      debug_difftest(this_s, s);
+      s = jit_exec(s);
+      n = n_remain;
+      if (s->idx_in_bb == 1) { this_s = NULL; goto end_of_bb; }
+      continue;
+    }
+#endif
+
     // Here is per inst action
     // Because every instruction executed goes here, don't put Log here to improve performance
     def_finish();
@@ -267,7 +493,7 @@ end_of_loop:
   // Here is per loop action and some priv instruction action
   Loge("end_of_loop: prev pc = 0x%lx, pc = 0x%lx, total insts: %lu, remain: %lu",
        prev_s->pc, s->pc, get_abs_instr_count(), n_remain_total);
-  per_bb_profile(s);
+  if (unlikely(bb_hooks)) per_bb_profile(s);
 
   debug_difftest(this_s, s);
   prev_s = s;
@@ -278,6 +504,8 @@ end_of_loop:
 
 #define rtl_priv_next(s)
 #define rtl_priv_jr(s, target) rtl_jr(s, target)
+#define rtl_ras_push(s)
+#define rtl_ret(s, target) rtl_jr(s, target)
 
 #include "isa-exec.h"
 static const void* g_exec_table[TOTAL_INSTR] = {
@@ -285,7 +513,7 @@ static const void* g_exec_table[TOTAL_INSTR] = {
 };
 
 static int execute(int n) {
-  static Decode s;
+  static hart_local Decode s;
   prev_s = &s;
   for (;n > 0; n --) {
     fetch_decode(&s, cpu.pc);
@@ -303,6 +531,7 @@ static int execute(int n) {
     if (nemu_state.state == NEMU_STOP) {
         break;
     }
+    IFDEF(CONFIG_IDLE_FAST_FORWARD, if (cpu_idle) { n --; break; });
   }
   return n;
 }
@@ -327,21 +556,7 @@ static void update_global() {
 }
 #endif
 
-/* Simulate how the CPU works. */
-void cpu_exec(uint64_t n) {
-  IFDEF(CONFIG_SHARE, assert(n <= 1));
-  g_print_step = (n < MAX_INSTR_TO_PRINT);
-  switch (nemu_state.state) {
-    case NEMU_END: case NEMU_ABORT:
-      printf("Program execution has ended. To restart the program, exit NEMU and run again.\n");
-      return;
-    default:
-      nemu_state.state = NEMU_RUNNING;
-      Loge("Setting NEMU state to RUNNING");
-  }
-
-  uint64_t timer_start = get_time();
-
+static void exec_loop(uint64_t n) {
   n_remain_total = n; // deal with setjmp()
   Loge("cpu_exec will exec %lu instrunctions", n_remain_total);
   int cause;
@@ -356,14 +571,39 @@ void cpu_exec(uint64_t n) {
 
   while (nemu_state.state == NEMU_RUNNING &&
       MUXDEF(CONFIG_ENABLE_INSTR_CNT, n_remain_total > 0, true)) {
+    IFDEF(CONFIG_EVENT_QUEUE, event_run(get_virtual_time()));
+#ifdef CONFIG_SMP_LOCKSTEP
+    if (cause == NEMU_EXEC_SERIAL) {
+      // run the rest of the quantum serially from the instruction
+      cause = 0;
+      smp_end_parallel(true);
+      tcache_handle_exception(cpu.pc);
+      continue;
+    }
+    if (get_abs_instr_count() >= quantum_end) {
+      if (pmem_buffered) smp_end_parallel(false);
+      else smp_end_serial();
+      quantum_end += CONFIG_SMP_QUANTUM;
+      continue;
+    }
+#endif
+#ifdef CONFIG_SMP
+    // the CLINT is shared, and each hart picks up its own interrupts
+    extern void update_clint();
+    update_clint();
+#endif
 #ifdef CONFIG_DEVICE
     extern void device_update();
-    device_update();
+    if (MUXDEF(CONFIG_SMP, g_hart_id == 0, true)) device_update();
 #endif
+    IFDEF(CONFIG_IDLE_FAST_FORWARD, if (cpu_idle && cause == 0 && idle_fast_forward()) continue);
 
     if (cause == NEMU_EXEC_EXCEPTION) {
       Loge("Handle NEMU_EXEC_EXCEPTION");
       cause = 0;
+#if defined(CONFIG_ENGINE_JIT) && defined(CONFIG_DIFFTEST)
+      jit_difftest_exception();
+#endif
       cpu.pc = raise_intr(g_ex_cause, prev_s->pc);
       cpu.amo = false; // clean up
       IFDEF(CONFIG_PERF_OPT, tcache_handle_exception(cpu.pc));
@@ -378,7 +618,18 @@ void cpu_exec(uint64_t n) {
       }
     }
 
-    int n_batch = n_remain_total >= BATCH_SIZE ? BATCH_SIZE : n_remain_total;
+    n_batch = n_remain_total >= BATCH_SIZE ? BATCH_SIZE : n_remain_total;
+    n_remain = n_batch; // keep get_abs_instr_count() right before execute()
+#ifdef CONFIG_EVENT_QUEUE
+    // run until the next event, which is always later than now after event_run()
+    uint64_t n_event = event_next() - get_virtual_time();
+    if (n_batch > n_event) n_batch = n_remain = n_event;
+#endif
+#ifdef CONFIG_SMP_LOCKSTEP
+    // end the quantum at the end of the basic block reaching it
+    uint64_t n_quantum = quantum_end - get_abs_instr_count();
+    if (n_batch > n_quantum) n_batch = n_remain = n_quantum;
+#endif
     n_remain = execute(n_batch);
 #ifdef CONFIG_PERF_OPT
     // return from execute
@@ -388,11 +639,45 @@ void cpu_exec(uint64_t n) {
     n_remain_total -= n_batch;
 #endif
   }
+}
+
+#ifdef CONFIG_SMP
+// the other harts run until NEMU stops, and leave nemu_state to hart 0
+void smp_hart_exec() {
+  exec_loop(-1);
+  update_instr_cnt();
+  __atomic_fetch_add(&g_nr_guest_instr_harts, g_nr_guest_instr, __ATOMIC_RELAXED);
+  __atomic_fetch_add(&nr_ras_hit_harts, nr_ras_hit, __ATOMIC_RELAXED);
+  __atomic_fetch_add(&nr_ras_miss_harts, nr_ras_miss, __ATOMIC_RELAXED);
+  void tcache_statistic_merge();
+  tcache_statistic_merge();
+}
+#endif
+
+/* Simulate how the CPU works. */
+void cpu_exec(uint64_t n) {
+  IFDEF(CONFIG_SHARE, assert(n <= 1));
+  g_print_step = (n < MAX_INSTR_TO_PRINT);
+  switch (nemu_state.state) {
+    case NEMU_END: case NEMU_ABORT:
+      printf("Program execution has ended. To restart the program, exit NEMU and run again.\n");
+      return;
+    default:
+      nemu_state.state = NEMU_RUNNING;
+      Loge("Setting NEMU state to RUNNING");
+  }
+  IFDEF(CONFIG_SMP, smp_start_harts());
+  update_bb_hooks();
+
+  uint64_t timer_start = get_time();
+
+  exec_loop(n);
 
   // If nemu_state.state is NEMU_RUNNING, n_remain_total should be zero.
   if (nemu_state.state == NEMU_RUNNING) {
     nemu_state.state = NEMU_QUIT;
   }
+  IFDEF(CONFIG_SMP, smp_join_harts());
 
   uint64_t timer_end = get_time();
   g_timer += timer_end - timer_start;
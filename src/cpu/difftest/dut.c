@@ -157,6 +157,30 @@ void difftest_step(vaddr_t pc, vaddr_t npc) {
 
   checkregs(&ref_r, pc);
 }
+
+// the `n` instructions from `pc` are run as one step by the host code of the JIT
+void difftest_step_n(vaddr_t pc, vaddr_t npc, int n) {
+  CPU_state ref_r;
+
+#ifndef __ICS_EXPORT
+  if (is_detach) return;
+
+#endif
+  if (skip_dut_nr_instr > 0 || is_skip_ref) {
+    // some of the instructions can not be checked, so the whole step is skipped
+    ref_difftest_regcpy(&cpu, DIFFTEST_TO_REF);
+    skip_dut_nr_instr = 0;
+    is_skip_ref = false;
+    return;
+  }
+
+  // the reference of NEMU runs at most one instruction per call
+  int i;
+  for (i = 0; i < n; i ++) ref_difftest_exec(1);
+  ref_difftest_regcpy(&ref_r, DIFFTEST_TO_DUT);
+
+  checkregs(&ref_r, pc);
+}
 #ifndef __ICS_EXPORT
 void difftest_detach() {
   is_detach = true;
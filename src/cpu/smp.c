@@ -0,0 +1,169 @@
+/***************************************************************************************
+* Copyright (c) 2020-2022 Institute of Computing Technology, Chinese Academy of Sciences
+*
+* NEMU is licensed under Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*          http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+* EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+* MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+*
+* See the Mulan PSL v2 for more details.
+***************************************************************************************/
+
+#include <isa.h>
+#include <cpu/cpu.h>
+#include <memory/paddr.h>
+#include <memory/host-tlb.h>
+
+#ifdef CONFIG_SMP
+#include <pthread.h>
+
+// the trace cache and the host TLB of a hart are in its static TLS
+#define HART_STACK_SIZE (64 * 1024 * 1024)
+
+hart_local int g_hart_id = 0;
+
+static pthread_t harts[CONFIG_NR_HARTS] = {};
+static CPU_state boot_cpu = {};
+static rtlreg_t boot_csr[4096] = {};
+
+#ifdef CONFIG_SMP_LOCKSTEP
+// In each round, the harts run their quanta in parallel with their stores
+// buffered. After all harts finish the parallel part, the stores are
+// committed in the order of the harts. Then the harts stopped at atomic
+// instructions or device accesses take turns in the order of the harts to
+// run the rest of their quanta, and the round ends.
+static pthread_mutex_t round_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t round_cond = PTHREAD_COND_INITIALIZER;
+static uint64_t nr_round = 0;
+static int nr_arrived = 0; // the harts finishing the parallel part
+static uint64_t serial_harts = 0; // the harts to run serially, one bit for each
+static int turn = -1; // the hart running serially
+
+uint64_t smp_round() {
+  return nr_round;
+}
+
+// called with round_mutex held
+static void next_turn() {
+  if (serial_harts != 0) {
+    turn = __builtin_ctzll(serial_harts);
+  } else {
+    turn = -1;
+    nr_arrived = 0;
+    nr_round ++;
+    extern void update_mtime();
+    update_mtime();
+  }
+  pthread_cond_broadcast(&round_cond);
+}
+
+static void wait_round_end(uint64_t round) {
+  while (nr_round == round && nemu_state.state == NEMU_RUNNING) {
+    pthread_cond_wait(&round_cond, &round_mutex);
+  }
+}
+
+// Called when the parallel part of the hart ends, or stops before an
+// instruction to run `serial`ly. Return when the hart runs the rest of
+// its quantum serially, or the round ends.
+void smp_end_parallel(bool serial) {
+  pthread_mutex_lock(&round_mutex);
+  uint64_t round = nr_round;
+  if (serial) serial_harts |= 1ull << g_hart_id;
+  if (++ nr_arrived == CONFIG_NR_HARTS) {
+    pmem_commit();
+    next_turn();
+  }
+  if (serial) {
+    while (turn != g_hart_id && nemu_state.state == NEMU_RUNNING) {
+      pthread_cond_wait(&round_cond, &round_mutex);
+    }
+  } else {
+    wait_round_end(round);
+  }
+  pthread_mutex_unlock(&round_mutex);
+  pmem_buffer_reset();
+  pmem_buffered = !serial;
+}
+
+// called when the hart runs serially to the end of its quantum
+void smp_end_serial() {
+  pthread_mutex_lock(&round_mutex);
+  uint64_t round = nr_round;
+  serial_harts &= ~(1ull << g_hart_id);
+  next_turn();
+  wait_round_end(round);
+  pthread_mutex_unlock(&round_mutex);
+  pmem_buffered = true;
+  // the host TLB maps pages to pmem for the stores
+  hosttlb_flush(0);
+}
+
+// wake up the harts waiting for the round, so they find that NEMU stops
+static void wake_harts() {
+  pthread_mutex_lock(&round_mutex);
+  pthread_cond_broadcast(&round_cond);
+  pthread_mutex_unlock(&round_mutex);
+}
+#endif
+
+static void *hart_main(void *arg) {
+  g_hart_id = (intptr_t)arg;
+  cpu = boot_cpu;
+  memcpy(csr_array, boot_csr, sizeof(boot_csr));
+  isa_init_hart(g_hart_id);
+  Log("hart %d starts from pc = " FMT_WORD, g_hart_id, cpu.pc);
+  IFDEF(CONFIG_SMP_LOCKSTEP, pmem_buffered = true);
+  smp_hart_exec();
+  IFDEF(CONFIG_SMP_LOCKSTEP, wake_harts());
+  return NULL;
+}
+
+// The other harts start from the state of hart 0 before it runs any
+// instruction, and run on their own threads until NEMU stops.
+void smp_start_harts() {
+  static bool started = false;
+  if (started) return;
+  started = true;
+
+  boot_cpu = cpu;
+  memcpy(boot_csr, csr_array, sizeof(boot_csr));
+
+  pthread_attr_t attr;
+  pthread_attr_init(&attr);
+  pthread_attr_setstacksize(&attr, HART_STACK_SIZE);
+  int i;
+  for (i = 1; i < CONFIG_NR_HARTS; i ++) {
+    int ret = pthread_create(&harts[i], &attr, hart_main, (void *)(intptr_t)i);
+    Assert(ret == 0, "Can not create thread for hart %d", i);
+  }
+  pthread_attr_destroy(&attr);
+  IFDEF(CONFIG_SMP_LOCKSTEP, pmem_buffered = true);
+}
+
+// Called by hart 0 after NEMU stops. The other harts leave their loops
+// as nemu_state is no longer NEMU_RUNNING, and they are joined here.
+void smp_join_harts() {
+  static bool joined = false;
+  if (joined) return;
+  joined = true;
+
+  assert(nemu_state.state != NEMU_RUNNING);
+  IFDEF(CONFIG_SMP_LOCKSTEP, wake_harts());
+  int i;
+  for (i = 1; i < CONFIG_NR_HARTS; i ++) {
+    int ret = pthread_join(harts[i], NULL);
+    Assert(ret == 0, "Can not join the thread of hart %d", i);
+  }
+#ifdef CONFIG_SMP_LOCKSTEP
+  // the stores of the last round
+  pmem_commit();
+  pmem_buffer_reset();
+  pmem_buffered = false;
+#endif
+}
+#endif
@@ -15,39 +15,105 @@
 
 #include <cpu/decode.h>
 #include <cpu/cpu.h>
+#include <memory/paddr.h>
+#include <memory/vaddr.h>
+#include <checkpoint/profiling.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <assert.h>
 
 #ifdef CONFIG_PERF_OPT
 
 #define TCACHE_BB_SIZE (CONFIG_TCACHE_SIZE / 4 + 2)
+#define TCACHE_NR_REGION CONFIG_TCACHE_REGIONS
+// tcache_bb_new() checks the next two entries of the freelist
+#define TCACHE_BB_RESERVED 3
+#define JR_SITE_SETS 512
+#define JR_SITE_WAYS 4
+#define JR_TARGET_SIZE 4096
+
+// operands are larger with CONFIG_DEBUG, CONFIG_RVV or x86
+#if !defined(CONFIG_DEBUG) && !defined(CONFIG_RVV) && !defined(CONFIG_ISA_x86)
+static_assert(offsetof(Decode, snpc) <= DECODE_HOT_SIZE, "hot fields of Decode exceed a cache line");
+#endif
 
+// Basic blocks are indexed by both the virtual and physical address of pc,
+// so code of different address spaces can stay in the trace cache together.
+// Links are resolved before the translation is known, so the table is hashed
+// on the virtual pc, and the physical pc is checked in the entry.
 typedef struct bb_t {
   Decode *s;
-  struct bb_t *next;
-  vaddr_t pc;
+  paddr_t paddr;
+  int mmu_state; // loads and stores are decoded for the data mmu state
+  bool single_epoch; // only valid in the epoch it is decoded
 } bb_t;
 
+#define BB_ANY_PADDR ((paddr_t)-1ul)
+#define BB_EMPTY ((vaddr_t)-1ul)
+
 enum { BB_RECORD_TYPE_NTAKEN = 1, BB_RECORD_TYPE_TAKEN };
 
-static Decode tcache_pool[CONFIG_TCACHE_SIZE] = {};
-static int tc_idx = 0;
-static Decode tcache_bb_pool[TCACHE_BB_SIZE] = {};
-static Decode *tcache_bb_freelist = NULL;
-static bb_t bb_pool[CONFIG_BB_POOL_SIZE] = {};
-static int bb_idx = 0;
-static bb_t bb_list [CONFIG_BB_LIST_SIZE] = {};
-static const void *g_exec_nemu_decode;
+static hart_local Decode tcache_pool[CONFIG_TCACHE_SIZE] = {};
+static hart_local int tc_idx = 0;
+static hart_local int tc_region = 0;
+static hart_local Decode tcache_bb_pool[TCACHE_BB_SIZE] = {};
+static hart_local Decode *tcache_bb_freelist = NULL;
+static hart_local int tcache_bb_nr_free = 0;
+// Open addressing with linear probing. The pc of the entries are kept in
+// a separate array, so probing scans consecutive keys, 8 in a cache line.
+// The table is doubled when it is half full. Every basic block takes at
+// least one entry of `tcache_pool`, so it never grows beyond that.
+static hart_local vaddr_t *bb_pc = NULL;
+static hart_local bb_t *bb_table = NULL;
+static hart_local uint32_t bb_cap = 0;
+static hart_local uint32_t bb_nr = 0;
+static hart_local const void *g_exec_nemu_decode;
+hart_local uint32_t g_tcache_epoch = 0;
+
+// Targets of indirect jumps beyond the two kept in `tnext` and `ntnext`.
+// They are looked up in a set-associative cache tagged with the jump site,
+// then in a cache indexed by the target pc shared by all sites.
+// Only the first instruction of basic blocks in `tcache_pool` is cached.
+typedef struct {
+  Decode *site;
+  Decode *target;
+} jr_entry_t;
+
+static hart_local jr_entry_t jr_site_cache[JR_SITE_SETS][JR_SITE_WAYS] = {};
+static hart_local Decode *jr_target_cache[JR_TARGET_SIZE] = {};
+
+#define TCACHE_COUNTERS(f) f(region_evict) f(bb_evict) f(flush) f(validate) f(page_invalidate) \
+  f(trace) f(jr_site_hit) f(jr_target_hit) f(jr_miss) f(bb_lookup) f(bb_probe) f(bb_grow)
+// the counters of the other harts are added to nr_*_harts when they exit
+#define TCACHE_COUNTER_DEF(name) static hart_local uint64_t concat(nr_, name) = 0; \
+  IFDEF(CONFIG_SMP, static uint64_t concat3(nr_, name, _harts) = 0;)
+MAP(TCACHE_COUNTERS, TCACHE_COUNTER_DEF)
+IFDEF(CONFIG_SMP, static uint64_t bb_nr_harts = 0);
+IFDEF(CONFIG_SMP, static uint64_t bb_cap_harts = 0);
+
+// the trace cache is divided into regions, and basic blocks never cross them
+static inline int tcache_region_idx(int region) {
+  return (int64_t)region * CONFIG_TCACHE_SIZE / TCACHE_NR_REGION;
+}
 
 static inline Decode* tcache_entry_init(Decode *s, vaddr_t pc) {
   s->tnext = s->ntnext = NULL;
   s->type = 0;
+  s->idx_in_bb = 1; // links always target the first instruction of a basic block
+  s->epoch = g_tcache_epoch;
+  s->exec_cnt = 0;
+  s->bbv_id = 0;
+  s->rnext = NULL;
+  IFDEF(CONFIG_ENGINE_JIT, s->jit_code = NULL);
   s->pc = pc;
   s->EHelper = g_exec_nemu_decode;
   return s;
 }
 
 static inline Decode* tcache_new(vaddr_t pc) {
-  if (tc_idx == CONFIG_TCACHE_SIZE) return NULL;
-  assert(tc_idx < CONFIG_TCACHE_SIZE);
+  int region_end = tcache_region_idx(tc_region + 1);
+  if (tc_idx == region_end) return NULL;
+  assert(tc_idx < region_end);
   Decode *s = &tcache_pool[tc_idx];
   tc_idx ++;
   return tcache_entry_init(s, pc);
@@ -70,70 +136,137 @@ static inline Decode* tcache_bb_new(vaddr_t pc) {
   tcache_bb_freelist = tcache_bb_freelist->tnext;
   tcache_bb_check(tcache_bb_freelist);
   tcache_bb_check(tcache_bb_freelist->tnext);
+  tcache_bb_nr_free --;
   return tcache_entry_init(s, pc);
 }
 
 static inline void tcache_bb_free(Decode *s) {
   tcache_bb_check(s);
   tcache_bb_check(tcache_bb_freelist);
+  s->type = 0; // free records are never patched
   s->tnext = tcache_bb_freelist;
   tcache_bb_freelist = s;
+  tcache_bb_nr_free ++;
   tcache_bb_check(tcache_bb_freelist->tnext);
 }
 
 
-static inline bb_t* bb_new(Decode *s, vaddr_t pc, bb_t *next) {
-  if (bb_idx == CONFIG_BB_POOL_SIZE) return NULL;
-  assert(bb_idx < CONFIG_BB_POOL_SIZE);
-  bb_t *bb = &bb_pool[bb_idx ++];
-  bb->s = s;
-  bb->pc = pc;
-  bb->next = next;
-  return bb;
+static inline int tcache_mmu_state() {
+  return MUXDEF(CONFIG_MODE_SYSTEM, isa_mmu_state(), 0);
 }
 
-static inline bb_t* bb_hash(vaddr_t pc) {
-  int idx = (pc / CONFIG_ILEN_MIN) % CONFIG_BB_LIST_SIZE;
-  return &bb_list[idx];
+static inline uint32_t bb_hash(vaddr_t pc) {
+  // Fibonacci hashing spreads the basic blocks of sequential code
+  return ((pc / CONFIG_ILEN_MIN) * 0x9e3779b97f4a7c15ull) >> 32 & (bb_cap - 1);
 }
 
-static struct bb_t* bb_insert(vaddr_t pc, Decode *fill) {
-  bb_t *head = bb_hash(pc);
-  if (head->next == (void *)-1ul) {
-    if (head->pc == (vaddr_t)-1ul) {
-      // first time
-      head->s = fill;
-      head->pc = pc;
-      return head;
-    }
+static inline uint32_t bb_idx(bb_t *bb) {
+  return bb - bb_table;
+}
+
+// append to the end of the probe sequence of `pc`
+static uint32_t bb_table_put(vaddr_t pc, const bb_t *bb) {
+  uint32_t i;
+  for (i = bb_hash(pc); bb_pc[i] != BB_EMPTY; i = (i + 1) & (bb_cap - 1));
+  bb_pc[i] = pc;
+  bb_table[i] = *bb;
+  bb_nr ++;
+  return i;
+}
+
+static void bb_table_alloc(uint32_t cap) {
+  bb_pc = malloc(sizeof(bb_pc[0]) * cap);
+  bb_table = malloc(sizeof(bb_table[0]) * cap);
+  assert(bb_pc != NULL && bb_table != NULL);
+  memset(bb_pc, -1, sizeof(bb_pc[0]) * cap);
+  bb_cap = cap;
+  bb_nr = 0;
+}
+
+static void bb_table_grow() {
+  vaddr_t *old_pc = bb_pc;
+  bb_t *old_table = bb_table;
+  uint32_t old_cap = bb_cap;
+  bb_table_alloc(old_cap * 2);
+
+  // start from an empty entry, so the order in each probe sequence is kept
+  uint32_t empty, i;
+  for (empty = 0; old_pc[empty] != BB_EMPTY; empty ++);
+  for (i = 1; i <= old_cap; i ++) {
+    uint32_t idx = (empty + i) & (old_cap - 1);
+    if (old_pc[idx] != BB_EMPTY) { bb_table_put(old_pc[idx], &old_table[idx]); }
   }
-  // second time
-  bb_t *bb = bb_new(head->s, head->pc, head->next);
-  if (bb == NULL) return NULL;
-  head->s = fill;
-  head->pc = pc;
-  head->next = bb;
-  return head;
-}
-
-static bb_t* bb_find(vaddr_t pc) {
-  bb_t *bb = bb_hash(pc);
-  if (likely(bb->pc == pc)) return bb;
-  bb_t *head = bb;
-  do {
-    bb = bb->next;
-    if (bb == (void *)-1ul) return NULL;
-    if (bb->pc == pc) {
-      Decode *tmp_s = bb->s; vaddr_t tmp_pc = bb->pc;
-      bb->s = head->s; bb->pc = head->pc;
-      head->s = tmp_s; head->pc = tmp_pc;
-      return head;
+  free(old_pc);
+  free(old_table);
+  nr_bb_grow ++;
+}
+
+// the entries of the same pc are ordered by their last use
+static inline bb_t* bb_promote(uint32_t first, uint32_t i) {
+  if (first != i) {
+    bb_t tmp = bb_table[i];
+    bb_table[i] = bb_table[first];
+    bb_table[first] = tmp;
+  }
+  return &bb_table[first];
+}
+
+static bb_t* bb_insert(vaddr_t pc, paddr_t paddr, int mmu_state, bool single_epoch, Decode *fill) {
+  if ((bb_nr + 1) * 2 > bb_cap) { bb_table_grow(); }
+  bb_t bb = { .s = fill, .paddr = paddr, .mmu_state = mmu_state, .single_epoch = single_epoch };
+  uint32_t i = bb_table_put(pc, &bb);
+  uint32_t first;
+  for (first = bb_hash(pc); bb_pc[first] != pc; first = (first + 1) & (bb_cap - 1));
+  return bb_promote(first, i);
+}
+
+static inline bool bb_match(bb_t *bb, paddr_t paddr, int mmu_state) {
+  return paddr == BB_ANY_PADDR || (bb->paddr == paddr && bb->mmu_state == mmu_state);
+}
+
+// the basic block found is moved to the first entry of its pc
+static bb_t* bb_find(vaddr_t pc, paddr_t paddr, int mmu_state) {
+  uint32_t i, first = UINT32_MAX;
+  nr_bb_lookup ++;
+  for (i = bb_hash(pc); bb_pc[i] != BB_EMPTY; i = (i + 1) & (bb_cap - 1)) {
+    nr_bb_probe ++;
+    if (bb_pc[i] != pc) continue;
+    if (first == UINT32_MAX) { first = i; }
+    if (bb_match(&bb_table[i], paddr, mmu_state)) return bb_promote(first, i);
+  }
+  return NULL;
+}
+
+// Remove the entry, and move the following entries in the probe sequence
+// backward, so no tombstone is left.
+static void bb_remove(bb_t *bb) {
+  uint32_t hole = bb_idx(bb), i = hole;
+  bb_pc[hole] = BB_EMPTY;
+  bb_nr --;
+  while (true) {
+    i = (i + 1) & (bb_cap - 1);
+    if (bb_pc[i] == BB_EMPTY) return;
+    // the entry can fill the hole if its home is not in (hole, i]
+    uint32_t home = bb_hash(bb_pc[i]);
+    if (((i - home) & (bb_cap - 1)) >= ((i - hole) & (bb_cap - 1))) {
+      bb_pc[hole] = bb_pc[i];
+      bb_table[hole] = bb_table[i];
+      bb_pc[i] = BB_EMPTY;
+      hole = i;
     }
-  } while (1);
+  }
+}
+
+// Only the translation of the first page of a basic block is recorded.
+// If the basic block crosses pages, or its page is remapped while it is
+// decoded, it is only valid in the epoch it is decoded.
+static inline bool bb_is_valid(bb_t *bb) {
+  return !bb->single_epoch || bb->s->epoch == g_tcache_epoch;
 }
 
 static void tcache_bb_fetch(Decode *_this, int is_taken, vaddr_t jpc) {
-  bb_t* bb = bb_find(jpc);
+  // the translation is not checked here, but when the target is entered
+  bb_t* bb = bb_find(jpc, BB_ANY_PADDR, 0);
   if (bb != NULL) {
     if (is_taken) { _this->tnext = bb->s; }
     else { _this->ntnext = bb->s; }
@@ -145,72 +278,302 @@ static void tcache_bb_fetch(Decode *_this, int is_taken, vaddr_t jpc) {
   }
 }
 
+static inline bool tcache_in_range(Decode *s, Decode *start, Decode *end) {
+  return s >= start && s < end;
+}
+
+static inline jr_entry_t* jr_site_set(Decode *site) {
+  return jr_site_cache[(uintptr_t)(site - tcache_pool) % JR_SITE_SETS];
+}
+
+static inline Decode** jr_target_slot(vaddr_t pc) {
+  return &jr_target_cache[(pc / CONFIG_ILEN_MIN) % JR_TARGET_SIZE];
+}
+
+static inline void jr_site_insert(Decode *site, Decode *target) {
+  jr_entry_t *set = jr_site_set(site);
+  memmove(&set[1], &set[0], sizeof(set[0]) * (JR_SITE_WAYS - 1));
+  set[0] = (jr_entry_t){ .site = site, .target = target };
+}
+
+// the entry found is moved to the first way of the set
+static Decode* jr_cache_find(Decode *site, vaddr_t jpc) {
+  jr_entry_t *set = jr_site_set(site);
+  int i;
+  for (i = 0; i < JR_SITE_WAYS; i ++) {
+    if (set[i].site == site && set[i].target->pc == jpc) {
+      jr_entry_t e = set[i];
+      memmove(&set[1], &set[0], sizeof(set[0]) * i);
+      set[0] = e;
+      nr_jr_site_hit ++;
+      return e.target;
+    }
+  }
+  Decode *target = *jr_target_slot(jpc);
+  if (target != NULL && target->pc == jpc) {
+    jr_site_insert(site, target);
+    nr_jr_target_hit ++;
+    return target;
+  }
+  return NULL;
+}
+
+static void jr_cache_insert(Decode *site, Decode *target) {
+  Decode *pool_end = tcache_pool + CONFIG_TCACHE_SIZE;
+  if (!tcache_in_range(site, tcache_pool, pool_end) ||
+      !tcache_in_range(target, tcache_pool, pool_end)) return;
+  jr_site_insert(site, target);
+  *jr_target_slot(target->pc) = target;
+}
+
+// remove the entries with the site or the target in [start, end)
+static void jr_cache_evict(Decode *start, Decode *end) {
+  int i, j;
+  for (i = 0; i < JR_SITE_SETS; i ++) {
+    jr_entry_t *set = jr_site_cache[i];
+    for (j = 0; j < JR_SITE_WAYS; j ++) {
+      if (tcache_in_range(set[j].site, start, end) || tcache_in_range(set[j].target, start, end)) {
+        set[j].site = NULL;
+      }
+    }
+  }
+  for (i = 0; i < JR_TARGET_SIZE; i ++) {
+    if (tcache_in_range(jr_target_cache[i], start, end)) jr_target_cache[i] = NULL;
+  }
+}
+
+// remove the basic blocks satisfying `cond` from the basic block table
+static uint64_t bb_remove_if(bool (*cond)(bb_t *bb, const void *arg), const void *arg) {
+  uint64_t nr_remove = 0;
+  uint32_t i = 0;
+  while (i < bb_cap) {
+    if (bb_pc[i] != BB_EMPTY && cond(&bb_table[i], arg)) {
+      // another entry may be moved here
+      bb_remove(&bb_table[i]);
+      nr_remove ++;
+    } else {
+      i ++;
+    }
+  }
+  return nr_remove;
+}
+
+static bool bb_in_range(bb_t *bb, const void *arg) {
+  Decode * const *range = arg;
+  return tcache_in_range(bb->s, range[0], range[1]);
+}
+
+static bool bb_in_page(bb_t *bb, const void *arg) {
+  return (bb->paddr & ~(paddr_t)PAGE_MASK) == *(const paddr_t *)arg;
+}
+
+// remove the basic blocks decoded in [start, end) from the basic block table
+static void bb_evict(Decode *start, Decode *end) {
+  Decode *range[2] = { start, end };
+  nr_bb_evict += bb_remove_if(bb_in_range, range);
+}
+
+enum { TCACHE_BB_BUILDING, TCACHE_RUNNING };
+static hart_local int tcache_state = TCACHE_RUNNING;
+static hart_local Decode *bb_now = NULL, *bb_now_record = NULL;
+static hart_local paddr_t bb_now_paddr = 0;
+static hart_local int bb_now_mmu_state = 0;
+static hart_local uint32_t bb_now_epoch = 0;
+static hart_local bool bb_now_single_epoch = false;
+
+void ras_evict(Decode *start, Decode *end);
+void ras_flush();
+
+// Evict all basic blocks in a region. Links from the other regions into it
+// are redirected to new records, so the targets are decoded again on demand.
+// Return false if there are not enough records, and the whole trace cache
+// should be flushed instead.
+static bool tcache_evict_region(int region) {
+  Decode *start = &tcache_pool[tcache_region_idx(region)];
+  Decode *end = &tcache_pool[tcache_region_idx(region + 1)];
+  Decode *s;
+
+  bb_evict(start, end);
+  jr_cache_evict(start, end);
+  ras_evict(start, end);
+
+  // records whose source is evicted are useless,
+  // except the one of the basic block being built
+  for (s = tcache_bb_pool; s < tcache_bb_pool + TCACHE_BB_SIZE; s ++) {
+    if (s->type != 0 && tcache_in_range(s->bb_src, start, end)) {
+      if (s == bb_now_record) { s->type = 0; }
+      else { tcache_bb_free(s); }
+    }
+  }
+
+  for (s = tcache_pool; s < tcache_pool + CONFIG_TCACHE_SIZE; s ++) {
+    if (tcache_in_range(s, start, end)) continue;
+    if (tcache_in_range(s->rnext, start, end)) { s->rnext = NULL; }
+    switch (s->type) {
+      case INSTR_TYPE_B:
+        if (tcache_in_range(s->ntnext, start, end)) {
+          if (tcache_bb_nr_free < TCACHE_BB_RESERVED) return false;
+          tcache_bb_fetch(s, false, s->ntnext->pc);
+        }
+        // fall through
+      case INSTR_TYPE_J:
+        if (tcache_in_range(s->tnext, start, end)) {
+          if (tcache_bb_nr_free < TCACHE_BB_RESERVED) return false;
+          tcache_bb_fetch(s, true, s->tnext->pc);
+        }
+        break;
+      case INSTR_TYPE_I:
+        if (tcache_in_range(s->tnext, start, end)) { s->tnext = s; }
+        if (tcache_in_range(s->ntnext, start, end)) { s->ntnext = s; }
+        break;
+    }
+  }
+
+  for (s = start; s < end; s ++) {
+    s->type = INSTR_TYPE_N;
+  }
+  nr_region_evict ++;
+  return true;
+}
+
+// move to the next region, which holds the oldest basic blocks
+static bool tcache_next_region() {
+  int region = (tc_region + 1) % TCACHE_NR_REGION;
+  if (!tcache_evict_region(region)) return false;
+  tc_region = region;
+  tc_idx = tcache_region_idx(region);
+  return true;
+}
+
 void tcache_flush() {
   tc_idx = 0;
-  bb_idx = 0;
-  memset(bb_list, -1, sizeof(bb_list));
+  tc_region = 0;
+  memset(bb_pc, -1, sizeof(bb_pc[0]) * bb_cap);
+  bb_nr = 0;
+  memset(jr_site_cache, 0, sizeof(jr_site_cache));
+  memset(jr_target_cache, 0, sizeof(jr_target_cache));
 
   int i;
+  for (i = 0; i < CONFIG_TCACHE_SIZE; i ++) {
+    tcache_pool[i].type = INSTR_TYPE_N;
+    tcache_pool[i].rnext = NULL;
+  }
+  ras_flush();
   for (i = 0; i < TCACHE_BB_SIZE - 1; i ++) {
     tcache_bb_pool[i].list_next = &tcache_bb_pool[i + 1];
+    tcache_bb_pool[i].type = 0;
   }
   tcache_bb_pool[TCACHE_BB_SIZE - 1].list_next = NULL;
+  tcache_bb_pool[TCACHE_BB_SIZE - 1].type = 0;
   tcache_bb_freelist = &tcache_bb_pool[0];
+  tcache_bb_nr_free = TCACHE_BB_SIZE;
 }
 
-enum { TCACHE_BB_BUILDING, TCACHE_RUNNING };
-static int tcache_state = TCACHE_RUNNING;
-static Decode *bb_now = NULL, *bb_now_record = NULL;
-
+// Called when both `tnext` and `ntnext` miss. They are kept as the two most recent
+// targets: the new target goes to `tnext`, and the previous one is moved to `ntnext`.
+// A record is not moved, since it only patches `tnext` and is freed when decoded.
 __attribute__((noinline))
 Decode* tcache_jr_fetch(Decode *s, vaddr_t jpc) {
-  s->ntnext = s->tnext;
-  tcache_bb_fetch(s, true, jpc);
+  Decode *mru = s->tnext;
+  Decode *target = jr_cache_find(s, jpc);
+  if (target != NULL) {
+    s->tnext = target;
+  } else {
+    nr_jr_miss ++;
+    tcache_bb_fetch(s, true, jpc);
+    // a record is cached after it is decoded
+    jr_cache_insert(s, s->tnext);
+  }
+  if (tcache_in_range(mru, tcache_pool, tcache_pool + CONFIG_TCACHE_SIZE)) { s->ntnext = mru; }
   return s->tnext;
 }
 
+// cache the return site of `call` if it is decoded
+void tcache_ras_fill(Decode *call, Decode *ret) {
+  if (tcache_in_range(ret, tcache_pool, tcache_pool + CONFIG_TCACHE_SIZE)) { call->rnext = ret; }
+}
+
 static inline void tcache_patch_and_free(Decode *bb_record, Decode *bb) {
   Decode *src = bb_record->bb_src;
-  if (bb_record->type == BB_RECORD_TYPE_TAKEN)  { src->tnext = bb; }
+  if (bb_record->type == BB_RECORD_TYPE_TAKEN)  {
+    src->tnext = bb;
+    if (src->type == INSTR_TYPE_I) { jr_cache_insert(src, bb); }
+  }
   if (bb_record->type == BB_RECORD_TYPE_NTAKEN) { src->ntnext = bb; }
   tcache_bb_free(bb_record);
 }
 
 __attribute__((noinline))
 Decode* tcache_decode(Decode *s) {
-  static int idx_in_bb = 0;
+  static hart_local int idx_in_bb = 0;
   vaddr_t thispc = s->pc;
 
   if (tcache_state == TCACHE_RUNNING) {  // start of a basic block
+    // the translation may raise exception before any instruction is decoded
+    s->idx_in_bb = 1;
+    save_globals(s);
+    paddr_t paddr = vaddr_ifetch_paddr(thispc);
+    int mmu_state = tcache_mmu_state();
+
     // first check whether this basic block is already decoded
-    bb_t *bb = bb_find(thispc);
-    if (bb != NULL) { // already decoded
-      tcache_patch_and_free(s, bb->s);
-      return bb->s;
+    bb_t *bb = bb_find(thispc, paddr, mmu_state);
+    if (bb != NULL) {
+      if (bb_is_valid(bb)) { // already decoded
+        bb->s->epoch = g_tcache_epoch;
+        tcache_patch_and_free(s, bb->s);
+        return bb->s;
+      }
+      bb_remove(bb);
     }
 
-    Decode *old = s;
+    bb_now_paddr = paddr;
+    bb_now_mmu_state = mmu_state;
+    bb_now_epoch = g_tcache_epoch;
+    bb_now_single_epoch = false;
+    IFDEF(CONFIG_MODE_SYSTEM, pmem_set_code_page(paddr));
+    bb_now_record = s;
     s = tcache_new(thispc);
     idx_in_bb = 1;
-    if (s == NULL) { goto full; }
+    // the end of the basic block fetches at most two records
+    if (s == NULL || tcache_bb_nr_free < TCACHE_BB_RESERVED + 2) {
+      // The current region is full, or the records are used up by the links
+      // from the basic blocks which are invalidated but not evicted yet.
+      if (!tcache_next_region() || tcache_bb_nr_free < TCACHE_BB_RESERVED + 2) { goto full; }
+      s = tcache_new(thispc);
+    }
 
-    bb_now_record = old;
     bb_now = s;
     tcache_state = TCACHE_BB_BUILDING;
   }
 
   save_globals(s);
   s->idx_in_bb = idx_in_bb;
+  if (unlikely(bb_now_epoch != g_tcache_epoch)) {
+    // the translation is changed by the instructions decoded before
+    paddr_t paddr = vaddr_ifetch_paddr(thispc);
+    if (paddr - bb_now_paddr != thispc - bb_now->pc ||
+        tcache_mmu_state() != bb_now_mmu_state) { bb_now_single_epoch = true; }
+    bb_now_epoch = g_tcache_epoch;
+  }
   fetch_decode(s, thispc); // note that exception may happen!
+  if ((bb_now->pc ^ (s->snpc - 1)) >> PAGE_SHIFT) {
+    bb_now_single_epoch = true;
+    IFDEF(CONFIG_MODE_SYSTEM, pmem_set_code_page(vaddr_ifetch_paddr(s->snpc - 1)));
+  }
 
   if (s->type == INSTR_TYPE_N) {
     Decode *next = tcache_new(s->snpc);
-    if (next == NULL) { goto full; }
+    if (next == NULL) {
+      // The basic block does not fit in the current region.
+      // Give it up and decode again from this instruction in the next region.
+      bb_now = bb_now_record = NULL;
+      if (!tcache_next_region()) { goto full; }
+      goto again;
+    }
     assert(next == s + 1);
   } else {
     // the end of the basic block
-    bb_t *ret = bb_insert(bb_now->pc, bb_now);
-    if (ret == NULL) { goto full; } // basic block list is full
+    bb_insert(bb_now->pc, bb_now_paddr, bb_now_mmu_state, bb_now_single_epoch, bb_now);
     tcache_patch_and_free(bb_now_record, bb_now);
     bb_now = bb_now_record = NULL;
 
@@ -231,6 +594,9 @@ Decode* tcache_decode(Decode *s) {
 
 full:
   tcache_flush();
+  nr_flush ++;
+again:
+  if (tcache_bb_nr_free < TCACHE_BB_RESERVED) { goto full; }
   s = tcache_bb_new(thispc); // decode this instruction again
   s->idx_in_bb = idx_in_bb;
   save_globals(s);
@@ -239,7 +605,7 @@ full:
   longjmp_exec(NEMU_EXEC_AGAIN);
 }
 
-static Decode ex = {};
+static hart_local Decode ex = {};
 
 void tcache_handle_exception(vaddr_t jpc) {
   tcache_bb_fetch(&ex, true, jpc);
@@ -253,7 +619,197 @@ Decode* tcache_handle_flush(vaddr_t snpc) {
   return ex.tnext;
 }
 
+// The rest of the basic block may be stale after the translation is changed
+// or fence.i, so decode from the next instruction again. The basic block
+// being built goes on, since the rest of it is not decoded yet.
+Decode* tcache_handle_stale(Decode *s) {
+  if (tcache_state == TCACHE_BB_BUILDING) return s + 1;
+  tcache_handle_exception(s->snpc);
+  return ex.tnext;
+}
+
+// Validate the entry `s` against the current translation of instruction fetch
+// and the data mmu state.
+// Return the basic block decoded from the same guest physical address and state,
+// or a record to decode it again.
+__attribute__((noinline))
+Decode* tcache_validate(Decode *s) {
+  if (s->EHelper != g_exec_nemu_decode) {
+    // the translation may raise exception before `s` is executed
+    save_globals(s);
+    paddr_t paddr = vaddr_ifetch_paddr(s->pc);
+    bb_t *bb = bb_find(s->pc, paddr, tcache_mmu_state());
+    if (bb != NULL && bb_is_valid(bb)) { s = bb->s; }
+    else {
+      if (bb != NULL) { bb_remove(bb); }
+      s = tcache_bb_new(s->pc);
+    }
+  }
+  s->epoch = g_tcache_epoch;
+  nr_validate ++;
+  return s;
+}
+
+#if CONFIG_TCACHE_TRACE_THRESHOLD > 0
+#define TRACE_MAX_BB 8
+
+// the entry of the basic block starting at `s`
+static bb_t* bb_find_block(Decode *s) {
+  uint32_t i;
+  for (i = bb_hash(s->pc); bb_pc[i] != BB_EMPTY; i = (i + 1) & (bb_cap - 1)) {
+    if (bb_pc[i] == s->pc && bb_table[i].s == s) return &bb_table[i];
+  }
+  return NULL;
+}
+
+static inline Decode* bb_tail(Decode *s) {
+  while (s->type == INSTR_TYPE_N) s ++;
+  return s;
+}
+
+// A basic block can be copied into a trace if it is decoded and validated
+// in the current epoch, and it is not in the trace yet.
+static bool trace_can_follow(Decode *s, Decode **trace, int nr_bb) {
+  if (!tcache_in_range(s, tcache_pool, tcache_pool + CONFIG_TCACHE_SIZE)) return false;
+  if (s->EHelper == g_exec_nemu_decode || s->idx_in_bb != 1 || s->epoch != g_tcache_epoch) return false;
+  int i;
+  for (i = 0; i < nr_bb; i ++) {
+    if (trace[i] == s) return false;
+  }
+  return true;
+}
+
+// the successor entered more often, if it is hot enough
+static Decode* trace_hot_succ(Decode *tail) {
+  switch (tail->type) {
+    case INSTR_TYPE_J: return tail->tnext;
+    case INSTR_TYPE_B: {
+      Decode *succ = (tail->ntnext->exec_cnt > tail->tnext->exec_cnt ? tail->ntnext : tail->tnext);
+      return (succ->exec_cnt >= CONFIG_TCACHE_TRACE_THRESHOLD / 2 ? succ : NULL);
+    }
+    default: return NULL;
+  }
+}
+
+// Extend the hot basic block `head` into a trace. The basic blocks along
+// the hot successors are copied into the current region, and the copies
+// keep counting `idx_in_bb` from the end of `head`. The cold directions
+// are side exits to the ordinary basic blocks.
+void tcache_trace_promote(Decode *head) {
+  if (profiling_state != NoProfiling || tcache_state != TCACHE_RUNNING) return;
+  if (!trace_can_follow(head, NULL, 0)) return;
+  Decode *tail = bb_tail(head);
+  if (tail->type != INSTR_TYPE_J && tail->type != INSTR_TYPE_B) return;
+  if (tail->tnext->idx_in_bb != 1 ||
+      (tail->type == INSTR_TYPE_B && tail->ntnext->idx_in_bb != 1)) return; // already a trace
+
+  if (bb_find_block(head) == NULL) return;
+
+  Decode *trace[TRACE_MAX_BB] = { head };
+  int nr_bb = 1, nr_instr = tail->idx_in_bb;
+  bool single_epoch = false;
+  while (nr_bb < TRACE_MAX_BB) {
+    Decode *succ = trace_hot_succ(tail);
+    if (succ == NULL || !trace_can_follow(succ, trace, nr_bb)) break;
+    trace[nr_bb ++] = succ;
+    tail = bb_tail(succ);
+    nr_instr += tail - succ + 1;
+    if (((head->pc ^ succ->pc) | (head->pc ^ (tail->snpc - 1))) >> PAGE_SHIFT) { single_epoch = true; }
+  }
+  if (nr_bb == 1 || nr_instr > UINT16_MAX) return;
+  if (tc_idx + nr_instr - bb_tail(head)->idx_in_bb > tcache_region_idx(tc_region + 1) ||
+      tcache_bb_nr_free < TCACHE_BB_RESERVED + 2 * nr_bb) return;
+
+  Decode *prev = bb_tail(head);
+  int idx_in_bb = prev->idx_in_bb;
+  int i;
+  for (i = 1; i < nr_bb; i ++) {
+    Decode *copy = &tcache_pool[tc_idx], *s;
+    for (s = trace[i]; ; s ++) {
+      Decode *c = &tcache_pool[tc_idx ++];
+      *c = *s;
+      c->idx_in_bb = ++ idx_in_bb;
+      IFDEF(CONFIG_ENGINE_JIT, c->jit_code = NULL);
+      if (s->type != INSTR_TYPE_N) break;
+    }
+
+    // link the previous basic block to the copy along the hot direction
+    Decode *orig = bb_tail(trace[i - 1]);
+    if (orig->tnext == trace[i]) { prev->tnext = copy; }
+    if (orig->type == INSTR_TYPE_B && orig->ntnext == trace[i]) { prev->ntnext = copy; }
+
+    // records only patch their own source, so the side exits are fetched again
+    prev = &tcache_pool[tc_idx - 1];
+    orig = bb_tail(trace[i]);
+    Decode *next = (i + 1 < nr_bb ? trace[i + 1] : NULL);
+    switch (prev->type) {
+      case INSTR_TYPE_J: if (next == NULL) { tcache_bb_fetch(prev, true, prev->jnpc); } break;
+      case INSTR_TYPE_B:
+        if (orig->tnext != next) { tcache_bb_fetch(prev, true, prev->jnpc); }
+        if (orig->ntnext != next) { tcache_bb_fetch(prev, false, prev->snpc + MUXDEF(__ISA_mips32__, 4, 0)); }
+        break;
+      case INSTR_TYPE_I: prev->tnext = prev->ntnext = prev; break;
+      default: assert(0);
+    }
+  }
+
+  // the entry may be moved by the lookups above
+  if (single_epoch) { bb_find_block(head)->single_epoch = true; }
+  nr_trace ++;
+}
+#endif
+
+#ifdef CONFIG_ENGINE_JIT
+// the host code is dropped when the code buffer of the JIT is full
+void tcache_drop_jit_code() {
+  int i;
+  for (i = 0; i < CONFIG_TCACHE_SIZE; i ++) {
+    tcache_pool[i].jit_code = NULL;
+  }
+}
+#endif
+
+// The physical page `pg` is written. Remove the basic blocks decoded from it,
+// and the links to them are checked again since the epoch is changed.
+void tcache_invalidate_page(paddr_t pg) {
+  bb_remove_if(bb_in_page, &pg);
+  if (tcache_state == TCACHE_BB_BUILDING && (bb_now_paddr & ~(paddr_t)PAGE_MASK) == pg) {
+    bb_now_single_epoch = true;
+  }
+  g_tcache_epoch ++;
+  nr_page_invalidate ++;
+}
+
+#ifdef CONFIG_SMP
+void tcache_statistic_merge() {
+#define TCACHE_COUNTER_MERGE(name) \
+  __atomic_fetch_add(&concat3(nr_, name, _harts), concat(nr_, name), __ATOMIC_RELAXED);
+  MAP(TCACHE_COUNTERS, TCACHE_COUNTER_MERGE)
+  __atomic_fetch_add(&bb_nr_harts, bb_nr, __ATOMIC_RELAXED);
+  __atomic_fetch_add(&bb_cap_harts, bb_cap, __ATOMIC_RELAXED);
+}
+#endif
+
+void tcache_statistic() {
+#define TCACHE_COUNTER_SUM(name) \
+  uint64_t name = concat(nr_, name) IFDEF(CONFIG_SMP, + concat3(nr_, name, _harts));
+  MAP(TCACHE_COUNTERS, TCACHE_COUNTER_SUM)
+  uint64_t nr_used = bb_nr IFDEF(CONFIG_SMP, + bb_nr_harts);
+  uint64_t nr_entry = bb_cap IFDEF(CONFIG_SMP, + bb_cap_harts);
+  Log("tcache: %'lu regions evicted, %'lu basic blocks evicted, %'lu flushes, %'lu validations, "
+      "%'lu pages invalidated, %'lu traces", region_evict, bb_evict, flush, validate,
+      page_invalidate, trace);
+  Log("tcache: %'lu basic block lookups, %.2f probes per lookup, %'lu of %'lu table entries used, "
+      "%'lu table growths", bb_lookup, bb_lookup ? (double)bb_probe / bb_lookup : 0.0,
+      nr_used, nr_entry, bb_grow);
+  uint64_t nr_jr = jr_site_hit + jr_target_hit + jr_miss;
+  Log("tcache: %'lu indirect jumps missing both recent targets, %.2f%% hit in the site cache, "
+      "%.2f%% hit in the target cache", nr_jr,
+      nr_jr ? 100.0 * jr_site_hit / nr_jr : 0.0, nr_jr ? 100.0 * jr_target_hit / nr_jr : 0.0);
+}
+
 Decode* tcache_init(const void *exec_nemu_decode, vaddr_t reset_vector) {
+  bb_table_alloc(CONFIG_BB_TABLE_SIZE);
   tcache_flush();
   g_exec_nemu_decode = exec_nemu_decode;
   return tcache_bb_new(reset_vector);
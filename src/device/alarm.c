@@ -15,6 +15,7 @@
 
 #include <common.h>
 #include "device/alarm.h"
+#include "device/event.h"
 #include <sys/time.h>
 #include <signal.h>
 
@@ -36,6 +37,25 @@ static void alarm_sig_handler(int signum) {
   }
 }
 
+#ifdef CONFIG_EVENT_QUEUE
+// the alarm goes off every 1/TIMER_HZ second of virtual time
+#define ALARM_PERIOD (CONFIG_EVENT_IPS / TIMER_HZ)
+
+static int alarm_event = -1;
+static uint64_t alarm_when = 0;
+
+static void alarm_event_handler() {
+  alarm_sig_handler(SIGVTALRM);
+  alarm_when += ALARM_PERIOD;
+  event_schedule(alarm_event, alarm_when);
+}
+
+void init_alarm() {
+  alarm_event = add_event(alarm_event_handler);
+  alarm_when = ALARM_PERIOD;
+  event_schedule(alarm_event, alarm_when);
+}
+#else
 void init_alarm() {
   struct sigaction s;
   memset(&s, 0, sizeof(s));
@@ -50,3 +70,4 @@ void init_alarm() {
   ret = setitimer(ITIMER_VIRTUAL, &it, NULL);
   Assert(ret == 0, "Can not set timer");
 }
+#endif
@@ -18,6 +18,7 @@
 #include <utils.h>
 #ifndef CONFIG_SHARE
 #include <device/alarm.h>
+#include <device/map.h>
 #include <SDL2/SDL.h>
 #endif // CONFIG_SHARE
 
@@ -50,6 +51,7 @@ void device_update() {
     return;
   }
   device_update_flag = false;
+  IFDEF(CONFIG_SMP, device_lock());
   IFDEF(CONFIG_HAS_VGA, vga_update_screen());
 
 #ifndef CONFIG_SHARE
@@ -73,6 +75,7 @@ void device_update() {
     }
   }
 #endif
+  IFDEF(CONFIG_SMP, device_unlock());
 }
 
 void sdl_clear_event_queue() {
@@ -0,0 +1,73 @@
+/***************************************************************************************
+* Copyright (c) 2020-2022 Institute of Computing Technology, Chinese Academy of Sciences
+*
+* NEMU is licensed under Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*          http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+* EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+* MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+*
+* See the Mulan PSL v2 for more details.
+***************************************************************************************/
+
+#include <device/event.h>
+
+#define MAX_EVENT 8
+
+// There are only a few devices, so the deadlines are kept in a plain array
+// and the earliest one is cached for cpu_exec() to size its batches.
+typedef struct {
+  event_handler_t handler;
+  uint64_t when;
+} event_t;
+
+static event_t events[MAX_EVENT] = {};
+static int nr_event = 0;
+static uint64_t next_event = EVENT_NONE;
+
+static void update_next_event() {
+  uint64_t next = EVENT_NONE;
+  for (int i = 0; i < nr_event; i ++) {
+    if (events[i].when < next) next = events[i].when;
+  }
+  next_event = next;
+}
+
+int add_event(event_handler_t h) {
+  assert(nr_event < MAX_EVENT);
+  events[nr_event].handler = h;
+  events[nr_event].when = EVENT_NONE;
+  return nr_event ++;
+}
+
+void event_schedule(int id, uint64_t when) {
+  assert(id >= 0 && id < nr_event);
+  uint64_t old = events[id].when;
+  events[id].when = when;
+  if (when < next_event) next_event = when;
+  else if (old == next_event) update_next_event();
+}
+
+void event_cancel(int id) {
+  event_schedule(id, EVENT_NONE);
+}
+
+uint64_t event_next() {
+  return next_event;
+}
+
+void event_run(uint64_t now) {
+  // a handler may schedule itself or others again
+  while (next_event <= now) {
+    for (int i = 0; i < nr_event; i ++) {
+      if (events[i].when <= now) {
+        events[i].when = EVENT_NONE;
+        events[i].handler();
+      }
+    }
+    update_next_event();
+  }
+}
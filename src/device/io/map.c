@@ -18,6 +18,9 @@
 #include <memory/host.h>
 #include <memory/vaddr.h>
 #include <device/map.h>
+#ifdef CONFIG_SMP
+#include <pthread.h>
+#endif
 
 #define IO_SPACE_MAX (128 * 1024 * 1024)
 
@@ -33,6 +36,18 @@ uint8_t* new_space(int size) {
   return p;
 }
 
+#ifdef CONFIG_SMP
+static pthread_mutex_t device_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+void device_lock() {
+  pthread_mutex_lock(&device_mutex);
+}
+
+void device_unlock() {
+  pthread_mutex_unlock(&device_mutex);
+}
+#endif
+
 static inline void check_bound(IOMap *map, paddr_t addr) {
   Assert(map != NULL && addr <= map->high && addr >= map->low,
       "address (" FMT_PADDR ") is out of bound {%s} [" FMT_PADDR ", " FMT_PADDR "] at pc = " FMT_WORD,
@@ -47,14 +62,19 @@ word_t map_read(paddr_t addr, int len, IOMap *map) {
   assert(len >= 1 && len <= 8);
   check_bound(map, addr);
   paddr_t offset = addr - map->low;
+  IFDEF(CONFIG_SMP, device_lock());
   invoke_callback(map->callback, offset, len, false); // prepare data to read
-  return host_read(map->space + offset, len);
+  word_t data = host_read(map->space + offset, len);
+  IFDEF(CONFIG_SMP, device_unlock());
+  return data;
 }
 
 void map_write(paddr_t addr, int len, word_t data, IOMap *map) {
   assert(len >= 1 && len <= 8);
   check_bound(map, addr);
   paddr_t offset = addr - map->low;
+  IFDEF(CONFIG_SMP, device_lock());
   host_write(map->space + offset, len, data);
   invoke_callback(map->callback, offset, len, true);
+  IFDEF(CONFIG_SMP, device_unlock());
 }
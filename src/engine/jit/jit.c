@@ -0,0 +1,462 @@
+/***************************************************************************************
+* Copyright (c) 2014-2021 Zihao Yu, Nanjing University
+* Copyright (c) 2020-2022 Institute of Computing Technology, Chinese Academy of Sciences
+*
+* NEMU is licensed under Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*          http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+* EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+* MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+*
+* See the Mulan PSL v2 for more details.
+***************************************************************************************/
+
+// A baseline JIT translating the basic blocks in the trace cache into x86-64 host code.
+// The host code of a basic block runs from its first instruction. If the whole basic block
+// is translated, including the branch or jump at its end, the host code counts the
+// instructions and goes on to the host code of the next basic block, as long as nothing
+// should be done at the end of the basic block. Otherwise it returns the first instruction
+// it does not run, which is interpreted. Guest registers stay in `cpu`, which is pointed by rbx.
+// The code buffer is only writable while the host code is emitted.
+
+#include <cpu/decode.h>
+#include <memory/vaddr.h>
+#include <memory/host-tlb.h>
+#include <isa-all-instr.h>
+#include <sys/mman.h>
+#include <stddef.h>
+
+#define JIT_MAX_INSTR_SIZE 160 // host code size of one guest instruction, including the epilogue
+
+enum { RAX = 0, RCX = 1, RDX = 2, RBX = 3, RSI = 6, RDI = 7, R8 = 8 };
+enum { ALU_ADD = 0, ALU_OR = 1, ALU_AND = 4, ALU_SUB = 5, ALU_XOR = 6, ALU_CMP = 7 };
+enum { SHIFT_SHL = 4, SHIFT_SHR = 5, SHIFT_SAR = 7 };
+enum { OP_ALU, OP_SHIFT, OP_SLT, OP_SLTU, OP_MUL };
+enum { CC_B = 0x2, CC_AE = 0x3, CC_E = 0x4, CC_NE = 0x5, CC_L = 0xc, CC_GE = 0xd, CC_LE = 0xe };
+
+static uint8_t *code_buf = NULL;
+static uint8_t *code_ptr = NULL;
+static const void **g_exec_table = NULL;
+static const void *g_exec_nemu_decode = NULL;
+static int *g_n_remain = NULL;
+static bool *g_bb_hooks = NULL;
+static int prologue_size = 0;
+extern uint32_t g_tcache_epoch;
+
+static uint64_t nr_block = 0;
+static uint64_t nr_instr = 0;
+static uint64_t nr_chain = 0;
+static uint64_t nr_flush = 0;
+
+// x86-64 code emitter
+
+static inline void emit8(uint8_t x) { *code_ptr ++ = x; }
+static inline void emit32(uint32_t x) { memcpy(code_ptr, &x, 4); code_ptr += 4; }
+static inline void emit64(uint64_t x) { memcpy(code_ptr, &x, 8); code_ptr += 8; }
+
+static inline bool fit_simm32(int64_t x) { return x == (int32_t)x; }
+
+// mov r64, [rbx + disp32]
+static void emit_load_reg(int r, int32_t disp) {
+  emit8(0x48 | (r >> 3 << 2)); emit8(0x8b); emit8(0x80 | (r & 7) << 3 | RBX); emit32(disp);
+}
+
+// mov [rbx + disp32], rax
+static void emit_store_rax(int32_t disp) {
+  emit8(0x48); emit8(0x89); emit8(0x80 | RAX << 3 | RBX); emit32(disp);
+}
+
+// mov r64, imm
+static void emit_li(int r, uint64_t imm) {
+  if (fit_simm32(imm)) { emit8(0x48 | (r >> 3)); emit8(0xc7); emit8(0xc0 | (r & 7)); emit32(imm); }
+  else { emit8(0x48 | (r >> 3)); emit8(0xb8 | (r & 7)); emit64(imm); }
+}
+
+// op rax, rcx
+static void emit_alu_rr(int alu, bool w64) {
+  if (w64) emit8(0x48);
+  emit8(alu << 3 | 0x01); emit8(0xc0 | RCX << 3 | RAX);
+}
+
+// op rax, simm32
+static void emit_alu_ri(int alu, int32_t imm) {
+  emit8(0x48); emit8(0x81); emit8(0xc0 | alu << 3 | RAX); emit32(imm);
+}
+
+// shift rax, cl
+static void emit_shift_cl(int shift, bool w64) {
+  if (w64) emit8(0x48);
+  emit8(0xd3); emit8(0xc0 | shift << 3 | RAX);
+}
+
+// shift rax, imm8
+static void emit_shift_ri(int shift, bool w64, uint8_t imm) {
+  if (w64) emit8(0x48);
+  emit8(0xc1); emit8(0xc0 | shift << 3 | RAX); emit8(imm);
+}
+
+// setcc al; movzx eax, al
+static void emit_setcc(uint8_t cc) {
+  emit8(0x0f); emit8(0x90 | cc); emit8(0xc0);
+  emit8(0x0f); emit8(0xb6); emit8(0xc0);
+}
+
+// sign extend the lower `len` bytes of rax
+static void emit_sext_rax(int len) {
+  switch (len) {
+    case 4: emit8(0x48); emit8(0x63); emit8(0xc0); break; // movsxd rax, eax
+    case 2: emit8(0x48); emit8(0x0f); emit8(0xbf); emit8(0xc0); break; // movsx rax, ax
+    case 1: emit8(0x48); emit8(0x0f); emit8(0xbe); emit8(0xc0); break; // movsx rax, al
+  }
+}
+
+static void emit_call(const void *fn) {
+  emit_li(RAX, (uintptr_t)fn);
+  emit8(0xff); emit8(0xd0); // call rax
+}
+
+// jcc rel32 and jmp rel32, whose target is patched by patch_jmp()
+static uint8_t* emit_jcc(uint8_t cc) { emit8(0x0f); emit8(0x80 | cc); emit32(0); return code_ptr; }
+static uint8_t* emit_jmp() { emit8(0xe9); emit32(0); return code_ptr; }
+
+static void patch_jmp(uint8_t *end) {
+  int32_t rel = code_ptr - end;
+  memcpy(end - 4, &rel, 4);
+}
+
+// pop rbx; ret
+static void emit_epilogue() {
+  emit8(0x58 | RBX);
+  emit8(0xc3);
+}
+
+// guest registers are accessed relative to `cpu`
+static bool reg_disp(const rtlreg_t *preg, int32_t *disp) {
+  int64_t off = (const uint8_t *)preg - (const uint8_t *)&cpu;
+  *disp = off;
+  return fit_simm32(off);
+}
+
+// translate the instruction computing `dest = a op b`, where `b` is `pb` or `imm`
+static bool jit_compute(int op, int alu, bool w64, const rtlreg_t *dest,
+    const rtlreg_t *pa, const rtlreg_t *pb, sword_t imm) {
+  int32_t d, a, b = 0;
+  if (!reg_disp(dest, &d) || !reg_disp(pa, &a) || (pb != NULL && !reg_disp(pb, &b))) return false;
+  if (pb == NULL && !fit_simm32(imm)) return false;
+
+  emit_load_reg(RAX, a);
+  if (pb != NULL) emit_load_reg(RCX, b);
+  switch (op) {
+    case OP_ALU:
+      if (pb != NULL) emit_alu_rr(alu, true);
+      else emit_alu_ri(alu, imm);
+      break;
+    case OP_SHIFT:
+      if (pb != NULL) emit_shift_cl(alu, w64);
+      else emit_shift_ri(alu, w64, imm & (w64 ? 0x3f : 0x1f));
+      break;
+    case OP_SLT: case OP_SLTU:
+      if (pb != NULL) emit_alu_rr(ALU_CMP, true);
+      else emit_alu_ri(ALU_CMP, imm);
+      emit_setcc(op == OP_SLT ? 0xc : 0x2); // setl, setb
+      break;
+    case OP_MUL:
+      emit8(0x48); emit8(0x0f); emit8(0xaf); emit8(0xc0 | RAX << 3 | RCX); // imul rax, rcx
+      break;
+  }
+  if (!w64) emit_sext_rax(4);
+  emit_store_rax(d);
+  return true;
+}
+
+static bool jit_li(const rtlreg_t *dest, word_t imm) {
+  int32_t d;
+  if (!reg_disp(dest, &d)) return false;
+  emit_li(RAX, imm);
+  emit_store_rax(d);
+  return true;
+}
+
+// Look up the host TLB of `type` with the guest virtual address in rsi.
+// The host address is rax + rsi when it hits. Return the jump to the slow path.
+static uint8_t* emit_hosttlb_lookup(int type) {
+  static_assert(sizeof(HostTLBEntry) == 16, "the index is scaled by 16");
+  emit8(0x48); emit8(0x89); emit8(0xf1); // mov rcx, rsi
+  emit8(0x48); emit8(0xc1); emit8(0xe9); emit8(PAGE_SHIFT - 4); // shr rcx, PAGE_SHIFT - 4
+  emit8(0x81); emit8(0xe1); emit32((HOSTTLB_SIZE - 1) << 4); // and ecx, (HOSTTLB_SIZE - 1) << 4
+  emit_li(RDX, (uintptr_t)hosttlb_table(type));
+  emit8(0x48); emit8(0x01); emit8(0xca); // add rdx, rcx
+  emit8(0x48); emit8(0x89); emit8(0xf0); // mov rax, rsi
+  emit8(0x48); emit8(0xc1); emit8(0xe8); emit8(PAGE_SHIFT); // shr rax, PAGE_SHIFT
+  emit8(0x48); emit8(0x3b); emit8(0x42); emit8(offsetof(HostTLBEntry, gvpn)); // cmp rax, [rdx + gvpn]
+  uint8_t *miss = emit_jcc(CC_NE);
+  emit8(0x48); emit8(0x8b); emit8(0x42); emit8(offsetof(HostTLBEntry, offset)); // mov rax, [rdx + offset]
+  return miss;
+}
+
+// Loads and stores with address translation access the host memory directly when the
+// host TLB hits. Otherwise they go through vaddr_read() and vaddr_write() as the interpreter,
+// and `s` is passed to report the exception of the instruction.
+static bool jit_load(Decode *s, int len, bool sext, int mmu_mode) {
+  int32_t d, a;
+  if (!reg_disp(ddest, &d) || !reg_disp(dsrc1, &a) || !fit_simm32(id_src2->imm)) return false;
+  emit_load_reg(RSI, a);
+  emit8(0x48); emit8(0x81); emit8(0xc0 | RSI); emit32(id_src2->imm); // add rsi, imm32
+  uint8_t *miss = NULL, *done = NULL;
+  if (mmu_mode == MMU_TRANSLATE) {
+    miss = emit_hosttlb_lookup(MEM_TYPE_READ);
+    switch (len) { // mov(zx) rax, [rax + rsi]
+      case 8: emit8(0x48); emit8(0x8b); break;
+      case 4: emit8(0x8b); break;
+      case 2: emit8(0x0f); emit8(0xb7); break;
+      case 1: emit8(0x0f); emit8(0xb6); break;
+    }
+    emit8(0x04); emit8(0x30);
+    done = emit_jmp();
+    patch_jmp(miss);
+  }
+  emit_li(RDI, (uintptr_t)s);
+  emit_li(RDX, len);
+  emit_li(RCX, mmu_mode);
+  emit_call(vaddr_read);
+  if (done != NULL) patch_jmp(done);
+  if (sext) emit_sext_rax(len);
+  emit_store_rax(d);
+  return true;
+}
+
+static bool jit_store(Decode *s, int len, int mmu_mode) {
+  int32_t v, a;
+  if (!reg_disp(ddest, &v) || !reg_disp(dsrc1, &a) || !fit_simm32(id_src2->imm)) return false;
+  emit_load_reg(RSI, a);
+  emit8(0x48); emit8(0x81); emit8(0xc0 | RSI); emit32(id_src2->imm); // add rsi, imm32
+  uint8_t *miss = NULL, *done = NULL;
+  if (mmu_mode == MMU_TRANSLATE) {
+    miss = emit_hosttlb_lookup(MEM_TYPE_WRITE);
+    emit_load_reg(RCX, v);
+    switch (len) { // mov [rax + rsi], rcx
+      case 8: emit8(0x48); emit8(0x89); break;
+      case 4: emit8(0x89); break;
+      case 2: emit8(0x66); emit8(0x89); break;
+      case 1: emit8(0x88); break;
+    }
+    emit8(0x0c); emit8(0x30);
+    done = emit_jmp();
+    patch_jmp(miss);
+  }
+  emit_load_reg(RCX, v);
+  emit_li(RDI, (uintptr_t)s);
+  emit_li(RDX, len);
+  emit_li(R8, mmu_mode);
+  emit_call(vaddr_write);
+  if (done != NULL) patch_jmp(done);
+  return true;
+}
+
+static int jit_exec_id(const void *EHelper) {
+  int i;
+  for (i = 0; i < TOTAL_INSTR; i ++) {
+    if (g_exec_table[i] == EHelper) return i;
+  }
+  return -1;
+}
+
+#define LDST(name, len, sext) \
+  case concat(EXEC_ID_, name): return jit_load(s, len, sext, MMU_DIRECT); \
+  case concat(EXEC_ID_, concat(name, _mmu)): return jit_load(s, len, sext, MMU_TRANSLATE);
+#define ST(name, len) \
+  case concat(EXEC_ID_, name): return jit_store(s, len, MMU_DIRECT); \
+  case concat(EXEC_ID_, concat(name, _mmu)): return jit_store(s, len, MMU_TRANSLATE);
+#define RR(name, op, alu, w64) \
+  case concat(EXEC_ID_, name): return jit_compute(op, alu, w64, ddest, dsrc1, dsrc2, 0);
+#define RI(name, op, alu, w64) \
+  case concat(EXEC_ID_, name): return jit_compute(op, alu, w64, ddest, dsrc1, NULL, id_src2->imm);
+#define C_RR(name, op, alu, w64) \
+  case concat(EXEC_ID_, name): return jit_compute(op, alu, w64, ddest, ddest, dsrc2, 0);
+#define C_RI(name, op, alu, w64) \
+  case concat(EXEC_ID_, name): return jit_compute(op, alu, w64, ddest, ddest, NULL, id_src2->imm);
+
+// Return false if the instruction is not translated. Nothing is emitted then.
+static bool jit_instr(Decode *s) {
+  switch (jit_exec_id(s->EHelper)) {
+    LDST(ld, 8, true) LDST(lw, 4, true) LDST(lh, 2, true) LDST(lb, 1, true)
+    LDST(lwu, 4, false) LDST(lhu, 2, false) LDST(lbu, 1, false)
+    ST(sd, 8) ST(sw, 4) ST(sh, 2) ST(sb, 1)
+
+    RR(add, OP_ALU, ALU_ADD, true) RR(sub, OP_ALU, ALU_SUB, true)
+    RR(and, OP_ALU, ALU_AND, true) RR(or, OP_ALU, ALU_OR, true) RR(xor, OP_ALU, ALU_XOR, true)
+    RR(sll, OP_SHIFT, SHIFT_SHL, true) RR(srl, OP_SHIFT, SHIFT_SHR, true) RR(sra, OP_SHIFT, SHIFT_SAR, true)
+    RR(slt, OP_SLT, 0, true) RR(sltu, OP_SLTU, 0, true) RR(mul, OP_MUL, 0, true)
+    RR(addw, OP_ALU, ALU_ADD, false) RR(subw, OP_ALU, ALU_SUB, false) RR(mulw, OP_MUL, 0, false)
+    RR(sllw, OP_SHIFT, SHIFT_SHL, false) RR(srlw, OP_SHIFT, SHIFT_SHR, false) RR(sraw, OP_SHIFT, SHIFT_SAR, false)
+
+    RI(addi, OP_ALU, ALU_ADD, true) RI(andi, OP_ALU, ALU_AND, true)
+    RI(ori, OP_ALU, ALU_OR, true) RI(xori, OP_ALU, ALU_XOR, true)
+    RI(slli, OP_SHIFT, SHIFT_SHL, true) RI(srli, OP_SHIFT, SHIFT_SHR, true) RI(srai, OP_SHIFT, SHIFT_SAR, true)
+    RI(slti, OP_SLT, 0, true) RI(sltui, OP_SLTU, 0, true)
+    RI(addiw, OP_ALU, ALU_ADD, false)
+    RI(slliw, OP_SHIFT, SHIFT_SHL, false) RI(srliw, OP_SHIFT, SHIFT_SHR, false) RI(sraiw, OP_SHIFT, SHIFT_SAR, false)
+
+    C_RR(c_add, OP_ALU, ALU_ADD, true) C_RR(c_sub, OP_ALU, ALU_SUB, true)
+    C_RR(c_and, OP_ALU, ALU_AND, true) C_RR(c_or, OP_ALU, ALU_OR, true) C_RR(c_xor, OP_ALU, ALU_XOR, true)
+    C_RR(c_addw, OP_ALU, ALU_ADD, false) C_RR(c_subw, OP_ALU, ALU_SUB, false)
+    C_RI(c_addi, OP_ALU, ALU_ADD, true) C_RI(c_andi, OP_ALU, ALU_AND, true)
+    C_RI(c_slli, OP_SHIFT, SHIFT_SHL, true) C_RI(c_srli, OP_SHIFT, SHIFT_SHR, true)
+    C_RI(c_srai, OP_SHIFT, SHIFT_SAR, true) C_RI(c_addiw, OP_ALU, ALU_ADD, false)
+
+    case EXEC_ID_p_sext_w: return jit_compute(OP_ALU, ALU_ADD, false, ddest, dsrc1, NULL, 0);
+    case EXEC_ID_p_inc: return jit_compute(OP_ALU, ALU_ADD, true, ddest, ddest, NULL, 1);
+    case EXEC_ID_p_dec: return jit_compute(OP_ALU, ALU_ADD, true, ddest, ddest, NULL, -1);
+    case EXEC_ID_c_mv: return jit_compute(OP_ALU, ALU_ADD, true, ddest, dsrc1, NULL, 0);
+    case EXEC_ID_lui: case EXEC_ID_auipc: return jit_li(ddest, id_src1->imm);
+    case EXEC_ID_c_li: return jit_li(ddest, id_src2->imm);
+    case EXEC_ID_p_li_0: return jit_li(ddest, 0);
+    case EXEC_ID_p_li_1: return jit_li(ddest, 1);
+    default: return false;
+  }
+}
+
+// Go on with the basic block `rax` points to, after the basic block ending at `tail`.
+// Its instructions are counted as the interpreter does at the end of a basic block. The host
+// code of the next basic block is entered directly if it is still valid and nothing else
+// should be done at the end of the basic block. Otherwise `rax` is returned.
+static void emit_chain(Decode *tail) {
+  emit8(0x66); emit8(0x83); emit8(0xb8); emit32(offsetof(Decode, idx_in_bb)); emit8(1); // cmp word [rax + idx_in_bb], 1
+  uint8_t *in_trace = emit_jcc(CC_NE);
+  emit_li(RCX, (uintptr_t)g_n_remain);
+  emit8(0x81); emit8(0x29); emit32(tail->idx_in_bb); // sub dword [rcx], imm32
+  uint8_t *exits[4] = { in_trace, emit_jcc(CC_LE) };
+  int nr_exit = 2;
+#ifndef CONFIG_DIFFTEST
+  // the instructions run by the host code are checked when it returns
+  emit_li(RCX, (uintptr_t)&g_tcache_epoch);
+  emit8(0x8b); emit8(0x09); // mov ecx, [rcx]
+  emit8(0x3b); emit8(0x88); emit32(offsetof(Decode, epoch)); // cmp ecx, [rax + epoch]
+  exits[nr_exit ++] = emit_jcc(CC_NE);
+  emit_li(RCX, (uintptr_t)g_bb_hooks);
+  emit8(0x80); emit8(0x39); emit8(0); // cmp byte [rcx], 0
+  exits[nr_exit ++] = emit_jcc(CC_NE);
+  emit8(0x48); emit8(0x8b); emit8(0x88); emit32(offsetof(Decode, jit_code)); // mov rcx, [rax + jit_code]
+  emit8(0x48); emit8(0x85); emit8(0xc9); // test rcx, rcx
+  uint8_t *no_code = emit_jcc(CC_E);
+  emit8(0x48); emit8(0x83); emit8(0xc1); emit8(prologue_size); // add rcx, prologue_size
+  emit8(0xff); emit8(0xe1); // jmp rcx
+  patch_jmp(no_code);
+#endif
+  int i;
+  for (i = 0; i < nr_exit; i ++) patch_jmp(exits[i]);
+  emit_epilogue();
+}
+
+// the successor in `rax` of a conditional branch comparing `pa` and `pb`
+static bool jit_branch(Decode *s, uint8_t cc, const rtlreg_t *pa, const rtlreg_t *pb) {
+  int32_t a, b;
+  if (!reg_disp(pa, &a) || !reg_disp(pb, &b)) return false;
+  emit_li(RDX, (uintptr_t)&s->ntnext);
+  emit_li(RSI, (uintptr_t)&s->tnext);
+  emit_load_reg(RAX, a);
+  emit_load_reg(RCX, b);
+  emit_alu_rr(ALU_CMP, true);
+  emit8(0x48); emit8(0x0f); emit8(0x40 | cc); emit8(0xd6); // cmovcc rdx, rsi
+  emit8(0x48); emit8(0x8b); emit8(0x02); // mov rax, [rdx]
+  return true;
+}
+
+// the target in `rax` of a direct jump
+static bool jit_jump(Decode *s, const rtlreg_t *link) {
+  if (link != NULL && !jit_li(link, id_src2->imm)) return false;
+  emit_li(RAX, (uintptr_t)&s->tnext);
+  emit8(0x48); emit8(0x8b); emit8(0x00); // mov rax, [rax]
+  return true;
+}
+
+// Translate the direct branch or jump at the end of a basic block.
+// Calls are left to the interpreter to push the return address stack.
+static bool jit_tail(Decode *s) {
+  bool ok;
+  switch (jit_exec_id(s->EHelper)) {
+    case EXEC_ID_beq: ok = jit_branch(s, CC_E, dsrc1, dsrc2); break;
+    case EXEC_ID_bne: ok = jit_branch(s, CC_NE, dsrc1, dsrc2); break;
+    case EXEC_ID_blt: ok = jit_branch(s, CC_L, dsrc1, dsrc2); break;
+    case EXEC_ID_bge: ok = jit_branch(s, CC_GE, dsrc1, dsrc2); break;
+    case EXEC_ID_bltu: ok = jit_branch(s, CC_B, dsrc1, dsrc2); break;
+    case EXEC_ID_bgeu: ok = jit_branch(s, CC_AE, dsrc1, dsrc2); break;
+    case EXEC_ID_c_beqz: ok = jit_branch(s, CC_E, dsrc1, rz); break;
+    case EXEC_ID_c_bnez: ok = jit_branch(s, CC_NE, dsrc1, rz); break;
+    case EXEC_ID_p_blez: ok = jit_branch(s, CC_GE, rz, dsrc2); break;
+    case EXEC_ID_p_bgtz: ok = jit_branch(s, CC_L, rz, dsrc2); break;
+    case EXEC_ID_p_bltz: ok = jit_branch(s, CC_L, dsrc1, rz); break;
+    case EXEC_ID_p_bgez: ok = jit_branch(s, CC_GE, dsrc1, rz); break;
+    case EXEC_ID_jal: ok = jit_jump(s, ddest); break;
+    case EXEC_ID_c_j: ok = jit_jump(s, NULL); break;
+    default: return false;
+  }
+  if (ok) emit_chain(s);
+  return ok;
+}
+
+void tcache_drop_jit_code();
+
+// the pages of the code buffer holding [start, end) are switched between RW and RX
+static void code_protect(uint8_t *start, uint8_t *end, int prot) {
+  uintptr_t lo = (uintptr_t)start & ~(PAGE_SIZE - 1);
+  uintptr_t hi = ((uintptr_t)end + PAGE_SIZE - 1) & ~(PAGE_SIZE - 1);
+  Assert(mprotect((void *)lo, hi - lo, prot) == 0, "fail to protect the code buffer of JIT");
+}
+
+void jit_compile(Decode *s) {
+  if (s->jit_code != NULL) return;
+
+  // stop at the tail, or at the instruction not decoded yet
+  int len = 0;
+  while (s[len].type == INSTR_TYPE_N && s[len].EHelper != g_exec_nemu_decode) len ++;
+  if (len == 0 && s->EHelper == g_exec_nemu_decode) return;
+  if (code_ptr + (len + 2) * JIT_MAX_INSTR_SIZE > code_buf + CONFIG_JIT_CODE_SIZE) {
+    tcache_drop_jit_code();
+    code_ptr = code_buf;
+    nr_flush ++;
+  }
+
+  uint8_t *start = code_ptr;
+  uint8_t *limit = code_ptr + (len + 2) * JIT_MAX_INSTR_SIZE;
+  code_protect(start, limit, PROT_READ | PROT_WRITE);
+  emit8(0x50 | RBX); // push rbx
+  emit_li(RBX, (uintptr_t)&cpu);
+  prologue_size = code_ptr - start;
+  int i;
+  for (i = 0; i < len; i ++) {
+    if (!jit_instr(&s[i])) break;
+  }
+  bool chained = (i == len && jit_tail(&s[len]));
+  if (i == 0 && !chained) { code_ptr = start; }
+  else {
+    if (!chained) {
+      emit_li(RAX, (uintptr_t)&s[i]);
+      emit_epilogue();
+    }
+    s->jit_code = start;
+    nr_block ++;
+    nr_instr += i + chained;
+    nr_chain += chained;
+  }
+  code_protect(start, limit, PROT_READ | PROT_EXEC);
+}
+
+void jit_init(const void **exec_table, const void *exec_nemu_decode, int *n_remain, bool *bb_hooks) {
+  g_exec_table = exec_table;
+  g_exec_nemu_decode = exec_nemu_decode;
+  g_n_remain = n_remain;
+  g_bb_hooks = bb_hooks;
+  code_buf = mmap(NULL, CONFIG_JIT_CODE_SIZE, PROT_READ | PROT_EXEC,
+      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  Assert(code_buf != MAP_FAILED, "fail to allocate the code buffer of JIT");
+  code_ptr = code_buf;
+}
+
+void jit_statistic() {
+  Log("jit: %'lu basic blocks, %'lu instructions translated, %'lu chained, %'lu flushes",
+      nr_block, nr_instr, nr_chain, nr_flush);
+}
@@ -0,0 +1,65 @@
+/***************************************************************************************
+* Copyright (c) 2020-2022 Institute of Computing Technology, Chinese Academy of Sciences
+*
+* NEMU is licensed under Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*          http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+* EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+* MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+*
+* See the Mulan PSL v2 for more details.
+***************************************************************************************/
+
+#include <isa.h>
+#include <checkpoint/cpt_format.h>
+#include "local-include/csr.h"
+
+#if defined(CONFIG_MODE_SYSTEM) && !defined(CONFIG_SHARE)
+void clint_restore(uint64_t mtime, uint64_t mtimecmp);
+int update_mmu_state();
+
+// the CSRs restored by the gcpt restorer, see resource/gcpt_restore/src/csr.h
+static const uint32_t restored_csrs[] = {
+  0x003, // fcsr
+  0x300, 0x301, 0x302, 0x303, 0x304, 0x305, 0x306, // mstatus, misa, medeleg, mideleg, mie, mtvec, mcounteren
+  0x340, 0x341, 0x342, 0x343, 0x344, // mscratch, mepc, mcause, mtval, mip
+  0x3a0, 0x3a2, // pmpcfg0, pmpcfg2
+  0x3b0, 0x3b1, 0x3b2, 0x3b3, 0x3b4, 0x3b5, 0x3b6, 0x3b7, // pmpaddr0-7
+  0x3b8, 0x3b9, 0x3ba, 0x3bb, 0x3bc, 0x3bd, 0x3be, 0x3bf, // pmpaddr8-15
+  0x105, 0x106, // stvec, scounteren
+  0x140, 0x141, 0x142, 0x143, // sscratch, sepc, scause, stval
+  0x180, // satp
+};
+
+// Restore the registers of a checkpoint as the gcpt restorer does, and
+// start from its pc. Unlike the restorer, mstatus and mepc are kept as
+// they are dumped.
+void isa_restore_cpt_regs(const CptRegs *regs) {
+  // the CSRs are written in M mode, as the restorer does
+  assert(cpu.mode == MODE_M);
+  for (int i = 0; i < ARRLEN(restored_csrs); i ++) {
+    uint32_t addr = restored_csrs[i];
+    if (MUXDEF(CONFIG_FPU_NONE, addr == 0x003, false)) continue;
+#ifdef CONFIG_RV_PMP_CSR
+    // the unimplemented pmpaddrs are illegal
+    if (addr >= CSR_PMPADDR0 && addr < CSR_PMPADDR0 + 16 && addr - CSR_PMPADDR0 >= CONFIG_RV_PMP_NUM) continue;
+#endif
+    csrid_write(addr, regs->csr[addr]);
+  }
+
+  for (int i = 1; i < 32; i ++) {
+    cpu.gpr[i]._64 = regs->gpr[i];
+  }
+  for (int i = 0; i < 32; i ++) {
+    cpu.fpr[i]._64 = regs->fpr[i];
+  }
+  clint_restore(regs->mtime, regs->mtimecmp);
+
+  cpu.mode = regs->mode;
+  update_mmu_state();
+  cpu.pc = regs->pc;
+}
+#endif
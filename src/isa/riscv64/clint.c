@@ -14,26 +14,59 @@
 ***************************************************************************************/
 
 #include <utils.h>
+#include <cpu/cpu.h>
 #include <device/alarm.h>
+#include <device/event.h>
 #include <device/map.h>
 #include "local-include/csr.h"
 
 #ifndef CONFIG_SHARE
+#define CLINT_MSIP     0
 #define CLINT_MTIMECMP (0x4000 / sizeof(clint_base[0]))
 #define CLINT_MTIME    (0xBFF8 / sizeof(clint_base[0]))
 #define TIMEBASE 10000000ul
 
 static uint64_t *clint_base = NULL;
 static uint64_t boot_time = 0;
+static uint64_t mtime_offset = 0; // to go on from the mtime of a checkpoint restored
 
-void update_clint() {
-#ifdef CONFIG_DETERMINISTIC
-  clint_base[CLINT_MTIME] += TIMEBASE / 10000;
+#ifdef CONFIG_EVENT_QUEUE
+// mtime is derived from the number of guest instructions executed or skipped
+#define INSTR_PER_TICK (CONFIG_EVENT_IPS / TIMEBASE)
+static int clint_event = -1;
+#endif
+
+// mtime is read by the other harts under CONFIG_SMP, so it is stored atomically.
+// With CONFIG_SMP_LOCKSTEP, it is updated at the end of each round.
+void update_mtime() {
+#if defined(CONFIG_EVENT_QUEUE)
+  extern uint64_t get_virtual_time();
+  uint64_t mtime = mtime_offset + get_virtual_time() / INSTR_PER_TICK;
+#elif defined(CONFIG_SMP_LOCKSTEP)
+  // as if each hart runs 100M instructions per second
+  uint64_t mtime = mtime_offset + smp_round() * CONFIG_SMP_QUANTUM / (100000000 / TIMEBASE);
+#elif defined(CONFIG_DETERMINISTIC)
+  uint64_t mtime = clint_base[CLINT_MTIME] + TIMEBASE / 10000;
 #else
   uint64_t now = get_time() - boot_time;
-  clint_base[CLINT_MTIME] = TIMEBASE * now / 1000000;
+  uint64_t mtime = mtime_offset + TIMEBASE * now / 1000000;
 #endif
+  __atomic_store_n(&clint_base[CLINT_MTIME], mtime, __ATOMIC_RELAXED);
+}
+
+void update_clint() {
+#ifdef CONFIG_SMP
+  // hart 0 owns mtime, and the other harts only read it
+  // msip and mtimecmp are per hart, and only the pending bits of the current hart are updated
+  int id = mhartid->val;
+  IFNDEF(CONFIG_SMP_LOCKSTEP, if (id == 0) update_mtime());
+  uint64_t mtime = __atomic_load_n(&clint_base[CLINT_MTIME], __ATOMIC_RELAXED);
+  mip->mtip = (mtime >= clint_base[CLINT_MTIMECMP + id]);
+  mip->msip = ((uint32_t *)&clint_base[CLINT_MSIP])[id] & 1;
+#else
+  update_mtime();
   mip->mtip = (clint_base[CLINT_MTIME] >= clint_base[CLINT_MTIMECMP]);
+#endif
 }
 
 uint64_t clint_uptime() {
@@ -41,14 +74,39 @@ uint64_t clint_uptime() {
   return clint_base[CLINT_MTIME];
 }
 
+#ifdef CONFIG_EVENT_QUEUE
+// wake up when mtime reaches mtimecmp, instead of checking it periodically
+static void clint_schedule() {
+  uint64_t cmp = clint_base[CLINT_MTIMECMP];
+  cmp = cmp > mtime_offset ? cmp - mtime_offset : 0;
+  event_schedule(clint_event, cmp > EVENT_NONE / INSTR_PER_TICK ? EVENT_NONE : cmp * INSTR_PER_TICK);
+}
+#endif
+
 static void clint_io_handler(uint32_t offset, int len, bool is_write) {
   update_clint();
+  IFDEF(CONFIG_EVENT_QUEUE, if (is_write) clint_schedule());
 }
 
 void init_clint() {
   clint_base = (uint64_t *)new_space(0x10000);
   add_mmio_map("clint", CONFIG_CLINT_MMIO, (uint8_t *)clint_base, 0x10000, clint_io_handler);
-  IFNDEF(CONFIG_DETERMINISTIC, add_alarm_handle(update_clint));
+#ifdef CONFIG_EVENT_QUEUE
+  clint_event = add_event(update_clint);
+  clint_schedule();
+#elif !defined(CONFIG_DETERMINISTIC) && !defined(CONFIG_SMP)
+  // with CONFIG_SMP, every hart calls update_clint() in cpu_exec() instead
+  add_alarm_handle(update_clint);
+#endif
   boot_time = get_time();
 }
+
+void clint_restore(uint64_t mtime, uint64_t mtimecmp) {
+  update_clint();
+  mtime_offset += mtime - clint_base[CLINT_MTIME];
+  clint_base[CLINT_MTIME] = mtime;
+  clint_base[CLINT_MTIMECMP] = mtimecmp;
+  IFDEF(CONFIG_EVENT_QUEUE, clint_schedule());
+  update_clint();
+}
 #endif
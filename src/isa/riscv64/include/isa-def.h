@@ -96,6 +96,10 @@ typedef struct {
   // for LR/SC
   uint64_t lr_addr;
   uint64_t lr_valid;
+#ifdef CONFIG_SMP
+  uint64_t lr_value; // sc fails if the memory no longer holds it
+  uint32_t lr_version; // or if a store bumped the version of the line
+#endif
 
   bool INTR;
 
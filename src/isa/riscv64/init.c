@@ -33,7 +33,20 @@ void init_clint();
 #endif
 void init_device();
 
+#ifdef CONFIG_SMP
+void init_csr_ptr();
+int update_mmu_state();
+
+// set up a hart started with a copy of the state of hart 0
+void isa_init_hart(int id) {
+  init_csr_ptr();
+  mhartid->val = id;
+  update_mmu_state();
+}
+#endif
+
 void init_isa() {
+  IFDEF(CONFIG_SMP, init_csr_ptr());
   init_csr();
 
 #ifndef CONFIG_RESET_FROM_MMIO
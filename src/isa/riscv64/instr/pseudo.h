@@ -60,6 +60,7 @@ def_EHelper(p_bgez) {
 
 def_EHelper(p_jal) {
   rtl_li(s, &cpu.gpr[1]._64, id_src2->imm);
+  rtl_ras_push(s);
   rtl_j(s, id_src1->imm);
 }
 
@@ -71,7 +72,7 @@ def_EHelper(p_ret) {
 #else
 //  IFDEF(CONFIG_ENGINE_INTERPRETER, rtl_andi(s, s0, s0, ~0x1u));
   IFNDEF(CONFIG_DIFFTEST_REF_NEMU, difftest_skip_dut(1, 2));
-  rtl_jr(s, &cpu.gpr[1]._64);
+  rtl_ret(s, &cpu.gpr[1]._64);
 #endif // CONFIG_SHARE
 }
 
@@ -19,16 +19,94 @@
 #include <rtl/rtl.h>
 #include "../local-include/intr.h"
 
+#ifdef CONFIG_SMP
+// The other harts are running at the same time, so atomic instructions on
+// pmem are done with host atomic instructions. sc succeeds if no store
+// bumps the version of the line after lr.
+// Return NULL if the access should go through the normal path instead,
+// which also raises the exceptions.
+static void *amo_host_addr(vaddr_t vaddr, int width, int type) {
+  if (vaddr & (width - 1)) return NULL;
+  paddr_t paddr = vaddr;
+  if (isa_mmu_check(vaddr, width, type) == MMU_TRANSLATE) {
+    paddr_t pg_base = isa_mmu_translate(vaddr, width, type);
+    if ((pg_base & PAGE_MASK) != MEM_RET_OK) return NULL;
+    paddr = pg_base | (vaddr & PAGE_MASK);
+  }
+  if (!in_pmem(paddr) || !isa_pmp_check_permission(paddr, width, type, cpu.mode)) return NULL;
+  return type == MEM_TYPE_WRITE ? pmem_atomic_addr(paddr) : guest_to_host(paddr);
+}
+
+static word_t amo_compute(uint32_t funct5, int width, word_t old, word_t src) {
+  switch (funct5) {
+    case 0b00001: return src;
+    case 0b00000: return old + src;
+    case 0b01000: return old | src;
+    case 0b01100: return old & src;
+    case 0b00100: return old ^ src;
+    case 0b10000: // amomin
+      return (width == 8 ? (int64_t)old < (int64_t)src : (int32_t)old < (int32_t)src) ? old : src;
+    case 0b10100: // amomax
+      return (width == 8 ? (int64_t)old > (int64_t)src : (int32_t)old > (int32_t)src) ? old : src;
+    case 0b11000: // amominu
+      return (width == 8 ? (uint64_t)old < (uint64_t)src : (uint32_t)old < (uint32_t)src) ? old : src;
+    case 0b11100: // amomaxu
+      return (width == 8 ? (uint64_t)old > (uint64_t)src : (uint32_t)old > (uint32_t)src) ? old : src;
+    default: assert(0);
+  }
+}
+
+// return the old value, sign-extended
+static word_t amo_host(void *haddr, uint32_t funct5, int width, word_t src) {
+  pmem_line_store(haddr, width);
+  if (width == 8) {
+    uint64_t old = __atomic_load_n((uint64_t *)haddr, __ATOMIC_RELAXED);
+    while (!__atomic_compare_exchange_n((uint64_t *)haddr, &old, amo_compute(funct5, 8, old, src),
+          false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED));
+    return old;
+  }
+  uint32_t old = __atomic_load_n((uint32_t *)haddr, __ATOMIC_RELAXED);
+  while (!__atomic_compare_exchange_n((uint32_t *)haddr, &old, amo_compute(funct5, 4, old, src),
+        false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED));
+  return (int32_t)old;
+}
+
+static bool sc_host(void *haddr, int width, word_t src) {
+  // claim the line, so the stores of the other harts after lr fail it
+  uint32_t version = cpu.lr_version;
+  if (!__atomic_compare_exchange_n(pmem_line_version(haddr), &version, version + 1,
+        false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED)) return false;
+  word_t expected = cpu.lr_value;
+  if (width == 8) {
+    uint64_t old = expected;
+    return __atomic_compare_exchange_n((uint64_t *)haddr, &old, src, false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED);
+  }
+  uint32_t old = expected;
+  return __atomic_compare_exchange_n((uint32_t *)haddr, &old, src, false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED);
+}
+#endif
+
 __attribute__((cold))
 def_rtl(amo_slow_path, rtlreg_t *dest, const rtlreg_t *src1, const rtlreg_t *src2) {
+#ifdef CONFIG_SMP_LOCKSTEP
+  // the atomic instructions are run in the serial part of the round
+  if (pmem_buffered) { save_globals(s); longjmp_exec(NEMU_EXEC_SERIAL); }
+#endif
   uint32_t funct5 = s->isa.instr.r.funct7 >> 2;
   int width = s->isa.instr.r.funct3 & 1 ? 8 : 4;
 
   if (funct5 == 0b00010) { // lr
     assert(!cpu.amo);
+    vaddr_t addr = *src1;
+#ifdef CONFIG_SMP
+    // take the version before the load, so a store in between fails sc
+    void *haddr = amo_host_addr(addr, width, MEM_TYPE_READ);
+    cpu.lr_version = (haddr ? __atomic_load_n(pmem_line_version(haddr), __ATOMIC_ACQUIRE) : 0);
+#endif
     rtl_lms(s, dest, src1, 0, width, MMU_DYNAMIC);
-    cpu.lr_addr = *src1;
+    cpu.lr_addr = addr;
     cpu.lr_valid = 1;
+    IFDEF(CONFIG_SMP, cpu.lr_value = *dest);
     return;
   } else if (funct5 == 0b00011) { // sc
 #ifdef CONFIG_DIFFTEST_STORE_COMMIT
@@ -39,6 +117,13 @@ def_rtl(amo_slow_path, rtlreg_t *dest, const rtlreg_t *src1, const rtlreg_t *src
 #endif
     // should check overlapping instead of equality
     int success = cpu.lr_addr == *src1 && cpu.lr_valid;
+#ifdef CONFIG_SMP
+    void *haddr = (success ? amo_host_addr(*src1, width, MEM_TYPE_WRITE) : NULL);
+    if (haddr != NULL) {
+      success = sc_host(haddr, width, *src2);
+      cpu.lr_valid = 0;
+    } else
+#endif
     if (success) {
       rtl_sm(s, src2, src1, 0, width, MMU_DYNAMIC);
       cpu.lr_valid = 0;
@@ -65,6 +150,14 @@ def_rtl(amo_slow_path, rtlreg_t *dest, const rtlreg_t *src1, const rtlreg_t *src
 
   cpu.amo = true;
   rtl_lms(s, s0, src1, 0, width, MMU_DYNAMIC);
+#ifdef CONFIG_SMP
+  void *haddr = amo_host_addr(*src1, width, MEM_TYPE_WRITE);
+  if (haddr != NULL) {
+    rtl_li(s, dest, amo_host(haddr, funct5, width, *src2));
+    cpu.amo = false;
+    return;
+  }
+#endif
   switch (funct5) {
     case 0b00001: rtl_mv (s, s1, src2); break;
     case 0b00000: rtl_add(s, s1, s0, src2); break;
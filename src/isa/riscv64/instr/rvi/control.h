@@ -35,6 +35,7 @@ def_EHelper(jalr) {
 #else
   rtl_li(s, ddest, s->snpc);
 #endif
+  if (ddest == &cpu.gpr[1]._64) { rtl_ras_push(s); }
   IFNDEF(CONFIG_DIFFTEST_REF_NEMU, difftest_skip_dut(1, 3));
   rtl_jr(s, s0);
 }
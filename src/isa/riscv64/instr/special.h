@@ -33,17 +33,21 @@ def_EHelper(rt_inv) {
 
 def_EHelper(nemu_trap) {
   save_globals(s);
+  // stop NEMU after the other harts finish the parallel part of the round
+  IFDEF(CONFIG_SMP_LOCKSTEP, if (pmem_buffered) longjmp_exec(NEMU_EXEC_SERIAL));
   if (cpu.gpr[10]._64 == 0x100) {
       extern void disable_time_intr();
       disable_time_intr();
   } else if (cpu.gpr[10]._64 == 0x101) {
-      extern uint64_t g_nr_guest_instr;
+      extern hart_local uint64_t g_nr_guest_instr;
       extern bool profiling_started;
 
       if (!profiling_started) {
         Log("Start profiling, resetting inst count from %lu to 1, (n_remain_total will not be cleared)\n", g_nr_guest_instr);
         g_nr_guest_instr = 1;
         profiling_started = true;
+        extern void update_bb_hooks();
+        update_bb_hooks();
       }
 
   } else {
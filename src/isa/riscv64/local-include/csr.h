@@ -568,7 +568,12 @@ CSR_STRUCT_START(marchid)
 CSR_STRUCT_END(mimpid)
 #endif // CONFIG_RV_ARCH_CSRS
 
+#ifdef CONFIG_SMP
+// csr_array is per hart, so the pointers to it are set up by each hart
+#define CSRS_DECL(name, addr) extern hart_local concat(name, _t)* name;
+#else
 #define CSRS_DECL(name, addr) extern concat(name, _t)* const name;
+#endif
 MAP(CSRS, CSRS_DECL)
 #ifdef CONFIG_RVV
   MAP(VCSRS, CSRS_DECL)
@@ -578,6 +583,7 @@ MAP(CSRS, CSRS_DECL)
 #endif // CONFIG_RV_ARCH_CSRS
 
 word_t csrid_read(uint32_t csrid);
+void csrid_write(uint32_t csrid, word_t val);
 
 // PMP
 uint8_t pmpcfg_from_index(int idx);
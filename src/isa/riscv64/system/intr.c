@@ -91,6 +91,10 @@ word_t raise_intr(word_t NO, vaddr_t epc) {
   }
 }
 
+bool isa_has_pending_intr() {
+  return (mie->val & mip->val) != 0;
+}
+
 word_t isa_query_intr() {
   word_t intr_vec = mie->val & mip->val;
   if (!intr_vec) return INTR_EMPTY;
@@ -178,8 +178,8 @@ bad:
   return MEM_RET_FAIL;
 }
 
-static int ifetch_mmu_state = MMU_DIRECT;
-static int data_mmu_state = MMU_DIRECT;
+static hart_local int ifetch_mmu_state = MMU_DIRECT;
+static hart_local int data_mmu_state = MMU_DIRECT;
 
 int get_data_mmu_state() {
   return (data_mmu_state == MMU_DIRECT ? MMU_DIRECT : MMU_TRANSLATE);
@@ -195,9 +195,14 @@ static inline int update_mmu_state_internal(bool ifetch) {
 }
 
 int update_mmu_state() {
+  int ifetch_mmu_state_old = ifetch_mmu_state;
   ifetch_mmu_state = update_mmu_state_internal(true);
   int data_mmu_state_old = data_mmu_state;
   data_mmu_state = update_mmu_state_internal(false);
+  // decoded loads and stores also depend on the data mmu state
+  if (ifetch_mmu_state != ifetch_mmu_state_old || data_mmu_state != data_mmu_state_old) {
+    mmu_ifetch_remap();
+  }
   return (data_mmu_state ^ data_mmu_state_old) ? true : false;
 }
 
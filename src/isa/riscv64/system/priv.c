@@ -27,10 +27,14 @@ void fp_set_dirty();
 void fp_update_rm_cache(uint32_t rm);
 void vp_set_dirty();
 
-rtlreg_t csr_array[4096] = {};
+hart_local rtlreg_t csr_array[4096] = {};
 
+#ifdef CONFIG_SMP
+#define CSRS_DEF(name, addr) hart_local concat(name, _t)* name = NULL;
+#else
 #define CSRS_DEF(name, addr) \
   concat(name, _t)* const name = (concat(name, _t) *)&csr_array[addr];
+#endif
 
 MAP(CSRS, CSRS_DEF)
 #ifdef CONFIG_RVV
@@ -40,6 +44,20 @@ MAP(CSRS, CSRS_DEF)
   MAP(ARCH_CSRS, CSRS_DEF)
 #endif // CONFIG_RV_ARCH_CSRS
 
+#ifdef CONFIG_SMP
+#define CSRS_PTR(name, addr) name = (concat(name, _t) *)&csr_array[addr];
+// called by each hart before accessing its CSRs
+void init_csr_ptr() {
+  MAP(CSRS, CSRS_PTR)
+#ifdef CONFIG_RVV
+  MAP(VCSRS, CSRS_PTR)
+#endif // CONFIG_RVV
+#ifdef CONFIG_RV_ARCH_CSRS
+  MAP(ARCH_CSRS, CSRS_PTR)
+#endif // CONFIG_RV_ARCH_CSRS
+}
+#endif
+
 #define CSRS_EXIST(name, addr) csr_exist[addr] = 1;
 static bool csr_exist[4096] = {};
 void init_csr() {
@@ -524,6 +542,10 @@ word_t csrid_read(uint32_t csrid) {
   return csr_read(csr_decode(csrid));
 }
 
+void csrid_write(uint32_t csrid, word_t val) {
+  csr_write(csr_decode(csrid), val);
+}
+
 static void csrrw(rtlreg_t *dest, const rtlreg_t *src, uint32_t csrid) {
   if (!csr_is_legal(csrid, src != NULL)) {
     Logti("Illegal csr id %u", csrid);
@@ -582,10 +604,17 @@ static word_t priv_instr(uint32_t op, const rtlreg_t *src) {
       if (cpu.mode < MODE_M && mstatus->tw == 1){
         longjmp_exception(EX_II);
       }
+      IFDEF(CONFIG_IDLE_FAST_FORWARD, cpu_wait_for_intr());
     break;
 #endif // CONFIG_MODE_USER
     case -1: // fence.i
+      // stores into decoded instructions are detected by pmem_write() in system mode,
+      // but only the stores of the same hart
+#if defined(CONFIG_MODE_SYSTEM) && !defined(CONFIG_SMP)
+      set_sys_state_flag(SYS_STATE_FENCE_I);
+#else
       set_sys_state_flag(SYS_STATE_FLUSH_TCACHE);
+#endif
       break;
     default:
       switch (op >> 5) { // instr[31:25]
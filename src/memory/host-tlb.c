@@ -18,20 +18,13 @@
 #include <memory/host.h>
 #include <memory/vaddr.h>
 #include <memory/paddr.h>
+#include <memory/host-tlb.h>
 #include <cpu/cpu.h>
 
-#define HOSTTLB_SIZE_SHIFT 12
-#define HOSTTLB_SIZE (1 << HOSTTLB_SIZE_SHIFT)
-
-typedef struct {
-  uint8_t *offset; // offset from the guest virtual address of the data page to the host virtual address
-  vaddr_t gvpn; // guest virtual page number
-} HostTLBEntry;
-
-static HostTLBEntry hosttlb[HOSTTLB_SIZE * 3];
-static HostTLBEntry* const hostrtlb = &hosttlb[0];
-static HostTLBEntry* const hostwtlb = &hosttlb[HOSTTLB_SIZE];
-static HostTLBEntry* const hostxtlb = &hosttlb[HOSTTLB_SIZE * 2];
+static hart_local HostTLBEntry hosttlb[HOSTTLB_SIZE * 3];
+#define hostrtlb (&hosttlb[0])
+#define hostwtlb (&hosttlb[HOSTTLB_SIZE])
+#define hostxtlb (&hosttlb[HOSTTLB_SIZE * 2])
 
 static inline vaddr_t hosttlb_vpn(vaddr_t vaddr) {
   return (vaddr >> PAGE_SHIFT);
@@ -41,9 +34,35 @@ static inline int hosttlb_idx(vaddr_t vaddr) {
   return (hosttlb_vpn(vaddr) % HOSTTLB_SIZE);
 }
 
+#ifdef CONFIG_SMP_LOCKSTEP
+// The entries mapped to the private copies of the pages, which are dropped
+// after the copies are committed. All entries are dropped if there are more.
+#define NR_PRIV_ENTRY 64
+static hart_local HostTLBEntry *priv_entry[NR_PRIV_ENTRY];
+static hart_local int nr_priv_entry = 0;
+static hart_local bool hosttlb_empty = true;
+#endif
+
+static inline void hosttlb_fill(HostTLBEntry *e, vaddr_t vaddr, paddr_t paddr) {
+#ifdef CONFIG_SMP_LOCKSTEP
+  uint8_t *haddr = pmem_hart_addr(paddr);
+  if (haddr != guest_to_host(paddr)) {
+    if (nr_priv_entry < NR_PRIV_ENTRY) priv_entry[nr_priv_entry] = e;
+    nr_priv_entry ++;
+  }
+  hosttlb_empty = false;
+#else
+  uint8_t *haddr = guest_to_host(paddr);
+#endif
+  e->offset = haddr - vaddr;
+  e->gvpn = hosttlb_vpn(vaddr);
+}
+
 void hosttlb_flush(vaddr_t vaddr) {
   if (vaddr == 0) {
     memset(hosttlb, -1, sizeof(hosttlb));
+    IFDEF(CONFIG_SMP_LOCKSTEP, nr_priv_entry = 0);
+    IFDEF(CONFIG_SMP_LOCKSTEP, hosttlb_empty = true);
   } else {
     vaddr_t gvpn = hosttlb_vpn(vaddr);
     int idx = hosttlb_idx(vaddr);
@@ -53,6 +72,47 @@ void hosttlb_flush(vaddr_t vaddr) {
   }
 }
 
+// Drop the write entries mapped to the physical page of `paddr`,
+// so stores into it go through the slow path again.
+void hosttlb_write_protect(paddr_t paddr) {
+  uint8_t *hpage = MUXDEF(CONFIG_SMP_LOCKSTEP, pmem_hart_addr, guest_to_host)(paddr & ~(paddr_t)PAGE_MASK);
+  int i;
+  for (i = 0; i < HOSTTLB_SIZE; i ++) {
+    HostTLBEntry *e = &hostwtlb[i];
+    if (e->gvpn != (vaddr_t)(sword_t)-1 && e->offset + (e->gvpn << PAGE_SHIFT) == hpage) {
+      e->gvpn = (sword_t)-1;
+    }
+  }
+}
+
+#ifdef CONFIG_SMP_LOCKSTEP
+// Drop the entries mapped to the physical page of `paddr` in pmem,
+// after the hart makes a private copy of it.
+void hosttlb_drop_page(paddr_t paddr) {
+  if (hosttlb_empty) return;
+  uint8_t *hpage = guest_to_host(paddr & ~(paddr_t)PAGE_MASK);
+  int i;
+  for (i = 0; i < HOSTTLB_SIZE * 3; i ++) {
+    HostTLBEntry *e = &hosttlb[i];
+    if (e->gvpn != (vaddr_t)(sword_t)-1 && e->offset + (e->gvpn << PAGE_SHIFT) == hpage) {
+      e->gvpn = (sword_t)-1;
+    }
+  }
+}
+
+void hosttlb_drop_private() {
+  if (nr_priv_entry > NR_PRIV_ENTRY) { hosttlb_flush(0); return; }
+  int i;
+  for (i = 0; i < nr_priv_entry; i ++) priv_entry[i]->gvpn = (sword_t)-1;
+  nr_priv_entry = 0;
+}
+#endif
+
+// the entries are also looked up by the host code of the JIT
+HostTLBEntry* hosttlb_table(int type) {
+  return type == MEM_TYPE_IFETCH ? hostxtlb : (type == MEM_TYPE_WRITE ? hostwtlb : hostrtlb);
+}
+
 void hosttlb_init() {
   hosttlb_flush(0);
 }
@@ -74,8 +134,7 @@ static word_t hosttlb_read_slowpath(struct Decode *s, vaddr_t vaddr, int len, in
   if (likely(in_pmem(paddr))) {
     HostTLBEntry *e = type == MEM_TYPE_IFETCH ?
       &hostxtlb[hosttlb_idx(vaddr)] : &hostrtlb[hosttlb_idx(vaddr)];
-    e->offset = guest_to_host(paddr) - vaddr;
-    e->gvpn = hosttlb_vpn(vaddr);
+    hosttlb_fill(e, vaddr, paddr);
   }
   Logtr("Slowpath, vaddr " FMT_WORD " --> paddr: " FMT_PADDR, vaddr, paddr);
   return data;
@@ -86,9 +145,7 @@ static void hosttlb_write_slowpath(struct Decode *s, vaddr_t vaddr, int len, wor
   paddr_t paddr = va2pa(s, vaddr, len, MEM_TYPE_WRITE);
   paddr_write(paddr, len, data, cpu.mode, vaddr);
   if (likely(in_pmem(paddr))) {
-    HostTLBEntry *e = &hostwtlb[hosttlb_idx(vaddr)];
-    e->offset = guest_to_host(paddr) - vaddr;
-    e->gvpn = hosttlb_vpn(vaddr);
+    hosttlb_fill(&hostwtlb[hosttlb_idx(vaddr)], vaddr, paddr);
   }
 }
 
@@ -106,6 +163,25 @@ word_t hosttlb_read(struct Decode *s, vaddr_t vaddr, int len, int type) {
   }
 }
 
+// translate the address of instruction fetch without reading the instruction
+paddr_t hosttlb_ifetch_paddr(vaddr_t vaddr) {
+  vaddr_t gvpn = hosttlb_vpn(vaddr);
+  HostTLBEntry *e = &hostxtlb[hosttlb_idx(vaddr)];
+  if (unlikely(e->gvpn != gvpn)) {
+    paddr_t paddr = va2pa(NULL, vaddr, CONFIG_ILEN_MIN, MEM_TYPE_IFETCH);
+    if (likely(in_pmem(paddr))) {
+      hosttlb_fill(e, vaddr, paddr);
+    }
+    return paddr;
+  }
+  paddr_t paddr = host_to_guest(e->offset + vaddr);
+#ifdef CONFIG_SMP_LOCKSTEP
+  // the entry maps to a private copy of the page
+  if (unlikely(!in_pmem(paddr))) return va2pa(NULL, vaddr, CONFIG_ILEN_MIN, MEM_TYPE_IFETCH);
+#endif
+  return paddr;
+}
+
 void hosttlb_write(struct Decode *s, vaddr_t vaddr, int len, word_t data) {
   vaddr_t gvpn = hosttlb_vpn(vaddr);
   HostTLBEntry *e = &hostwtlb[hosttlb_idx(vaddr)];
@@ -113,5 +189,6 @@ void hosttlb_write(struct Decode *s, vaddr_t vaddr, int len, word_t data) {
     hosttlb_write_slowpath(s, vaddr, len, data);
     return;
   }
+  IFDEF(CONFIG_SMP, pmem_host_store(e->offset + vaddr, len));
   host_write(e->offset + vaddr, len, data);
 }
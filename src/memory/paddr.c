@@ -17,6 +17,8 @@
 #include <isa.h>
 #include <memory/host.h>
 #include <memory/paddr.h>
+#include <memory/vaddr.h>
+#include <memory/host-tlb.h>
 #include <device/mmio.h>
 #include <stdlib.h>
 #include <time.h>
@@ -44,17 +46,265 @@ uint8_t *get_pmem()
 uint8_t* guest_to_host(paddr_t paddr) { return paddr + HOST_PMEM_OFFSET; }
 paddr_t host_to_guest(uint8_t *haddr) { return haddr - HOST_PMEM_OFFSET; }
 
+#ifdef CONFIG_SMP_LOCKSTEP
+// In the parallel part of a round, the stores of a hart go to its private
+// copies of the pages, and each copy is followed by a mask of the bytes
+// written. The loads of the hart see its own stores in the copies. The
+// copies are committed to pmem in the order of the harts after all harts
+// finish the part, so the result does not depend on the host scheduling.
+hart_local bool pmem_buffered = false;
+
+typedef struct {
+  paddr_t pg;
+  uint8_t *copy;
+} PrivPage;
+
+typedef struct {
+  PrivPage *table; // open addressing, keyed by pg
+  uint32_t cap, nr;
+  PrivPage last; // the last page looked up, with a NULL copy if not found
+  uint8_t **free; // the copies to reuse
+  uint32_t nr_free, nr_alloc;
+} PrivMem;
+
+// indexed by the hart id, so pmem_commit() sees the copies of all harts
+static PrivMem priv_mem[CONFIG_NR_HARTS] = {};
+
+static inline uint32_t priv_hash(PrivMem *m, paddr_t pg) {
+  return (pg >> PAGE_SHIFT) & (m->cap - 1);
+}
+
+static uint8_t *priv_search(PrivMem *m, paddr_t pg) {
+  m->last = (PrivPage){ .pg = pg, .copy = NULL };
+  uint32_t i;
+  for (i = priv_hash(m, pg); m->nr > 0 && m->table[i].copy != NULL; i = (i + 1) & (m->cap - 1)) {
+    if (m->table[i].pg == pg) { m->last = m->table[i]; break; }
+  }
+  return m->last.copy;
+}
+
+static inline uint8_t *priv_find(PrivMem *m, paddr_t pg) {
+  return likely(m->last.pg == pg) ? m->last.copy : priv_search(m, pg);
+}
+
+static void priv_insert(PrivMem *m, paddr_t pg, uint8_t *copy) {
+  uint32_t i;
+  for (i = priv_hash(m, pg); m->table[i].copy != NULL; i = (i + 1) & (m->cap - 1));
+  m->table[i] = (PrivPage){ .pg = pg, .copy = copy };
+  m->last = m->table[i];
+  m->nr ++;
+}
+
+static void priv_grow(PrivMem *m) {
+  PrivPage *old = m->table;
+  uint32_t old_cap = m->cap, i;
+  m->cap = (old_cap == 0 ? 256 : old_cap * 2);
+  m->table = calloc(m->cap, sizeof(PrivPage));
+  m->free = realloc(m->free, m->cap / 2 * sizeof(uint8_t *));
+  assert(m->table != NULL && m->free != NULL);
+  m->nr = 0;
+  for (i = 0; i < old_cap; i ++) {
+    if (old[i].copy != NULL) priv_insert(m, old[i].pg, old[i].copy);
+  }
+  free(old);
+}
+
+// the private copy of the page `pg`, made at the first store into it
+__attribute__((noinline))
+static uint8_t *priv_copy(PrivMem *m, paddr_t pg) {
+  if ((m->nr + 1) * 2 > m->cap) priv_grow(m);
+  uint8_t *copy;
+  if (m->nr_free > 0) copy = m->free[-- m->nr_free];
+  else {
+    copy = aligned_alloc(PAGE_SIZE, PAGE_SIZE * 2);
+    assert(copy != NULL);
+    memset(copy + PAGE_SIZE, 0, PAGE_SIZE);
+    m->nr_alloc ++;
+  }
+  memcpy(copy, guest_to_host(pg), PAGE_SIZE);
+  priv_insert(m, pg, copy);
+  // the host TLB maps the page to pmem before
+  hosttlb_drop_page(pg);
+  return copy;
+}
+
+uint8_t *pmem_hart_addr(paddr_t addr) {
+  if (pmem_buffered) {
+    uint8_t *copy = priv_find(&priv_mem[g_hart_id], addr & ~(paddr_t)PAGE_MASK);
+    if (copy != NULL) return copy + (addr & PAGE_MASK);
+  }
+  return guest_to_host(addr);
+}
+
+static inline word_t pmem_buffered_read(paddr_t addr, int len) {
+  if (likely(((addr ^ (addr + len - 1)) >> PAGE_SHIFT) == 0)) return host_read(pmem_hart_addr(addr), len);
+  word_t data = 0;
+  int i;
+  for (i = 0; i < len; i ++) data |= (word_t)*pmem_hart_addr(addr + i) << (i * 8);
+  return data;
+}
+
+// the host address of `addr` in the private copy of its page
+static inline uint8_t *priv_addr(PrivMem *m, paddr_t addr) {
+  paddr_t pg = addr & ~(paddr_t)PAGE_MASK;
+  uint8_t *copy = priv_find(m, pg);
+  if (unlikely(copy == NULL)) copy = priv_copy(m, pg);
+  return copy + (addr & PAGE_MASK);
+}
+
+static inline void pmem_buffered_write(paddr_t addr, int len, word_t data) {
+  PrivMem *m = &priv_mem[g_hart_id];
+  if (likely(((addr ^ (addr + len - 1)) >> PAGE_SHIFT) == 0)) {
+    uint8_t *h = priv_addr(m, addr);
+    host_write(h, len, data);
+    host_write(h + PAGE_SIZE, len, -1); // mark the bytes written
+    return;
+  }
+  int i;
+  for (i = 0; i < len; i ++) {
+    uint8_t *h = priv_addr(m, addr + i);
+    *h = data >> (i * 8);
+    h[PAGE_SIZE] = 0xff;
+  }
+}
+
+// Called with all harts stopped. The bytes written by later harts win.
+void pmem_commit() {
+  int h;
+  uint32_t i, j;
+  for (h = 0; h < CONFIG_NR_HARTS; h ++) {
+    PrivMem *m = &priv_mem[h];
+    for (i = 0; m->nr > 0 && i < m->cap; i ++) {
+      if (m->table[i].copy == NULL) continue;
+      uint64_t *dst = (uint64_t *)guest_to_host(m->table[i].pg);
+      uint64_t *src = (uint64_t *)m->table[i].copy;
+      uint64_t *mask = (uint64_t *)(m->table[i].copy + PAGE_SIZE);
+      for (j = 0; j < PAGE_SIZE / sizeof(uint64_t); j ++) {
+        if (mask[j] == 0) continue;
+        __atomic_fetch_add(pmem_line_version(&dst[j]), 1, __ATOMIC_RELAXED); // fail sc
+        dst[j] = (dst[j] & ~mask[j]) | (src[j] & mask[j]);
+        mask[j] = 0;
+      }
+    }
+  }
+}
+
+// Called by each hart after pmem_commit(), to drop its copies.
+void pmem_buffer_reset() {
+  PrivMem *m = &priv_mem[g_hart_id];
+  if (m->nr == 0) return;
+  uint32_t i;
+  for (i = 0; i < m->cap; i ++) {
+    if (m->table[i].copy != NULL) m->free[m->nr_free ++] = m->table[i].copy;
+    m->table[i].copy = NULL;
+  }
+  m->nr = 0;
+  m->last = (PrivPage){ .pg = (paddr_t)-1, .copy = NULL };
+  hosttlb_drop_private();
+}
+#endif
+
 static inline word_t pmem_read(paddr_t addr, int len) {
+  IFDEF(CONFIG_SMP_LOCKSTEP, if (pmem_buffered) return pmem_buffered_read(addr, len));
   return host_read(guest_to_host(addr), len);
 }
 
+#ifdef CONFIG_PERF_OPT
+// Pages holding instructions decoded by the trace cache. They are kept out of
+// the host write TLB, so stores into them always reach pmem_write().
+// Each hart only watches its own stores. Instructions written by other harts
+// are picked up when it executes fence.i, which flushes the trace cache.
+static hart_local uint64_t code_page_bitmap[(CONFIG_MSIZE / PAGE_SIZE + 63) / 64] = {};
+
+static inline uint64_t code_page_idx(paddr_t addr) {
+  return (addr - CONFIG_MBASE) >> PAGE_SHIFT;
+}
+
+static inline bool is_code_page(paddr_t addr) {
+  uint64_t idx = code_page_idx(addr);
+  return (code_page_bitmap[idx / 64] >> (idx % 64)) & 1;
+}
+
+void pmem_set_code_page(paddr_t addr) {
+  if (!in_pmem(addr) || is_code_page(addr)) return;
+  uint64_t idx = code_page_idx(addr);
+  code_page_bitmap[idx / 64] |= 1ull << (idx % 64);
+  hosttlb_write_protect(addr);
+}
+
+__attribute__((noinline))
+static void pmem_write_code_page(paddr_t addr) {
+  uint64_t idx = code_page_idx(addr);
+  code_page_bitmap[idx / 64] &= ~(1ull << (idx % 64));
+  void tcache_invalidate_page(paddr_t pg);
+  tcache_invalidate_page(addr & ~(paddr_t)PAGE_MASK);
+}
+#endif
+
+#ifndef CONFIG_SMP
+// Pages written since the last checkpoint, for the delta checkpoints.
+// A page enters the host write TLB only after a store through pmem_write(),
+// so clearing the bitmap also flushes the host TLB.
+// It is not kept under CONFIG_SMP, where the harts store in parallel.
+static uint64_t dirty_page_bitmap[(CONFIG_MSIZE / PAGE_SIZE + 63) / 64] = {};
+
+static inline void pmem_set_dirty(paddr_t addr) {
+  uint64_t idx = (addr - CONFIG_MBASE) >> PAGE_SHIFT;
+  dirty_page_bitmap[idx / 64] |= 1ull << (idx % 64);
+}
+
+// for the writes to pmem not through pmem_write()
+void pmem_mark_dirty(paddr_t addr, size_t len) {
+  for (paddr_t pg = addr & ~(paddr_t)PAGE_MASK; pg < addr + len; pg += PAGE_SIZE) {
+    pmem_set_dirty(pg);
+  }
+}
+
+const uint64_t *pmem_dirty_bitmap() {
+  return dirty_page_bitmap;
+}
+
+void pmem_clear_dirty() {
+  memset(dirty_page_bitmap, 0, sizeof(dirty_page_bitmap));
+  hosttlb_flush(0);
+}
+#endif
+
 static inline void pmem_write(paddr_t addr, int len, word_t data) {
 #ifdef CONFIG_DIFFTEST_STORE_COMMIT
   store_commit_queue_push(addr, data, len);
 #endif
+#ifndef CONFIG_SMP
+  pmem_set_dirty(addr);
+  if (unlikely(((addr ^ (addr + len - 1)) >> PAGE_SHIFT) && in_pmem(addr + len - 1))) {
+    pmem_set_dirty(addr + len - 1);
+  }
+#endif
+#ifdef CONFIG_PERF_OPT
+  if (unlikely(is_code_page(addr))) pmem_write_code_page(addr);
+  paddr_t last = addr + len - 1;
+  if (unlikely((addr ^ last) >> PAGE_SHIFT) && in_pmem(last) && is_code_page(last)) {
+    pmem_write_code_page(last);
+  }
+#endif
+  IFDEF(CONFIG_SMP_LOCKSTEP, if (pmem_buffered) { pmem_buffered_write(addr, len, data); return; });
+  IFDEF(CONFIG_SMP, pmem_line_store(guest_to_host(addr), len));
   host_write(guest_to_host(addr), len, data);
 }
 
+#ifdef CONFIG_SMP
+uint32_t pmem_line_version_table[PMEM_NR_LINE_VERSION] = {};
+
+// The host address of an aligned atomic access, which is done in place
+// instead of through pmem_write(), since the other harts are running.
+uint8_t *pmem_atomic_addr(paddr_t addr) {
+#ifdef CONFIG_PERF_OPT
+  if (unlikely(is_code_page(addr))) pmem_write_code_page(addr);
+#endif
+  return guest_to_host(addr);
+}
+#endif
+
 static inline void raise_access_fault(int cause, vaddr_t vaddr) {
   INTR_TVAL_REG(cause) = vaddr;
   // cpu.amo flag must be reset to false before longjmp_exception,
@@ -129,6 +379,8 @@ word_t paddr_read(paddr_t addr, int len, int type, int mode, vaddr_t vaddr) {
 #ifndef CONFIG_SHARE
   if (likely(in_pmem(addr))) return pmem_read(addr, len);
   else {
+    // the devices are shared by the harts, so they are accessed serially
+    IFDEF(CONFIG_SMP_LOCKSTEP, if (pmem_buffered && type == MEM_TYPE_READ) longjmp_exec(NEMU_EXEC_SERIAL));
     if (likely(is_in_mmio(addr))) return mmio_read(addr, len);
     else raise_read_access_fault(type, vaddr);
     return 0;
@@ -171,6 +423,7 @@ void paddr_write(paddr_t addr, int len, word_t data, int mode, vaddr_t vaddr) {
 #ifndef CONFIG_SHARE
   if (likely(in_pmem(addr))) pmem_write(addr, len, data);
   else {
+    IFDEF(CONFIG_SMP_LOCKSTEP, if (pmem_buffered) longjmp_exec(NEMU_EXEC_SERIAL));
     if (likely(is_in_mmio(addr))) mmio_write(addr, len, data);
     else raise_access_fault(EX_SAF, vaddr);
   }
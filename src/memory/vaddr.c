@@ -23,6 +23,7 @@
 #include <memory/paddr.h>
 #include <memory/vaddr.h>
 #include <memory/host-tlb.h>
+#include <cpu/cpu.h>
 
 #ifndef __ICS_EXPORT
 #ifndef ENABLE_HOSTTLB
@@ -117,6 +118,8 @@ static inline word_t vaddr_read_internal(void *s, vaddr_t addr, int len, int typ
   }
   if (mmu_mode == MMU_DIRECT) {
     Logm("Paddr reading directly");
+    // a device access restarts the instruction in the serial part of the round
+    IFDEF(CONFIG_SMP_LOCKSTEP, if (s != NULL) save_globals(s));
     return paddr_read(addr, len, type, cpu.mode, addr);
   }
 #ifndef __ICS_EXPORT
@@ -129,6 +132,21 @@ word_t vaddr_ifetch(vaddr_t addr, int len) {
   return vaddr_read_internal(NULL, addr, len, MEM_TYPE_IFETCH, MMU_DYNAMIC);
 }
 
+// the guest physical address of the instruction at `addr`,
+// exception is raised if it can not be fetched
+paddr_t vaddr_ifetch_paddr(vaddr_t addr) {
+  if (isa_mmu_check(addr, CONFIG_ILEN_MIN, MEM_TYPE_IFETCH) == MMU_DIRECT) return addr;
+#ifndef __ICS_EXPORT
+#ifdef ENABLE_HOSTTLB
+  return hosttlb_ifetch_paddr(addr);
+#else
+  paddr_t pg_base = isa_mmu_translate(addr, CONFIG_ILEN_MIN, MEM_TYPE_IFETCH);
+  if ((pg_base & PAGE_MASK) == MEM_RET_OK) return pg_base | (addr & PAGE_MASK);
+#endif
+#endif
+  return addr;
+}
+
 word_t vaddr_read(struct Decode *s, vaddr_t addr, int len, int mmu_mode) {
   Logm("Reading vaddr %lx", addr);
   return vaddr_read_internal(s, addr, len, MEM_TYPE_READ, mmu_mode);
@@ -140,7 +158,11 @@ void vaddr_write(struct Decode *s, vaddr_t addr, int len, word_t data, int mmu_m
   isa_misalign_data_addr_check(addr, len, MEM_TYPE_WRITE);
 #endif
   if (unlikely(mmu_mode == MMU_DYNAMIC)) mmu_mode = isa_mmu_check(addr, len, MEM_TYPE_WRITE);
-  if (mmu_mode == MMU_DIRECT) { paddr_write(addr, len, data, cpu.mode, addr); return; }
+  if (mmu_mode == MMU_DIRECT) {
+    IFDEF(CONFIG_SMP_LOCKSTEP, if (s != NULL) save_globals(s));
+    paddr_write(addr, len, data, cpu.mode, addr);
+    return;
+  }
 #ifndef __ICS_EXPORT
   MUXDEF(ENABLE_HOSTTLB, hosttlb_write, vaddr_mmu_write) (s, addr, len, data);
 #endif
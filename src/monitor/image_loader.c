@@ -17,9 +17,21 @@
 #include <stdlib.h>
 #include <macro.h>
 #include <memory/paddr.h>
+#include <unistd.h>
+#include <fcntl.h>
 #ifdef CONFIG_MEM_COMPRESS
 #include <zlib.h>
+#include <pthread.h>
+#include <limits.h>
+#include <errno.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <linux/userfaultfd.h>
+#include <sys/stat.h>
 #endif
+#include <checkpoint/profiling.h>
+#include <checkpoint/cpt_format.h>
 
 #ifndef CONFIG_MODE_USER
 
@@ -58,8 +70,431 @@ long load_gz_img(const char *filename) {
   Assert(!gzclose(compressed_mem), "Error closing '%s'\n", filename);
   return curr_size;
 }
+
+static void cpt_read_header(int fd, const char *filename, CptHeader *header) {
+  Assert(pread(fd, header, sizeof(*header), 0) == sizeof(*header) &&
+      !memcmp(header->magic, CPT_MAGIC, sizeof(header->magic)) && header->version == CPT_VERSION && header->chunk_size == CPT_CHUNK_SIZE,
+      "Unsupported checkpoint '%s'", filename);
+  Assert(header->mem_size <= MEMORY_SIZE && header->mem_size % CPT_PAGE_SIZE == 0,
+      "Checkpoint size 0x%lx is larger than the memory or not page-aligned", header->mem_size);
+}
+
+// the path of the parent of a delta is relative to the delta
+static void cpt_parent_path(int fd, const char *filename, const CptHeader *header, char *parent) {
+  const char *slash = strrchr(filename, '/');
+  int dir_len = slash ? slash - filename + 1 : 0;
+  memcpy(parent, filename, dir_len);
+  ssize_t len = pread(fd, parent + dir_len, PATH_MAX - dir_len, header->parent_offset);
+  Assert(len > 0 && memchr(parent + dir_len, '\0', len), "Can not read the parent of '%s'", filename);
+}
+
+// The entries are checked here, so the loaders can trust them
+// to stay within the file and within pmem.
+static CptChunk *cpt_read_index(int fd, const char *filename, const CptHeader *header) {
+  struct stat st;
+  Assert(fstat(fd, &st) == 0, "Can not stat '%s'", filename);
+  uint64_t file_size = st.st_size;
+  Assert(header->nr_chunks <= (header->mem_size + CPT_CHUNK_SIZE - 1) / CPT_CHUNK_SIZE &&
+      header->index_offset <= file_size &&
+      header->nr_chunks * sizeof(CptChunk) <= file_size - header->index_offset,
+      "Corrupted chunk index of '%s'", filename);
+
+  size_t index_size = header->nr_chunks * sizeof(CptChunk);
+  CptChunk *index = (CptChunk *)malloc(index_size);
+  Assert(pread(fd, index, index_size, header->index_offset) == (ssize_t)index_size,
+      "Can not read the chunk index of '%s'", filename);
+  for (uint64_t i = 0; i < header->nr_chunks; i ++) {
+    const CptChunk *c = &index[i];
+    // the last page stored must end within the memory of the checkpoint,
+    // which is the end of the chunk unless the memory ends in the chunk
+    Assert(c->page_mask != 0 && c->addr % CPT_CHUNK_SIZE == 0 && c->addr < header->mem_size &&
+        (64 - __builtin_clzl(c->page_mask)) * CPT_PAGE_SIZE <= header->mem_size - c->addr,
+        "Chunk at 0x%lx is out of the memory of '%s'", c->addr, filename);
+    Assert(c->offset <= file_size && c->size <= file_size - c->offset,
+        "Chunk at 0x%lx is out of '%s'", c->addr, filename);
+  }
+  return index;
+}
+
+typedef struct {
+  uint8_t *pages; // the pages decompressed
+  uint8_t *buf;   // the pages compressed
+  uint64_t buf_size;
+} CptChunkBuf;
+
+// decompress the pages stored in a chunk into the chunk at dst
+static void cpt_unpack_chunk(int fd, const CptChunk *c, uint8_t *dst, CptChunkBuf *b) {
+  if (b->pages == NULL) {
+    b->pages = (uint8_t *)malloc(CPT_CHUNK_SIZE);
+  }
+  if (c->size > b->buf_size) {
+    b->buf_size = c->size;
+    b->buf = (uint8_t *)realloc(b->buf, b->buf_size);
+  }
+  Assert(pread(fd, b->buf, c->size, c->offset) == (ssize_t)c->size, "Can not read chunk at 0x%lx", c->addr);
+
+  // a full chunk is decompressed in place
+  bool full = c->page_mask == ~0ul;
+  uLongf len = CPT_CHUNK_SIZE;
+  int ret = uncompress(full ? dst : b->pages, &len, b->buf, c->size);
+  Assert(ret == Z_OK && len == __builtin_popcountl(c->page_mask) * CPT_PAGE_SIZE,
+      "Corrupted chunk at 0x%lx", c->addr);
+  if (full) return;
+
+  uint8_t *src = b->pages;
+  for (int p = 0; p < CPT_CHUNK_PAGES; p++) {
+    if (c->page_mask & (1ul << p)) {
+      memcpy(dst + p * CPT_PAGE_SIZE, src, CPT_PAGE_SIZE);
+      src += CPT_PAGE_SIZE;
+    }
+  }
+}
+
+typedef struct {
+  int fd;
+  const CptChunk *index;
+  uint64_t nr_chunks;
+  uint64_t next; // the next chunk to load
+} CptLoader;
+
+static void *load_cpt_chunks(void *arg) {
+  CptLoader *l = (CptLoader *)arg;
+  uint8_t *pmem_start = (uint8_t *)guest_to_host(RESET_VECTOR);
+  CptChunkBuf b = {};
+  uint64_t i;
+  while ((i = __atomic_fetch_add(&l->next, 1, __ATOMIC_RELAXED)) < l->nr_chunks) {
+    cpt_unpack_chunk(l->fd, &l->index[i], pmem_start + l->index[i].addr, &b);
+  }
+  free(b.buf);
+  free(b.pages);
+  return NULL;
+}
+
+// A full checkpoint does not store the zero pages. They are dropped from pmem,
+// so nothing written before, such as the built-in image, is left in them.
+static void cpt_zero_missing(const CptChunk *index, uint64_t nr_chunks, uint64_t mem_size) {
+  uint8_t *pmem_start = (uint8_t *)guest_to_host(RESET_VECTOR);
+  uint64_t nr_pages = mem_size / CPT_PAGE_SIZE;
+  uint64_t *stored = (uint64_t *)calloc((nr_pages + CPT_CHUNK_PAGES - 1) / CPT_CHUNK_PAGES, sizeof(uint64_t));
+  for (uint64_t i = 0; i < nr_chunks; i++) {
+    stored[index[i].addr / CPT_CHUNK_SIZE] = index[i].page_mask;
+  }
+#define page_stored(p) ((stored[(p) / CPT_CHUNK_PAGES] >> ((p) % CPT_CHUNK_PAGES)) & 1)
+  for (uint64_t p = 0; p < nr_pages; ) {
+    if (page_stored(p)) { p++; continue; }
+    uint64_t start = p;
+    while (p < nr_pages && !page_stored(p)) p++;
+    uint8_t *addr = pmem_start + start * CPT_PAGE_SIZE;
+    size_t len = (p - start) * CPT_PAGE_SIZE;
+    if (madvise(addr, len, MADV_DONTNEED) != 0) memset(addr, 0, len);
+  }
+#undef page_stored
+  free(stored);
+}
+
+long load_cpt_img(const char *filename) {
+  int fd = open(filename, O_RDONLY);
+  Assert(fd >= 0, "Can not open '%s'", filename);
+  CptHeader header;
+  cpt_read_header(fd, filename, &header);
+
+  // a delta is applied on the memory of its parent
+  if (header.parent_offset != 0) {
+    char parent[PATH_MAX];
+    cpt_parent_path(fd, filename, &header, parent);
+    Log("Loading the parent checkpoint %s", parent);
+    load_cpt_img(parent);
+  }
+
+  CptChunk *index = cpt_read_index(fd, filename, &header);
+  if (header.parent_offset == 0) {
+    cpt_zero_missing(index, header.nr_chunks, header.mem_size);
+  }
+
+  // the chunks are independent, so they are decompressed in parallel
+  CptLoader loader = { .fd = fd, .index = index, .nr_chunks = header.nr_chunks, .next = 0 };
+  long nr_threads = sysconf(_SC_NPROCESSORS_ONLN);
+  if (nr_threads > 64) nr_threads = 64;
+  if (nr_threads > (long)header.nr_chunks) nr_threads = header.nr_chunks;
+  pthread_t threads[64];
+  for (long t = 1; t < nr_threads; t++) {
+    Assert(pthread_create(&threads[t], NULL, load_cpt_chunks, &loader) == 0, "Can not create loader thread");
+  }
+  load_cpt_chunks(&loader);
+  for (long t = 1; t < nr_threads; t++) {
+    pthread_join(threads[t], NULL);
+  }
+  Log("Loaded %lu chunks with %ld threads, taken @ instruction count %lu",
+      header.nr_chunks, nr_threads, header.inst_count);
+
+  free(index);
+  close(fd);
+  return header.mem_size;
+}
+
+// Lazy restore: pmem is registered to userfaultfd, and a chunk is loaded by
+// a handler thread when one of its pages is touched for the first time.
+// The checkpoints of a delta chain are applied in order, from the full one.
+typedef struct {
+  int fd;
+  CptChunk *index;
+  int32_t *chunk_idx; // the index entry of each chunk of pmem, -1 if it is not stored
+} CptLazyFile;
+
+static CptLazyFile *lazy_files = NULL;
+static int nr_lazy_files = 0;
+static uint64_t nr_pmem_chunks = 0;
+static uint64_t nr_lazy_loaded = 0;
+
+static void cpt_lazy_open(const char *filename) {
+  int fd = open(filename, O_RDONLY);
+  Assert(fd >= 0, "Can not open '%s'", filename);
+  CptHeader header;
+  cpt_read_header(fd, filename, &header);
+  if (header.parent_offset != 0) {
+    char parent[PATH_MAX];
+    cpt_parent_path(fd, filename, &header, parent);
+    cpt_lazy_open(parent);
+  }
+
+  lazy_files = (CptLazyFile *)realloc(lazy_files, sizeof(CptLazyFile) * (nr_lazy_files + 1));
+  CptLazyFile *f = &lazy_files[nr_lazy_files ++];
+  f->fd = fd;
+  f->index = cpt_read_index(fd, filename, &header);
+  f->chunk_idx = (int32_t *)malloc(sizeof(int32_t) * nr_pmem_chunks);
+  memset(f->chunk_idx, -1, sizeof(int32_t) * nr_pmem_chunks);
+  for (uint64_t i = 0; i < header.nr_chunks; i ++) {
+    f->chunk_idx[f->index[i].addr / CPT_CHUNK_SIZE] = i;
+  }
+  Log("Opened checkpoint %s with %lu chunks, taken @ instruction count %lu",
+      filename, header.nr_chunks, header.inst_count);
+}
+
+// copy the pages from src, or zero them if src is NULL;
+// *done is the bytes filled, which are fewer than len on an error
+static int cpt_lazy_ioctl(int uffd, uintptr_t start, uint64_t len, const uint8_t *src, int64_t *done) {
+  int ret;
+  if (src != NULL) {
+    struct uffdio_copy copy = { .dst = start, .src = (uintptr_t)src, .len = len, .mode = 0, .copy = 0 };
+    ret = ioctl(uffd, UFFDIO_COPY, &copy);
+    *done = copy.copy;
+  } else {
+    struct uffdio_zeropage zero = { .range = { .start = start, .len = len }, .mode = 0, .zeropage = 0 };
+    ret = ioctl(uffd, UFFDIO_ZEROPAGE, &zero);
+    *done = zero.zeropage;
+  }
+  return ret;
+}
+
+// A fill stops at the first page already present, or early with EAGAIN,
+// so the rest of the pages are then filled one by one.
+static void cpt_lazy_fill(int uffd, uintptr_t start, uint64_t len, const uint8_t *src) {
+  int64_t done;
+  if (cpt_lazy_ioctl(uffd, start, len, src, &done) == 0) return;
+  uint64_t off = done > 0 ? done & ~(uint64_t)(CPT_PAGE_SIZE - 1) : 0;
+  for (; off < len; off += CPT_PAGE_SIZE) {
+    int ret;
+    while ((ret = cpt_lazy_ioctl(uffd, start + off, CPT_PAGE_SIZE, src ? src + off : NULL, &done)) != 0 && errno == EAGAIN);
+    Assert(ret == 0 || errno == EEXIST, "Failed to load the page at host address 0x%lx", start + off);
+  }
+}
+
+static void *cpt_lazy_handler(void *arg) {
+  int uffd = (intptr_t)arg;
+  uint8_t *pmem = get_pmem();
+  uint8_t *chunk = (uint8_t *)aligned_alloc(CPT_PAGE_SIZE, CPT_CHUNK_SIZE);
+  uint8_t *loaded = (uint8_t *)calloc(nr_pmem_chunks, 1);
+  CptChunkBuf b = {};
+
+  while (true) {
+    struct uffd_msg msg;
+    ssize_t n = read(uffd, &msg, sizeof(msg));
+    if (n < 0 && errno == EINTR) continue;
+    Assert(n == sizeof(msg), "Failed to read userfaultfd");
+    if (msg.event != UFFD_EVENT_PAGEFAULT) continue;
+
+    uint64_t i = (msg.arg.pagefault.address - (uintptr_t)pmem) / CPT_CHUNK_SIZE;
+    uint64_t len = MEMORY_SIZE - i * CPT_CHUNK_SIZE;
+    if (len > CPT_CHUNK_SIZE) len = CPT_CHUNK_SIZE;
+    struct uffdio_range range = { .start = (uintptr_t)pmem + i * CPT_CHUNK_SIZE, .len = len };
+    if (loaded[i]) {
+      // the chunk is loaded after the fault is raised
+      ioctl(uffd, UFFDIO_WAKE, &range);
+      continue;
+    }
+
+    bool stored = false;
+    for (int f = 0; f < nr_lazy_files; f ++) {
+      int32_t idx = lazy_files[f].chunk_idx[i];
+      if (idx < 0) continue;
+      if (!stored) memset(chunk, 0, CPT_CHUNK_SIZE);
+      stored = true;
+      cpt_unpack_chunk(lazy_files[f].fd, &lazy_files[f].index[idx], chunk, &b);
+    }
+    cpt_lazy_fill(uffd, range.start, len, stored ? chunk : NULL);
+    // every page of the chunk is present now
+    loaded[i] = 1;
+    __atomic_fetch_add(&nr_lazy_loaded, 1, __ATOMIC_RELAXED);
+  }
+  return NULL;
+}
+
+static void cpt_lazy_statistic() {
+  Log("Lazily loaded %lu of %lu chunks of the checkpoint", nr_lazy_loaded, nr_pmem_chunks);
+}
+
+long load_cpt_img_lazy(const char *filename) {
+  int uffd = syscall(SYS_userfaultfd, O_CLOEXEC);
+  struct uffdio_api api = { .api = UFFD_API, .features = 0 };
+  if (uffd < 0 || ioctl(uffd, UFFDIO_API, &api) != 0) {
+    Log("userfaultfd is not available, load the checkpoint eagerly");
+    if (uffd >= 0) close(uffd);
+    return load_cpt_img(filename);
+  }
+
+  nr_pmem_chunks = (MEMORY_SIZE + CPT_CHUNK_SIZE - 1) / CPT_CHUNK_SIZE;
+  cpt_lazy_open(filename);
+
+  // drop the pages written before, such as the built-in image,
+  // so every page of pmem is missing until its chunk is loaded
+  uint8_t *pmem = get_pmem();
+  Assert(madvise(pmem, MEMORY_SIZE, MADV_DONTNEED) == 0, "Failed to drop the pages of pmem");
+  struct uffdio_register reg = {
+    .range = { .start = (uintptr_t)pmem, .len = MEMORY_SIZE },
+    .mode = UFFDIO_REGISTER_MODE_MISSING,
+  };
+  Assert(ioctl(uffd, UFFDIO_REGISTER, &reg) == 0, "Failed to register pmem to userfaultfd");
+
+  pthread_t thread;
+  Assert(pthread_create(&thread, NULL, cpt_lazy_handler, (void *)(intptr_t)uffd) == 0,
+      "Can not create the lazy loader thread");
+  pthread_detach(thread);
+  atexit(cpt_lazy_statistic);
+  return MEMORY_SIZE;
+}
 #endif //  CONFIG_MEM_COMPRESS
 
+// Return whether a file is a chunked checkpoint, determined by its magic.
+static bool is_cpt_file(const char *filename) {
+  char magic[sizeof(CPT_MAGIC)] = {};
+  FILE *fp = fopen(filename, "rb");
+  if (fp == NULL) {
+    return false;
+  }
+  bool ret = fread(magic, sizeof(magic), 1, fp) == 1 && !memcmp(magic, CPT_MAGIC, sizeof(magic));
+  fclose(fp);
+  return ret;
+}
+
+// Read the registers of a chunked checkpoint, return false if it is not one.
+bool load_cpt_regs(const char *filename, CptRegs *regs) {
+  if (!is_cpt_file(filename)) {
+    return false;
+  }
+  int fd = open(filename, O_RDONLY);
+  Assert(fd >= 0, "Can not open '%s'", filename);
+  CptHeader header;
+  Assert(pread(fd, &header, sizeof(header), 0) == sizeof(header) && header.version == CPT_VERSION &&
+      pread(fd, regs, sizeof(*regs), header.regs_offset) == sizeof(*regs),
+      "Can not read the registers of '%s'", filename);
+  close(fd);
+  return true;
+}
+
+#if defined(CONFIG_MEM_COMPRESS) && defined(CONFIG_USE_MMAP)
+// The cache of decompressed checkpoints shared by the NEMUs on a host.
+// An image is named by the crc32 and adler32 of the checkpoint files,
+// including the parents of a delta, and mapped privately over pmem,
+// so its pages are shared in the page cache until the guest writes them.
+static void cpt_cache_hash(const char *filename, uint32_t *crc, uint32_t *adler) {
+  int fd = open(filename, O_RDONLY);
+  Assert(fd >= 0, "Can not open '%s'", filename);
+  if (is_cpt_file(filename)) {
+    CptHeader header;
+    cpt_read_header(fd, filename, &header);
+    if (header.parent_offset != 0) {
+      char parent[PATH_MAX];
+      cpt_parent_path(fd, filename, &header, parent);
+      cpt_cache_hash(parent, crc, adler);
+    }
+  }
+
+  const size_t buf_size = 1 << 20;
+  uint8_t *buf = (uint8_t *)malloc(buf_size);
+  ssize_t len;
+  while ((len = read(fd, buf, buf_size)) > 0) {
+    *crc = crc32(*crc, buf, len);
+    *adler = adler32(*adler, buf, len);
+  }
+  Assert(len == 0, "Can not read '%s'", filename);
+  free(buf);
+  close(fd);
+}
+
+static bool is_zero_page(const uint8_t *page) {
+  const uint64_t *p = (const uint64_t *)page;
+  for (int i = 0; i < CPT_PAGE_SIZE / sizeof(uint64_t); i ++) {
+    if (p[i] != 0) return false;
+  }
+  return true;
+}
+
+// Decompress a checkpoint in pmem and write it to the cache, leaving holes for
+// the zero pages. It is renamed at last, so a racing NEMU never sees a partial one.
+static void cpt_cache_fill(const char *filename, const char *path) {
+  uint8_t *pmem = get_pmem();
+  if (is_cpt_file(filename)) load_cpt_img(filename);
+  else load_gz_img(filename);
+
+  char tmp[PATH_MAX + 8];
+  snprintf(tmp, sizeof(tmp), "%s.XXXXXX", path);
+  int fd = mkstemp(tmp);
+  Assert(fd >= 0, "Can not create '%s'", tmp);
+  for (uint64_t start = 0; start < MEMORY_SIZE; ) {
+    if (is_zero_page(pmem + start)) {
+      start += CPT_PAGE_SIZE;
+      continue;
+    }
+    uint64_t end = start + CPT_PAGE_SIZE;
+    while (end < MEMORY_SIZE && !is_zero_page(pmem + end)) end += CPT_PAGE_SIZE;
+    for (uint64_t off = start; off < end; ) {
+      ssize_t len = pwrite(fd, pmem + off, end - off, off);
+      Assert(len > 0, "Write failed on '%s'", tmp);
+      off += len;
+    }
+    start = end;
+  }
+  Assert(ftruncate(fd, MEMORY_SIZE) == 0 && fchmod(fd, 0644) == 0 && rename(tmp, path) == 0,
+      "Can not write '%s'", path);
+  close(fd);
+}
+
+static long load_cached_img(const char *filename) {
+  uint32_t crc = crc32(0, NULL, 0), adler = adler32(0, NULL, 0);
+  cpt_cache_hash(filename, &crc, &adler);
+  char path[PATH_MAX];
+  snprintf(path, sizeof(path), "%s/%08x%08x_%lx.img", checkpoint_cache_dir, crc, adler, (uint64_t)MEMORY_SIZE);
+
+  int fd = open(path, O_RDONLY);
+  if (fd < 0) {
+    cpt_cache_fill(filename, path);
+    Log("Cached checkpoint %s as %s", filename, path);
+    fd = open(path, O_RDONLY);
+    Assert(fd >= 0, "Can not open '%s'", path);
+  } else {
+    Log("Found checkpoint %s in cache as %s", filename, path);
+  }
+
+  struct stat st;
+  Assert(fstat(fd, &st) == 0 && st.st_size == MEMORY_SIZE, "The size of '%s' is not the memory size", path);
+  uint8_t *pmem = get_pmem();
+  void *ret = mmap(pmem, MEMORY_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd, 0);
+  Assert(ret == pmem, "Can not map '%s' to pmem", path);
+  close(fd);
+  return MEMORY_SIZE;
+}
+#endif
+
 // Return whether a file is a gz file, determined by its name.
 // If the filename ends with ".gz", we treat it as a gz file.
 
@@ -72,6 +507,22 @@ long load_img(char* img_name, char *which_img, uint64_t load_start, size_t img_s
     return 4096; // built-in image size
   }
 
+#if defined(CONFIG_MEM_COMPRESS) && defined(CONFIG_USE_MMAP)
+  // the cache takes the place of the lazy loading
+  if (checkpoint_restoring && checkpoint_cache_dir != NULL && (is_cpt_file(loading_img) || is_gz_file(loading_img))) {
+    return load_cached_img(loading_img);
+  }
+#endif
+
+  if (is_cpt_file(loading_img)) {
+#ifdef CONFIG_MEM_COMPRESS
+      Log("Loading chunked checkpoint %s", loading_img);
+      return checkpoint_lazy_restore ? load_cpt_img_lazy(loading_img) : load_cpt_img(loading_img);
+#else
+      panic("CONFIG_MEM_COMPRESS is disabled, turn it on in memuconfig!");
+#endif
+  }
+
   if (is_gz_file(loading_img)) {
 #ifdef CONFIG_MEM_COMPRESS
       Log("Loading GZ image %s", loading_img);
@@ -21,6 +21,7 @@
 #include <memory/paddr.h>
 #include <getopt.h>
 #include <stdlib.h>
+#include <unistd.h>
 
 #ifndef CONFIG_SHARE
 void init_aligncheck();
@@ -36,6 +37,8 @@ static char *diff_so_file = NULL;
 static char *img_file = NULL;
 static int batch_mode = false;
 static int difftest_port = 1234;
+static char *cluster_bbv_file = NULL;
+static bool simpoint_single_pass = false;
 char *max_instr = NULL;
 
 int is_batch_mode() { return batch_mode; }
@@ -68,16 +71,28 @@ static inline int parse_args(int argc, char *argv[]) {
     // restore cpt
     {"restore"            , no_argument      , NULL, 'c'},
     {"cpt-restorer"       , required_argument, NULL, 'r'},
+    {"cpt-native"         , no_argument      , NULL, 11},
+    {"cpt-lazy"           , no_argument      , NULL, 12},
+    {"cpt-cache"          , required_argument, NULL, 13},
 
     // take cpt
     {"simpoint-dir"       , required_argument, NULL, 'S'},
     {"uniform-cpt"        , no_argument      , NULL, 'u'},
     {"cpt-interval"       , required_argument, NULL, 5},
     {"cpt-mmode"          , no_argument      , NULL, 7},
+    {"cpt-jobs"           , required_argument, NULL, 8},
+    {"cpt-format"         , required_argument, NULL, 9},
+    {"cpt-delta"          , required_argument, NULL, 10},
 
     // profiling
     {"simpoint-profile"   , no_argument      , NULL, 3},
     {"dont-skip-boot"     , no_argument      , NULL, 6},
+    {"simpoint-cluster"   , optional_argument, NULL, 14},
+    {"cluster-bbv"        , required_argument, NULL, 15},
+    {"simpoint-single-pass", no_argument     , NULL, 16},
+    {"bbv-format"         , required_argument, NULL, 17},
+    {"simpoint-shard"     , required_argument, NULL, 18},
+    {"simpoint-shard-jobs", required_argument, NULL, 19},
 
     // restore cpt
     {"cpt-id"             , required_argument, NULL, 4},
@@ -138,6 +153,47 @@ static inline int parse_args(int argc, char *argv[]) {
         force_cpt_mmode = true;
         break;
 
+      case 8: sscanf(optarg, "%d", &checkpoint_jobs); break;
+
+      case 9:
+        if (!strcmp(optarg, "gz")) checkpoint_format = GzCheckpoint;
+        else if (!strcmp(optarg, "cpt")) checkpoint_format = ChunkedCheckpoint;
+        else panic("Unknown checkpoint format '%s'", optarg);
+        break;
+
+      case 10: sscanf(optarg, "%d", &checkpoint_delta); break;
+
+      case 11: checkpoint_native_restore = true; break;
+
+      case 12: checkpoint_lazy_restore = true; break;
+
+      case 13:
+        if (!ISDEF(CONFIG_USE_MMAP)) panic("--cpt-cache requires CONFIG_USE_MMAP");
+        checkpoint_cache_dir = optarg;
+        break;
+
+      case 14:
+        simpoint_cluster_maxk = 30;
+        if (optarg != NULL) sscanf(optarg, "%d", &simpoint_cluster_maxk);
+        break;
+
+      case 15: cluster_bbv_file = optarg; break;
+
+      case 16:
+        simpoint_single_pass = true;
+        checkpoint_taking = true;
+        break;
+
+      case 17:
+        if (!strcmp(optarg, "text")) simpoint_bbv_format = TextBbv;
+        else if (!strcmp(optarg, "bin")) simpoint_bbv_format = BinaryBbv;
+        else panic("Unknown BBV format '%s'", optarg);
+        break;
+
+      case 18: sscanf(optarg, "%lu", &simpoint_shard_intervals); break;
+
+      case 19: sscanf(optarg, "%d", &simpoint_shard_jobs); break;
+
       case 4: sscanf(optarg, "%d", &cpt_id); break;
 
       default:
@@ -154,14 +210,26 @@ static inline int parse_args(int argc, char *argv[]) {
 
         printf("\t-c,--restore            restoring from CPT FILE\n");
         printf("\t-r,--cpt-restorer=R     binary of gcpt restorer\n");
+        printf("\t--cpt-native            restore the registers of cpt in NEMU instead of running gcpt restorer\n");
+        printf("\t--cpt-lazy              load the pages of a chunked cpt on their first touch\n");
+        printf("\t--cpt-cache=DIR         share the decompressed cpts through the page cache with the cache in DIR\n");
 
         printf("\t-S,--simpoint-dir=SIMPOINT_DIR   simpoints dir\n");
         printf("\t-u,--uniform-cpt        uniformly take cpt with fixed interval\n");
         printf("\t--cpt-interval=INTERVAL cpt interval: the profiling period for simpoint; the checkpoint interval for uniform cpt\n");
         printf("\t--cpt-mmode             force to take cpt in mmode, which might not work.\n");
+        printf("\t--cpt-jobs=N            write up to N cpts in background processes while running\n");
+        printf("\t--cpt-format=FMT        format of the taken cpts: gz (default), or cpt for the chunked sparse one\n");
+        printf("\t--cpt-delta=N           chain up to N cpts storing only the pages written since the previous one, after each full cpt\n");
 
         printf("\t--simpoint-profile      simpoint profiling\n");
         printf("\t--dont-skip-boot        profiling/checkpoint immediately after boot\n");
+        printf("\t--simpoint-cluster[=K]  pick up to K (default 30) simpoints from the BBVs after profiling\n");
+        printf("\t--cluster-bbv=BBV_FILE  pick simpoints from BBV_FILE into its directory, then exit\n");
+        printf("\t--simpoint-single-pass  take candidate cpts while profiling, and keep the ones of the simpoints\n");
+        printf("\t--bbv-format=FMT        format of the BBVs: text (default), or bin for the varint one\n");
+        printf("\t--simpoint-shard=N      fast-forward and fork workers to profile the shards of N intervals in parallel\n");
+        printf("\t--simpoint-shard-jobs=J run up to J shard workers at once (default: the number of host cores)\n");
         printf("\t--cpt-id                checkpoint id\n");
         printf("\n");
         exit(0);
@@ -183,7 +251,38 @@ void init_monitor(int argc, char *argv[]) {
   extern void init_path_manager();
   extern void simpoint_init();
   extern void init_serializer();
-  extern void unserialize();
+  extern void unserialize(const char *cpt);
+
+  // a cpt only holds the state of one hart, while the other harts keep storing into pmem
+  if (ISDEF(CONFIG_SMP) && (checkpoint_taking || profiling_state != NoProfiling)) {
+    panic("Taking cpts and profiling are not supported with CONFIG_SMP");
+  }
+
+  if (simpoint_single_pass) {
+    if (profiling_state != SimpointProfiling) {
+      panic("--simpoint-single-pass requires --simpoint-profile");
+    }
+    // the candidates are loaded back with the chunked cpt loader
+    if (!ISDEF(CONFIG_MEM_COMPRESS)) {
+      panic("--simpoint-single-pass requires CONFIG_MEM_COMPRESS");
+    }
+    if (simpoint_cluster_maxk == 0) simpoint_cluster_maxk = 30;
+  }
+
+  if (simpoint_shard_intervals > 0) {
+    // the shards are forked from the blocks profiled with the tcache
+    if (!ISDEF(CONFIG_PERF_OPT) || profiling_state != SimpointProfiling || checkpoint_taking) {
+      panic("--simpoint-shard requires --simpoint-profile without taking cpts, and CONFIG_PERF_OPT");
+    }
+    if (simpoint_shard_jobs <= 0) simpoint_shard_jobs = sysconf(_SC_NPROCESSORS_ONLN);
+  }
+
+  // A forked child, such as a cpt writer or a shard, loses the userfaultfd
+  // registration of pmem without UFFD_FEATURE_EVENT_FORK, and has no handler
+  // thread. It would silently read zero pages for the chunks not loaded yet.
+  if (checkpoint_lazy_restore && (checkpoint_taking || simpoint_shard_intervals)) {
+    panic("--cpt-lazy can not be used when taking cpts or with --simpoint-shard");
+  }
 
   bool output_features_enabled = checkpoint_taking || profiling_state == SimpointProfiling;
   if (output_features_enabled) {
@@ -195,6 +294,14 @@ void init_monitor(int argc, char *argv[]) {
   /* Open the log file. */
   init_log(log_file);
 
+  if (cluster_bbv_file != NULL) {
+    extern void simpoint_cluster(const char *bbv_file, const char *output_dir, int max_k);
+    char *slash = strrchr(cluster_bbv_file, '/');
+    char *dir = slash ? strndup(cluster_bbv_file, slash - cluster_bbv_file) : strdup(".");
+    simpoint_cluster(cluster_bbv_file, dir, simpoint_cluster_maxk ? simpoint_cluster_maxk : 30);
+    exit(0);
+  }
+
   /* Initialize memory. */
   init_mem();
 
@@ -221,7 +328,11 @@ void init_monitor(int argc, char *argv[]) {
     bbl_start = MEMORY_SIZE; // bbl size should never be used, let it crash if used
 
     load_img(img_file, "Gcpt file form cmdline", RESET_VECTOR, 0);
-    load_img(restorer, "Gcpt restorer form cmdline", RESET_VECTOR, 0xf00);
+    if (checkpoint_native_restore) {
+      unserialize(img_file);
+    } else {
+      load_img(restorer, "Gcpt restorer form cmdline", RESET_VECTOR, 0xf00);
+    }
 
   } else if (checkpoint_taking) {
     // boot: jump to restorer --> restorer jump to bbl
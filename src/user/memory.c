@@ -33,6 +33,10 @@ word_t vaddr_ifetch(vaddr_t addr, int len) {
   return vaddr_read(NULL, addr, len, MMU_DYNAMIC);
 }
 
+paddr_t vaddr_ifetch_paddr(vaddr_t addr) {
+  return addr;
+}
+
 word_t vaddr_read_safe(vaddr_t addr, int len) {
   return vaddr_read(NULL, addr, len, MMU_DYNAMIC);
 }
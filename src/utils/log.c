@@ -29,7 +29,7 @@ void init_log(const char *log_file) {
 }
 
 bool log_enable() {
-  extern uint64_t g_nr_guest_instr;
+  extern hart_local uint64_t g_nr_guest_instr;
   return (g_nr_guest_instr >= LOG_START) && (g_nr_guest_instr <= LOG_END);
 }
 
@@ -0,0 +1,81 @@
+/***************************************************************************************
+* Copyright (c) 2020-2022 Institute of Computing Technology, Chinese Academy of Sciences
+*
+* NEMU is licensed under Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*          http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+* EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+* MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+*
+* See the Mulan PSL v2 for more details.
+***************************************************************************************/
+
+// Convert a binary BBV file of NEMU into the text format read by SimPoint,
+// which is written in gzip if the output ends with ".gz", or plain otherwise.
+
+#include <checkpoint/bbv_format.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zlib.h>
+
+#define check(cond, ...) do { \
+  if (!(cond)) { fprintf(stderr, __VA_ARGS__); fprintf(stderr, "\n"); exit(1); } \
+} while (0)
+
+static bool read_varint(gzFile in, uint64_t *v) {
+  *v = 0;
+  for (int shift = 0; shift < 64; shift += 7) {
+    int c = gzgetc(in);
+    if (c < 0) return false;
+    *v |= (uint64_t)(c & 0x7f) << shift;
+    if (!(c & 0x80)) return true;
+  }
+  return false;
+}
+
+static bool is_gz_file(const char *filename) {
+  size_t len = strlen(filename);
+  return len >= 3 && !strcmp(filename + len - 3, ".gz");
+}
+
+int main(int argc, char *argv[]) {
+  if (argc != 3) {
+    printf("Usage: %s BBV OUTPUT\n", argv[0]);
+    return 1;
+  }
+
+  gzFile in = gzopen(argv[1], "rb");
+  check(in != NULL, "Can not open '%s'", argv[1]);
+  gzbuffer(in, 1 << 20);
+  BbvHeader header;
+  check(gzread(in, &header, sizeof(header)) == sizeof(header) &&
+      !memcmp(header.magic, BBV_MAGIC, sizeof(header.magic)) && header.version == BBV_VERSION,
+      "Unsupported BBV file '%s'", argv[1]);
+
+  gzFile out = gzopen(argv[2], is_gz_file(argv[2]) ? "wb" : "wT");
+  check(out != NULL, "Can not open '%s'", argv[2]);
+  gzbuffer(out, 1 << 20);
+
+  uint64_t nr_intervals = 0, nr_blocks;
+  while (read_varint(in, &nr_blocks)) {
+    gzputc(out, 'T');
+    uint64_t id = 0, delta, count;
+    for (uint64_t i = 0; i < nr_blocks; i ++) {
+      check(read_varint(in, &delta) && read_varint(in, &count),
+          "Truncated interval %lu in '%s'", nr_intervals, argv[1]);
+      id += delta;
+      check(gzprintf(out, ":%lu:%lu ", id, count) > 0, "Write failed on '%s'", argv[2]);
+    }
+    gzputc(out, '\n');
+    nr_intervals ++;
+  }
+  check(gzclose(out) == Z_OK, "Close failed on '%s'", argv[2]);
+  gzclose(in);
+  printf("Converted %lu intervals of %lu instructions to %s\n", nr_intervals, header.interval_size, argv[2]);
+  return 0;
+}
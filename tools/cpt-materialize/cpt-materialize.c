@@ -0,0 +1,126 @@
+/***************************************************************************************
+* Copyright (c) 2020-2022 Institute of Computing Technology, Chinese Academy of Sciences
+*
+* NEMU is licensed under Mulan PSL v2.
+* You can use this software according to the terms and conditions of the Mulan PSL v2.
+* You may obtain a copy of Mulan PSL v2 at:
+*          http://license.coscl.org.cn/MulanPSL2
+*
+* THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+* EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+* MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+*
+* See the Mulan PSL v2 for more details.
+***************************************************************************************/
+
+// Materialize a chunked checkpoint, applying the deltas on their parents,
+// into the whole memory image, which is written as a gz checkpoint if the
+// output ends with ".gz", or a raw binary otherwise.
+
+#include <checkpoint/cpt_format.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <zlib.h>
+
+#define check(cond, ...) do { \
+  if (!(cond)) { fprintf(stderr, __VA_ARGS__); fprintf(stderr, "\n"); exit(1); } \
+} while (0)
+
+static uint8_t *mem = NULL;
+static uint64_t mem_size = 0;
+
+static void apply(const char *filename) {
+  int fd = open(filename, O_RDONLY);
+  check(fd >= 0, "Can not open '%s'", filename);
+
+  CptHeader header;
+  check(pread(fd, &header, sizeof(header), 0) == sizeof(header) &&
+      !memcmp(header.magic, CPT_MAGIC, sizeof(header.magic)) &&
+      header.version == CPT_VERSION && header.chunk_size == CPT_CHUNK_SIZE,
+      "Unsupported checkpoint '%s'", filename);
+
+  if (header.parent_offset != 0) {
+    char parent[PATH_MAX];
+    const char *slash = strrchr(filename, '/');
+    int dir_len = slash ? slash - filename + 1 : 0;
+    memcpy(parent, filename, dir_len);
+    ssize_t len = pread(fd, parent + dir_len, sizeof(parent) - dir_len, header.parent_offset);
+    check(len > 0 && memchr(parent + dir_len, '\0', len), "Can not read the parent of '%s'", filename);
+    apply(parent);
+    check(header.mem_size == mem_size, "The memory size of '%s' differs from its parent", filename);
+  } else {
+    mem_size = header.mem_size;
+    mem = mmap(NULL, mem_size, PROT_READ | PROT_WRITE, MAP_ANONYMOUS | MAP_PRIVATE, -1, 0);
+    check(mem != MAP_FAILED, "Can not allocate 0x%lx bytes", mem_size);
+  }
+
+  size_t index_size = header.nr_chunks * sizeof(CptChunk);
+  CptChunk *index = malloc(index_size);
+  check(pread(fd, index, index_size, header.index_offset) == (ssize_t)index_size,
+      "Can not read the chunk index of '%s'", filename);
+
+  uint8_t *buf = NULL, *pages = malloc(CPT_CHUNK_SIZE);
+  uint64_t buf_size = 0;
+  for (uint64_t i = 0; i < header.nr_chunks; i ++) {
+    const CptChunk *c = &index[i];
+    if (c->size > buf_size) {
+      buf_size = c->size;
+      buf = realloc(buf, buf_size);
+    }
+    check(pread(fd, buf, c->size, c->offset) == (ssize_t)c->size, "Can not read chunk at 0x%lx", c->addr);
+    uLongf len = CPT_CHUNK_SIZE;
+    check(uncompress(pages, &len, buf, c->size) == Z_OK &&
+        len == __builtin_popcountl(c->page_mask) * CPT_PAGE_SIZE, "Corrupted chunk at 0x%lx", c->addr);
+    uint8_t *src = pages;
+    for (int p = 0; p < CPT_CHUNK_PAGES; p ++) {
+      if (c->page_mask & (1ul << p)) {
+        memcpy(mem + c->addr + p * CPT_PAGE_SIZE, src, CPT_PAGE_SIZE);
+        src += CPT_PAGE_SIZE;
+      }
+    }
+  }
+  printf("Applied %lu chunks of %s, taken @ instruction count %lu\n",
+      header.nr_chunks, filename, header.inst_count);
+
+  free(buf);
+  free(pages);
+  free(index);
+  close(fd);
+}
+
+static bool is_gz_file(const char *filename) {
+  size_t len = strlen(filename);
+  return len >= 3 && !strcmp(filename + len - 3, ".gz");
+}
+
+int main(int argc, char *argv[]) {
+  if (argc != 3) {
+    printf("Usage: %s CPT OUTPUT\n", argv[0]);
+    return 1;
+  }
+  apply(argv[1]);
+
+  const uint64_t pass_size = 1ul << 30;
+  if (is_gz_file(argv[2])) {
+    gzFile out = gzopen(argv[2], "wb");
+    check(out != NULL, "Can not open '%s'", argv[2]);
+    for (uint64_t written = 0; written < mem_size; written += pass_size) {
+      unsigned size = mem_size - written < pass_size ? mem_size - written : pass_size;
+      check(gzwrite(out, mem + written, size) == (int)size, "Write failed on '%s'", argv[2]);
+    }
+    check(gzclose(out) == Z_OK, "Close failed on '%s'", argv[2]);
+  } else {
+    FILE *out = fopen(argv[2], "wb");
+    check(out != NULL, "Can not open '%s'", argv[2]);
+    check(fwrite(mem, mem_size, 1, out) == 1, "Write failed on '%s'", argv[2]);
+    fclose(out);
+  }
+  printf("Written 0x%lx bytes to %s\n", mem_size, argv[2]);
+  return 0;
+}